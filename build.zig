@@ -193,6 +193,10 @@ fn buildFLS(
             "fls/src/lsp_protocol.cpp",
             "fls/src/completion_data.cpp",
             "fls/src/completion.cpp",
+            "fls/src/json.cpp",
+            "fls/src/position_index.cpp",
+            "fls/src/symbol_index.cpp",
+            "fls/src/text_document.cpp",
 
             // Sources from the main project
             "src/error/base_error.cpp",
@@ -217,6 +221,7 @@ fn buildFLS(
             "src/matcher/lookbehind_matcher.cpp",
             "src/profiler.cpp",
             "src/resolver.cpp",
+            "src/time_trace.cpp",
         },
         .flags = &[_][]const u8{
             "-std=c++20",                   // Set C++ standard to C++20
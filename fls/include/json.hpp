@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/// @class `JsonValue`
+/// @brief A lightweight DOM of a single json value. All messages of the LSP are parsed into it exactly once, in a single pass over the
+/// message, so the cost of handling a message is linear in its size no matter how many fields a handler looks at
+class JsonValue {
+  public:
+    /// @typedef `Array`
+    /// @brief The elements of a json array
+    using Array = std::vector<JsonValue>;
+
+    /// @typedef `Object`
+    /// @brief The members of a json object in the order they appeared in. LSP objects only have a handful of members, so a linear
+    /// search through them is faster than any map
+    using Object = std::vector<std::pair<std::string, JsonValue>>;
+
+    JsonValue() = default;
+
+    /// @function `parse`
+    /// @brief Parses the given text as a single json value
+    ///
+    /// @param `text` The json text to parse
+    /// @return `std::optional<JsonValue>` The parsed value, nullopt if the text is no valid json
+    static std::optional<JsonValue> parse(std::string_view text);
+
+    /// @function `operator[]`
+    /// @brief Returns the member with the given key of this object
+    ///
+    /// @param `key` The key of the member
+    /// @return `const JsonValue &` The member, a null value if this is no object or if it has no such member
+    const JsonValue &operator[](std::string_view key) const;
+
+    /// @function `is_null`
+    /// @brief Whether this value is null, which is also the case for all missing members
+    ///
+    /// @return `bool` Whether this value is null
+    bool is_null() const {
+        return std::holds_alternative<std::monostate>(value);
+    }
+
+    /// @function `get_string`
+    /// @brief Returns the string of this value
+    ///
+    /// @return `std::optional<std::string_view>` The string, nullopt if this value is no string
+    std::optional<std::string_view> get_string() const;
+
+    /// @function `get_int`
+    /// @brief Returns the integer of this value
+    ///
+    /// @return `std::optional<int64_t>` The integer, nullopt if this value is no integral number
+    std::optional<int64_t> get_int() const;
+
+    /// @function `get_array`
+    /// @brief Returns the elements of this array
+    ///
+    /// @return `const Array &` The elements, an empty array if this value is no array
+    const Array &get_array() const;
+
+    /// @function `to_json`
+    /// @brief Serializes this value back to json text
+    ///
+    /// @return `std::string` The json text of this value
+    std::string to_json() const;
+
+  private:
+    /// @class `Parser`
+    /// @brief The single-pass recursive descent parser building the DOM
+    class Parser;
+
+    /// @var `MAX_DEPTH`
+    /// @brief The maximum nesting depth of arrays and objects, deeper values are rejected instead of overflowing the stack
+    static constexpr unsigned int MAX_DEPTH = 256;
+
+    /// @var `value`
+    /// @brief The actual value, integral numbers are kept as integers so that request IDs are echoed exactly
+    std::variant<std::monostate, bool, int64_t, double, std::string, Array, Object> value;
+
+    /// @function `append_json`
+    /// @brief Appends the serialized json text of this value to the given string
+    ///
+    /// @param `out` The string to append to
+    void append_json(std::string &out) const;
+};
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "json.hpp"
+
 #include <string>
+#include <string_view>
 
 /// @class `LspProtocol`
 /// @brief Class which is responsible for handling all the protocol part of the LSP
@@ -16,10 +19,14 @@ class LspProtocol {
     static constexpr const char *METHOD_TEXT_DOCUMENT_DID_OPEN = "textDocument/didOpen";
     static constexpr const char *METHOD_TEXT_DOCUMENT_DID_CHANGE = "textDocument/didChange";
     static constexpr const char *METHOD_TEXT_DOCUMENT_DID_SAVE = "textDocument/didSave";
+    static constexpr const char *METHOD_TEXT_DOCUMENT_DID_CLOSE = "textDocument/didClose";
     static constexpr const char *METHOD_TEXT_DOCUMENT_COMPLETION = "textDocument/completion";
     static constexpr const char *METHOD_TEXT_DOCUMENT_HOVER = "textDocument/hover";
     static constexpr const char *METHOD_TEXT_DOCUMENT_DEFINITION = "textDocument/definition";
+    static constexpr const char *METHOD_TEXT_DOCUMENT_REFERENCES = "textDocument/references";
+    static constexpr const char *METHOD_WORKSPACE_SYMBOL = "workspace/symbol";
     static constexpr const char *METHOD_TEXT_DOCUMENT_PUBLISH_DIAGNOSTICS = "textDocument/publishDiagnostics";
+    static constexpr const char *METHOD_CANCEL_REQUEST = "$/cancelRequest";
 
     // Server info
     static constexpr const char *SERVER_NAME = "Flint Language Server";
@@ -32,19 +39,18 @@ class LspProtocol {
 // Utility functions for LSP message handling
 
 /// @function `extract_request_id`
-/// @brief
+/// @brief Extracts the ID of the given request as json text, so that it can be echoed in the response as it is
 ///
-/// @param `content`
-/// @return `std::string`
-std::string extract_request_id(const std::string &content);
+/// @param `message` The parsed request message
+/// @return `std::string` The json text of the request ID, `null` if the message has no ID
+std::string extract_request_id(const JsonValue &message);
 
-/// @function `contains_method`
-/// @brief Checks whether the given content contains the given method
+/// @function `extract_method`
+/// @brief Extracts the method name of the given message
 ///
-/// @param `content` The content to search through
-/// @param `method` The method to search for
-/// @return `bool` Whether the given content contains the given method
-bool contains_method(const std::string &content, const char *method);
+/// @param `message` The parsed message
+/// @return `std::string_view` The method of the message, an empty string if the message has no method (e.g. a response)
+std::string_view extract_method(const JsonValue &message);
 
 /// @function `send_lsp_response`
 /// @brief Sends an lsp response message to stdout, over which the LS communicates with the LC
@@ -1,17 +1,33 @@
 #pragma once
 
 #include "completion_data.hpp"
+#include "json.hpp"
 #include "parser/ast/file_node.hpp"
+#include "position_index.hpp"
+#include "symbol_index.hpp"
+#include "text_document.hpp"
 
 #ifndef FLINT_LSP
 #define FLINT_LSP
 #endif
 #include "error/diagnostics.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+class Parser;
+
 /// @class `LspServer`
 /// @brief Main Class of the whole LS
 class LspServer {
@@ -19,18 +35,28 @@ class LspServer {
     LspServer() = delete;
 
     /// @function `run`
-    /// @brief Executes the main loop of the server. Listens for any messages on stdin and processes them
+    /// @brief Executes the main loop of the server. Listens for any messages on stdin and queues them up for the message thread, which
+    /// processes them in order. Cancellations of queued requests are handled directly when they are received
     static void run();
 
     /// @function `parse_program`
     /// @brief Parses the whole program and returns the main file of the program
     ///
     /// @brief `file_path` The path to the root file of the parsing process
-    /// @brief `file_content` The content of the file, possibly
-    ///
-    /// @note This function is mutexed, so only one thread can ever re-parse the file at once
-    /// @note All internal state of the parser etc is cleaned at the beginning of the function before actual parsing begins
-    static std::optional<FileNode *> parse_program(const std::string &file_path, const std::optional<std::string> &file_content);
+    /// @brief `file_content` The content of the file, possibly. If not given, the content of the opened document is used if the file
+    /// is opened in the client, otherwise the file is read from disk
+    /// @brief `is_cancelled` Checked between the parsing phases, parsing is stopped and nullopt is returned if it returns true
+    ///
+    /// @attention The `workspace_mutex` must be held by the caller for as long as the returned file or any other parser state is used
+    /// @note The parsed program is kept as the workspace of the server. If neither the root file nor any file it depends on has changed
+    /// since the last successful parse, the workspace is reused as-is. If some files changed, only the changed files are parsed again, and
+    /// the files which depend on them only if the signature of a changed file differs from before. Otherwise (the root file differs) all
+    /// internal state of the parser etc is cleaned before the program is parsed again
+    static std::optional<FileNode *> parse_program(                         //
+        const std::string &file_path,                                       //
+        const std::optional<std::string> &file_content,                     //
+        const std::function<bool()> &is_cancelled = std::function<bool()>() //
+    );
 
     /// @function `log_info`
     /// @brief Logs a given message with the [INFO] prefix to stdout
@@ -39,11 +65,292 @@ class LspServer {
     static void log_info(const std::string &message);
 
   private:
+    /// @var `ANALYSIS_DEBOUNCE`
+    /// @brief How long a document needs to stay unchanged before it is analyzed in the background
+    static constexpr std::chrono::milliseconds ANALYSIS_DEBOUNCE{250};
+
+    /// @var `workspace_mutex`
+    /// @brief Guards the workspace and all parser state. Only one thread at a time is allowed to parse or to inspect parsed files
+    static inline std::mutex workspace_mutex;
+
+    /// @var `documents`
+    /// @brief The content of all documents which are currently opened in the client, keyed by their file path
+    static inline std::unordered_map<std::string, TextDocument> documents;
+
+    /// @var `documents_mutex`
+    /// @brief A mutex for thread-safe access on the `documents` map
+    static inline std::mutex documents_mutex;
+
+    /// @var `message_queue`
+    /// @brief All received messages which have not been processed yet, in the order they have been received
+    static inline std::deque<JsonValue> message_queue;
+
+    /// @var `cancelled_requests`
+    /// @brief The IDs of all queued requests the client has cancelled
+    static inline std::unordered_set<std::string> cancelled_requests;
+
+    /// @var `message_queue_mutex`
+    /// @brief A mutex for thread-safe access on the `message_queue` and the `cancelled_requests`
+    static inline std::mutex message_queue_mutex;
+
+    /// @var `message_queue_cv`
+    /// @brief Notifies the message thread about newly received messages
+    static inline std::condition_variable message_queue_cv;
+
+    /// @var `pending_workspace_requests`
+    /// @brief The number of received requests which need the workspace and have not been answered yet. A running background analysis is
+    /// cancelled as long as there are pending requests, so that these are never blocked by it
+    static inline std::atomic<unsigned int> pending_workspace_requests{0};
+
+    /// @var `analysis_queue`
+    /// @brief The URIs of all documents which need to be analyzed in the background
+    static inline std::unordered_set<std::string> analysis_queue;
+
+    /// @var `analysis_deadline`
+    /// @brief The point in time at which the next background analysis is allowed to start, it is moved with every edit
+    static inline std::chrono::steady_clock::time_point analysis_deadline;
+
+    /// @var `analysis_generation`
+    /// @brief Increased whenever an analysis is scheduled. A running analysis is stale and cancelled once the generation changes
+    static inline std::atomic<uint64_t> analysis_generation{0};
+
+    /// @var `analysis_mutex`
+    /// @brief A mutex for thread-safe access on the `analysis_queue` and the `analysis_deadline`
+    static inline std::mutex analysis_mutex;
+
+    /// @var `analysis_cv`
+    /// @brief Notifies the analysis thread about newly scheduled analyses
+    static inline std::condition_variable analysis_cv;
+
+    /// @var `index_queue`
+    /// @brief The paths of all workspace files which still need to be indexed, they are only indexed while no analysis is pending
+    static inline std::deque<std::string> index_queue;
+
+    /// @var `symbol_index_path`
+    /// @brief The path the symbol index of the opened workspace is persisted at, empty if there is no workspace or no cache directory
+    static inline std::filesystem::path symbol_index_path;
+
+    /// @function `process_messages`
+    /// @brief The main loop of the message thread. Processes all queued messages in order and answers cancelled requests with an error
+    static void process_messages();
+
+    /// @function `run_analysis`
+    /// @brief The main loop of the analysis thread. Analyzes all scheduled documents once they stayed unchanged for the debounce
+    /// interval, and publishes their diagnostics
+    static void run_analysis();
+
+    /// @function `schedule_analysis`
+    /// @brief Schedules a background analysis of the given document, cancelling any analysis which is currently running
+    ///
+    /// @param `file_uri` The URI of the document to analyze
+    static void schedule_analysis(const std::string &file_uri);
+
+    /// @function `schedule_workspace_indexing`
+    /// @brief Schedules the background indexing of all Flint files of the workspace which are not indexed with their current content
+    ///
+    /// @param `root_path` The path to the root directory of the workspace
+    static void schedule_workspace_indexing(const std::string &root_path);
+
+    /// @function `is_indexed`
+    /// @brief Checks whether the given file is indexed with its current content
+    ///
+    /// @param `file_path` The path of the file
+    /// @return `bool` Whether the file is indexed with its current content, or whether it cannot be read at all
+    static bool is_indexed(const std::string &file_path);
+
+    /// @function `index_parsed_file`
+    /// @brief Adds all definitions and references of the file of the given parser instance to the symbol index, if the index does not
+    /// already contain the file with the same content
+    ///
+    /// @param `instance` The parser instance of the parsed file
+    static void index_parsed_file(const Parser &instance);
+
+    /// @function `get_reference_key`
+    /// @brief Resolves the symbol the given token references and returns the key its references are indexed with
+    ///
+    /// @param `ns` The namespace the token is contained in
+    /// @param `tok` The token to resolve
+    /// @return `std::optional<std::string>` The key of the referenced symbol, nullopt if the token is no identifier or type
+    static std::optional<std::string> get_reference_key(const Namespace *ns, const TokenContext &tok);
+
+    /// @function `is_workspace_request`
+    /// @brief Checks whether the given message is a request which needs the parsed workspace to be answered
+    ///
+    /// @param `message` The parsed message
+    /// @return `bool` Whether the message needs the workspace
+    static bool is_workspace_request(const JsonValue &message);
+
+    /// @function `send_cancelled_response`
+    /// @brief Sends the error response for a cancelled request over stdout
+    ///
+    /// @param `request_id` The ID of the cancelled request
+    static void send_cancelled_response(const std::string &request_id);
+
+    /// @function `get_document_content`
+    /// @brief Returns the content of the given file if it is opened in the client
+    ///
+    /// @param `file_path` The path of the file
+    /// @return `std::optional<std::string>` The content of the opened document, nullopt if the file is not opened
+    static std::optional<std::string> get_document_content(const std::string &file_path);
+
+    /// @struct `WorkspaceFile`
+    /// @brief The state of a single file of the workspace at the time it was parsed
+    struct WorkspaceFile {
+        /// @var `write_time`
+        /// @brief The last write time of the file on disk when it was parsed, used as a cheap check whether the file could have changed
+        std::filesystem::file_time_type write_time;
+
+        /// @var `content_hash`
+        /// @brief The hash of the content the file was parsed from
+        size_t content_hash;
+
+        /// @var `signature_hash`
+        /// @brief The hash of everything other files can see of the file, see `get_signature_hash`
+        size_t signature_hash;
+
+        /// @var `file_hash`
+        /// @brief The hash of the file's path
+        Hash file_hash;
+
+        /// @var `imports`
+        /// @brief The hashes of all files the file imports
+        std::vector<Hash> imports;
+    };
+
+    /// @var `workspace_root`
+    /// @brief The path of the root file the current workspace was parsed from, empty if there is no valid workspace
+    static inline std::string workspace_root;
+
+    /// @var `workspace_file`
+    /// @brief The parsed root file of the current workspace
+    static inline FileNode *workspace_file = nullptr;
+
+    /// @var `position_indices`
+    /// @brief The position indices of all files of the current workspace which have been looked into, keyed by their namespace
+    static inline std::unordered_map<const Namespace *, PositionIndex> position_indices;
+
+    /// @function `get_position_index`
+    /// @brief Returns the position index of the given namespace's file, building it on first use after every parse
+    ///
+    /// @param `ns` The namespace of the file
+    /// @return `PositionIndex &` The position index of the file
+    static PositionIndex &get_position_index(const Namespace *ns);
+
+    /// @var `workspace_files`
+    /// @brief All files which have been parsed for the current workspace, keyed by their path
+    static inline std::unordered_map<std::string, WorkspaceFile> workspace_files;
+
+    /// @function `get_changed_workspace_files`
+    /// @brief Checks which files of the current workspace changed since they have been parsed
+    ///
+    /// @param `file_path` The path to the root file of the parsing process
+    /// @param `file_content` The content of the root file, if it has not been read from disk
+    /// @return `std::optional<std::unordered_set<Hash>>` The hashes of all changed files, an empty set if the workspace is up to date and
+    /// nullopt if the workspace cannot be reused for the given root file at all
+    static std::optional<std::unordered_set<Hash>> get_changed_workspace_files( //
+        const std::string &file_path,                                         //
+        const std::optional<std::string> &file_content                        //
+    );
+
+    /// @struct `RetiredInstances`
+    /// @brief Parser instances of files which have been parsed again while files depending on them were kept. The kept files still refer
+    /// to the nodes of these instances, so they are kept alive until all of the referring files are parsed again too
+    struct RetiredInstances {
+        /// @var `instances`
+        /// @brief The retired parser instances
+        std::vector<Parser> instances;
+
+        /// @var `referrers`
+        /// @brief The hashes of all kept files which still refer to the nodes of the retired instances
+        std::unordered_set<Hash> referrers;
+    };
+
+    /// @var `retired_instances`
+    /// @brief All retired parser instances which are still referred to by files of the current workspace
+    static std::vector<RetiredInstances> retired_instances;
+
+    /// @function `get_signature_hash`
+    /// @brief Hashes everything other files can see of the given file: the kinds, names, types and positions of all its definitions and
+    /// its type aliases. Other files refer to the definitions by their position too, so moving a definition changes the signature
+    ///
+    /// @param `file` The file to hash the signature of
+    /// @return `size_t` The signature hash of the file
+    static size_t get_signature_hash(const FileNode *file);
+
+    /// @function `get_dependent_workspace_files`
+    /// @brief Returns the given files together with all files of the workspace which depend on them, directly or transitively
+    ///
+    /// @param `file_hashes` The hashes of the files to get the dependents of
+    /// @return `std::unordered_set<Hash>` The hashes of the given files and of all their dependents
+    static std::unordered_set<Hash> get_dependent_workspace_files(const std::unordered_set<Hash> &file_hashes);
+
+    /// @function `remove_workspace_files`
+    /// @brief Removes the given files from the workspace and from the parser, so that only they are parsed again. If kept files depend on
+    /// the removed files, the removed parser instances are retired instead of destroyed
+    ///
+    /// @param `file_hashes` The hashes of the files to remove
+    static void remove_workspace_files(const std::unordered_set<Hash> &file_hashes);
+
+    /// @function `parse_workspace_files`
+    /// @brief Parses the given files together with all files they import which are not part of the workspace yet
+    ///
+    /// @param `root_path` The path to the root file of the parsing process
+    /// @param `file_hashes` The hashes of the files to parse. Files which do not exist anymore are skipped
+    /// @param `root_content` The content of the root file, if it has not been read from disk
+    /// @param `was_cancelled` Checked between the parsing phases
+    /// @return `bool` Whether all files were parsed successfully and parsing was not cancelled
+    static bool parse_workspace_files(                  //
+        const std::string &root_path,                   //
+        const std::unordered_set<Hash> &file_hashes,    //
+        const std::optional<std::string> &root_content, //
+        const std::function<bool()> &was_cancelled      //
+    );
+
+    /// @function `store_workspace_files`
+    /// @brief Stores the state of all newly parsed files as part of the workspace
+    ///
+    /// @param `root_path` The path to the root file of the parsing process
+    /// @param `root_content` The content of the root file, if it has not been read from disk
+    /// @param `first_instance` The index of the first newly parsed parser instance, all instances before it are already stored
+    /// @param `old_signatures` The signature hashes the newly parsed files had before they were parsed again
+    /// @return `std::unordered_set<Hash>` The hashes of all newly parsed files whose signature differs from before they were parsed again
+    static std::unordered_set<Hash> store_workspace_files(     //
+        const std::string &root_path,                          //
+        const std::optional<std::string> &root_content,        //
+        const size_t first_instance,                           //
+        const std::unordered_map<Hash, size_t> &old_signatures //
+    );
+
     /// @function `process_message`
-    /// @brief Processes a given message and calls the corresponding handler functions
+    /// @brief Processes a given message and logs how long handling the message took
+    ///
+    /// @param `message` The parsed message
+    static void process_message(const JsonValue &message);
+
+    /// @function `process_method`
+    /// @brief Calls the handler function corresponding to the method of the given message
     ///
-    /// @param `content` The content of the message
-    static void process_message(const std::string &content);
+    /// @param `message` The parsed message
+    static void process_method(const JsonValue &message);
+
+    /// @struct `MethodHandler`
+    /// @brief The entry of a single supported method in the dispatch table
+    struct MethodHandler {
+        /// @var `handle`
+        /// @brief The function handling all messages of the method
+        void (*handle)(const JsonValue &message);
+
+        /// @var `needs_workspace`
+        /// @brief Whether messages of the method need the parsed workspace to be answered
+        bool needs_workspace;
+    };
+
+    /// @function `get_method_handler`
+    /// @brief Looks up the method of the given message in the dispatch table of all supported methods
+    ///
+    /// @param `message` The parsed message
+    /// @return `const MethodHandler *` The handler of the method, nullptr if the method is not supported or if the message has no method
+    static const MethodHandler *get_method_handler(const JsonValue &message);
 
     /*
      * ==========================
@@ -51,6 +358,12 @@ class LspServer {
      * ==========================
      */
 
+    /// @function `handle_initialize`
+    /// @brief Answers the initialize request and starts indexing the opened workspace folder
+    ///
+    /// @param `message` The parsed request message
+    static void handle_initialize(const JsonValue &message);
+
     /// @function `send_initialize_response`
     /// @brief Sends the initialization response over stdout
     ///
@@ -66,8 +379,8 @@ class LspServer {
     /// @function `send_completion`
     /// @brief Sends the completion response over stdout
     ///
-    /// @param `content` The content of the request message
-    static void send_completion_response(const std::string &content);
+    /// @param `message` The parsed request message
+    static void send_completion_response(const JsonValue &message);
 
     /// @struct `DefinitionResult`
     /// @brief Carries the target location plus the source range to highlight
@@ -96,8 +409,8 @@ class LspServer {
     /// @function `send_definition_response`
     /// @brief Sends the definition response over stdout
     ///
-    /// @param `content` The content of the request message
-    static void send_definition_response(const std::string &content);
+    /// @param `message` The parsed request message
+    static void send_definition_response(const JsonValue &message);
 
     /// @function `find_definition_at_position`
     /// @brief Finds the definition of the symbol at the given position
@@ -158,11 +471,31 @@ class LspServer {
     /// @note This function parses not only the given file but all files it includes too, to give suggestions of each file it included
     static std::vector<CompletionItem> get_context_aware_completions(const std::string &file_path, int line, int character);
 
+    /// @function `send_references_response`
+    /// @brief Sends the references response over stdout, containing all references to the name under the cursor in the workspace
+    ///
+    /// @param `message` The parsed request message
+    static void send_references_response(const JsonValue &message);
+
+    /// @function `send_workspace_symbol_response`
+    /// @brief Sends the workspace symbol response over stdout, containing all symbols of the workspace matching the query
+    ///
+    /// @param `message` The parsed request message
+    static void send_workspace_symbol_response(const JsonValue &message);
+
+    /// @function `location_to_json`
+    /// @brief Converts a location of the symbol index to a LSP `Location` json object
+    ///
+    /// @param `file_path` The path of the file the location is in
+    /// @param `location` The location in the file
+    /// @return `std::string` The json object of the location
+    static std::string location_to_json(const std::string &file_path, const SymbolIndex::Location &location);
+
     /// @function `send_hover_response`
     /// @brief Sends the hover response over stdout
     ///
-    /// @param `request_id` The ID of the request which is handled by this function
-    static void send_hover_response(const std::string &request_id = "4");
+    /// @param `message` The parsed request message
+    static void send_hover_response(const JsonValue &message);
 
     /*
      * =================
@@ -173,48 +506,73 @@ class LspServer {
     /// @function `handle_document_open`
     /// @brief Handles the event when a document got opened
     ///
-    /// @brief `content` The message content from the LSP of the open event
-    static void handle_document_open(const std::string &content);
+    /// @brief `message` The parsed message from the LSP of the open event
+    static void handle_document_open(const JsonValue &message);
 
     /// @function `handle_document_change`
     /// @brief Handles the event when a document changed
     ///
-    /// @brief `content` The message content from the LSP of the change event
-    static void handle_document_change(const std::string &content);
+    /// @brief `message` The parsed message from the LSP of the change event
+    static void handle_document_change(const JsonValue &message);
 
     /// @function `handle_document_save`
     /// @brief Handles the event when a document is saved
     ///
-    /// @brief `content` The message content from the LSP of the save event
-    static void handle_document_save(const std::string &content);
+    /// @brief `message` The parsed message from the LSP of the save event
+    static void handle_document_save(const JsonValue &message);
+
+    /// @function `handle_document_close`
+    /// @brief Handles the event when a document is closed
+    ///
+    /// @brief `message` The parsed message from the LSP of the close event
+    static void handle_document_close(const JsonValue &message);
 
     /// @function `extract_file_uri`
     /// @brief Extracts the file URI from a textDocument request
     ///
-    /// @param `content` The LSP message content
+    /// @param `message` The parsed LSP message
     /// @return `std::string` The file URI (empty if not found)
-    static std::string extract_file_uri(const std::string &content);
+    static std::string extract_file_uri(const JsonValue &message);
+
+    /// @function `extract_root_path`
+    /// @brief Extracts the path of the workspace root from the initialize request
+    ///
+    /// @param `message` The parsed LSP message
+    /// @return `std::string` The path of the workspace root (empty if no folder is opened)
+    static std::string extract_root_path(const JsonValue &message);
 
-    /// @function `extract_file_content_from_change`
-    /// @brief Extracts the file content from a textDocument request
+    /// @function `extract_document_text`
+    /// @brief Extracts the full document text from a textDocument/didOpen notification
     ///
-    /// @param `content` The LSP message content
-    /// @return `std::string` The file content (empty if not found)
-    static std::string extract_file_content_from_change(const std::string &content);
+    /// @param `message` The parsed LSP message
+    /// @return `std::optional<std::string>` The document text, nullopt if not found
+    static std::optional<std::string> extract_document_text(const JsonValue &message);
+
+    /// @struct `ContentChange`
+    /// @brief A single change of a textDocument/didChange notification
+    struct ContentChange {
+        /// @var `range`
+        /// @brief The start and end of the replaced range, nullopt if the change replaces the whole document
+        std::optional<std::pair<TextDocument::Position, TextDocument::Position>> range;
 
-    /// @function `unescape_json_string`
-    /// @brief Unescapes all escapes in the string from a json message
+        /// @var `text`
+        /// @brief The new text of the range or of the whole document
+        std::string text;
+    };
+
+    /// @function `extract_content_changes`
+    /// @brief Extracts all content changes from a textDocument/didChange notification, in the order they need to be applied
     ///
-    /// @param `escaped` The escaped string to unescape
-    /// @result `std::string` The unescaped result
-    static std::string unescape_json_string(const std::string &escaped);
+    /// @param `message` The parsed LSP message
+    /// @return `std::vector<ContentChange>` The content changes (empty if not found)
+    static std::vector<ContentChange> extract_content_changes(const JsonValue &message);
 
     /// @function `extract_position`
     /// @brief Extracts line and character position from completion request
     ///
-    /// @param `content` The LSP message content
+    /// @param `message` The parsed LSP message
     /// @return `std::pair<int, int>` Line and character position (-1, -1 if not found)
-    static std::pair<int, int> extract_position(const std::string &content);
+    static std::pair<int, int> extract_position(const JsonValue &message);
 
     /// @function `uri_to_file_path`
     /// @brief Converts file:// URI to local file path
@@ -417,3 +775,15 @@ class LspServer {
     /// @return `std::string` The "json compatible" string
     static std::string json_escape(const std::string &s);
 };
+
+/// @def LSP_TRACE(message)
+/// @brief Logs the given message in debug builds only. The message is not even built in release builds, which matters for the messages
+/// logged for every visited node of a traversal
+/// @param message The message to log
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LSP_TRACE(message)                                                                                                                 \
+    do {                                                                                                                                   \
+        if (DEBUG_MODE) {                                                                                                                  \
+            LspServer::log_info(message);                                                                                                  \
+        }                                                                                                                                  \
+    } while (false)
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "parser/ast/file_node.hpp"
+#include "parser/ast/scope.hpp"
+#include "parser/ast/statements/statement_node.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/// @class `PositionIndex`
+/// @brief An index of a single parsed file which maps a (line, column) position to the tokens, definitions and statements at that
+/// position. It is built once per parse, so that every hover, definition and completion request only needs a binary search instead of
+/// a linear scan through the whole file
+class PositionIndex {
+  public:
+    /// @function `PositionIndex`
+    /// @brief Builds the token and definition index of the given namespace's file. Statement indices of scopes are built lazily on
+    /// their first lookup
+    ///
+    /// @param `ns` The namespace of the file to index
+    explicit PositionIndex(const Namespace *ns);
+
+    /// @function `get_token_at`
+    /// @brief Returns the token at the given position
+    ///
+    /// @param `line` The line of the position
+    /// @param `col` The column of the position
+    /// @return `const TokenContext *` The token at the position, nullptr if there is no token at the position
+    const TokenContext *get_token_at(unsigned int line, unsigned int col) const;
+
+    /// @function `get_definitions_at`
+    /// @brief Returns all top-level definitions and imports of the file containing the given position, in file order
+    ///
+    /// @param `line` The line of the position
+    /// @param `col` The column of the position
+    /// @return `std::vector<const DefinitionNode *>` The definitions containing the position
+    std::vector<const DefinitionNode *> get_definitions_at(unsigned int line, unsigned int col) const;
+
+    /// @function `get_statements_at`
+    /// @brief Returns all statements of the given scope's body containing the given position, in the order of the body
+    ///
+    /// @param `scope` The scope whose statements to search through
+    /// @param `line` The line of the position
+    /// @param `col` The column of the position
+    /// @return `std::vector<const StatementNode *>` The statements containing the position
+    std::vector<const StatementNode *> get_statements_at(const Scope *scope, unsigned int line, unsigned int col);
+
+  private:
+    /// @class `IntervalList`
+    /// @brief A list of AST nodes sorted by their start line, which finds all nodes spanning a given line in logarithmic time as long as
+    /// the nodes do not overlap
+    template <typename NodeType> class IntervalList {
+      public:
+        explicit IntervalList(std::vector<const NodeType *> list) :
+            nodes(std::move(list)) {
+            std::stable_sort(nodes.begin(), nodes.end(), [](const NodeType *lhs, const NodeType *rhs) { return lhs->line < rhs->line; });
+            max_end_lines.reserve(nodes.size());
+            unsigned int max_end_line = 0;
+            for (const NodeType *node : nodes) {
+                max_end_line = std::max({max_end_line, node->line, node->end_line});
+                max_end_lines.emplace_back(max_end_line);
+            }
+        }
+
+        /// @function `get_nodes_at`
+        /// @brief Returns all nodes of the list containing the given position
+        ///
+        /// @param `line` The line of the position
+        /// @param `col` The column of the position
+        /// @return `std::vector<const NodeType *>` The nodes containing the position, sorted by their start line
+        std::vector<const NodeType *> get_nodes_at(unsigned int line, unsigned int col) const {
+            const auto upper = std::upper_bound(nodes.begin(), nodes.end(), line, [](unsigned int l, const NodeType *node) {
+                return l < node->line;
+            });
+            // Only the nodes starting before the position which reach at least up to the position's line need to be checked
+            std::vector<const NodeType *> result;
+            for (auto i = static_cast<size_t>(upper - nodes.begin()); i > 0 && max_end_lines[i - 1] >= line; i--) {
+                if (nodes[i - 1]->contains_pos(line, col)) {
+                    result.emplace_back(nodes[i - 1]);
+                }
+            }
+            std::reverse(result.begin(), result.end());
+            return result;
+        }
+
+      private:
+        /// @var `nodes`
+        /// @brief All nodes of the list, sorted by their start line
+        std::vector<const NodeType *> nodes;
+
+        /// @var `max_end_lines`
+        /// @brief The maximum end line of all nodes up to and including the node at the same index
+        std::vector<unsigned int> max_end_lines;
+    };
+
+    /// @struct `TokenEntry`
+    /// @brief The span of a single token of the file
+    struct TokenEntry {
+        /// @var `line`
+        /// @brief The line of the token
+        unsigned int line;
+
+        /// @var `column`
+        /// @brief The column the token starts at
+        unsigned int column;
+
+        /// @var `end_column`
+        /// @brief The column after the last character of the token
+        unsigned int end_column;
+
+        /// @var `token`
+        /// @brief The token itself
+        const TokenContext *token;
+    };
+
+    /// @var `tokens`
+    /// @brief The spans of all tokens of the file, sorted by their position
+    std::vector<TokenEntry> tokens;
+
+    /// @var `definitions`
+    /// @brief All top-level definitions and imports of the file
+    IntervalList<DefinitionNode> definitions;
+
+    /// @var `scope_statements`
+    /// @brief The statement lists of all scopes which have been searched through already
+    std::unordered_map<const Scope *, IntervalList<StatementNode>> scope_statements;
+};
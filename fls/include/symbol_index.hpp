@@ -0,0 +1,207 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/// @enum `SymbolKind`
+/// @brief All kinds of symbols the LSP knows about
+enum class SymbolKind : int {
+    File = 1,
+    Module = 2,
+    Namespace = 3,
+    Package = 4,
+    Class = 5,
+    Method = 6,
+    Property = 7,
+    Field = 8,
+    Constructor = 9,
+    Enum = 10,
+    Interface = 11,
+    Function = 12,
+    Variable = 13,
+    Constant = 14,
+    String = 15,
+    Number = 16,
+    Boolean = 17,
+    Array = 18,
+    Object = 19,
+    Key = 20,
+    Null = 21,
+    EnumMember = 22,
+    Struct = 23,
+    Event = 24,
+    Operator = 25,
+    TypeParameter = 26,
+};
+
+/// @class `SymbolIndex`
+/// @brief The workspace-wide index of all definitions and of all references to symbols in all indexed files. The index is built from
+/// the parsed namespaces of the workspace and persisted to disk once per workspace, keyed by the content hash of every file, so that a
+/// restarted server only needs to re-parse the files which changed in the meantime
+/// @note This class cannot be initialized and all functions within this class are static
+class SymbolIndex {
+  public:
+    SymbolIndex() = delete;
+
+    /// @struct `Location`
+    /// @brief A location in an indexed file, already converted to the 0-indexed line and character positions of the LSP
+    struct Location {
+        /// @var `line`
+        /// @brief The 0-indexed line of the location
+        unsigned int line;
+
+        /// @var `character`
+        /// @brief The 0-indexed start character of the location
+        unsigned int character;
+
+        /// @var `end_character`
+        /// @brief The 0-indexed end character of the location (exclusive)
+        unsigned int end_character;
+    };
+
+    /// @struct `Symbol`
+    /// @brief A single definition of an indexed file
+    struct Symbol {
+        /// @var `name`
+        /// @brief The name of the defined symbol
+        std::string name;
+
+        /// @var `kind`
+        /// @brief The kind of the symbol
+        SymbolKind kind;
+
+        /// @var `location`
+        /// @brief The location of the definition
+        Location location;
+    };
+
+    /// @struct `FileEntry`
+    /// @brief Everything the index knows about a single file
+    struct FileEntry {
+        /// @var `content_hash`
+        /// @brief The hash of the content the entry has been built from, see `hash_content`
+        uint64_t content_hash;
+
+        /// @var `symbols`
+        /// @brief All definitions of the file
+        std::vector<Symbol> symbols;
+
+        /// @var `references`
+        /// @brief The locations of all identifiers and type usages in the file, keyed by the referenced symbol, see `get_symbol_key`
+        std::unordered_map<std::string, std::vector<Location>> references;
+    };
+
+    /// @var `MAX_WORKSPACE_SYMBOLS`
+    /// @brief The maximum number of symbols returned by a single workspace symbol query
+    static constexpr size_t MAX_WORKSPACE_SYMBOLS = 256;
+
+    /// @var `MAX_CACHE_AGE`
+    /// @brief The time after which the persisted index of a workspace which has not been opened since is deleted
+    static constexpr std::chrono::hours MAX_CACHE_AGE = std::chrono::hours(24 * 30);
+
+    /// @function `hash_content`
+    /// @brief Hashes the content of a file. Unlike `std::hash` the hash is stable across runs, which is needed for the persisted index
+    ///
+    /// @param `content` The file content to hash
+    /// @return `uint64_t` The FNV-1a hash of the content
+    static uint64_t hash_content(std::string_view content);
+
+    /// @function `get_cache_file_path`
+    /// @brief Returns the path of the persisted index of the given workspace in `$HOME/.cache/fls/` or in
+    /// `%LOCALAPPDATA%\Flint\Cache\fls\`, creating the directory if needed. The indices of workspaces which have not been opened for
+    /// `MAX_CACHE_AGE` are deleted from the directory
+    ///
+    /// @param `workspace_root` The absolute and lexically normalized path to the root directory of the workspace
+    /// @return `std::filesystem::path` The path to the index file, an empty path if there is no cache directory available
+    static std::filesystem::path get_cache_file_path(const std::filesystem::path &workspace_root);
+
+    /// @function `get_symbol_key`
+    /// @brief Returns the key references to a symbol are indexed with. Symbols are identified by the location of their definition, so
+    /// that equally named symbols (like two local variables `x`) never share their references
+    ///
+    /// @param `file_path` The absolute and lexically normalized path of the file the symbol is defined in
+    /// @param `line` The 1-indexed line of the definition
+    /// @param `column` The 1-indexed column of the definition
+    /// @return `std::string` The key of the symbol
+    static std::string get_symbol_key(const std::filesystem::path &file_path, unsigned int line, unsigned int column);
+
+    /// @function `get_name_key`
+    /// @brief Returns the key references to a name which could not be resolved to its definition are indexed with
+    ///
+    /// @param `name` The unresolved name
+    /// @return `std::string` The key of the name
+    static std::string get_name_key(std::string_view name);
+
+    /// @function `is_up_to_date`
+    /// @brief Checks whether the given file is indexed with the given content
+    ///
+    /// @param `file_path` The path of the file
+    /// @param `content_hash` The hash of the current file content
+    /// @return `bool` Whether the indexed entry of the file has been built from the same content
+    static bool is_up_to_date(const std::string &file_path, uint64_t content_hash);
+
+    /// @function `update_file`
+    /// @brief Replaces the entry of the given file in the index
+    ///
+    /// @param `file_path` The path of the file
+    /// @param `entry` The new entry of the file
+    static void update_file(const std::string &file_path, FileEntry entry);
+
+    /// @function `find_symbols`
+    /// @brief Finds all symbols of the workspace whose name contains the given query, ignoring case
+    ///
+    /// @param `query` The query to search for, an empty query matches all symbols
+    /// @return `std::vector<std::pair<std::string, Symbol>>` The file paths and the matching symbols, at most `MAX_WORKSPACE_SYMBOLS`
+    static std::vector<std::pair<std::string, Symbol>> find_symbols(const std::string &query);
+
+    /// @function `find_references`
+    /// @brief Finds all references to the given symbol in the workspace
+    ///
+    /// @param `key` The key of the referenced symbol, see `get_symbol_key` and `get_name_key`
+    /// @return `std::vector<std::pair<std::string, Location>>` The file paths and locations of all references
+    static std::vector<std::pair<std::string, Location>> find_references(const std::string &key);
+
+    /// @function `prune`
+    /// @brief Removes the entries of all files which no longer exist or which are not part of the given workspace from the index
+    ///
+    /// @param `workspace_root` The absolute and lexically normalized path to the root directory of the workspace
+    static void prune(const std::filesystem::path &workspace_root);
+
+    /// @function `load`
+    /// @brief Loads the persisted index from the given file, replacing the current index
+    ///
+    /// @param `file_path` The path of the persisted index
+    /// @return `bool` Whether the index could be loaded
+    static bool load(const std::filesystem::path &file_path);
+
+    /// @function `save`
+    /// @brief Persists the index to the given file if it changed since it has been loaded or saved the last time. The index is written to
+    /// a uniquely named temporary file first, so that multiple servers never write to the same temporary file
+    ///
+    /// @param `file_path` The path of the persisted index
+    /// @return `bool` Whether the index is persisted
+    static bool save(const std::filesystem::path &file_path);
+
+  private:
+    /// @var `FORMAT_HEADER`
+    /// @brief The first line of every persisted index, it changes whenever the format changes
+    static constexpr std::string_view FORMAT_HEADER = "fls-symbol-index 2";
+
+    /// @var `files`
+    /// @brief The entries of all indexed files, keyed by their path
+    static inline std::unordered_map<std::string, FileEntry> files;
+
+    /// @var `is_dirty`
+    /// @brief Whether the index changed since it has been loaded or saved the last time
+    static inline bool is_dirty = false;
+
+    /// @var `files_mutex`
+    /// @brief A mutex for thread-safe access on the `files` map and the `is_dirty` flag
+    static inline std::shared_mutex files_mutex;
+};
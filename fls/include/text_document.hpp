@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @class `TextDocument`
+/// @brief The in-memory content of a document opened in the client. The content is stored as a list of lines, so an incremental edit
+/// only touches the lines it spans instead of copying the whole document
+class TextDocument {
+  public:
+    /// @struct `Position`
+    /// @brief A position in the document as the LSP defines it
+    struct Position {
+        /// @var `line`
+        /// @brief The 0-indexed line of the position
+        unsigned int line;
+
+        /// @var `character`
+        /// @brief The 0-indexed character of the position in UTF-16 code units
+        unsigned int character;
+    };
+
+    explicit TextDocument(const std::string &text) {
+        set_text(text);
+    }
+
+    /// @function `set_text`
+    /// @brief Replaces the whole content of the document
+    ///
+    /// @param `text` The new content of the document
+    void set_text(const std::string &text);
+
+    /// @function `apply_change`
+    /// @brief Replaces the given range of the document with the given text
+    ///
+    /// @param `start` The start of the replaced range (inclusive)
+    /// @param `end` The end of the replaced range (exclusive)
+    /// @param `text` The text to insert in place of the range
+    ///
+    /// @note Positions outside of the document are clamped to the end of their line or to the end of the document
+    void apply_change(const Position &start, const Position &end, const std::string &text);
+
+    /// @function `get_text`
+    /// @brief Returns the whole content of the document
+    ///
+    /// @return `std::string` The content of the document
+    std::string get_text() const;
+
+  private:
+    /// @function `character_to_offset`
+    /// @brief Converts a character in UTF-16 code units to the byte offset within the given UTF-8 encoded line
+    ///
+    /// @param `line` The line to convert the character in
+    /// @param `character` The character to convert
+    /// @return `size_t` The byte offset of the character, clamped to the length of the line
+    static size_t character_to_offset(std::string_view line, unsigned int character);
+
+    /// @var `lines`
+    /// @brief All lines of the document, without their trailing line break
+    std::vector<std::string> lines;
+};
@@ -0,0 +1,395 @@
+#include "json.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+
+/// @function `append_utf8`
+/// @brief Appends the given code point encoded as UTF-8 to the given string
+///
+/// @param `result` The string to append to
+/// @param `code_point` The code point to encode
+static void append_utf8(std::string &result, const uint32_t code_point) {
+    if (code_point < 0x80) {
+        result += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        result += static_cast<char>(0xC0 | (code_point >> 6));
+        result += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        result += static_cast<char>(0xE0 | (code_point >> 12));
+        result += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        result += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        result += static_cast<char>(0xF0 | (code_point >> 18));
+        result += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        result += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        result += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+class JsonValue::Parser {
+  public:
+    explicit Parser(std::string_view source) :
+        text(source) {}
+
+    /// @function `parse_document`
+    /// @brief Parses the whole text as a single value, only surrounded by whitespace
+    ///
+    /// @return `std::optional<JsonValue>` The parsed value, nullopt if the text is no valid json
+    std::optional<JsonValue> parse_document() {
+        JsonValue result;
+        if (!parse_value(result, 0)) {
+            return std::nullopt;
+        }
+        skip_whitespace();
+        if (pos != text.size()) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+  private:
+    /// @var `text`
+    /// @brief The json text being parsed
+    std::string_view text;
+
+    /// @var `pos`
+    /// @brief The current position in the text
+    size_t pos = 0;
+
+    void skip_whitespace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+            pos++;
+        }
+    }
+
+    bool consume_literal(std::string_view literal) {
+        if (text.substr(pos, literal.size()) != literal) {
+            return false;
+        }
+        pos += literal.size();
+        return true;
+    }
+
+    bool parse_value(JsonValue &result, const unsigned int depth) {
+        if (depth > MAX_DEPTH) {
+            return false;
+        }
+        skip_whitespace();
+        if (pos >= text.size()) {
+            return false;
+        }
+        switch (text[pos]) {
+            case '{':
+                return parse_object(result, depth);
+            case '[':
+                return parse_array(result, depth);
+            case '"': {
+                std::string string;
+                if (!parse_string(string)) {
+                    return false;
+                }
+                result.value = std::move(string);
+                return true;
+            }
+            case 't':
+                result.value = true;
+                return consume_literal("true");
+            case 'f':
+                result.value = false;
+                return consume_literal("false");
+            case 'n':
+                result.value = std::monostate{};
+                return consume_literal("null");
+            default:
+                return parse_number(result);
+        }
+    }
+
+    bool parse_object(JsonValue &result, const unsigned int depth) {
+        Object object;
+        pos++;
+        skip_whitespace();
+        if (pos < text.size() && text[pos] == '}') {
+            pos++;
+            result.value = std::move(object);
+            return true;
+        }
+        while (true) {
+            skip_whitespace();
+            std::string key;
+            if (pos >= text.size() || text[pos] != '"' || !parse_string(key)) {
+                return false;
+            }
+            skip_whitespace();
+            if (pos >= text.size() || text[pos] != ':') {
+                return false;
+            }
+            pos++;
+            JsonValue member;
+            if (!parse_value(member, depth + 1)) {
+                return false;
+            }
+            object.emplace_back(std::move(key), std::move(member));
+            skip_whitespace();
+            if (pos >= text.size()) {
+                return false;
+            }
+            if (text[pos] == '}') {
+                pos++;
+                result.value = std::move(object);
+                return true;
+            }
+            if (text[pos] != ',') {
+                return false;
+            }
+            pos++;
+        }
+    }
+
+    bool parse_array(JsonValue &result, const unsigned int depth) {
+        Array array;
+        pos++;
+        skip_whitespace();
+        if (pos < text.size() && text[pos] == ']') {
+            pos++;
+            result.value = std::move(array);
+            return true;
+        }
+        while (true) {
+            JsonValue element;
+            if (!parse_value(element, depth + 1)) {
+                return false;
+            }
+            array.emplace_back(std::move(element));
+            skip_whitespace();
+            if (pos >= text.size()) {
+                return false;
+            }
+            if (text[pos] == ']') {
+                pos++;
+                result.value = std::move(array);
+                return true;
+            }
+            if (text[pos] != ',') {
+                return false;
+            }
+            pos++;
+        }
+    }
+
+    bool parse_hex4(uint32_t &result) {
+        if (pos + 4 > text.size()) {
+            return false;
+        }
+        const auto [end, ec] = std::from_chars(text.data() + pos, text.data() + pos + 4, result, 16);
+        if (ec != std::errc() || end != text.data() + pos + 4) {
+            return false;
+        }
+        pos += 4;
+        return true;
+    }
+
+    bool parse_string(std::string &result) {
+        pos++;
+        // Most strings contain no escapes at all, so unescaped runs are appended as a whole
+        while (pos < text.size()) {
+            const size_t run_end = text.find_first_of("\"\\", pos);
+            if (run_end == std::string_view::npos) {
+                return false;
+            }
+            result.append(text.substr(pos, run_end - pos));
+            pos = run_end + 1;
+            if (text[run_end] == '"') {
+                return true;
+            }
+            if (pos >= text.size()) {
+                return false;
+            }
+            const char escaped = text[pos++];
+            switch (escaped) {
+                case 'n':
+                    result += '\n';
+                    break;
+                case 't':
+                    result += '\t';
+                    break;
+                case 'r':
+                    result += '\r';
+                    break;
+                case 'b':
+                    result += '\b';
+                    break;
+                case 'f':
+                    result += '\f';
+                    break;
+                case '"':
+                case '\\':
+                case '/':
+                    result += escaped;
+                    break;
+                case 'u': {
+                    uint32_t code_point = 0;
+                    if (!parse_hex4(code_point)) {
+                        return false;
+                    }
+                    // Code points outside of the BMP are escaped as a surrogate pair
+                    if (code_point >= 0xD800 && code_point < 0xDC00 && text.substr(pos, 2) == "\\u") {
+                        pos += 2;
+                        uint32_t low = 0;
+                        if (!parse_hex4(low) || low < 0xDC00 || low >= 0xE000) {
+                            return false;
+                        }
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    append_utf8(result, code_point);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        return false;
+    }
+
+    bool parse_number(JsonValue &result) {
+        const size_t start = pos;
+        bool is_integral = true;
+        if (pos < text.size() && text[pos] == '-') {
+            pos++;
+        }
+        while (pos < text.size()) {
+            const char c = text[pos];
+            if (c == '.' || c == 'e' || c == 'E' || c == '+' || (c == '-' && pos > start)) {
+                is_integral = false;
+            } else if (c < '0' || c > '9') {
+                break;
+            }
+            pos++;
+        }
+        const char *first = text.data() + start;
+        const char *last = text.data() + pos;
+        if (is_integral) {
+            int64_t integer = 0;
+            const auto [end, ec] = std::from_chars(first, last, integer);
+            if (ec == std::errc() && end == last) {
+                result.value = integer;
+                return true;
+            }
+        }
+        // Unlike `strtod`, `std::from_chars` always uses the '.' decimal separator, regardless of the current locale
+        double floating = 0.0;
+        const auto [end, ec] = std::from_chars(first, last, floating, std::chars_format::general);
+        if (ec != std::errc() || end != last) {
+            return false;
+        }
+        result.value = floating;
+        return true;
+    }
+};
+
+std::optional<JsonValue> JsonValue::parse(std::string_view text) {
+    return Parser(text).parse_document();
+}
+
+const JsonValue &JsonValue::operator[](std::string_view key) const {
+    static const JsonValue null_value;
+    const auto *object = std::get_if<Object>(&value);
+    if (object == nullptr) {
+        return null_value;
+    }
+    for (const auto &[member_key, member] : *object) {
+        if (member_key == key) {
+            return member;
+        }
+    }
+    return null_value;
+}
+
+std::optional<std::string_view> JsonValue::get_string() const {
+    const auto *string = std::get_if<std::string>(&value);
+    if (string == nullptr) {
+        return std::nullopt;
+    }
+    return *string;
+}
+
+std::optional<int64_t> JsonValue::get_int() const {
+    if (const auto *integer = std::get_if<int64_t>(&value)) {
+        return *integer;
+    }
+    const auto *floating = std::get_if<double>(&value);
+    // The comparisons are false for NaN, and 2^63 itself is the first value which no longer fits into an int64_t
+    if (floating == nullptr || !(*floating >= -9223372036854775808.0 && *floating < 9223372036854775808.0)) {
+        return std::nullopt;
+    }
+    if (std::trunc(*floating) == *floating) {
+        return static_cast<int64_t>(*floating);
+    }
+    return std::nullopt;
+}
+
+const JsonValue::Array &JsonValue::get_array() const {
+    static const Array empty_array;
+    const auto *array = std::get_if<Array>(&value);
+    return array == nullptr ? empty_array : *array;
+}
+
+std::string JsonValue::to_json() const {
+    std::string result;
+    append_json(result);
+    return result;
+}
+
+void JsonValue::append_json(std::string &out) const {
+    const auto append_string = [&out](const std::string &string) {
+        out += '"';
+        for (const char c : string) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[7];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                out += escaped;
+            } else {
+                out += c;
+            }
+        }
+        out += '"';
+    };
+    if (std::holds_alternative<std::monostate>(value)) {
+        out += "null";
+    } else if (const auto *boolean = std::get_if<bool>(&value)) {
+        out += *boolean ? "true" : "false";
+    } else if (const auto *integer = std::get_if<int64_t>(&value)) {
+        out += std::to_string(*integer);
+    } else if (const auto *floating = std::get_if<double>(&value)) {
+        // The shortest round-trip representation, which like the parsing does not depend on the locale
+        char buffer[32];
+        const auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), *floating);
+        out.append(buffer, ec == std::errc() ? end : buffer);
+    } else if (const auto *string = std::get_if<std::string>(&value)) {
+        append_string(*string);
+    } else if (const auto *array = std::get_if<Array>(&value)) {
+        out += '[';
+        for (size_t i = 0; i < array->size(); i++) {
+            if (i > 0) {
+                out += ',';
+            }
+            (*array)[i].append_json(out);
+        }
+        out += ']';
+    } else if (const auto *object = std::get_if<Object>(&value)) {
+        out += '{';
+        for (size_t i = 0; i < object->size(); i++) {
+            if (i > 0) {
+                out += ',';
+            }
+            append_string((*object)[i].first);
+            out += ':';
+            (*object)[i].second.append_json(out);
+        }
+        out += '}';
+    }
+}
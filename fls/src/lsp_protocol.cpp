@@ -3,28 +3,15 @@
 #include "lsp_server.hpp"
 
 #include <iostream>
+#include <mutex>
 #include <string>
 
-std::string extract_request_id(const std::string &content) {
-    // Simple extraction to find "id": number or "id":number
-    size_t id_pos = content.find("\"id\":");
-    if (id_pos != std::string::npos) {
-        size_t start = content.find_first_of("0123456789", id_pos);
-        if (start != std::string::npos) {
-            size_t end = content.find_first_of(",}", start);
-            if (end != std::string::npos) {
-                return content.substr(start, end - start);
-            }
-        }
-    }
-    return "1"; // fallback
+std::string extract_request_id(const JsonValue &message) {
+    return message["id"].to_json();
 }
 
-bool contains_method(const std::string &content, const char *method) {
-    std::string method_pattern = "\"method\":\"";
-    method_pattern += method;
-    method_pattern += "\"";
-    return content.find(method_pattern) != std::string::npos;
+std::string_view extract_method(const JsonValue &message) {
+    return message["method"].get_string().value_or("");
 }
 
 void send_lsp_response(const std::string &response) {
@@ -32,5 +19,13 @@ void send_lsp_response(const std::string &response) {
         LspServer::log_info("SENDING_LSP_RESPONSE: 'Content-Length: " + std::to_string(response.length()) + "\r\n\r\n" + response + "'\n");
         LspServer::log_info("response.substr(0, 10) = '" + response.substr(0, 10) + "'\n");
     }
-    std::cout << "Content-Length: " << response.length() << "\r\n\r\n" << response << std::flush;
+    // The header and the body are written as a single block, so every response costs exactly one write to stdout
+    std::string message = "Content-Length: " + std::to_string(response.length()) + "\r\n\r\n";
+    message.reserve(message.size() + response.size());
+    message += response;
+    // Responses are sent from the message thread and from the analysis thread, so they must not interleave
+    static std::mutex output_mutex;
+    std::lock_guard<std::mutex> lock(output_mutex);
+    std::cout.write(message.data(), static_cast<std::streamsize>(message.size()));
+    std::cout.flush();
 }
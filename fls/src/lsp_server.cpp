@@ -7,7 +7,16 @@
 #include "parser/parser.hpp"
 #include "parser/type/interface_type.hpp"
 #include "profiler.hpp"
-
+#include "symbol_index.hpp"
+
+#include "parser/ast/definitions/data_node.hpp"
+#include "parser/ast/definitions/enum_node.hpp"
+#include "parser/ast/definitions/error_node.hpp"
+#include "parser/ast/definitions/func_node.hpp"
+#include "parser/ast/definitions/function_node.hpp"
+#include "parser/ast/definitions/interface_node.hpp"
+#include "parser/ast/definitions/object_node.hpp"
+#include "parser/ast/definitions/variant_node.hpp"
 #include "parser/ast/expressions/array_access_node.hpp"
 #include "parser/ast/expressions/array_initializer_node.hpp"
 #include "parser/ast/expressions/binary_op_node.hpp"
@@ -64,32 +73,351 @@
 #include "parser/type/type.hpp"
 #include "parser/type/variant_type.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <variant>
 
 std::vector<Diagnostic> diagnostics;
 
+/// @function `equals_ignore_case`
+/// @brief Checks whether the two given ASCII strings are equal, ignoring their case
+///
+/// @param `lhs` The first string
+/// @param `rhs` The second string
+/// @return `bool` Whether both strings are equal
+static bool equals_ignore_case(std::string_view lhs, std::string_view rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](unsigned char l, unsigned char r) {
+        return std::tolower(l) == std::tolower(r);
+    });
+}
+
+/// @function `is_flint_file`
+/// @brief Checks whether the given file path is a Flint source file
+///
+/// @param `file_path` The path to check
+/// @return `bool` Whether the path has the Flint file extension
+static bool is_flint_file(const std::string &file_path) {
+    return std::filesystem::path(file_path).extension() == LspProtocol::FLINT_EXTENSION;
+}
+
 void LspServer::run() {
+    std::thread(process_messages).detach();
+    std::thread(run_analysis).detach();
     std::string line;
+    size_t content_length = 0;
     while (std::getline(std::cin, line)) {
-        // Basic LSP message handling
-        if (line.find("Content-Length:") == 0) {
-            // Extract content length
-            size_t length = std::stoul(line.substr(16));
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty()) {
+            // Header names are case-insensitive and all headers except the content length are ignored
+            const size_t colon = line.find(':');
+            if (colon != std::string::npos && equals_ignore_case(std::string_view(line).substr(0, colon), "Content-Length")) {
+                content_length = std::strtoul(line.c_str() + colon + 1, nullptr, 10);
+            }
+            continue;
+        }
+        // The empty line ends the header part, the message content follows
+        if (content_length == 0) {
+            continue;
+        }
+        std::string content(content_length, '\0');
+        content_length = 0;
+        if (!std::cin.read(content.data(), static_cast<std::streamsize>(content.size()))) {
+            break;
+        }
+        // Every message is parsed exactly once, all handlers work on the parsed message
+        std::optional<JsonValue> message = JsonValue::parse(content);
+        if (!message.has_value()) {
+            log_info("Dropping malformed message: " + content.substr(0, std::min(content.size(), size_t(200))));
+            continue;
+        }
+
+        // Queue the message, cancellations are handled right away as the cancelled request could still be queued
+        std::lock_guard<std::mutex> lock(message_queue_mutex);
+        if (extract_method(message.value()) == LspProtocol::METHOD_CANCEL_REQUEST) {
+            cancelled_requests.emplace(message.value()["params"]["id"].to_json());
+            continue;
+        }
+        if (is_workspace_request(message.value())) {
+            pending_workspace_requests.fetch_add(1);
+        }
+        message_queue.emplace_back(std::move(message.value()));
+        message_queue_cv.notify_one();
+    }
+}
+
+void LspServer::process_messages() {
+    while (true) {
+        JsonValue message;
+        bool is_cancelled = false;
+        {
+            std::unique_lock<std::mutex> lock(message_queue_mutex);
+            if (message_queue.empty()) {
+                // Every request a cancellation has been received for has been handled already
+                cancelled_requests.clear();
+                message_queue_cv.wait(lock, []() { return !message_queue.empty(); });
+            }
+            message = std::move(message_queue.front());
+            message_queue.pop_front();
+            if (!cancelled_requests.empty() && !message["id"].is_null()) {
+                is_cancelled = cancelled_requests.erase(extract_request_id(message)) > 0;
+            }
+        }
+        if (is_cancelled) {
+            log_info("Cancelled request: " + std::string(extract_method(message)));
+            send_cancelled_response(extract_request_id(message));
+        } else {
+            process_message(message);
+        }
+        if (is_workspace_request(message)) {
+            // Analyses which were cancelled in favour of the request can continue now
+            std::lock_guard<std::mutex> lock(analysis_mutex);
+            pending_workspace_requests.fetch_sub(1);
+            analysis_cv.notify_one();
+        }
+    }
+}
+
+void LspServer::run_analysis() {
+    while (true) {
+        std::string file_uri;
+        std::string index_file_path;
+        uint64_t generation = 0;
+        {
+            std::unique_lock<std::mutex> lock(analysis_mutex);
+            analysis_cv.wait(lock, []() {
+                return (!analysis_queue.empty() || !index_queue.empty()) && pending_workspace_requests.load() == 0;
+            });
+            if (!analysis_queue.empty()) {
+                // Every edit moves the deadline, so the analysis only starts once the document stayed unchanged for the debounce interval
+                while (std::chrono::steady_clock::now() < analysis_deadline) {
+                    analysis_cv.wait_until(lock, analysis_deadline);
+                }
+                if (analysis_queue.empty() || pending_workspace_requests.load() > 0) {
+                    continue;
+                }
+                file_uri = *analysis_queue.begin();
+                analysis_queue.erase(analysis_queue.begin());
+            } else {
+                // Indexing the workspace has the lowest priority, it only continues while no document needs to be analyzed
+                index_file_path = index_queue.front();
+                index_queue.pop_front();
+            }
+            generation = analysis_generation.load();
+        }
+
+        const auto is_cancelled = [generation]() {
+            return analysis_generation.load() != generation || pending_workspace_requests.load() > 0;
+        };
+        bool is_stale = false;
+        {
+            std::lock_guard<std::mutex> lock(workspace_mutex);
+            const auto start = std::chrono::steady_clock::now();
+            if (!file_uri.empty()) {
+                parse_program(uri_to_file_path(file_uri), std::nullopt, is_cancelled);
+                // Diagnostics of a stale analysis are not published, the analysis is re-run for the newest content instead
+                is_stale = is_cancelled();
+                if (!is_stale) {
+                    publish_diagnostics(file_uri);
+                }
+            } else if (!is_indexed(index_file_path)) {
+                // The file could have been indexed as a dependency of another file in the meantime
+                parse_program(index_file_path, std::nullopt, is_cancelled);
+                is_stale = is_cancelled();
+            }
+            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            const std::string state = is_stale ? " (stale)" : "";
+            const std::string task = file_uri.empty() ? "indexing of " + index_file_path : "analysis of " + file_uri;
+            log_info("[LATENCY] " + task + " took " + std::to_string(duration.count()) + " ms" + state);
+        }
+        std::lock_guard<std::mutex> lock(analysis_mutex);
+        if (is_stale) {
+            if (file_uri.empty()) {
+                index_queue.emplace_front(index_file_path);
+            } else {
+                analysis_queue.emplace(file_uri);
+            }
+        } else if (analysis_queue.empty() && index_queue.empty() && !symbol_index_path.empty()) {
+            // The index is only persisted once all work is done, as writing it is not free for large workspaces
+            if (!SymbolIndex::save(symbol_index_path)) {
+                log_info("Could not save the symbol index to " + symbol_index_path.string());
+            }
+        }
+    }
+}
 
-            // Skip empty line
-            std::getline(std::cin, line);
+void LspServer::schedule_workspace_indexing(const std::string &root_path) {
+    std::vector<std::string> file_paths;
+    std::error_code ec;
+    auto it = std::filesystem::recursive_directory_iterator(root_path, std::filesystem::directory_options::skip_permission_denied, ec);
+    for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        const std::filesystem::path &path = it->path();
+        // Hidden directories like `.git` or `.fip` never contain sources of the workspace
+        if (it->is_directory() && path.filename().string().starts_with(".")) {
+            it.disable_recursion_pending();
+            continue;
+        }
+        if (it->is_regular_file() && path.extension() == LspProtocol::FLINT_EXTENSION && !is_indexed(path.string())) {
+            file_paths.emplace_back(path.lexically_normal().string());
+        }
+    }
+    log_info("Indexing " + std::to_string(file_paths.size()) + " changed files of the workspace " + root_path);
+    std::lock_guard<std::mutex> lock(analysis_mutex);
+    index_queue.insert(index_queue.end(), file_paths.begin(), file_paths.end());
+    analysis_cv.notify_one();
+}
 
-            // Read message content
-            std::string content(length, '\0');
-            std::cin.read(&content[0], length);
+bool LspServer::is_indexed(const std::string &file_path) {
+    const std::optional<std::string> document_content = get_document_content(file_path);
+    if (document_content.has_value()) {
+        return SymbolIndex::is_up_to_date(file_path, SymbolIndex::hash_content(document_content.value()));
+    }
+    if (!IO::file_exists_and_is_readable(file_path)) {
+        return true;
+    }
+    return SymbolIndex::is_up_to_date(file_path, SymbolIndex::hash_content(IO::load_file(file_path)));
+}
+
+void LspServer::index_parsed_file(const Parser &instance) {
+    const std::string file_path = std::filesystem::absolute(instance.get_file_path()).lexically_normal().string();
+    const uint64_t content_hash = SymbolIndex::hash_content(instance.get_source_code());
+    if (instance.file_node_ptr == nullptr || SymbolIndex::is_up_to_date(file_path, content_hash)) {
+        return;
+    }
+    const auto lines = instance.get_source_code_lines();
+    const auto to_location = [&lines](unsigned int line, unsigned int column, unsigned int length) -> SymbolIndex::Location {
+        const std::string_view source_line = line > 0 && line <= lines.size() ? lines[line - 1].second : std::string_view();
+        return SymbolIndex::Location{
+            line > 0 ? line - 1 : 0,
+            column_to_vscode_char(source_line, column),
+            column_to_vscode_char(source_line, column + length),
+        };
+    };
 
-            // Process the message
-            process_message(content);
+    SymbolIndex::FileEntry entry{content_hash, {}, {}};
+    const auto add_symbol = [&](const std::string &name, const SymbolKind kind, const DefinitionNode *def) {
+        entry.symbols.emplace_back(SymbolIndex::Symbol{name, kind, to_location(def->line, def->column, def->length)});
+    };
+    const auto add_functions = [&](const std::vector<FunctionNode *> &functions) {
+        for (const FunctionNode *fn : functions) {
+            add_symbol(fn->name, SymbolKind::Method, fn);
         }
+    };
+    for (const auto &def : instance.file_node_ptr->file_namespace->public_symbols.definitions) {
+        switch (def->get_variation()) {
+            case DefinitionNode::Variation::DATA:
+                add_symbol(def->as<DataNode>()->name, SymbolKind::Struct, def.get());
+                break;
+            case DefinitionNode::Variation::ENUM:
+                add_symbol(def->as<EnumNode>()->name, SymbolKind::Enum, def.get());
+                break;
+            case DefinitionNode::Variation::ERROR:
+                add_symbol(def->as<ErrorNode>()->name, SymbolKind::Enum, def.get());
+                break;
+            case DefinitionNode::Variation::FUNC:
+                add_symbol(def->as<FuncNode>()->name, SymbolKind::Module, def.get());
+                add_functions(def->as<FuncNode>()->functions);
+                break;
+            case DefinitionNode::Variation::FUNCTION: {
+                const auto *node = def->as<FunctionNode>();
+                add_symbol(node->name == "_main" ? "main" : node->name, SymbolKind::Function, def.get());
+                break;
+            }
+            case DefinitionNode::Variation::INTERFACE:
+                add_symbol(def->as<InterfaceNode>()->name, SymbolKind::Interface, def.get());
+                add_functions(def->as<InterfaceNode>()->functions);
+                break;
+            case DefinitionNode::Variation::OBJECT:
+                add_symbol(def->as<ObjectNode>()->name, SymbolKind::Class, def.get());
+                add_functions(def->as<ObjectNode>()->functions);
+                break;
+            case DefinitionNode::Variation::VARIANT:
+                add_symbol(def->as<VariantNode>()->name, SymbolKind::Enum, def.get());
+                break;
+            case DefinitionNode::Variation::IMPORT:
+            case DefinitionNode::Variation::TEST:
+                // Imports and tests cannot be referenced by name, so they are no symbols
+                break;
+        }
+    }
+
+    // References are collected from the tokens, so every identifier and every type usage is found, even in unparsed bodies
+    const Namespace *file_namespace = instance.file_node_ptr->file_namespace.get();
+    for (const TokenContext &tok : instance.file_node_ptr->tokens) {
+        std::optional<std::string> key = get_reference_key(file_namespace, tok);
+        if (!key.has_value()) {
+            continue;
+        }
+        const auto length = static_cast<unsigned int>(tok.token == TOK_TYPE ? tok.type->to_string().size() : tok.lexme.size());
+        entry.references[std::move(key.value())].emplace_back(to_location(tok.line, tok.column, length));
+    }
+    SymbolIndex::update_file(file_path, std::move(entry));
+}
+
+void LspServer::schedule_analysis(const std::string &file_uri) {
+    std::lock_guard<std::mutex> lock(analysis_mutex);
+    analysis_queue.emplace(file_uri);
+    analysis_deadline = std::chrono::steady_clock::now() + ANALYSIS_DEBOUNCE;
+    analysis_generation.fetch_add(1);
+    analysis_cv.notify_one();
+}
+
+std::optional<std::string> LspServer::get_reference_key(const Namespace *ns, const TokenContext &tok) {
+    if (tok.token != TOK_IDENTIFIER && tok.token != TOK_TYPE) {
+        return std::nullopt;
+    }
+    const std::optional<PositionInfo> node = find_node_at(ns, tok.line, tok.column);
+    if (node.has_value()) {
+        if (const auto *var = std::get_if<LocalVariable>(&node.value())) {
+            return SymbolIndex::get_symbol_key(var->file_hash.path, var->line, var->column);
+        } else if (const auto *fn = std::get_if<const FunctionNode *>(&node.value())) {
+            return SymbolIndex::get_symbol_key((*fn)->file_hash.path, (*fn)->line, (*fn)->column);
+        } else if (const auto *type = std::get_if<std::shared_ptr<Type>>(&node.value())) {
+            const auto location = get_type_definition_location(*type);
+            if (location.has_value()) {
+                const auto &[file_hash, line, column] = location.value();
+                const auto def_line = static_cast<unsigned int>(line + 1);
+                return SymbolIndex::get_symbol_key(file_hash.path, def_line, static_cast<unsigned int>(column + 1));
+            }
+        }
+    }
+    // Names which cannot be resolved to their definition, like the names in unparsed bodies, are only referenced by their name
+    return SymbolIndex::get_name_key(tok.token == TOK_TYPE ? tok.type->to_string() : std::string(tok.lexme));
+}
+
+bool LspServer::is_workspace_request(const JsonValue &message) {
+    const MethodHandler *handler = get_method_handler(message);
+    return handler != nullptr && handler->needs_workspace;
+}
+
+void LspServer::send_cancelled_response(const std::string &request_id) {
+    std::stringstream response;
+    response << R"({
+  "jsonrpc": "2.0",
+  "id": )" << request_id
+             << R"(,
+  "error": {
+    "code": -32800,
+    "message": "Request cancelled"
+  }
+})";
+    send_lsp_response(response.str());
+}
+
+std::optional<std::string> LspServer::get_document_content(const std::string &file_path) {
+    std::lock_guard<std::mutex> lock(documents_mutex);
+    const auto it = documents.find(file_path);
+    if (it == documents.end()) {
+        return std::nullopt;
     }
+    return it->second.get_text();
 }
 
 void parser_cleanup() {
@@ -102,102 +430,477 @@ void parser_cleanup() {
     FIP::shutdown();
 }
 
-std::optional<FileNode *> LspServer::parse_program(const std::string &source_file_path, const std::optional<std::string> &file_content) {
-    log_info("Parsing file path: " + source_file_path);
-    static std::mutex parsing_mutex;
-    std::lock_guard<std::mutex> lock(parsing_mutex);
-    std::filesystem::path file_path(source_file_path);
+std::optional<std::unordered_set<Hash>> LspServer::get_changed_workspace_files( //
+    const std::string &file_path,                                             //
+    const std::optional<std::string> &file_content                            //
+) {
+    if (workspace_root.empty() || workspace_root != file_path) {
+        return std::nullopt;
+    }
+    std::unordered_set<Hash> changed_files;
+    for (auto &[path, workspace_file_state] : workspace_files) {
+        if (file_content.has_value() && path == file_path) {
+            if (std::hash<std::string>{}(file_content.value()) != workspace_file_state.content_hash) {
+                changed_files.emplace(workspace_file_state.file_hash);
+            }
+            continue;
+        }
+        std::error_code ec;
+        const auto write_time = std::filesystem::last_write_time(path, ec);
+        if (ec) {
+            changed_files.emplace(workspace_file_state.file_hash);
+            continue;
+        }
+        if (write_time == workspace_file_state.write_time) {
+            continue;
+        }
+        // The file has been written to, but it only needs to be re-parsed if its content actually changed
+        if (!IO::file_exists_and_is_readable(path) || std::hash<std::string>{}(IO::load_file(path)) != workspace_file_state.content_hash) {
+            changed_files.emplace(workspace_file_state.file_hash);
+            continue;
+        }
+        workspace_file_state.write_time = write_time;
+    }
+    return changed_files;
+}
+
+std::unordered_set<Hash> LspServer::get_dependent_workspace_files(const std::unordered_set<Hash> &file_hashes) {
+    std::unordered_map<Hash, std::vector<Hash>> dependents;
+    for (const auto &[path, workspace_file_state] : workspace_files) {
+        for (const Hash &import_hash : workspace_file_state.imports) {
+            dependents[import_hash].emplace_back(workspace_file_state.file_hash);
+        }
+    }
+    std::unordered_set<Hash> dependent_files = file_hashes;
+    std::vector<Hash> open_files(file_hashes.begin(), file_hashes.end());
+    while (!open_files.empty()) {
+        const Hash file_hash = open_files.back();
+        open_files.pop_back();
+        const auto it = dependents.find(file_hash);
+        if (it == dependents.end()) {
+            continue;
+        }
+        for (const Hash &dependent_hash : it->second) {
+            if (dependent_files.emplace(dependent_hash).second) {
+                open_files.emplace_back(dependent_hash);
+            }
+        }
+    }
+    return dependent_files;
+}
+
+std::vector<LspServer::RetiredInstances> LspServer::retired_instances;
+
+void LspServer::remove_workspace_files(const std::unordered_set<Hash> &file_hashes) {
+    for (const Parser &instance : Parser::instances) {
+        if (file_hashes.contains(instance.file_node_ptr->file_namespace->namespace_hash)) {
+            position_indices.erase(instance.file_node_ptr->file_namespace.get());
+        }
+    }
+    // All kept files which depend on the removed files, directly or transitively, still refer to the nodes of the removed files
+    std::unordered_set<Hash> referrers = get_dependent_workspace_files(file_hashes);
+    std::erase_if(referrers, [&file_hashes](const Hash &file_hash) { return file_hashes.contains(file_hash); });
+    std::erase_if(workspace_files, [&file_hashes](const auto &entry) { return file_hashes.contains(entry.second.file_hash); });
+    // The removed files do not refer to any retired instances anymore, so retired instances nobody refers to can be destroyed now
+    for (auto &retired : retired_instances) {
+        std::erase_if(retired.referrers, [&file_hashes](const Hash &file_hash) { return file_hashes.contains(file_hash); });
+    }
+    std::erase_if(retired_instances, [](const RetiredInstances &retired) { return retired.referrers.empty(); });
+    std::vector<Parser> removed_instances = Parser::remove_instances(file_hashes);
+    if (!referrers.empty()) {
+        retired_instances.emplace_back(RetiredInstances{std::move(removed_instances), std::move(referrers)});
+    }
+    Resolver::remove_files(file_hashes);
+}
+
+size_t LspServer::get_signature_hash(const FileNode *file) {
+    std::string signature;
+    const auto add_type = [&signature](const std::shared_ptr<Type> &type) { signature.append(type->to_string()).push_back(','); };
+    const auto add_function = [&signature, &add_type](const FunctionNode *function) {
+        signature.append(function->name).append(function->is_const ? " const(" : "(");
+        for (const auto &param : function->parameters) {
+            signature.append(param.is_mutable ? "mut " : "").append(param.name).push_back(' ');
+            add_type(param.type);
+        }
+        signature.append(")->");
+        for (const auto &return_type : function->return_types) {
+            add_type(return_type);
+        }
+        signature.push_back('!');
+        for (const auto &error_type : function->error_types) {
+            add_type(error_type);
+        }
+        signature.push_back(';');
+    };
+    const auto &public_symbols = file->file_namespace->public_symbols;
+    for (const auto &definition : public_symbols.definitions) {
+        const DefinitionNode::Variation variation = definition->get_variation();
+        if (variation == DefinitionNode::Variation::TEST) {
+            // Tests cannot be referred to from other files
+            continue;
+        }
+        signature.append(std::to_string(static_cast<int>(variation)) + "@" + std::to_string(definition->line) + ":" +
+            std::to_string(definition->column) + " ");
+        switch (variation) {
+            case DefinitionNode::Variation::DATA: {
+                const auto *node = definition->as<DataNode>();
+                signature.append(node->name).append(node->is_const ? " const" : "").append(node->is_shared ? " shared{" : "{");
+                for (const auto &field : node->fields) {
+                    signature.append(field.name).push_back(' ');
+                    add_type(field.type);
+                    if (field.initializer_tokens.has_value()) {
+                        // Default values are used by the initializers of other files
+                        for (auto it = field.initializer_tokens->first; it != field.initializer_tokens->second; ++it) {
+                            signature.append(it->lexme).push_back(' ');
+                        }
+                    }
+                }
+                break;
+            }
+            case DefinitionNode::Variation::ENUM: {
+                const auto *node = definition->as<EnumNode>();
+                signature.append(node->name).push_back('{');
+                for (const auto &[tag, value] : node->values) {
+                    signature.append(tag + "=" + std::to_string(value) + ",");
+                }
+                break;
+            }
+            case DefinitionNode::Variation::ERROR: {
+                const auto *node = definition->as<ErrorNode>();
+                signature.append(node->name + "(" + node->parent_error + "){");
+                for (size_t i = 0; i < node->values.size(); i++) {
+                    signature.append(node->values[i] + "=" + node->default_messages[i] + ",");
+                }
+                break;
+            }
+            case DefinitionNode::Variation::FUNC: {
+                const auto *node = definition->as<FuncNode>();
+                signature.append(node->name).push_back('{');
+                for (const auto &required : node->required_data) {
+                    signature.append(required.accessor_name).push_back(' ');
+                    add_type(required.type);
+                }
+                for (const FunctionNode *function : node->functions) {
+                    add_function(function);
+                }
+                break;
+            }
+            case DefinitionNode::Variation::FUNCTION:
+                add_function(definition->as<FunctionNode>());
+                break;
+            case DefinitionNode::Variation::INTERFACE: {
+                const auto *node = definition->as<InterfaceNode>();
+                signature.append(node->name).push_back('{');
+                for (const FunctionNode *function : node->functions) {
+                    add_function(function);
+                }
+                break;
+            }
+            case DefinitionNode::Variation::OBJECT: {
+                const auto *node = definition->as<ObjectNode>();
+                signature.append(node->name).push_back('{');
+                for (const auto &[data_node, accessor] : node->data_modules) {
+                    signature.append(data_node->name + " " + accessor.value_or("") + ",");
+                }
+                for (const FuncNode *func_node : node->func_components) {
+                    signature.append(func_node->name).push_back(',');
+                }
+                for (const FunctionNode *function : node->functions) {
+                    add_function(function);
+                }
+                break;
+            }
+            case DefinitionNode::Variation::VARIANT: {
+                const auto *node = definition->as<VariantNode>();
+                signature.append(node->name).push_back('{');
+                for (const auto &[tag, type] : node->possible_types) {
+                    signature.append(tag.value_or("")).push_back(' ');
+                    add_type(type);
+                }
+                break;
+            }
+            case DefinitionNode::Variation::IMPORT:
+            case DefinitionNode::Variation::TEST:
+                break;
+        }
+        signature.push_back('\n');
+    }
+    // The type map is unordered, so the aliases are sorted to get the same signature for the same aliases
+    std::vector<std::string> aliases;
+    for (const auto &[name, type] : public_symbols.types) {
+        if (type->get_variation() == Type::Variation::ALIAS) {
+            aliases.emplace_back(name + "=" + type->as<AliasType>()->type->to_string());
+        }
+    }
+    std::sort(aliases.begin(), aliases.end());
+    for (const std::string &alias : aliases) {
+        signature.append(alias).push_back('\n');
+    }
+    return std::hash<std::string>{}(signature);
+}
+
+bool LspServer::parse_workspace_files(              //
+    const std::string &root_path,                   //
+    const std::unordered_set<Hash> &file_hashes,    //
+    const std::optional<std::string> &root_content, //
+    const std::function<bool()> &was_cancelled      //
+) {
     const bool parse_parallel = false;
-    // Clear all internal state before parsing so that the internal state is valid after we are done with this function
-    Resolver::clear();
-    Parser::clear_instances();
-    Type::clear_types();
+    const Hash root_hash = Hash(std::filesystem::path(root_path));
+    const size_t first_instance = Parser::instances.size();
+    for (const Hash &file_hash : file_hashes) {
+        // The file could already have been parsed as an import of another file of this batch
+        const auto is_parsed = [&file_hash](const Parser &instance) {
+            return instance.file_node_ptr->file_namespace->namespace_hash == file_hash;
+        };
+        if (std::any_of(Parser::instances.begin() + first_instance, Parser::instances.end(), is_parsed)) {
+            continue;
+        }
+        std::optional<FileNode *> file;
+        if (root_content.has_value() && file_hash == root_hash) {
+            file = Parser::create(file_hash.path, root_content.value())->parse();
+        } else {
+            std::optional<Parser *> parser = Parser::create(file_hash.path);
+            if (!parser.has_value()) {
+                if (file_hash == root_hash) {
+                    std::cerr << RED << "Error" << DEFAULT << ": The file " << YELLOW << file_hash.path.relative_path().string() << DEFAULT
+                              << " does not exist" << std::endl;
+                    return false;
+                }
+                // Deleted files are not parsed again, the files importing them report the missing import instead
+                continue;
+            }
+            file = parser.value()->parse();
+        }
+        if (!file.has_value()) {
+            std::cerr << RED << "Error" << DEFAULT << ": Failed to parse file " << YELLOW << file_hash.path.filename().string() << DEFAULT
+                      << std::endl;
+            return false;
+        }
+        if (was_cancelled()) {
+            return false;
+        }
+        Resolver::create_dependency_graph(file.value(), parse_parallel);
+        if (was_cancelled()) {
+            return false;
+        }
+    }
+    if (!Parser::resolve_all_imports(first_instance)) {
+        THROW_BASIC_ERR(ERR_PARSING);
+        return false;
+    }
+    if (!Parser::resolve_all_unknown_types(first_instance)) {
+        THROW_BASIC_ERR(ERR_PARSING);
+        return false;
+    }
+    if (!Parser::parse_all_open_data_modules(parse_parallel) || !Parser::parse_all_open_objects(parse_parallel)) {
+        return false;
+    }
+    if (was_cancelled()) {
+        return false;
+    }
+    return Parser::parse_all_open_functions(parse_parallel, root_hash);
+}
+
+std::unordered_set<Hash> LspServer::store_workspace_files( //
+    const std::string &root_path,                          //
+    const std::optional<std::string> &root_content,        //
+    const size_t first_instance,                           //
+    const std::unordered_map<Hash, size_t> &old_signatures //
+) {
+    std::unordered_set<Hash> changed_signatures;
+    for (size_t i = first_instance; i < Parser::instances.size(); i++) {
+        const Parser &instance = Parser::instances[i];
+        index_parsed_file(instance);
+        const std::string path = instance.get_file_path().string();
+        std::error_code ec;
+        auto write_time = std::filesystem::last_write_time(path, ec);
+        if (ec || (root_content.has_value() && path == root_path)) {
+            // Files whose content did not come from disk always need their content compared
+            write_time = std::filesystem::file_time_type::min();
+        }
+        std::vector<Hash> imports;
+        for (const auto &import : instance.file_node_ptr->file_namespace->public_symbols.imports) {
+            if (std::holds_alternative<Hash>(import->path)) {
+                imports.emplace_back(std::get<Hash>(import->path));
+            }
+        }
+        const size_t content_hash = std::hash<std::string>{}(instance.get_source_code());
+        const size_t signature_hash = get_signature_hash(instance.file_node_ptr.get());
+        const Hash &file_hash = instance.file_node_ptr->file_namespace->namespace_hash;
+        const auto old_signature = old_signatures.find(file_hash);
+        if (old_signature == old_signatures.end() || old_signature->second != signature_hash) {
+            changed_signatures.emplace(file_hash);
+        }
+        workspace_files.insert_or_assign(path, WorkspaceFile{write_time, content_hash, signature_hash, file_hash, std::move(imports)});
+    }
+    return changed_signatures;
+}
+
+std::optional<FileNode *> LspServer::parse_program( //
+    const std::string &source_file_path,            //
+    const std::optional<std::string> &file_content, //
+    const std::function<bool()> &is_cancelled       //
+) {
+    // Opened documents are parsed from their in-memory content, which may differ from the file on disk
+    const std::optional<std::string> content = file_content.has_value() ? file_content : get_document_content(source_file_path);
+    const std::optional<std::unordered_set<Hash>> changed_files = get_changed_workspace_files(source_file_path, content);
+    if (changed_files.has_value() && changed_files.value().empty()) {
+        log_info("Reusing workspace of file path: " + source_file_path);
+        return workspace_file;
+    }
+    const Hash root_hash = Hash(std::filesystem::path(source_file_path));
+    const size_t workspace_size = workspace_files.size();
+    // The workspace is invalid until it is stored again, so that a failed or cancelled parse is never reused
+    workspace_root.clear();
+    workspace_file = nullptr;
     diagnostics.clear();
+    if (changed_files.has_value()) {
+        log_info("Parsing " + std::to_string(changed_files.value().size()) + " changed of " + std::to_string(workspace_size) +
+            " workspace files of file path: " + source_file_path);
+    } else {
+        log_info("Parsing file path: " + source_file_path);
+        // Clear all internal state before parsing so that the internal state is valid after we are done with this function
+        workspace_files.clear();
+        position_indices.clear();
+        retired_instances.clear();
+        Resolver::clear();
+        Parser::clear_instances();
+        Type::clear_types();
+        Type::init_types();
+    }
 
     Profiler::start_task("ALL");
-    Type::init_types();
     static bool core_modules_initialized = false;
     if (!core_modules_initialized) {
         Parser::init_core_modules();
         core_modules_initialized = true;
     }
+    const auto was_cancelled = [&]() {
+        if (!is_cancelled || !is_cancelled()) {
+            return false;
+        }
+        log_info("Cancelled parsing of file path: " + source_file_path);
+        return true;
+    };
     // Set the "main" file to the current source file being parsed
     main_file_path = source_file_path;
-    std::optional<FileNode *> file;
-    if (file_content.has_value()) {
-        file = Parser::create(file_path, file_content.value())->parse();
-    } else {
-        std::optional<Parser *> parser = Parser::create(file_path);
-        if (!parser.has_value()) {
-            std::cerr << RED << "Error" << DEFAULT << ": The file " << YELLOW << file_path.relative_path().string() << DEFAULT
-                      << " does not exist" << std::endl;
+    // First only the changed files are parsed again. The files depending on them refer to their nodes, but as long as the signature of a
+    // changed file stays the same these nodes are equivalent to the new ones. Only the dependents of files whose signature changed are
+    // parsed again in a second pass, every file is parsed at most once
+    std::unordered_set<Hash> next_files = changed_files.value_or(std::unordered_set<Hash>{root_hash});
+    std::unordered_set<Hash> parsed_files;
+    while (!next_files.empty()) {
+        std::unordered_map<Hash, size_t> old_signatures;
+        for (const auto &[path, workspace_file_state] : workspace_files) {
+            if (next_files.contains(workspace_file_state.file_hash)) {
+                old_signatures.emplace(workspace_file_state.file_hash, workspace_file_state.signature_hash);
+            }
+        }
+        remove_workspace_files(next_files);
+        const size_t first_instance = Parser::instances.size();
+        if (!parse_workspace_files(source_file_path, next_files, content, was_cancelled)) {
+            parser_cleanup();
             return std::nullopt;
         }
-        file = parser.value()->parse();
+        std::unordered_set<Hash> changed_signatures = store_workspace_files(source_file_path, content, first_instance, old_signatures);
+        // Files which could not be parsed again because they have been deleted changed their signature as well
+        for (const auto &[file_hash, old_signature] : old_signatures) {
+            const auto is_parsed = [&file_hash](const Parser &instance) {
+                return instance.file_node_ptr->file_namespace->namespace_hash == file_hash;
+            };
+            if (std::none_of(Parser::instances.begin() + first_instance, Parser::instances.end(), is_parsed)) {
+                changed_signatures.emplace(file_hash);
+            }
+        }
+        parsed_files.insert(next_files.begin(), next_files.end());
+        next_files.clear();
+        for (const Hash &dependent_hash : get_dependent_workspace_files(changed_signatures)) {
+            if (!parsed_files.contains(dependent_hash)) {
+                next_files.emplace(dependent_hash);
+            }
+        }
+        if (!next_files.empty()) {
+            log_info("Parsing " + std::to_string(next_files.size()) + " dependent workspace files of file path: " + source_file_path);
+        }
     }
-    if (!file.has_value()) {
-        std::cerr << RED << "Error" << DEFAULT << ": Failed to parse file " << YELLOW << file_path.filename().string() << DEFAULT
-                  << std::endl;
-        parser_cleanup();
-        return std::nullopt;
+    parser_cleanup();
+
+    const auto root_instance = std::find_if(Parser::instances.begin(), Parser::instances.end(), [&root_hash](const Parser &instance) {
+        return instance.file_node_ptr->file_namespace->namespace_hash == root_hash;
+    });
+    ASSERT(root_instance != Parser::instances.end());
+    workspace_root = source_file_path;
+    workspace_file = root_instance->file_node_ptr.get();
+    return workspace_file;
+}
+
+void LspServer::process_message(const JsonValue &message) {
+    // Basic JSON-RPC message handling
+    if (DEBUG_MODE) {
+        log_info("PROCESS_MESSAGE: '" + message.to_json() + "'\n");
     }
-    auto dep_graph = Resolver::create_dependency_graph(file.value(), parse_parallel);
-    if (!Parser::resolve_all_imports()) {
-        THROW_BASIC_ERR(ERR_PARSING);
-        return std::nullopt;
+    const auto start = std::chrono::steady_clock::now();
+    process_method(message);
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    log_info("[LATENCY] " + std::string(extract_method(message)) + " took " + std::to_string(duration.count() / 1000) + "." +
+        std::to_string(duration.count() % 1000 / 100) + " ms");
+}
+
+const LspServer::MethodHandler *LspServer::get_method_handler(const JsonValue &message) {
+    static const std::unordered_map<std::string_view, MethodHandler> method_handlers = {
+        {LspProtocol::METHOD_INITIALIZE, {handle_initialize, false}},
+        {LspProtocol::METHOD_INITIALIZED, {[](const JsonValue &) { log_info("LSP Server initialized"); }, false}},
+        {LspProtocol::METHOD_SHUTDOWN, {[](const JsonValue &msg) { send_shutdown_response(extract_request_id(msg)); }, false}},
+        {LspProtocol::METHOD_EXIT, {[](const JsonValue &) { exit(0); }, false}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_DID_OPEN, {handle_document_open, false}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_DID_CHANGE, {handle_document_change, false}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_DID_SAVE, {handle_document_save, false}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_DID_CLOSE, {handle_document_close, false}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_COMPLETION, {send_completion_response, true}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_DEFINITION, {send_definition_response, true}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_HOVER, {send_hover_response, true}},
+        {LspProtocol::METHOD_TEXT_DOCUMENT_REFERENCES, {send_references_response, true}},
+        {LspProtocol::METHOD_WORKSPACE_SYMBOL, {send_workspace_symbol_response, false}},
+    };
+    const auto it = method_handlers.find(extract_method(message));
+    return it == method_handlers.end() ? nullptr : &it->second;
+}
+
+void LspServer::process_method(const JsonValue &message) {
+    const MethodHandler *handler = get_method_handler(message);
+    if (handler == nullptr) {
+        return;
     }
-    if (!Parser::resolve_all_unknown_types()) {
-        THROW_BASIC_ERR(ERR_PARSING);
-        return std::nullopt;
+    if (handler->needs_workspace) {
+        std::lock_guard<std::mutex> lock(workspace_mutex);
+        handler->handle(message);
+    } else {
+        handler->handle(message);
     }
-    bool parsed_successful = Parser::parse_all_open_data_modules(parse_parallel);
-    if (!parsed_successful) {
-        parser_cleanup();
-        return std::nullopt;
+}
+
+void LspServer::handle_initialize(const JsonValue &message) {
+    send_initialize_response(extract_request_id(message));
+    const std::string root_path = extract_root_path(message);
+    if (root_path.empty()) {
+        return;
     }
-    parsed_successful = Parser::parse_all_open_objects(parse_parallel);
-    if (!parsed_successful) {
-        parser_cleanup();
-        return std::nullopt;
+    // Every workspace has its own persisted index, so the index only ever contains files of the opened workspace
+    std::filesystem::path root = std::filesystem::absolute(root_path).lexically_normal();
+    if (!root.has_filename()) {
+        root = root.parent_path();
     }
-    parsed_successful = Parser::parse_all_open_functions(parse_parallel, Hash(std::filesystem::path(source_file_path)));
-    if (!parsed_successful) {
-        parser_cleanup();
-        return std::nullopt;
+    const std::filesystem::path index_path = SymbolIndex::get_cache_file_path(root);
+    if (!index_path.empty() && SymbolIndex::load(index_path)) {
+        log_info("Loaded the symbol index from " + index_path.string());
     }
-
-    parser_cleanup();
-    return file.value();
-}
-
-void LspServer::process_message(const std::string &content) {
-    // Basic JSON-RPC message handling
-    if (DEBUG_MODE) {
-        log_info("PROCESS_MESSAGE: '" + content + "'\n");
-    }
-    if (contains_method(content, LspProtocol::METHOD_INITIALIZE)) {
-        std::string request_id = extract_request_id(content);
-        send_initialize_response(request_id);
-    } else if (contains_method(content, LspProtocol::METHOD_INITIALIZED)) {
-        log_info("LSP Server initialized");
-    } else if (contains_method(content, LspProtocol::METHOD_SHUTDOWN)) {
-        std::string request_id = extract_request_id(content);
-        send_shutdown_response(request_id);
-    } else if (contains_method(content, LspProtocol::METHOD_EXIT)) {
-        exit(0);
-    } else if (contains_method(content, LspProtocol::METHOD_TEXT_DOCUMENT_DID_OPEN)) {
-        handle_document_open(content);
-    } else if (contains_method(content, LspProtocol::METHOD_TEXT_DOCUMENT_DID_CHANGE)) {
-        handle_document_change(content);
-    } else if (contains_method(content, LspProtocol::METHOD_TEXT_DOCUMENT_DID_SAVE)) {
-        handle_document_save(content);
-    } else if (contains_method(content, LspProtocol::METHOD_TEXT_DOCUMENT_COMPLETION)) {
-        send_completion_response(content);
-    } else if (contains_method(content, LspProtocol::METHOD_TEXT_DOCUMENT_DEFINITION)) {
-        send_definition_response(content);
-    } else if (contains_method(content, LspProtocol::METHOD_TEXT_DOCUMENT_HOVER)) {
-        send_hover_response(content);
+    SymbolIndex::prune(root);
+    {
+        std::lock_guard<std::mutex> lock(analysis_mutex);
+        symbol_index_path = index_path;
     }
+    schedule_workspace_indexing(root_path);
 }
 
 void LspServer::send_initialize_response(const std::string &request_id) {
@@ -210,7 +913,7 @@ void LspServer::send_initialize_response(const std::string &request_id) {
     "capabilities": {
       "textDocumentSync": {
         "openClose": true,
-        "change": 1,
+        "change": 2,
         "save": {
           "includeText": false
         }
@@ -220,6 +923,8 @@ void LspServer::send_initialize_response(const std::string &request_id) {
       },
       "hoverProvider": true,
       "definitionProvider": true,
+      "referencesProvider": true,
+      "workspaceSymbolProvider": true,
       "documentSymbolProvider": true
     },
     "serverInfo": {
@@ -244,15 +949,15 @@ void LspServer::send_shutdown_response(const std::string &request_id) {
     send_lsp_response(response.str());
 }
 
-void LspServer::send_completion_response(const std::string &content) {
+void LspServer::send_completion_response(const JsonValue &message) {
     // DEBUG: Log the actual request content
-    log_info("Full completion request content (first 500 chars): " + content.substr(0, std::min(content.length(), size_t(500))));
+    LSP_TRACE("Full completion request content (first 500 chars): " + message.to_json().substr(0, 500));
 
     // Extract file context from the request
-    std::string request_id = extract_request_id(content);
-    std::string file_uri = extract_file_uri(content);
+    std::string request_id = extract_request_id(message);
+    std::string file_uri = extract_file_uri(message);
     std::string file_path = uri_to_file_path(file_uri);
-    auto position = extract_position(content);
+    auto position = extract_position(message);
 
     log_info("Completion request for file: " + file_path + " at line " + std::to_string(position.first) + ", char " +
         std::to_string(position.second));
@@ -282,15 +987,15 @@ void LspServer::send_completion_response(const std::string &content) {
     send_lsp_response(response.str());
 }
 
-void LspServer::send_definition_response(const std::string &content) {
-    const std::string request_id = extract_request_id(content);
-    const std::string file_uri = extract_file_uri(content);
+void LspServer::send_definition_response(const JsonValue &message) {
+    const std::string request_id = extract_request_id(message);
+    const std::string file_uri = extract_file_uri(message);
     const std::string file_path = uri_to_file_path(file_uri);
-    const auto position = extract_position(content);
+    const auto position = extract_position(message);
 
-    log_info("Definition request for file: " + file_path + " at line " + std::to_string(position.first) + ", char " +
+    LSP_TRACE("Definition request for file: " + file_path + " at line " + std::to_string(position.first) + ", char " +
         std::to_string(position.second));
-    log_info("Content of the definition request: " + content);
+    LSP_TRACE("Content of the definition request: " + message.to_json());
 
     // Find the definition
     const auto definition = find_definition_at_position(file_path, position.first, position.second);
@@ -349,7 +1054,7 @@ void LspServer::send_definition_response(const std::string &content) {
     }
 
     response << "\n}";
-    log_info("DEFINITION_RESPONSE_BEGIN" + response.str() + " |DEFINTION_RESPONSE_END");
+    LSP_TRACE("DEFINITION_RESPONSE_BEGIN" + response.str() + " |DEFINTION_RESPONSE_END");
     send_lsp_response(response.str());
 }
 
@@ -359,24 +1064,24 @@ std::optional<LspServer::DefinitionResult> LspServer::find_definition_at_positio
     int character                                                                  //
 ) {
     if (line == -1) {
-        log_info("DEFINITION: LINE -1");
+        LSP_TRACE("DEFINITION: LINE -1");
         return std::nullopt;
     }
     if (character == -1) {
-        log_info("DEFINITION: CHARACTER -1");
+        LSP_TRACE("DEFINITION: CHARACTER -1");
         return std::nullopt;
     }
-    log_info("DEFINITION: Begin");
+    LSP_TRACE("DEFINITION: Begin");
 
     // Parse the program to get the AST
     std::optional<FileNode *> file = parse_program(file_path, std::nullopt);
     if (!file.has_value()) {
         return std::nullopt;
     }
-    log_info("DEFINITION: After Parsing");
+    LSP_TRACE("DEFINITION: After Parsing");
 
     std::filesystem::path source_file_path(file_path);
-    log_info("[DEFINITION] file_name = " + source_file_path.filename().string());
+    LSP_TRACE("[DEFINITION] file_name = " + source_file_path.filename().string());
     const Parser *parser = Parser::get_instance_from_hash(Hash(source_file_path)).value();
     const Namespace *file_namespace = parser->file_node_ptr->file_namespace.get();
     const auto &lines = parser->get_source_code_lines();
@@ -385,10 +1090,10 @@ std::optional<LspServer::DefinitionResult> LspServer::find_definition_at_positio
     const unsigned int uline = static_cast<unsigned int>(line + 1);
     const unsigned int ucol = (line >= 0 && static_cast<size_t>(line) < lines.size()) ? vscode_char_to_column(lines[line].second, character)
                                                                                       : static_cast<unsigned int>(character);
-    log_info("[DEFINITION] find_node_at(" + std::to_string(uline) + ", " + std::to_string(ucol) + ")");
+    LSP_TRACE("[DEFINITION] find_node_at(" + std::to_string(uline) + ", " + std::to_string(ucol) + ")");
     auto node = find_node_at(file_namespace, uline, ucol);
     if (!node.has_value()) {
-        log_info("[DEFINITION] find_node_at returned nullopt");
+        LSP_TRACE("[DEFINITION] find_node_at returned nullopt");
         return std::nullopt;
     }
 
@@ -410,7 +1115,7 @@ std::optional<LspServer::DefinitionResult> LspServer::find_definition_at_positio
 
     auto &pos = node.value();
     if (const auto *var = std::get_if<LocalVariable>(&pos)) {
-        log_info("[DEFINITION] found variable: " + var->name);
+        LSP_TRACE("[DEFINITION] found variable: " + var->name);
         return DefinitionResult{
             var->file_hash,
             static_cast<int>(var->line - 1),
@@ -427,7 +1132,7 @@ std::optional<LspServer::DefinitionResult> LspServer::find_definition_at_positio
             source_end,
         };
     } else if (const auto *type = std::get_if<std::shared_ptr<Type>>(&pos)) {
-        log_info("[DEFINITION] found Type: " + (*type)->to_string());
+        LSP_TRACE("[DEFINITION] found Type: " + (*type)->to_string());
         auto loc = get_type_definition_location(*type);
         if (loc.has_value()) {
             return DefinitionResult{
@@ -440,7 +1145,7 @@ std::optional<LspServer::DefinitionResult> LspServer::find_definition_at_positio
         }
         return std::nullopt;
     } else if (const auto **fn = std::get_if<const FunctionNode *>(&pos)) {
-        log_info("[DEFINITION] found function: " + (*fn)->name);
+        LSP_TRACE("[DEFINITION] found function: " + (*fn)->name);
         return DefinitionResult{
             (*fn)->file_hash,
             static_cast<int>((*fn)->line - 1),
@@ -469,11 +1174,11 @@ void LspServer::publish_diagnostics(const std::string &file_uri) {
     log_info("Published " + std::to_string(diagnostics.size()) + " diagnostics for " + file_uri);
 }
 
-void LspServer::send_hover_response(const std::string &content) {
-    const std::string file_uri = extract_file_uri(content);
+void LspServer::send_hover_response(const JsonValue &message) {
+    const std::string file_uri = extract_file_uri(message);
     const std::string file_path = uri_to_file_path(file_uri);
-    const auto position = extract_position(content);
-    const std::string request_id = extract_request_id(content);
+    const auto position = extract_position(message);
+    const std::string request_id = extract_request_id(message);
 
     const auto send_null = [&]() {
         std::stringstream response;
@@ -491,7 +1196,7 @@ void LspServer::send_hover_response(const std::string &content) {
         return;
     }
 
-    log_info("Hover request for file: " + file_path + " at line " + std::to_string(position.first) + ", char " +
+    LSP_TRACE("Hover request for file: " + file_path + " at line " + std::to_string(position.first) + ", char " +
         std::to_string(position.second));
 
     std::optional<FileNode *> file = parse_program(file_path, std::nullopt);
@@ -522,10 +1227,10 @@ void LspServer::send_hover_response(const std::string &content) {
     const unsigned int uline = static_cast<unsigned int>(line + 1);
     const unsigned int ucol = (line >= 0 && static_cast<size_t>(line) < lines.size()) ? vscode_char_to_column(lines[line].second, character)
                                                                                       : static_cast<unsigned int>(character);
-    log_info("[HOVER] find_node_at(" + std::to_string(uline) + ", " + std::to_string(ucol) + ")");
+    LSP_TRACE("[HOVER] find_node_at(" + std::to_string(uline) + ", " + std::to_string(ucol) + ")");
     auto hover_node = find_node_at(file_namespace, uline, ucol);
     if (!hover_node.has_value()) {
-        log_info("[HOVER] find_node_at returned nullopt");
+        LSP_TRACE("[HOVER] find_node_at returned nullopt");
         send_null();
         return;
     }
@@ -533,22 +1238,22 @@ void LspServer::send_hover_response(const std::string &content) {
     std::string hover_value;
     auto &pos = hover_node.value();
     if (const auto *var = std::get_if<LocalVariable>(&pos)) {
-        log_info("[HOVER] found variable: " + var->name);
+        LSP_TRACE("[HOVER] found variable: " + var->name);
         if (var->type) {
             std::stringstream ss;
             ss << "**variable** **`" << var->name << "`**\n" << build_type_hover_info(var->type);
             hover_value = ss.str();
         }
     } else if (const auto *imported_file = std::get_if<ImportedFile>(&pos)) {
-        log_info("[HOVER] found file import: " + imported_file->file_hash.to_string());
+        LSP_TRACE("[HOVER] found file import: " + imported_file->file_hash.to_string());
     } else if (const auto *type = std::get_if<std::shared_ptr<Type>>(&pos)) {
-        log_info("[HOVER] found Type: " + (*type)->to_string());
+        LSP_TRACE("[HOVER] found Type: " + (*type)->to_string());
         hover_value = build_type_hover_info(*type);
     } else if (const auto *fn = std::get_if<const FunctionNode *>(&pos)) {
-        log_info("[HOVER] found function: " + (*fn)->name);
+        LSP_TRACE("[HOVER] found function: " + (*fn)->name);
         hover_value = build_function_hover_info(*fn);
     } else {
-        log_info("[HOVER] unknown node type in variant");
+        LSP_TRACE("[HOVER] unknown node type in variant");
     }
 
     // Build and send response
@@ -558,7 +1263,7 @@ void LspServer::send_hover_response(const std::string &content) {
   "id": )" << request_id;
 
     if (!hover_value.empty()) {
-        log_info("[HOVER] sending hover_value: " + hover_value);
+        LSP_TRACE("[HOVER] sending hover_value: " + hover_value);
         response << R"(,
   "result": {
     "contents": {
@@ -569,7 +1274,7 @@ void LspServer::send_hover_response(const std::string &content) {
   }
 })";
     } else {
-        log_info("[HOVER] hover_value empty, sending null");
+        LSP_TRACE("[HOVER] hover_value empty, sending null");
         response << R"(,
   "result": null
 })";
@@ -578,202 +1283,214 @@ void LspServer::send_hover_response(const std::string &content) {
     send_lsp_response(response.str());
 }
 
-void LspServer::handle_document_open(const std::string &content) {
-    std::string file_uri = extract_file_uri(content);
+void LspServer::send_references_response(const JsonValue &message) {
+    const std::string request_id = extract_request_id(message);
+    const std::string file_path = uri_to_file_path(extract_file_uri(message));
+    const auto [line, character] = extract_position(message);
+
+    // The referenced symbol is the identifier or type under the cursor
+    std::optional<std::string> key;
+    if (line >= 0 && character >= 0 && parse_program(file_path, std::nullopt).has_value()) {
+        const std::optional<const Parser *> parser = Parser::get_instance_from_hash(Hash(std::filesystem::path(file_path)));
+        if (parser.has_value()) {
+            const auto &lines = parser.value()->get_source_code_lines();
+            const unsigned int uline = static_cast<unsigned int>(line + 1);
+            const unsigned int ucol = static_cast<size_t>(line) < lines.size() ? vscode_char_to_column(lines[line].second, character)
+                                                                               : static_cast<unsigned int>(character);
+            const Namespace *file_namespace = parser.value()->file_node_ptr->file_namespace.get();
+            const auto tok = get_token_at_pos(file_namespace, uline, ucol);
+            if (tok.has_value()) {
+                key = get_reference_key(file_namespace, tok.value());
+            }
+        }
+    }
+
+    std::stringstream response;
+    response << R"({
+  "jsonrpc": "2.0",
+  "id": )" << request_id
+             << R"(,
+  "result": [)";
+    if (key.has_value()) {
+        bool is_first = true;
+        for (const auto &[path, location] : SymbolIndex::find_references(key.value())) {
+            response << (is_first ? "\n" : ",\n") << "    " << location_to_json(path, location);
+            is_first = false;
+        }
+        log_info("[REFERENCES] found references to '" + key.value() + "'");
+    }
+    response << R"(
+  ]
+})";
+    send_lsp_response(response.str());
+}
+
+void LspServer::send_workspace_symbol_response(const JsonValue &message) {
+    const std::string request_id = extract_request_id(message);
+    const std::string query(message["params"]["query"].get_string().value_or(""));
+
+    std::stringstream response;
+    response << R"({
+  "jsonrpc": "2.0",
+  "id": )" << request_id
+             << R"(,
+  "result": [)";
+    bool is_first = true;
+    for (const auto &[path, symbol] : SymbolIndex::find_symbols(query)) {
+        response << (is_first ? "\n" : ",\n") << R"(    {"name": ")" << json_escape(symbol.name) << R"(", "kind": )"
+                 << static_cast<int>(symbol.kind) << R"(, "location": )" << location_to_json(path, symbol.location) << "}";
+        is_first = false;
+    }
+    response << R"(
+  ]
+})";
+    send_lsp_response(response.str());
+}
+
+std::string LspServer::location_to_json(const std::string &file_path, const SymbolIndex::Location &location) {
+    std::stringstream json;
+    json << R"({"uri": "file://)" << json_escape(file_path) << R"(", "range": {"start": {"line": )" << location.line
+         << R"(, "character": )" << location.character << R"(}, "end": {"line": )" << location.line << R"(, "character": )"
+         << location.end_character << "}}}";
+    return json.str();
+}
+
+std::string LspServer::extract_root_path(const JsonValue &message) {
+    // The root URI is null if no folder is opened
+    const std::optional<std::string_view> root_uri = message["params"]["rootUri"].get_string();
+    if (!root_uri.has_value()) {
+        return "";
+    }
+    return uri_to_file_path(std::string(root_uri.value()));
+}
+
+void LspServer::handle_document_open(const JsonValue &message) {
+    std::string file_uri = extract_file_uri(message);
     std::string file_path = uri_to_file_path(file_uri);
 
-    if (content.find(LspProtocol::FLINT_EXTENSION) != std::string::npos) {
+    if (is_flint_file(file_path)) {
         log_info("Flint document (.ft) opened");
 
-        // Parse the file and publish diagnostics
-        LspServer::parse_program(file_path, std::nullopt);
-        publish_diagnostics(file_uri);
+        std::optional<std::string> text = extract_document_text(message);
+        if (text.has_value()) {
+            std::lock_guard<std::mutex> lock(documents_mutex);
+            documents.insert_or_assign(file_path, TextDocument(text.value()));
+        }
+        // Parse the file and publish diagnostics in the background
+        schedule_analysis(file_uri);
     } else {
         log_info("Document opened");
     }
 }
 
-void LspServer::handle_document_change(const std::string &content) {
-    std::string file_uri = extract_file_uri(content);
+void LspServer::handle_document_change(const JsonValue &message) {
+    std::string file_uri = extract_file_uri(message);
     std::string file_path = uri_to_file_path(file_uri);
 
-    if (content.find(LspProtocol::FLINT_EXTENSION) != std::string::npos) {
+    if (is_flint_file(file_path)) {
         log_info("Flint document (.ft) changed");
-        // TODO: The parser crashes way too often on invalid input while typing, the change event stuff will only be re-activated when the
-        // parser has been made much more robust
-        return;
-
-        // Parse the file and publish diagnostics
-        // std::string file_content = extract_file_content_from_change(content);
-        // LspServer::parse_program(file_path, file_content);
-        // publish_diagnostics(file_uri);
+        const std::vector<ContentChange> changes = extract_content_changes(message);
+        {
+            std::lock_guard<std::mutex> lock(documents_mutex);
+            auto document = documents.find(file_path);
+            for (const ContentChange &change : changes) {
+                if (document == documents.end()) {
+                    // Range edits of a document which was never opened cannot be applied
+                    if (change.range.has_value()) {
+                        log_info("Ignoring change of unknown document: " + file_uri);
+                        return;
+                    }
+                    document = documents.emplace(file_path, TextDocument(change.text)).first;
+                } else if (change.range.has_value()) {
+                    document->second.apply_change(change.range->first, change.range->second, change.text);
+                } else {
+                    document->second.set_text(change.text);
+                }
+            }
+        }
+        // Parse the file and publish diagnostics in the background once the user stopped typing
+        schedule_analysis(file_uri);
     } else {
         log_info("Document changed");
     }
 }
 
-void LspServer::handle_document_save(const std::string &content) {
-    std::string file_uri = extract_file_uri(content);
-    std::string file_path = uri_to_file_path(file_uri);
+void LspServer::handle_document_save(const JsonValue &message) {
+    std::string file_uri = extract_file_uri(message);
 
-    if (content.find(LspProtocol::FLINT_EXTENSION) != std::string::npos) {
+    if (is_flint_file(uri_to_file_path(file_uri))) {
         log_info("Flint document (.ft) saved");
 
-        // Parse the file and publish diagnostics
-        parse_program(file_path, std::nullopt);
-        publish_diagnostics(file_uri);
+        // Parse the file and publish diagnostics in the background
+        schedule_analysis(file_uri);
     } else {
         log_info("Document saved");
     }
 }
 
+void LspServer::handle_document_close(const JsonValue &message) {
+    std::string file_uri = extract_file_uri(message);
+    std::string file_path = uri_to_file_path(file_uri);
+
+    std::lock_guard<std::mutex> lock(documents_mutex);
+    documents.erase(file_path);
+    log_info("Document closed");
+}
+
 void LspServer::log_info(const std::string &message) {
     std::cerr << "[INFO] " << message << std::endl;
 }
 
-std::string LspServer::extract_file_uri(const std::string &content) {
-    // Look for "textDocument":{"uri":"file://..."
-    size_t uri_start = content.find("\"uri\":\"");
-    if (uri_start != std::string::npos) {
-        uri_start += 7; // Skip past "uri":"
-        size_t uri_end = content.find("\"", uri_start);
-        if (uri_end != std::string::npos) {
-            return content.substr(uri_start, uri_end - uri_start);
-        }
-    }
-    return "";
+std::string LspServer::extract_file_uri(const JsonValue &message) {
+    return std::string(message["params"]["textDocument"]["uri"].get_string().value_or(""));
 }
 
-std::string LspServer::extract_file_content_from_change(const std::string &content) {
-    // Look for "contentChanges":[{"text":"..."}]
-    size_t changes_start = content.find("\"contentChanges\":");
-    if (changes_start == std::string::npos) {
-        return "";
-    }
-
-    // Find the first "text" field in the changes array
-    size_t text_start = content.find("\"text\":\"", changes_start);
-    if (text_start == std::string::npos) {
-        return "";
-    }
-
-    text_start += 8; // Skip past "text":"
-
-    // Find the closing quote, handling escaped quotes
-    size_t text_end = text_start;
-    while (text_end < content.length()) {
-        if (content[text_end] == '"' && (text_end == text_start || content[text_end - 1] != '\\')) {
-            break;
-        }
-        text_end++;
-    }
-
-    if (text_end >= content.length()) {
-        return "";
+std::optional<std::string> LspServer::extract_document_text(const JsonValue &message) {
+    const std::optional<std::string_view> text = message["params"]["textDocument"]["text"].get_string();
+    if (!text.has_value()) {
+        return std::nullopt;
     }
+    return std::string(text.value());
+}
 
-    std::string raw_content = content.substr(text_start, text_end - text_start);
-
-    // Unescape JSON string
-    return unescape_json_string(raw_content);
+/// @function `read_json_position`
+/// @brief Reads a LSP position object of the form `{"line": 0, "character": 0}`
+///
+/// @param `position` The parsed position object
+/// @return `TextDocument::Position` The read position, missing fields are 0
+static TextDocument::Position read_json_position(const JsonValue &position) {
+    return TextDocument::Position{
+        static_cast<unsigned int>(std::max<int64_t>(0, position["line"].get_int().value_or(0))),
+        static_cast<unsigned int>(std::max<int64_t>(0, position["character"].get_int().value_or(0))),
+    };
 }
 
-// Helper function to unescape JSON strings
-std::string LspServer::unescape_json_string(const std::string &escaped) {
-    std::string result;
-    result.reserve(escaped.length());
-
-    for (size_t i = 0; i < escaped.length(); ++i) {
-        if (escaped[i] == '\\' && i + 1 < escaped.length()) {
-            switch (escaped[i + 1]) {
-                case 'n':
-                    result += '\n';
-                    i++;
-                    break;
-                case 't':
-                    result += '\t';
-                    i++;
-                    break;
-                case 'r':
-                    result += '\r';
-                    i++;
-                    break;
-                case '"':
-                    result += '"';
-                    i++;
-                    break;
-                case '\\':
-                    result += '\\';
-                    i++;
-                    break;
-                default:
-                    result += escaped[i];
-                    break;
-            }
-        } else {
-            result += escaped[i];
-        }
+std::vector<LspServer::ContentChange> LspServer::extract_content_changes(const JsonValue &message) {
+    // The changes are of the form "contentChanges":[{"range":{...},"text":"..."}, ...]
+    const JsonValue::Array &content_changes = message["params"]["contentChanges"].get_array();
+    std::vector<ContentChange> changes;
+    changes.reserve(content_changes.size());
+    for (const JsonValue &content_change : content_changes) {
+        ContentChange change;
+        change.text = std::string(content_change["text"].get_string().value_or(""));
+        const JsonValue &range = content_change["range"];
+        if (!range.is_null()) {
+            change.range = std::make_pair(read_json_position(range["start"]), read_json_position(range["end"]));
+        }
+        changes.emplace_back(std::move(change));
     }
-
-    return result;
+    return changes;
 }
 
-std::pair<int, int> LspServer::extract_position(const std::string &content) {
-    size_t pos_start = content.find("\"position\":");
-    if (pos_start == std::string::npos) {
+std::pair<int, int> LspServer::extract_position(const JsonValue &message) {
+    const JsonValue &position = message["params"]["position"];
+    const std::optional<int64_t> line = position["line"].get_int();
+    const std::optional<int64_t> character = position["character"].get_int();
+    if (!line.has_value() || !character.has_value()) {
         log_info("extract_position: NOPOS");
         return {-1, -1};
     }
-
-    // Find the opening brace after "position":
-    size_t brace_start = content.find("{", pos_start);
-    if (brace_start == std::string::npos) {
-        log_info("extract_position: NOOPEN");
-        return {-1, -1};
-    }
-
-    // Extract character
-    size_t char_pos = content.find("\"character\":", brace_start);
-    if (char_pos == std::string::npos) {
-        log_info("extract_position: NOCHAR");
-        return {-1, -1};
-    }
-    char_pos += 12; // Skip "character":
-
-    size_t first_end = content.find_first_of(",", brace_start);
-    if (first_end == std::string::npos) {
-        log_info("extract_position: NOCOMMA");
-        return {-1, -1};
-    }
-
-    // Extract line
-    size_t line_pos = content.find("\"line\":", brace_start);
-    if (line_pos == std::string::npos) {
-        log_info("extract_position: NOLINE");
-        return {-1, -1};
-    }
-    line_pos += 7; // Skip "line":
-
-    size_t second_end = content.find_first_of(",}", brace_start);
-    if (second_end == std::string::npos) {
-        log_info("extract_position: NOCLOSE");
-        return {-1, -1};
-    }
-
-    try {
-        if (char_pos < line_pos) {
-            int line = std::stoi(content.substr(line_pos, second_end - line_pos));
-            int character = std::stoi(content.substr(char_pos, first_end - char_pos));
-            return {line, character};
-        } else {
-            int line = std::stoi(content.substr(line_pos, first_end - line_pos));
-            int character = std::stoi(content.substr(char_pos, second_end - char_pos));
-            return {line, character};
-        }
-    } catch (const std::exception &e) {
-        log_info("extract_position: EXCEPTION(" + std::string(e.what()) + ")");
-        return {-1, -1};
-    }
+    return {static_cast<int>(line.value()), static_cast<int>(character.value())};
 }
 
 static std::string url_decode(const std::string &s) {
@@ -823,22 +1540,20 @@ std::string LspServer::uri_to_file_path(const std::string &uri) {
     return decoded;
 }
 
+PositionIndex &LspServer::get_position_index(const Namespace *ns) {
+    auto it = position_indices.find(ns);
+    if (it == position_indices.end()) {
+        it = position_indices.emplace(ns, PositionIndex(ns)).first;
+    }
+    return it->second;
+}
+
 std::optional<TokenContext> LspServer::get_token_at_pos(const Namespace *ns, unsigned int line, unsigned int col) {
-    for (const auto &tok : ns->file_node->tokens) {
-        if (tok.line != line) {
-            continue;
-        }
-        if (col < tok.column) {
-            continue;
-        }
-        if (tok.token == TOK_TYPE && col < tok.column + tok.type->to_string().size()) {
-            return tok;
-        }
-        if (col < tok.column + tok.lexme.size()) {
-            return tok;
-        }
+    const TokenContext *tok = get_position_index(ns).get_token_at(line, col);
+    if (tok == nullptr) {
+        return std::nullopt;
     }
-    return std::nullopt;
+    return *tok;
 }
 
 /// @brief Recursively finds what's at (line, col) in an expression tree — a variable, a type, or a function.
@@ -851,7 +1566,7 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_expr( //
     if (!expr->contains_pos(line, col)) {
         return std::nullopt;
     }
-    LspServer::log_info("[TRAVERSAL] expr_variation=" + std::to_string(static_cast<int>(expr->get_variation())));
+    LSP_TRACE("[TRAVERSAL] expr_variation=" + std::to_string(static_cast<int>(expr->get_variation())));
     switch (expr->get_variation()) {
         case ExpressionNode::Variation::ARRAY_ACCESS: {
             const auto *node = expr->as<ArrayAccessNode>();
@@ -1055,11 +1770,11 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_expr( //
                     continue;
                 }
                 const auto &elem_expr = std::get<std::unique_ptr<ExpressionNode>>(elem);
-                LspServer::log_info("[TRAVERSE]   String Interpolation contains Expr, line= " + std::to_string(elem_expr->line) +
+                LSP_TRACE("[TRAVERSE]   String Interpolation contains Expr, line= " + std::to_string(elem_expr->line) +
                     ", col=" + std::to_string(elem_expr->column) + ", length=" + std::to_string(elem_expr->length) +
                     ", end_line=" + std::to_string(elem_expr->end_line));
                 const bool contains = elem_expr->contains_pos(line, col);
-                LspServer::log_info("[TRAVERSE]    Contains=" + std::to_string(contains) + ", line=" + std::to_string(line) +
+                LSP_TRACE("[TRAVERSE]    Contains=" + std::to_string(contains) + ", line=" + std::to_string(line) +
                     ", col=" + std::to_string(col));
                 if (contains) {
                     return find_node_in_expr(elem_expr.get(), scope, line, col);
@@ -1091,7 +1806,7 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_expr( //
         }
         case ExpressionNode::Variation::TYPE_CAST: {
             const auto *node = expr->as<TypeCastNode>();
-            LspServer::log_info("[TRAVERSAL]    TypeCast to " + node->type->to_string());
+            LSP_TRACE("[TRAVERSAL]    TypeCast to " + node->type->to_string());
             if (node->expr->contains_pos(line, col)) {
                 return find_node_in_expr(node->expr.get(), scope, line, col);
             }
@@ -1110,7 +1825,7 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_expr( //
         }
         case ExpressionNode::Variation::VARIABLE: {
             const auto *node = expr->as<VariableNode>();
-            LspServer::log_info("[TRAVERSAL]     Variable: " + node->name);
+            LSP_TRACE("[TRAVERSAL]     Variable: " + node->name);
             if (scope->variables.find(node->name) == scope->variables.end()) {
                 return std::nullopt;
             }
@@ -1419,15 +2134,11 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_scope( //
     const unsigned int line,                                          //
     const unsigned int col                                            //
 ) {
-    for (const auto &stmt : scope->body) {
-        const bool contains_pos = stmt->contains_pos(line, col);
-        LspServer::log_info("[TRAVERSE]   stmt var=" + std::to_string(static_cast<int>(stmt->get_variation())) +
+    for (const StatementNode *stmt : get_position_index(ns).get_statements_at(scope, line, col)) {
+        LSP_TRACE("[TRAVERSE]   stmt var=" + std::to_string(static_cast<int>(stmt->get_variation())) +
             " line=" + std::to_string(stmt->line) + " end_line=" + std::to_string(stmt->end_line) + " col=" + std::to_string(stmt->column) +
-            " len=" + std::to_string(stmt->length) + " contains_line=" + (contains_pos ? "yes" : "no"));
-        if (!contains_pos) {
-            continue;
-        }
-        const auto &pos = find_node_in_stmt(ns, stmt.get(), scope, line, col);
+            " len=" + std::to_string(stmt->length));
+        const auto &pos = find_node_in_stmt(ns, stmt, scope, line, col);
         if (pos.has_value()) {
             return pos;
         }
@@ -1476,7 +2187,7 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_def( //
         }
         case DefinitionNode::Variation::FUNCTION: {
             const auto *node = def->as<FunctionNode>();
-            LspServer::log_info(
+            LSP_TRACE(
                 std::string("[TRAVERSE]   -> recursing into fn body, has_scope=") + (node->scope.has_value() ? "yes" : "no"));
             const bool on_signature = line == def->line && col >= def->column && col < def->column + def->length;
             if (on_signature) {
@@ -1507,7 +2218,7 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_def( //
         }
         case DefinitionNode::Variation::TEST: {
             const auto *node = def->as<TestNode>();
-            LspServer::log_info(std::string("[TRAVERSE]   -> recursing into test body"));
+            LSP_TRACE(std::string("[TRAVERSE]   -> recursing into test body"));
             return find_node_in_scope(ns, node->scope.get(), line, col);
         }
         case DefinitionNode::Variation::VARIANT: {
@@ -1519,33 +2230,15 @@ std::optional<LspServer::PositionInfo> LspServer::find_node_in_def( //
 }
 
 std::optional<LspServer::PositionInfo> LspServer::find_node_at(const Namespace *ns, unsigned int line, unsigned int col) {
-    LspServer::log_info("[TRAVERSE] find_node_at(" + std::to_string(line) + ", " + std::to_string(col) + "), " +
+    LSP_TRACE("[TRAVERSE] find_node_at(" + std::to_string(line) + ", " + std::to_string(col) + "), " +
         std::to_string(ns->public_symbols.definitions.size()) + " definitions");
 
-    for (const auto &def : ns->public_symbols.definitions) {
-        const bool contains_pos = def->contains_pos(line, col);
-        LspServer::log_info("[TRAVERSE]   def var=" + std::to_string(static_cast<int>(def->get_variation())) + " name='" +
+    for (const DefinitionNode *def : get_position_index(ns).get_definitions_at(line, col)) {
+        LSP_TRACE("[TRAVERSE]   def var=" + std::to_string(static_cast<int>(def->get_variation())) + " name='" +
             (def->get_variation() == DefinitionNode::Variation::FUNCTION ? def->as<FunctionNode>()->name : "?") +
             "' line=" + std::to_string(def->line) + " end_line=" + std::to_string(def->end_line) + " col=" + std::to_string(def->column) +
-            " len=" + std::to_string(def->length) + " contains_pos=" + (contains_pos ? "yes" : "no"));
-        if (!contains_pos) {
-            continue;
-        }
-        const auto &pos = find_node_in_def(ns, def.get(), line, col);
-        if (pos.has_value()) {
-            return pos;
-        }
-    }
-    for (const auto &import : ns->public_symbols.imports) {
-        const bool contains_pos = import->contains_pos(line, col);
-        LspServer::log_info("[TRAVERSE]   def var=" + std::to_string(static_cast<int>(import->get_variation())) + " name='" +
-            (import->get_variation() == DefinitionNode::Variation::FUNCTION ? import->as<FunctionNode>()->name : "?") + "' line=" +
-            std::to_string(import->line) + " end_line=" + std::to_string(import->end_line) + " col=" + std::to_string(import->column) +
-            " len=" + std::to_string(import->length) + " contains_pos=" + (contains_pos ? "yes" : "no"));
-        if (!contains_pos) {
-            continue;
-        }
-        const auto &pos = find_node_in_def(ns, import.get(), line, col);
+            " len=" + std::to_string(def->length));
+        const auto &pos = find_node_in_def(ns, def, line, col);
         if (pos.has_value()) {
             return pos;
         }
@@ -1609,7 +2302,7 @@ std::optional<std::tuple<Hash, int, int>> LspServer::get_type_definition_locatio
             return std::nullopt;
         }
         default:
-            LspServer::log_info("TODO: Definition");
+            LSP_TRACE("TODO: Definition");
             return std::nullopt;
     }
 }
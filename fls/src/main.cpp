@@ -39,6 +39,11 @@ void print_version() {
 }
 
 int main(int argc, char *argv[]) {
+    // Responses are flushed explicitly, so stdin and stdout neither need to be synced with stdio nor tied to each other. Unsyncing is only
+    // well-defined before any I/O happened, so it has to be the very first thing, before any stream is used or any thread is started
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
     if (argc > 1) {
         std::string arg = argv[1];
         if (arg == "--help" || arg == "-h") {
@@ -0,0 +1,96 @@
+#include "position_index.hpp"
+
+/// @function `collect_definitions`
+/// @brief Collects all top-level definitions and imports of the given namespace
+///
+/// @param `ns` The namespace to collect the definitions from
+/// @return `std::vector<const DefinitionNode *>` All definitions and imports of the namespace
+static std::vector<const DefinitionNode *> collect_definitions(const Namespace *ns) {
+    std::vector<const DefinitionNode *> result;
+    result.reserve(ns->public_symbols.definitions.size() + ns->public_symbols.imports.size());
+    for (const auto &def : ns->public_symbols.definitions) {
+        result.emplace_back(def.get());
+    }
+    for (const auto &import : ns->public_symbols.imports) {
+        result.emplace_back(import.get());
+    }
+    return result;
+}
+
+/// @function `get_alias_width`
+/// @brief Returns the width of the source text an alias token was collapsed from
+///
+/// @param `ns` The namespace of the file the alias token is part of
+/// @param `alias` The alias token
+/// @param `end` The end of the token list of the file
+/// @return `unsigned int` The width of the alias in the source
+static unsigned int get_alias_width(const Namespace *ns, const token_list::const_iterator alias, const token_list::const_iterator end) {
+    // An alias chain like `a.b` is collapsed into a single alias token which keeps no text of its own, but it is always directly
+    // followed by the `.` of the accessed symbol, so the alias spans up to the next token
+    const auto next = std::next(alias);
+    if (next != end && next->line == alias->line && next->column > alias->column) {
+        return next->column - alias->column;
+    }
+    for (const auto &[name, aliased_namespace] : ns->public_symbols.aliased_imports) {
+        if (aliased_namespace == alias->alias_namespace) {
+            return static_cast<unsigned int>(name.size());
+        }
+    }
+    return 0;
+}
+
+PositionIndex::PositionIndex(const Namespace *ns) :
+    definitions(collect_definitions(ns)) {
+    const token_list &file_tokens = ns->file_node->tokens;
+    tokens.reserve(file_tokens.size());
+    for (auto it = file_tokens.begin(); it != file_tokens.end(); ++it) {
+        const TokenContext &tok = *it;
+        unsigned int width = 0;
+        if (tok.token == TOK_TYPE) {
+            // The width of a type token is only known through its type
+            width = static_cast<unsigned int>(tok.type->to_string().size());
+        } else if (tok.token == TOK_ALIAS) {
+            width = get_alias_width(ns, it, file_tokens.end());
+        } else {
+            width = static_cast<unsigned int>(tok.lexme.size());
+        }
+        tokens.emplace_back(TokenEntry{tok.line, tok.column, tok.column + width, &tok});
+    }
+    std::stable_sort(tokens.begin(), tokens.end(), [](const TokenEntry &lhs, const TokenEntry &rhs) {
+        return lhs.line < rhs.line || (lhs.line == rhs.line && lhs.column < rhs.column);
+    });
+}
+
+const TokenContext *PositionIndex::get_token_at(unsigned int line, unsigned int col) const {
+    auto it = std::upper_bound(tokens.begin(), tokens.end(), std::make_pair(line, col), [](const auto &pos, const TokenEntry &entry) {
+        return pos.first < entry.line || (pos.first == entry.line && pos.second < entry.column);
+    });
+    // Walk back over all tokens of the line starting before the position, the closest one is almost always the match
+    while (it != tokens.begin()) {
+        --it;
+        if (it->line != line) {
+            break;
+        }
+        if (col < it->end_column) {
+            return it->token;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<const DefinitionNode *> PositionIndex::get_definitions_at(unsigned int line, unsigned int col) const {
+    return definitions.get_nodes_at(line, col);
+}
+
+std::vector<const StatementNode *> PositionIndex::get_statements_at(const Scope *scope, unsigned int line, unsigned int col) {
+    auto it = scope_statements.find(scope);
+    if (it == scope_statements.end()) {
+        std::vector<const StatementNode *> statements;
+        statements.reserve(scope->body.size());
+        for (const auto &stmt : scope->body) {
+            statements.emplace_back(stmt.get());
+        }
+        it = scope_statements.emplace(scope, IntervalList<StatementNode>(std::move(statements))).first;
+    }
+    return it->second.get_nodes_at(line, col);
+}
@@ -0,0 +1,256 @@
+#include "symbol_index.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+
+uint64_t SymbolIndex::hash_content(std::string_view content) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char c : content) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/// @function `to_hex`
+/// @brief Formats the given value as a hexadecimal string
+///
+/// @param `value` The value to format
+/// @return `std::string` The hexadecimal string
+static std::string to_hex(uint64_t value) {
+    std::stringstream hex;
+    hex << std::hex << value;
+    return hex.str();
+}
+
+/// @function `prune_cache_directory`
+/// @brief Deletes all persisted indices (and left-over temporary files) from the cache directory which have not been written to or
+/// loaded from for `SymbolIndex::MAX_CACHE_AGE`
+///
+/// @param `cache_path` The path to the cache directory
+static void prune_cache_directory(const std::filesystem::path &cache_path) {
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::error_code ec;
+    auto it = std::filesystem::directory_iterator(cache_path, ec);
+    for (; !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file() || !it->path().filename().string().starts_with("symbol_index")) {
+            continue;
+        }
+        std::error_code time_ec;
+        const auto last_write_time = it->last_write_time(time_ec);
+        if (!time_ec && now - last_write_time > SymbolIndex::MAX_CACHE_AGE) {
+            std::filesystem::remove(it->path(), time_ec);
+        }
+    }
+}
+
+std::filesystem::path SymbolIndex::get_cache_file_path(const std::filesystem::path &workspace_root) {
+#ifdef __WIN32__
+    const char *local_appdata = std::getenv("LOCALAPPDATA");
+    if (local_appdata == nullptr) {
+        return std::filesystem::path();
+    }
+    const std::filesystem::path cache_path = std::filesystem::path(local_appdata) / "Flint" / "Cache" / "fls";
+#else
+    const char *home = std::getenv("HOME");
+    if (home == nullptr) {
+        return std::filesystem::path();
+    }
+    const std::filesystem::path cache_path = std::filesystem::path(home) / ".cache" / "fls";
+#endif
+    std::error_code ec;
+    std::filesystem::create_directories(cache_path, ec);
+    if (ec) {
+        return std::filesystem::path();
+    }
+    prune_cache_directory(cache_path);
+    return cache_path / ("symbol_index_" + to_hex(hash_content(workspace_root.string())));
+}
+
+std::string SymbolIndex::get_symbol_key(const std::filesystem::path &file_path, unsigned int line, unsigned int column) {
+    return file_path.string() + ":" + std::to_string(line) + ":" + std::to_string(column);
+}
+
+std::string SymbolIndex::get_name_key(std::string_view name) {
+    return "?" + std::string(name);
+}
+
+bool SymbolIndex::is_up_to_date(const std::string &file_path, uint64_t content_hash) {
+    std::shared_lock<std::shared_mutex> lock(files_mutex);
+    const auto it = files.find(file_path);
+    return it != files.end() && it->second.content_hash == content_hash;
+}
+
+void SymbolIndex::update_file(const std::string &file_path, FileEntry entry) {
+    std::unique_lock<std::shared_mutex> lock(files_mutex);
+    files.insert_or_assign(file_path, std::move(entry));
+    is_dirty = true;
+}
+
+/// @function `to_lower`
+/// @brief Converts the given string to lower case
+///
+/// @param `str` The string to convert
+/// @return `std::string` The lower case string
+static std::string to_lower(std::string_view str) {
+    std::string result(str);
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return result;
+}
+
+std::vector<std::pair<std::string, SymbolIndex::Symbol>> SymbolIndex::find_symbols(const std::string &query) {
+    const std::string lower_query = to_lower(query);
+    std::vector<std::pair<std::string, Symbol>> result;
+    std::shared_lock<std::shared_mutex> lock(files_mutex);
+    for (const auto &[file_path, entry] : files) {
+        for (const Symbol &symbol : entry.symbols) {
+            if (!lower_query.empty() && to_lower(symbol.name).find(lower_query) == std::string::npos) {
+                continue;
+            }
+            result.emplace_back(file_path, symbol);
+            if (result.size() == MAX_WORKSPACE_SYMBOLS) {
+                return result;
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<std::pair<std::string, SymbolIndex::Location>> SymbolIndex::find_references(const std::string &key) {
+    std::vector<std::pair<std::string, Location>> result;
+    std::shared_lock<std::shared_mutex> lock(files_mutex);
+    for (const auto &[file_path, entry] : files) {
+        const auto it = entry.references.find(key);
+        if (it == entry.references.end()) {
+            continue;
+        }
+        for (const Location &location : it->second) {
+            result.emplace_back(file_path, location);
+        }
+    }
+    return result;
+}
+
+void SymbolIndex::prune(const std::filesystem::path &workspace_root) {
+    std::unique_lock<std::shared_mutex> lock(files_mutex);
+    for (auto it = files.begin(); it != files.end();) {
+        // A file is part of the workspace if the workspace root is a prefix of its path
+        const std::filesystem::path path(it->first);
+        const auto root_end = std::mismatch(workspace_root.begin(), workspace_root.end(), path.begin(), path.end()).first;
+        std::error_code ec;
+        if (root_end == workspace_root.end() && std::filesystem::is_regular_file(path, ec)) {
+            ++it;
+            continue;
+        }
+        it = files.erase(it);
+        is_dirty = true;
+    }
+}
+
+bool SymbolIndex::load(const std::filesystem::path &file_path) {
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != FORMAT_HEADER) {
+        return false;
+    }
+
+    // Every file starts with a "file" line, followed by its "sym" and "ref" lines. Names, keys and paths are the last field
+    std::unordered_map<std::string, FileEntry> loaded_files;
+    FileEntry *current = nullptr;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string kind;
+        fields >> kind;
+        if (kind == "file") {
+            FileEntry entry{0, {}, {}};
+            std::string path;
+            fields >> std::hex >> entry.content_hash >> std::dec;
+            fields.ignore(1);
+            std::getline(fields, path);
+            current = &loaded_files.insert_or_assign(path, std::move(entry)).first->second;
+        } else if (kind == "sym" && current != nullptr) {
+            Symbol symbol{"", SymbolKind::File, {0, 0, 0}};
+            int symbol_kind = 0;
+            fields >> symbol_kind >> symbol.location.line >> symbol.location.character >> symbol.location.end_character;
+            fields.ignore(1);
+            std::getline(fields, symbol.name);
+            symbol.kind = static_cast<SymbolKind>(symbol_kind);
+            current->symbols.emplace_back(std::move(symbol));
+        } else if (kind == "ref" && current != nullptr) {
+            Location location{0, 0, 0};
+            std::string key;
+            fields >> location.line >> location.character >> location.end_character;
+            fields.ignore(1);
+            std::getline(fields, key);
+            current->references[key].emplace_back(location);
+        } else {
+            return false;
+        }
+        if (fields.fail()) {
+            return false;
+        }
+    }
+
+    file.close();
+    // Loading the index counts as using it, so the index of a workspace which is opened regularly is never pruned as stale
+    std::error_code ec;
+    std::filesystem::last_write_time(file_path, std::filesystem::file_time_type::clock::now(), ec);
+
+    std::unique_lock<std::shared_mutex> lock(files_mutex);
+    files = std::move(loaded_files);
+    is_dirty = false;
+    return true;
+}
+
+bool SymbolIndex::save(const std::filesystem::path &file_path) {
+    std::unique_lock<std::shared_mutex> lock(files_mutex);
+    if (!is_dirty) {
+        return true;
+    }
+    // Write to a temporary file first, so that a crash while saving never leaves a truncated index behind. The name of the temporary
+    // file is unique, as multiple servers could save the index of the same workspace at the same time
+    std::random_device random;
+    std::filesystem::path temp_path = file_path;
+    temp_path += ".tmp." + to_hex((static_cast<uint64_t>(random()) << 32) | random());
+    std::error_code ec;
+    {
+        std::ofstream file(temp_path, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << FORMAT_HEADER << "\n";
+        for (const auto &[path, entry] : files) {
+            file << "file " << std::hex << entry.content_hash << std::dec << " " << path << "\n";
+            for (const Symbol &symbol : entry.symbols) {
+                const Location &loc = symbol.location;
+                const int kind = static_cast<int>(symbol.kind);
+                file << "sym " << kind << " " << loc.line << " " << loc.character << " " << loc.end_character << " " << symbol.name << "\n";
+            }
+            for (const auto &[key, locations] : entry.references) {
+                for (const Location &loc : locations) {
+                    file << "ref " << loc.line << " " << loc.character << " " << loc.end_character << " " << key << "\n";
+                }
+            }
+        }
+        if (!file.good()) {
+            file.close();
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(temp_path, file_path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    is_dirty = false;
+    return true;
+}
@@ -0,0 +1,94 @@
+#include "text_document.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+/// @function `split_lines`
+/// @brief Splits the given text at every line break
+///
+/// @param `text` The text to split
+/// @return `std::vector<std::string>` The lines of the text, there always is at least one line
+static std::vector<std::string> split_lines(const std::string &text) {
+    std::vector<std::string> result;
+    size_t line_start = 0;
+    size_t line_end = text.find('\n');
+    while (line_end != std::string::npos) {
+        result.emplace_back(text.substr(line_start, line_end - line_start));
+        line_start = line_end + 1;
+        line_end = text.find('\n', line_start);
+    }
+    result.emplace_back(text.substr(line_start));
+    return result;
+}
+
+void TextDocument::set_text(const std::string &text) {
+    lines = split_lines(text);
+}
+
+void TextDocument::apply_change(const Position &start, const Position &end, const std::string &text) {
+    const size_t start_line = std::min(static_cast<size_t>(start.line), lines.size() - 1);
+    const size_t end_line = std::max(start_line, std::min(static_cast<size_t>(end.line), lines.size() - 1));
+    const size_t start_offset = character_to_offset(lines[start_line], start.line < lines.size() ? start.character : UINT32_MAX);
+    size_t end_offset = character_to_offset(lines[end_line], end.line < lines.size() ? end.character : UINT32_MAX);
+    if (end_line == start_line && end_offset < start_offset) {
+        end_offset = start_offset;
+    }
+
+    std::vector<std::string> new_lines = split_lines(text);
+    new_lines.front().insert(0, std::string_view(lines[start_line]).substr(0, start_offset));
+    new_lines.back().append(std::string_view(lines[end_line]).substr(end_offset));
+
+    // Overwrite the replaced lines in place and only insert or erase the difference in line count
+    const size_t replaced_count = end_line - start_line + 1;
+    const size_t common_count = std::min(replaced_count, new_lines.size());
+    for (size_t i = 0; i < common_count; i++) {
+        lines[start_line + i] = std::move(new_lines[i]);
+    }
+    const auto first_uncommon = lines.begin() + static_cast<std::ptrdiff_t>(start_line + common_count);
+    if (new_lines.size() > replaced_count) {
+        const auto new_lines_rest = new_lines.begin() + static_cast<std::ptrdiff_t>(common_count);
+        lines.insert(first_uncommon, std::make_move_iterator(new_lines_rest), std::make_move_iterator(new_lines.end()));
+    } else if (replaced_count > new_lines.size()) {
+        lines.erase(first_uncommon, lines.begin() + static_cast<std::ptrdiff_t>(end_line + 1));
+    }
+}
+
+std::string TextDocument::get_text() const {
+    size_t size = lines.size() - 1;
+    for (const auto &line : lines) {
+        size += line.size();
+    }
+    std::string text;
+    text.reserve(size);
+    for (size_t i = 0; i < lines.size(); i++) {
+        if (i > 0) {
+            text.push_back('\n');
+        }
+        text.append(lines[i]);
+    }
+    return text;
+}
+
+size_t TextDocument::character_to_offset(std::string_view line, unsigned int character) {
+    size_t offset = 0;
+    unsigned int units = 0;
+    while (offset < line.size() && units < character) {
+        const auto byte = static_cast<unsigned char>(line[offset]);
+        if (byte >= 0xF0) {
+            // Code points outside of the BMP are a surrogate pair in UTF-16
+            offset += 4;
+            units += 2;
+        } else if (byte >= 0xE0) {
+            offset += 3;
+            units++;
+        } else if (byte >= 0xC0) {
+            offset += 2;
+            units++;
+        } else {
+            offset++;
+            units++;
+        }
+    }
+    return std::min(offset, line.size());
+}
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 class Parser;
 
@@ -231,6 +232,31 @@ class Analyzer {
         );
     };
 
+    /// @var `PARALLEL_SPLIT_THRESHOLD`
+    /// @brief The number of top-level definitions a file needs to have to be analyzed definition-by-definition on the thread pool instead of
+    /// as a single task when analyzing in parallel
+    static constexpr size_t PARALLEL_SPLIT_THRESHOLD = 16;
+
+    /// @function `analyze_program`
+    /// @brief Analyzes all parsed files for semantic correctness, one file after another. The parallel pipeline analyzes the files as part
+    /// of `Parser::parse_and_analyze_bodies` instead
+    ///
+    /// @return `bool` Whether all files were analyzed successfully
+    static bool analyze_program();
+
+    /// @function `get_analysis_ranges`
+    /// @brief Splits the definitions of the given parser instance's file into the ranges which are analyzed as separate tasks. Files with
+    /// fewer than `PARALLEL_SPLIT_THRESHOLD` definitions are analyzed as a single range
+    ///
+    /// @param `parser` The parser instance whose definitions to split
+    /// @return `std::vector<std::pair<size_t, size_t>>` The `[begin, end)` ranges of definitions, in definition order
+    static std::vector<std::pair<size_t, size_t>> get_analysis_ranges(const Parser &parser);
+
+    /// @function `assign_dense_error_ids`
+    /// @brief Assigns a dense ID to every error set of the program, including the error sets of the core modules. The IDs are consecutive
+    /// and start at `1`, in the same order as `Parser::get_all_errors` returns the error sets
+    static void assign_dense_error_ids();
+
     /// @function `analyze_file`
     /// @brief Analyzes the given parser instance's file node for semantic correctness. Errors are printed inside the analyzer
     ///
@@ -238,6 +264,15 @@ class Analyzer {
     /// @return `bool` Whether the file was analyzed successfully
     static bool analyze_file(Parser &parser);
 
+    /// @function `analyze_definitions`
+    /// @brief Analyzes the definitions in the range `[begin, end)` of the given parser instance's file for semantic correctness
+    ///
+    /// @param `parser` The parser instance whose definitions to analyze
+    /// @param `begin` The index of the first definition to analyze
+    /// @param `end` The index one past the last definition to analyze
+    /// @return `bool` Whether all definitions in the range were analyzed successfully
+    static bool analyze_definitions(Parser &parser, const size_t begin, const size_t end);
+
     /// @function `analyze_definition`
     /// @brief Analyzes a top-level definition node (data, function, enum, etc.)
     ///
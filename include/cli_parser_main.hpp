@@ -309,6 +309,15 @@ class CLIParserMain : public CLIParserBase {
                 i++;
             } else if (arg == "--no-fip") {
                 FIP_ENABLED = false;
+            } else if (arg == "--frontend-timings") {
+                PRINT_FRONTEND_TIMINGS = true;
+            } else if (arg == "--time-trace") {
+                if (!n_args_follow(i + 1, "<file>", arg)) {
+                    return 1;
+                }
+                time_trace_file_path = get_absolute(cwd_path, args.at(i + 1));
+                time_trace = true;
+                i++;
 #ifdef DEBUG_BUILD
             } else if (arg == "--profile-cumulative") {
                 PRINT_CUMULATIVE_PROFILE_RESULTS = true;
@@ -390,8 +399,10 @@ class CLIParserMain : public CLIParserBase {
     std::filesystem::path source_file_path = "";
     std::filesystem::path out_file_path = "main";
     std::filesystem::path ir_file_path = "";
+    std::filesystem::path time_trace_file_path = "";
     std::vector<std::string> compile_flags;
     bool emit_ir{false};
+    bool time_trace{false};
     bool run{false};
     bool test{false};
     bool parallel{false};
@@ -425,6 +436,8 @@ class CLIParserMain : public CLIParserBase {
         std::cout << "      --no-colors                 Disables colored console output\n";
         std::cout << "      --no-fip                    Disables the Flint Interop Protocol entirely\n";
         std::cout << "                                  HINT: Extern declarations are assumed to be present and no longer chcecked\n";
+        std::cout << "      --frontend-timings          Prints the wall time and lower bound of every front-end phase\n";
+        std::cout << "      --time-trace <file>         Writes a Chrome trace-event JSON file of all compilation phases to the given file\n";
 #ifdef DEBUG_BUILD
         std::cout << YELLOW << "\nDebug Options" << DEFAULT << ":\n";
         std::cout
@@ -131,8 +131,66 @@
 #include "error_types/analyzing/err_ptr_not_allowed_in_non_extern_context.hpp"
 
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
+
+/// @struct `ErrorBuffer`
+/// @brief Collects all errors thrown on a thread while the buffer is active on that thread instead of emitting them directly. This is used
+/// whenever work is spread across the thread pool, the buffers are then flushed in a well-defined order once all tasks have finished so
+/// that the error output stays deterministic regardless of thread scheduling
+struct ErrorBuffer {
+#ifdef FLINT_LSP
+    /// @var `diagnostics`
+    /// @brief All diagnostics collected while this buffer was active
+    std::vector<Diagnostic> diagnostics;
+#else
+    /// @var `messages`
+    /// @brief All fully rendered error messages collected while this buffer was active
+    std::vector<std::string> messages;
+#endif
+
+    /// @function `flush`
+    /// @brief Emits all collected errors in the order they were thrown and clears the buffer
+    void flush() {
+#ifdef FLINT_LSP
+        for (auto &diagnostic : diagnostics) {
+            ::diagnostics.emplace_back(std::move(diagnostic));
+        }
+        diagnostics.clear();
+#else
+        for (const auto &message : messages) {
+            std::cerr << message << std::endl;
+        }
+        messages.clear();
+#endif
+    }
+
+    /// @var `active`
+    /// @brief The error buffer currently active on this thread, nullptr if errors are emitted directly
+    static inline thread_local ErrorBuffer *active = nullptr;
+};
+
+/// @class `ErrorBufferScope`
+/// @brief RAII helper which activates the given error buffer on the current thread for the lifetime of the scope
+class ErrorBufferScope {
+  public:
+    explicit ErrorBufferScope(ErrorBuffer &buffer) :
+        previous(ErrorBuffer::active) {
+        ErrorBuffer::active = &buffer;
+    }
+
+    ~ErrorBufferScope() {
+        ErrorBuffer::active = previous;
+    }
+
+    ErrorBufferScope(const ErrorBufferScope &) = delete;
+    ErrorBufferScope &operator=(const ErrorBufferScope &) = delete;
+
+  private:
+    ErrorBuffer *previous;
+};
 
 /// @brief Throws the given ErrorType as an runtime error to the console. Very basic error handling
 ///
@@ -174,13 +232,27 @@ throw_err(
 ) {
     ErrorType error(std::forward<Args>(args)...);
 #ifdef FLINT_LSP
+    if (ErrorBuffer::active != nullptr) {
+        ErrorBuffer::active->diagnostics.emplace_back(error.to_diagnostic());
+        return;
+    }
     diagnostics.emplace_back(error.to_diagnostic());
 #else
-    std::cerr << error.to_string();
+    std::ostringstream message;
+    message << error.to_string();
     if (DEBUG_MODE) {
-        std::cerr << YELLOW << "\n[Debug Info]" << DEFAULT << " Called from: " << file << ":" << line;
+        message << YELLOW << "\n[Debug Info]" << DEFAULT << " Called from: " << file << ":" << line;
+    }
+    message << "\n";
+    if (ErrorBuffer::active != nullptr) {
+        ErrorBuffer::active->messages.emplace_back(message.str());
+        if (HARD_CRASH) {
+            ErrorBuffer::active->flush();
+            ASSERT(false);
+        }
+        return;
     }
-    std::cerr << "\n" << std::endl;
+    std::cerr << message.str() << std::endl;
     if (HARD_CRASH) {
         ASSERT(false);
     }
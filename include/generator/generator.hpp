@@ -50,13 +50,18 @@
 #include "parser/ast/statements/while_node.hpp"
 #include "resolver/resolver.hpp"
 
+#include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/DIBuilder.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Target/TargetMachine.h>
 
+#include <array>
+#include <future>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -115,6 +120,14 @@ class Generator {
     /// @return `bool` Whether compilation was successful
     static bool compile_module(llvm::Module *module, const std::filesystem::path &module_path);
 
+    /// @function `compile_module`
+    /// @brief Compiles a given module and emits the contents of its .o / .obj file into the given buffer, without touching the disk
+    ///
+    /// @param `module` The module to compile
+    /// @param `object` The buffer to emit the object file into, its previous contents are discarded
+    /// @return `bool` Whether compilation was successful
+    static bool compile_module(llvm::Module *module, llvm::SmallVector<char, 0> &object);
+
     /// @function `verify_module`
     /// @brief Verifies a given module
     ///
@@ -161,6 +174,13 @@ class Generator {
     /// @return `std::string` The modified IR code, where all metadata is resolved into IR comments
     static std::string resolve_ir_comments(const std::string &ir_string);
 
+    /// @function `get_cold_path_statistics`
+    /// @brief Collects how much code of the given module has been outlined into cold functions and returns it as IR comments
+    ///
+    /// @param `module` The module whose cold functions will be counted
+    /// @return `std::string` The IR comment lines containing the number of cold functions and the instructions and blocks within them
+    static std::string get_cold_path_statistics(const llvm::Module *module);
+
   private:
     /// @var `context`
     /// @brief The global llvm context used for code generation
@@ -226,6 +246,147 @@ class Generator {
         {CFunction::DUP2, nullptr},
         {CFunction::FILENO, nullptr},
         {CFunction::CLOSE, nullptr},
+        {CFunction::STRCMP, nullptr},
+        {CFunction::STRSTR, nullptr},
+        {CFunction::QSORT, nullptr},
+        {CFunction::FPRINTF, nullptr},
+        {CFunction::MEMCHR, nullptr},
+        {CFunction::FERROR, nullptr},
+#ifndef __WIN32__
+        {CFunction::FORK, nullptr},
+        {CFunction::WAITPID, nullptr},
+        {CFunction::MMAP, nullptr},
+        {CFunction::MUNMAP, nullptr},
+        {CFunction::MADVISE, nullptr},
+#endif
+    };
+
+    /// @class `AllocationMap`
+    /// @brief All "allocations" of a function. The allocations of variables are kept in a flat list indexed by the variable's slot, which
+    /// is resolved during parsing, and the index arrays are kept in a fixed array indexed by their length, so neither of the lookups done
+    /// for every variable access or array access builds or hashes a string. Only the per-function allocations, like the thread stack
+    /// pointers, are looked up by their name
+    class AllocationMap {
+      public:
+        /// @var `MAX_FIXED_INDEX_ARRAY_LENGTH`
+        /// @brief The largest index array length stored in the fixed index array list, longer index arrays are stored by their name
+        static constexpr unsigned int MAX_FIXED_INDEX_ARRAY_LENGTH = 16;
+
+        /// @function `get_variable`
+        /// @brief Returns the allocation of the variable with the given slot
+        ///
+        /// @param `slot` The slot of the variable
+        /// @return `llvm::Value *` The allocation of the variable
+        llvm::Value *get_variable(const unsigned int slot) const {
+            ASSERT(slot < variables.size() && variables[slot] != nullptr);
+            return variables[slot];
+        }
+
+        /// @function `has_variable`
+        /// @brief Checks whether an allocation exists for the variable with the given slot
+        ///
+        /// @param `slot` The slot of the variable
+        /// @return `bool` Whether the variable has an allocation
+        bool has_variable(const unsigned int slot) const {
+            return slot < variables.size() && variables[slot] != nullptr;
+        }
+
+        /// @function `set_variable`
+        /// @brief Sets the allocation of the variable with the given slot, replacing any previous allocation of it
+        ///
+        /// @param `slot` The slot of the variable
+        /// @param `value` The allocation of the variable
+        void set_variable(const unsigned int slot, llvm::Value *value) {
+            if (slot >= variables.size()) {
+                variables.resize(slot + 1, nullptr);
+            }
+            variables[slot] = value;
+        }
+
+        /// @function `erase_variable`
+        /// @brief Removes the allocation of the variable with the given slot
+        ///
+        /// @param `slot` The slot of the variable
+        void erase_variable(const unsigned int slot) {
+            if (slot < variables.size()) {
+                variables[slot] = nullptr;
+            }
+        }
+
+        /// @function `get_index_array`
+        /// @brief Returns the index array allocation of the given length, which holds the indices or lengths of a multi-dimensional access
+        ///
+        /// @param `length` The number of elements of the index array
+        /// @return `llvm::Value *` The index array allocation
+        llvm::Value *get_index_array(const size_t length) const {
+            if (length > MAX_FIXED_INDEX_ARRAY_LENGTH) {
+                return named.at("arr::idx::" + std::to_string(length));
+            }
+            ASSERT(index_arrays[length] != nullptr);
+            return index_arrays[length];
+        }
+
+        /// @function `set_index_array`
+        /// @brief Sets the index array allocation of the given length
+        ///
+        /// @param `length` The number of elements of the index array
+        /// @param `value` The index array allocation
+        void set_index_array(const size_t length, llvm::Value *value) {
+            if (length > MAX_FIXED_INDEX_ARRAY_LENGTH) {
+                named["arr::idx::" + std::to_string(length)] = value;
+                return;
+            }
+            index_arrays[length] = value;
+        }
+
+        /// @function `at`
+        /// @brief Returns the named allocation with the given name
+        ///
+        /// @param `name` The name of the allocation
+        /// @return `llvm::Value *` The named allocation
+        llvm::Value *at(const std::string &name) const {
+            return named.at(name);
+        }
+
+        /// @function `contains`
+        /// @brief Checks whether a named allocation with the given name exists
+        ///
+        /// @param `name` The name of the allocation
+        /// @return `bool` Whether the named allocation exists
+        bool contains(const std::string &name) const {
+            return named.find(name) != named.end();
+        }
+
+        /// @function `emplace`
+        /// @brief Adds a named allocation, an already existing allocation with the same name is kept
+        ///
+        /// @param `name` The name of the allocation
+        /// @param `value` The allocation
+        /// @return `bool` Whether the allocation was added
+        bool emplace(const std::string &name, llvm::Value *value) {
+            return named.emplace(name, value).second;
+        }
+
+        /// @function `erase`
+        /// @brief Removes the named allocation with the given name
+        ///
+        /// @param `name` The name of the allocation
+        void erase(const std::string &name) {
+            named.erase(name);
+        }
+
+      private:
+        /// @var `variables`
+        /// @brief The allocations of all variables, indexed by their slot. Slots without an allocation are nullptr
+        std::vector<llvm::Value *> variables;
+
+        /// @var `index_arrays`
+        /// @brief The index array allocations, indexed by their length. Lengths without an index array are nullptr
+        std::array<llvm::Value *, MAX_FIXED_INDEX_ARRAY_LENGTH + 1> index_arrays{};
+
+        /// @var `named`
+        /// @brief All allocations which are not variables, by their name
+        std::unordered_map<std::string, llvm::Value *> named;
     };
 
     /// @struct `GenerationContext`
@@ -249,7 +410,7 @@ class Generator {
 
         /// @var `allocations`
         /// @brief The map of all allocations (from the preallocation system) to track the AllocaInst instructions
-        std::unordered_map<std::string, llvm::Value *const> allocations;
+        AllocationMap allocations;
 
         /// @var `imported_core_modules`
         /// @brief The list of imported core modules
@@ -411,10 +572,12 @@ class Generator {
     /// file B can call the extern-defined functions defined in file A)
     static inline std::unordered_map<std::string, FunctionNode *> extern_functions;
 
-    /// @var `object_dispatch_functions`
-    /// @brief A map of all object dispatch functions. The key is the type ID of the object, the value is the generated object dispatch
-    /// function needed for proper function dispatch when calling functions of func component instances (interfaces).
-    static inline std::unordered_map<uint32_t, llvm::Function *> object_dispatch_functions;
+    /// @var `object_vtables`
+    /// @brief A map of all object vtables. The outer key is the type ID of the object, the inner key is the type ID of the implemented
+    /// interface. Each vtable is a constant array containing the setup and the execute function of every interface function, in the order
+    /// the interface defines its functions. Interface instances point to the vtable of their object, so calling an interface function is
+    /// a load from the vtable followed by a direct call through the loaded pointer
+    static inline std::unordered_map<uint32_t, std::unordered_map<uint32_t, llvm::GlobalVariable *>> object_vtables;
 
     /// @class `IR`
     /// @brief The class which is responsible for the utility functions for the IR generation
@@ -482,6 +645,38 @@ class Generator {
         /// @return `llvm::MDNode *` The created branch weights
         static llvm::MDNode *generate_weights(unsigned int true_weight, unsigned int false_weight);
 
+        /// @function `generate_cold_crash`
+        /// @brief Generates a call to an outlined crash function which prints the given message and aborts, followed by an `unreachable`.
+        /// The crash function is created once per module and is marked `cold`, `noinline` and `noreturn`, so that the failure path only
+        /// costs a single call instruction in the hot function and the block calling it is laid out away from the hot code
+        ///
+        /// @param `builder` The IRBuilder positioned at the failure block
+        /// @param `module` The module in which the crash function is generated in
+        /// @param `name` The name of the crash function, it will be called `flint.cold.<name>`
+        /// @param `message` The message printed before aborting
+        static void generate_cold_crash( //
+            llvm::IRBuilder<> &builder,  //
+            llvm::Module *module,        //
+            const std::string &name,     //
+            const std::string &message   //
+        );
+
+        /// @function `generate_cold_rethrow`
+        /// @brief Generates a call to the outlined `flint.cold.rethrow` function, which copies the error of a failed call's frame into the
+        /// error field of the current function's frame. The function is created once per module and is marked `cold` and `noinline`
+        ///
+        /// @param `builder` The IRBuilder positioned at the catch block
+        /// @param `module` The module in which the rethrow function is generated in
+        /// @param `callee_frame` The thread stack frame of the failed call
+        /// @param `current_frame` The thread stack frame of the current function
+        /// @return `llvm::CallInst *` The call to the rethrow function
+        static llvm::CallInst *generate_cold_rethrow( //
+            llvm::IRBuilder<> &builder,               //
+            llvm::Module *module,                     //
+            llvm::Value *callee_frame,                //
+            llvm::Value *current_frame                //
+        );
+
         /// @function `generate_forward_declarations`
         /// @brief Generates the forward-declarations of all constructs in the given FileNode, except the 'use' constructs to make another
         /// module able to use them. This function is also essential for Flint's support of circular dependency resolution
@@ -490,11 +685,28 @@ class Generator {
         /// @param `file_node` The FileNode whose construct definitions will be forward-declared in the given module
         static void generate_forward_declarations(llvm::Module *module, const FileNode &file_node);
 
-        /// @function `generate_object_dispatch_functions`
-        /// @brief Generates all object dispatch functions of every object type defined in the program
-        ///
-        /// @param `module` THe module in which to generate the object dispatch functions in
-        static void generate_object_dispatch_functions(llvm::Module *module);
+        /// @function `generate_object_vtables`
+        /// @brief Generates the vtables of every object type defined in the program, one for every interface the object implements
+        ///
+        /// @param `module` The module in which to generate the object vtables in
+        static void generate_object_vtables(llvm::Module *module);
+
+        /// @function `generate_vtable_entry`
+        /// @brief Generates the setup and execute function of the given object function for the vtables. The setup function stores the
+        /// default frame of the function on the stack and returns the pointer to the start of its arguments, the execute function stores
+        /// the implicit parameters of the function in the frame and calls it, returning whether an error happened
+        ///
+        /// @param `module` The module in which to generate the functions in
+        /// @param `object` The object the function belongs to
+        /// @param `func` The func component the function belongs to, nullptr if it is a function of the object itself
+        /// @param `function_node` The function to generate the vtable entry for
+        /// @return `std::pair<llvm::Function *, llvm::Function *>` The setup and the execute function
+        static std::pair<llvm::Function *, llvm::Function *> generate_vtable_entry( //
+            llvm::Module *module,                                                  //
+            const ObjectNode *object,                                              //
+            const FuncNode *func,                                                  //
+            const FunctionNode *function_node                                      //
+        );
 
         /// @function `get_extern_type`
         /// @brief Returns the llvm Type from a given Type for the use with FIP
@@ -586,7 +798,8 @@ class Generator {
         );
 
         /// @function `generate_err_value`
-        /// @brief Generates an error value from the given error components
+        /// @brief Generates an error value from the given error components. The value is built by the outlined `flint.cold.create_err`
+        /// function, so constructing an error only costs a single call in the function throwing it
         ///
         /// @param `builder` The IRBuilder
         /// @param `module` The module in which to generate the error value in
@@ -697,6 +910,61 @@ class Generator {
         /// @return `llvm::Function *` The generated `visible_width` function
         static llvm::Function *generate_visible_width_function(llvm::IRBuilder<> *builder, llvm::Module *module);
 
+        /// @function `generate_measure_perf_test_function`
+        /// @brief Generates the `measure_perf` function which repeats a passed performance test for the configured number of warmup
+        /// runs, iterations and minimum measured time. Every repetition starts from a snapshot of the initial frame of the test
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `measure_perf` function is being generated in
+        /// @return `llvm::Function *` The generated `measure_perf` function
+        static llvm::Function *generate_measure_perf_test_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+        /// @function `generate_perf_stats_function`
+        /// @brief Generates the `perf_stats` function which sorts the samples of a performance test and computes their min, median,
+        /// mean, standard deviation and 99th percentile
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `perf_stats` function is being generated in
+        /// @return `llvm::Function *` The generated `perf_stats` function
+        static llvm::Function *generate_perf_stats_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+        /// @function `generate_escape_perf_name_function`
+        /// @brief Generates the `escape_perf_name` function which escapes the name of a performance test for a quoted CSV field or a
+        /// JSON string, the destination needs room for twice the length of the name plus the terminator
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `escape_perf_name` function is being generated in
+        /// @return `llvm::Function *` The generated `escape_perf_name` function
+        static llvm::Function *generate_escape_perf_name_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+        /// @function `generate_perf_baseline_function`
+        /// @brief Generates the `perf_baseline_median` function which looks up the median of a performance test in the CSV or JSON
+        /// baseline file, as written by a previous run with `--perf-output`
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `perf_baseline_median` function is being generated in
+        /// @param `escape_name_fn` The `escape_perf_name` function
+        /// @return `llvm::Function *` The generated `perf_baseline_median` function
+        static llvm::Function *generate_perf_baseline_function( //
+            llvm::IRBuilder<> *builder,                         //
+            llvm::Module *module,                               //
+            llvm::Function *escape_name_fn                      //
+        );
+
+        /// @function `generate_write_perf_result_function`
+        /// @brief Generates the `write_perf_result` function which appends the statistics of a performance test to the output file as
+        /// a CSV row or a JSON line
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `write_perf_result` function is being generated in
+        /// @param `escape_name_fn` The `escape_perf_name` function
+        /// @return `llvm::Function *` The generated `write_perf_result` function
+        static llvm::Function *generate_write_perf_result_function( //
+            llvm::IRBuilder<> *builder,                             //
+            llvm::Module *module,                                   //
+            llvm::Function *escape_name_fn                          //
+        );
+
         /// @function `generate_execute_test_function`
         /// @brief Generates the `execute_test` function which is a wrapper around running a test, printing it's output etc. All the good
         /// stuff. It has been created because without it the code duplication levels were kinda insane. With it, the IR code of tests now
@@ -707,6 +975,62 @@ class Generator {
         /// @return `llvm::Function *` The generated `execute_test` function
         static llvm::Function *generate_execute_test_function(llvm::IRBuilder<> *builder, llvm::Module *module);
 
+        /// @function `generate_test_runner_variables`
+        /// @brief Generates the global variables of the test runner which hold the parsed command line options and the state of all
+        /// worker processes
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the variables are being generated in
+        static void generate_test_runner_variables(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+        /// @function `generate_parse_test_args_function`
+        /// @brief Generates the `parse_args` function of the test runner, which parses the `--shard <index>/<count>`,
+        /// `--filter <name>`, `--jobs <count>` and all `--perf-*` options of the test binary into the test runner variables
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `parse_args` function is being generated in
+        /// @return `llvm::Function *` The generated `parse_args` function
+        static llvm::Function *generate_parse_test_args_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+#ifndef __WIN32__
+        /// @function `generate_drain_test_slot_function`
+        /// @brief Generates the `drain_slot` function which waits for the worker process of a single slot to finish and copies its
+        /// captured output to stdout. Tests are always drained in the order they have been started in, which keeps the output of a
+        /// parallel run identical to the output of a sequential run
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `drain_slot` function is being generated in
+        /// @return `llvm::Function *` The generated `drain_slot` function
+        static llvm::Function *generate_drain_test_slot_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+        /// @function `generate_drain_all_test_slots_function`
+        /// @brief Generates the `drain_all` function which drains all slots, starting at the oldest running worker
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `drain_all` function is being generated in
+        /// @param `drain_slot_fn` The `drain_slot` function
+        /// @return `llvm::Function *` The generated `drain_all` function
+        static llvm::Function *generate_drain_all_test_slots_function( //
+            llvm::IRBuilder<> *builder,                                //
+            llvm::Module *module,                                      //
+            llvm::Function *drain_slot_fn                              //
+        );
+#endif
+
+        /// @function `generate_dispatch_test_function`
+        /// @brief Generates the `dispatch_test` function which decides whether a test is part of the selected shard and matches the
+        /// filter, and runs it either directly or, when running with more than one job, in a forked worker process
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the `dispatch_test` function is being generated in
+        /// @param `execute_test_fn` The `execute_test` function
+        /// @return `llvm::Function *` The generated `dispatch_test` function
+        static llvm::Function *generate_dispatch_test_function( //
+            llvm::IRBuilder<> *builder,                         //
+            llvm::Module *module,                               //
+            llvm::Function *execute_test_fn                     //
+        );
+
         /// @function `generate_builtin_test`
         /// @brief Generates the entry point of the program when compiled with the `--test` flag enabled
         ///
@@ -714,6 +1038,34 @@ class Generator {
         /// @param `module` The LLVM Module the test entry point will be generated in
         /// @return `bool` Whether generating the builtin test function was successful (it fails when global initializers fail)
         [[nodiscard]] static bool generate_builtin_test(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+      private:
+        /// @var `MAX_TEST_JOBS`
+        /// @brief The maximum number of worker processes the test runner runs tests in at once
+        static constexpr unsigned int MAX_TEST_JOBS = 256;
+
+        /// @var `MAX_PERF_SAMPLES`
+        /// @brief The maximum number of samples a single performance test collects, which bounds the runs of time budgeted tests
+        static constexpr unsigned int MAX_PERF_SAMPLES = 100000;
+
+        /// @function `generate_elapsed_ms`
+        /// @brief Generates the computation of the milliseconds between two time stamps and releases both time stamps
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `module` The LLVM Module the computation is being generated in
+        /// @param `start_stamp` The time stamp taken before the measured code
+        /// @param `end_stamp` The time stamp taken after the measured code
+        /// @return `llvm::Value *` The elapsed time in milliseconds as an `f64`
+        static llvm::Value *generate_elapsed_ms( //
+            llvm::IRBuilder<> *builder,          //
+            llvm::Module *module,                //
+            llvm::Value *start_stamp,            //
+            llvm::Value *end_stamp               //
+        );
+
+        /// @var `test_variables`
+        /// @brief All global variables of the test runner, keyed by their name without the `test.` prefix
+        static inline std::unordered_map<std::string, llvm::GlobalVariable *> test_variables;
     }; // subclass Builtin
 
     /// @class `Logical`
@@ -732,6 +1084,39 @@ class Generator {
         /// @return `llvm::Value *` The inverted value
         static llvm::Value *generate_not(llvm::IRBuilder<> &builder, llvm::Value *value_to_negate);
 
+        /// @function `get_string_literal`
+        /// @brief Returns the string literal of the given expression, if it is one. A literal cast to a 'str' counts as a literal too
+        ///
+        /// @param `expr` The expression to check
+        /// @return `std::optional<std::string_view>` The value of the literal, nullopt if the expression is no string literal
+        static std::optional<std::string_view> get_string_literal(const ExpressionNode *expr);
+
+        /// @function `compare_string_literals`
+        /// @brief Compares two string literals at compile time, with the exact semantics of the 'compare_str' function
+        ///
+        /// @param `lhs` The left hand side literal
+        /// @param `rhs` The right hand side literal
+        /// @return `int32_t` The comparison result, negative if lhs < rhs, 0 if both are equal and positive if lhs > rhs
+        static int32_t compare_string_literals(const std::string_view lhs, const std::string_view rhs);
+
+        /// @function `generate_string_cmp_literal`
+        /// @brief Generates the comparison between a string and a string literal inline, without materializing the literal as a 'str'.
+        /// The length is compared against the length constant first and the contents are only compared if both lengths match
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `predicate` The predicate the 'compare_str(lhs, rhs)' result is compared against zero with
+        /// @param `str_value` The 'str*' value which is compared against the literal
+        /// @param `literal` The string literal to compare against
+        /// @param `literal_is_lhs` Whether the literal is the left hand side of the comparison
+        /// @return `llvm::Value *` The result of the string comparison
+        static llvm::Value *generate_string_cmp_literal( //
+            llvm::IRBuilder<> &builder,                  //
+            const llvm::CmpInst::Predicate predicate,    //
+            llvm::Value *str_value,                      //
+            const std::string_view literal,              //
+            const bool literal_is_lhs                    //
+        );
+
         /// @function `generate_string_cmp_lt`
         /// @brief Generates the less than comparison between two strings
         ///
@@ -833,6 +1218,58 @@ class Generator {
             llvm::Value *rhs,                        //
             const ExpressionNode *rhs_expr           //
         );
+
+        /// @function `generate_string_switch_index`
+        /// @brief Generates the dispatch of a string over a set of string literals, as used by switches on strings. The string is first
+        /// dispatched on its length and then, if multiple literals share that length, on a byte at which all of them differ. Only the
+        /// single remaining candidate is then verified by comparing the contents
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `str_value` The 'str*' value to dispatch
+        /// @param `literals` The string literals to match against
+        /// @return `llvm::Value *` The i32 index of the first matching literal, -1 if no literal matches
+        static llvm::Value *generate_string_switch_index( //
+            llvm::IRBuilder<> &builder,                   //
+            llvm::Value *str_value,                       //
+            const std::vector<std::string_view> &literals //
+        );
+
+      private:
+        /// @function `generate_string_content_cmp`
+        /// @brief Compares the contents of a string against a string literal of the same length. Short literals are compared as a
+        /// single word for equality comparisons, all other comparisons call 'memcmp' against the constant literal
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `predicate` The predicate the 'memcmp' result is compared against zero with
+        /// @param `value_ptr` The pointer to the contents of the string, which has the same length as the literal
+        /// @param `literal` The string literal to compare against
+        /// @return `llvm::Value *` The result of the content comparison
+        static llvm::Value *generate_string_content_cmp( //
+            llvm::IRBuilder<> &builder,                  //
+            const llvm::CmpInst::Predicate predicate,    //
+            llvm::Value *value_ptr,                      //
+            const std::string_view literal               //
+        );
+
+        /// @function `generate_string_cmp`
+        /// @brief Generates the comparison between two strings with the given predicate applied to the result of 'compare_str'. When
+        /// one of both sides is a literal, the comparison is lowered inline against the literal instead
+        ///
+        /// @param `builder` The LLVM IRBuilder
+        /// @param `predicate` The predicate the 'compare_str(lhs, rhs)' result is compared against zero with
+        /// @param `lhs` The LLVM value of the left hand side
+        /// @param `lhs_expr` The lhs expression to check if its a literal
+        /// @param `rhs` The LLVM value of the right hand side
+        /// @param `rhs_expr` The rhs expression to check if its a literal
+        /// @return `llvm::Value *` The result of the string comparison
+        static llvm::Value *generate_string_cmp(      //
+            llvm::IRBuilder<> &builder,               //
+            const llvm::CmpInst::Predicate predicate, //
+            llvm::Value *lhs,                         //
+            const ExpressionNode *lhs_expr,           //
+            llvm::Value *rhs,                         //
+            const ExpressionNode *rhs_expr            //
+        );
     };
 
     /// @class `Allocation`
@@ -843,6 +1280,26 @@ class Generator {
         // The constructor is deleted to make this class non-initializable
         Allocation() = delete;
 
+        /// @struct `FrameField`
+        /// @brief A single field of a function frame
+        struct FrameField {
+            /// @var `name`
+            /// @brief The name of the field, which is the name of its allocation
+            std::string name;
+
+            /// @var `type`
+            /// @brief The type of the field
+            llvm::Type *type;
+
+            /// @var `slot`
+            /// @brief The slot of the variable stored in this field, nullopt if the field does not store a variable
+            std::optional<unsigned int> slot = std::nullopt;
+
+            /// @var `index_array_length`
+            /// @brief The length of the index array stored in this field, 0 if the field does not store an index array
+            unsigned int index_array_length = 0;
+        };
+
         /// @function `generate_function_allocations`
         /// @brief Generates all allocations of the given function recursively. Adds all "allocation" pointers to the allocations map
         ///
@@ -864,7 +1321,7 @@ class Generator {
             llvm::IRBuilder<> &builder,                                                       //
             llvm::Function *parent,                                                           //
             const FunctionNode *function,                                                     //
-            std::unordered_map<std::string, llvm::Value *const> &allocations                  //
+            AllocationMap &allocations                                                        //
         );
 
         /// @function `generate_allocations`
@@ -879,11 +1336,11 @@ class Generator {
         ///
         /// @attention The allocations map will be modified (new entries are added), but it will not be cleared. If you want a clear
         /// allocations map before calling this function, you need to clear it yourself.
-        [[nodiscard]] static bool generate_allocations(                          //
-            llvm::IRBuilder<> &builder,                                          //
-            llvm::Function *parent,                                              //
-            const std::shared_ptr<Scope> scope,                                  //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types //
+        [[nodiscard]] static bool generate_allocations( //
+            llvm::IRBuilder<> &builder,                 //
+            llvm::Function *parent,                     //
+            const std::shared_ptr<Scope> scope,         //
+            std::vector<FrameField> &struct_types       //
         );
 
         /// @funnction `generate_call_allcoations`
@@ -897,12 +1354,12 @@ class Generator {
         /// @return `bool` Whether the call allocations were all successful
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_call_allocations(                      //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            const std::shared_ptr<Scope> scope,                                   //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const CallNodeBase *call_node                                         //
+        [[nodiscard]] static bool generate_call_allocations( //
+            llvm::IRBuilder<> &builder,                      //
+            llvm::Function *parent,                          //
+            const std::shared_ptr<Scope> scope,              //
+            std::vector<FrameField> &struct_types,           //
+            const CallNodeBase *call_node                    //
         );
 
         /// @funnction `generate_if_allcoations`
@@ -915,11 +1372,11 @@ class Generator {
         /// @return `bool` Whether the if allocations were all successful
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_if_allocations(                        //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const IfNode *if_node                                                 //
+        [[nodiscard]] static bool generate_if_allocations( //
+            llvm::IRBuilder<> &builder,                    //
+            llvm::Function *parent,                        //
+            std::vector<FrameField> &struct_types,         //
+            const IfNode *if_node                          //
         );
 
         /// @function `generate_enh_for_allocations`
@@ -932,11 +1389,11 @@ class Generator {
         /// @return `bool` Whether the allocations were all successfull
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_enh_for_allocations(                   //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const EnhForLoopNode *for_node                                        //
+        [[nodiscard]] static bool generate_enh_for_allocations( //
+            llvm::IRBuilder<> &builder,                         //
+            llvm::Function *parent,                             //
+            std::vector<FrameField> &struct_types,              //
+            const EnhForLoopNode *for_node                      //
         );
 
         /// @function `generate_switch_statement_allocations`
@@ -950,12 +1407,12 @@ class Generator {
         /// @return `bool` Whether the allocations were all successfull
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_switch_statement_allocations(          //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            const std::shared_ptr<Scope> scope,                                   //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const SwitchStatement *switch_statement                               //
+        [[nodiscard]] static bool generate_switch_statement_allocations( //
+            llvm::IRBuilder<> &builder,                                  //
+            llvm::Function *parent,                                      //
+            const std::shared_ptr<Scope> scope,                          //
+            std::vector<FrameField> &struct_types,                       //
+            const SwitchStatement *switch_statement                      //
         );
 
         /// @function `generate_switch_expression_allocations`
@@ -969,12 +1426,12 @@ class Generator {
         /// @return `bool` Whether the allocations were all successfull
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_switch_expression_allocations(         //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            const std::shared_ptr<Scope> scope,                                   //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const SwitchExpression *switch_expression                             //
+        [[nodiscard]] static bool generate_switch_expression_allocations( //
+            llvm::IRBuilder<> &builder,                                   //
+            llvm::Function *parent,                                       //
+            const std::shared_ptr<Scope> scope,                           //
+            std::vector<FrameField> &struct_types,                        //
+            const SwitchExpression *switch_expression                     //
         );
 
         /// @funnction `generate_declaration_allcoations`
@@ -988,12 +1445,12 @@ class Generator {
         /// @return `bool` Whether all declaration allocations succeeded
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_declaration_allocations(               //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            const std::shared_ptr<Scope> scope,                                   //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const DeclarationNode *declaration_node                               //
+        [[nodiscard]] static bool generate_declaration_allocations( //
+            llvm::IRBuilder<> &builder,                             //
+            llvm::Function *parent,                                 //
+            const std::shared_ptr<Scope> scope,                     //
+            std::vector<FrameField> &struct_types,                  //
+            const DeclarationNode *declaration_node                 //
         );
 
         /// @funnction `generate_group_declaration_allcoations`
@@ -1007,12 +1464,12 @@ class Generator {
         /// @return `bool` Whether all group declaration allocations were successful
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_group_declaration_allocations(         //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            const std::shared_ptr<Scope> scope,                                   //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const GroupDeclarationNode *group_declaration_node                    //
+        [[nodiscard]] static bool generate_group_declaration_allocations( //
+            llvm::IRBuilder<> &builder,                                   //
+            llvm::Function *parent,                                       //
+            const std::shared_ptr<Scope> scope,                           //
+            std::vector<FrameField> &struct_types,                        //
+            const GroupDeclarationNode *group_declaration_node            //
         );
 
         /// @function `generate_array_indexing_allocation`
@@ -1024,7 +1481,7 @@ class Generator {
         /// @param `indexing_expressions` The indexing expressions of the array
         static void generate_array_indexing_allocation(                              //
             llvm::IRBuilder<> &builder,                                              //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types,    //
+            std::vector<FrameField> &struct_types,                                   //
             const std::vector<std::unique_ptr<ExpressionNode>> &indexing_expressions //
         );
 
@@ -1038,12 +1495,12 @@ class Generator {
         /// @param `bool` Whether all expression allocations were successful
         ///
         /// @attention The allocations map will be modified
-        [[nodiscard]] static bool generate_expression_allocations(                //
-            llvm::IRBuilder<> &builder,                                           //
-            llvm::Function *parent,                                               //
-            const std::shared_ptr<Scope> scope,                                   //
-            std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-            const ExpressionNode *expression                                      //
+        [[nodiscard]] static bool generate_expression_allocations( //
+            llvm::IRBuilder<> &builder,                            //
+            llvm::Function *parent,                                //
+            const std::shared_ptr<Scope> scope,                    //
+            std::vector<FrameField> &struct_types,                 //
+            const ExpressionNode *expression                       //
         );
 
         /// @function `calculate_type_alignment`
@@ -1110,7 +1567,7 @@ class Generator {
             /// @var `allocations`
             /// @brief The map of all "allocations" of the function, being struct GEPs into the function frame in the setup block, needed
             /// for the generation of the function body
-            std::unordered_map<std::string, llvm::Value *const> allocations;
+            AllocationMap allocations;
         };
 
         /// @var `function_allocations`
@@ -2482,6 +2939,7 @@ class Generator {
         /// @attention The functions are nullpointers until the `generate_error_functions` function is called
         /// @attention The map is not being cleared after the program module has been generated
         static inline std::unordered_map<std::string_view, llvm::Function *> error_functions = {
+            {"get_err_type_index", nullptr},
             {"get_err_type_str", nullptr},
             {"get_err_val_str", nullptr},
             {"get_err_str", nullptr},
@@ -2494,6 +2952,22 @@ class Generator {
         /// @param `module` The module in which the functions are generated in
         static void generate_error_functions(llvm::IRBuilder<> *builder, llvm::Module *module);
 
+        /// @function `generate_error_tables`
+        /// @brief Generates the constant lookup tables of all error type and value names. All names are pooled into a single string blob
+        /// and the tables only contain offsets into that blob, indexed by the dense IDs of the error sets. The values of an error set are
+        /// stored together with the values of all its parent sets, so a value lookup never needs to walk the inheritance chain
+        ///
+        /// @param `module` The module in which the tables are generated in
+        static void generate_error_tables(llvm::Module *module);
+
+        /// @function `generate_get_err_type_index_function`
+        /// @brief Generates the `get_err_type_index` function which maps the hashed error type ID to its dense ID through an open
+        /// addressing hash table with at most half of its slots used
+        ///
+        /// @param `builder` The IRBuilder
+        /// @param `module` The module in which the functions are generated in
+        static void generate_get_err_type_index_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
         /// @function `generate_get_err_type_str_function`
         /// @brief Generates the `get_err_type_str` function used to resolve error types
         ///
@@ -2514,6 +2988,16 @@ class Generator {
         /// @param `builder` The IRBuilder
         /// @param `module` The module in which the functions are generated in
         static void generate_get_err_str_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+      private:
+        /// @function `create_error_table`
+        /// @brief Creates a private constant global containing the given table data
+        ///
+        /// @param `module` The module in which the table is created in
+        /// @param `table_data` The constant data of the table
+        /// @param `table_name` The name of the table global
+        /// @return `llvm::GlobalVariable *` The created table
+        static llvm::GlobalVariable *create_error_table(llvm::Module *module, llvm::Constant *table_data, const std::string &table_name);
     };
 
     /// @class `Memory`
@@ -2613,6 +3097,49 @@ class Generator {
         /// @param `module` The module in which the function is generated in
         /// @param `only_declatations` Whether to only generate the declaration for the `clone` function
         static void generate_clone_function(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations);
+
+        /// @function `get_typed_function_name`
+        /// @brief Returns the name of the free or clone function specialized for the given type. The type ID is used instead of the type
+        /// name, since two types of different files could share the same name
+        ///
+        /// @param `base_name` The name of the generic function, `free` or `clone`
+        /// @param `type` The type the function is specialized for
+        /// @return `std::string` The name of the specialized function
+        static std::string get_typed_function_name(const std::string &base_name, const std::shared_ptr<Type> &type);
+
+        /// @function `generate_free_call`
+        /// @brief Generates a call which frees the given value of the given type. The free function specialized for the type is called
+        /// directly if the module contains one, the generic `free` function is called with the ID of the type otherwise
+        ///
+        /// @param `builder` The IRBuilder
+        /// @param `module` The module in which the call is generated in
+        /// @param `value` The value to free
+        /// @param `type` The type of the value to free
+        /// @return `llvm::CallInst *` The generated call
+        static llvm::CallInst *generate_free_call( //
+            llvm::IRBuilder<> *const builder,      //
+            llvm::Module *const module,            //
+            llvm::Value *const value,              //
+            const std::shared_ptr<Type> &type      //
+        );
+
+        /// @function `generate_clone_call`
+        /// @brief Generates a call which clones the given value of the given type into `dest`. The clone function specialized for the
+        /// type is called directly if the module contains one, the generic `clone` function is called with the ID of the type otherwise
+        ///
+        /// @param `builder` The IRBuilder
+        /// @param `module` The module in which the call is generated in
+        /// @param `src` The value to clone
+        /// @param `dest` The place where to store the cloned value
+        /// @param `type` The type of the value to clone
+        /// @return `llvm::CallInst *` The generated call
+        static llvm::CallInst *generate_clone_call( //
+            llvm::IRBuilder<> *const builder,       //
+            llvm::Module *const module,             //
+            llvm::Value *const src,                 //
+            llvm::Value *const dest,                //
+            const std::shared_ptr<Type> &type       //
+        );
     };
 
     /// @class `Debug`
@@ -2772,12 +3299,12 @@ class Generator {
         /// @param `scope` The scope tree to walk for declarations
         /// @param `allocations` The map of all allocation GEPs
         /// @param `hash_key` The hash of the file for looking up DIFile info
-        static void generate_variable_debug_info(                                   //
-            llvm::IRBuilder<> &builder,                                             //
-            llvm::Function *parent,                                                 //
-            const std::shared_ptr<Scope> scope,                                     //
-            const std::unordered_map<std::string, llvm::Value *const> &allocations, //
-            const Hash &hash_key                                                    //
+        static void generate_variable_debug_info( //
+            llvm::IRBuilder<> &builder,           //
+            llvm::Function *parent,               //
+            const std::shared_ptr<Scope> scope,   //
+            const AllocationMap &allocations,     //
+            const Hash &hash_key                  //
         );
 
         /// @function `generate_parameter_debug_info`
@@ -2788,12 +3315,12 @@ class Generator {
         /// @param `function_node` The FunctionNode (contains parameter list and scope id)
         /// @param `allocations` The map of all allocation GEPs
         /// @param `hash_key` The hash of the file for looking up DIFile info
-        static void generate_parameter_debug_info(                                  //
-            llvm::IRBuilder<> &builder,                                             //
-            llvm::Function *parent,                                                 //
-            const FunctionNode *function_node,                                      //
-            const std::unordered_map<std::string, llvm::Value *const> &allocations, //
-            const Hash &hash_key                                                    //
+        static void generate_parameter_debug_info( //
+            llvm::IRBuilder<> &builder,            //
+            llvm::Function *parent,                //
+            const FunctionNode *function_node,     //
+            const AllocationMap &allocations,      //
+            const Hash &hash_key                   //
         );
     };
 
@@ -2812,17 +3339,50 @@ class Generator {
         /// @param `module_name` The name of the module to generate the dima heads from
         static void generate_dima_heads(llvm::Module *module, const std::string &module_name);
 
+        /// @var `builtin_modules`
+        /// @brief All builtin modules and their names, in the order they are generated in and archived into the static library
+        static constexpr std::array<std::pair<BuiltinLibrary, std::string_view>, 14> builtin_modules = {{
+            {BuiltinLibrary::PRINT, "print"},
+            {BuiltinLibrary::STR, "str"},
+            {BuiltinLibrary::CAST, "cast"},
+            {BuiltinLibrary::ARITHMETIC, "arithmetic"},
+            {BuiltinLibrary::ARRAY, "array"},
+            {BuiltinLibrary::READ, "read"},
+            {BuiltinLibrary::ASSERT, "assert"},
+            {BuiltinLibrary::FILESYSTEM, "filesystem"},
+            {BuiltinLibrary::ENV, "env"},
+            {BuiltinLibrary::SYSTEM, "system"},
+            {BuiltinLibrary::MATH, "math"},
+            {BuiltinLibrary::PARSE, "parse"},
+            {BuiltinLibrary::TIME, "time"},
+            {BuiltinLibrary::DIMA, "dima"},
+        }};
+
+        /// @function `compile_module_bitcode`
+        /// @brief Loads the bitcode of a generated module into a fresh LLVM context and compiles it to its .o file. This function is
+        /// thread-safe, since it does not touch the shared context of the generator
+        ///
+        /// @param `bitcode` The bitcode of the generated module
+        /// @param `module_path` The path of the object file to create, without its file ending
+        /// @param `module_name` The name of the module
+        /// @return `bool` Whether the module was able to be compiled
+        static bool compile_module_bitcode(            //
+            const llvm::SmallVector<char, 0> &bitcode, //
+            const std::filesystem::path &module_path,  //
+            const std::string &module_name             //
+        );
+
         /// @function `generate_module`
-        /// @brief Generates a single module and compiles it to its .o file
+        /// @brief Generates a single module and enqueues its compilation to its .o file on the thread pool
         ///
         /// @param `lib_to_build` The library to build
         /// @param `cache_path` The path to the cache directory
         /// @param `module_name` The name of the generated module
-        /// @return `bool` Whether the module was able to be generated
-        static bool generate_module(                 //
-            const BuiltinLibrary lib_to_build,       //
-            const std::filesystem::path &cache_path, //
-            const std::string &module_name           //
+        /// @return `std::optional<std::future<bool>>` The pending compilation of the module, nullopt if the module could not be generated
+        static std::optional<std::future<bool>> generate_module( //
+            const BuiltinLibrary lib_to_build,                   //
+            const std::filesystem::path &cache_path,             //
+            const std::string &module_name                       //
         );
 
         /// @function `generate_modules`
@@ -3054,6 +3614,26 @@ class Generator {
             /// @return `bool` Whether all refreshs were successful
             static bool refresh_arithmetic_functions(llvm::Module *module);
 
+            /// @function `generate_inline_safe_op`
+            /// @brief Generates an overflow-checked addition, subtraction or multiplication of (vector) integers inline at the use site
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `operation` The operation to generate, either `TOK_PLUS`, `TOK_MINUS` or `TOK_MULT`
+            /// @param `type_str` The name of the operand type, e.g. 'i32' or 'u8x4'
+            /// @param `lhs` The left hand side of the operation
+            /// @param `rhs` The right hand side of the operation
+            /// @return `llvm::Value *` The result of the operation
+            ///
+            /// @note The fast path is a single `*.with.overflow` intrinsic and a rarely taken branch, only the overflowing case calls the
+            /// out-of-line `safe_*` function through a cold call which then handles the overflow depending on the overflow mode
+            static llvm::Value *generate_inline_safe_op( //
+                llvm::IRBuilder<> &builder,              //
+                const Token operation,                   //
+                const std::string &type_str,             //
+                llvm::Value *lhs,                        //
+                llvm::Value *rhs                         //
+            );
+
             /// @function `generate_pow_function`
             /// @brief Generates the pow function for the given integer type
             ///
@@ -4062,28 +4642,92 @@ class Generator {
                 const size_t bit_width                //
             );
 
-            /// @function `generate_parse_f32_function`
-            /// @brief Helper function to generate the parse_f32 function
+            /// @function `generate_parse_float_function`
+            /// @brief Helper function to generate the parse_fX functions for the specified bit width
             ///
             /// @param `builder` The LLVM IRBuilder
             /// @param `module` The LLVM Module the parse function will be generated in
             /// @param `only_declarations` Whether to actually generate the function or to only generate the declaration for it
-            static void generate_parse_f32_function( //
-                llvm::IRBuilder<> *builder,          //
-                llvm::Module *module,                //
-                const bool only_declarations         //
+            /// @param `bit_width` The width of the parsed floating point number, either 32 or 64
+            static void generate_parse_float_function( //
+                llvm::IRBuilder<> *builder,            //
+                llvm::Module *module,                  //
+                const bool only_declarations,          //
+                const size_t bit_width                 //
+            );
+
+          private:
+            /// @var `SMALLEST_POWER_OF_FIVE`
+            /// @brief The smallest power of five contained in the power of five table of the Eisel-Lemire algorithm
+            static constexpr int SMALLEST_POWER_OF_FIVE = -342;
+
+            /// @var `LARGEST_POWER_OF_FIVE`
+            /// @brief The largest power of five contained in the power of five table of the Eisel-Lemire algorithm
+            static constexpr int LARGEST_POWER_OF_FIVE = 308;
+
+            /// @function `generate_parse_error_block`
+            /// @brief Generates a block which returns the given `ErrParse` error from the given parse function
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `module` The LLVM Module the parse function is generated in
+            /// @param `parent` The parse function to add the block to
+            /// @param `function_result_type` The result type of the parse function
+            /// @param `value_id` The value ID of the `ErrParse` error to return
+            /// @param `name` The name of the block
+            /// @return `llvm::BasicBlock *` The generated block, the insert point of the builder is left unchanged
+            static llvm::BasicBlock *generate_parse_error_block( //
+                llvm::IRBuilder<> *builder,                      //
+                llvm::Module *module,                            //
+                llvm::Function *parent,                          //
+                llvm::StructType *function_result_type,          //
+                const unsigned int value_id,                     //
+                const std::string &name                          //
             );
 
-            /// @function `generate_parse_f64_function`
-            /// @brief Helper function to generate the parse_f32 function
+            /// @function `generate_parse_integer`
+            /// @brief Generates the locale-independent parsing of the decimal integer in the given string. Leading whitespace and a sign
+            /// are accepted, everything else has to be a digit
             ///
             /// @param `builder` The LLVM IRBuilder
-            /// @param `module` The LLVM Module the parse function will be generated in
-            /// @param `only_declarations` Whether to actually generate the function or to only generate the declaration for it
-            static void generate_parse_f64_function( //
-                llvm::IRBuilder<> *builder,          //
-                llvm::Module *module,                //
-                const bool only_declarations         //
+            /// @param `module` The LLVM Module the parse function is generated in
+            /// @param `parent` The parse function the parsing is generated in
+            /// @param `input` The `str` to parse
+            /// @param `is_signed` Whether the target type is signed
+            /// @param `bit_width` The width of the target type
+            /// @param `invalid_block` The block to branch to if the input contains an invalid character
+            /// @param `out_of_bounds_block` The block to branch to if the number does not fit into the target type
+            /// @return `llvm::Value *` The parsed i64 value, the builder is left in the block where parsing succeeded
+            static llvm::Value *generate_parse_integer( //
+                llvm::IRBuilder<> *builder,             //
+                llvm::Module *module,                   //
+                llvm::Function *parent,                 //
+                llvm::Value *input,                     //
+                const bool is_signed,                   //
+                const size_t bit_width,                 //
+                llvm::BasicBlock *invalid_block,        //
+                llvm::BasicBlock *out_of_bounds_block   //
+            );
+
+            /// @function `get_power_of_five_table`
+            /// @brief Returns the table of 128 bit approximations of all powers of five the Eisel-Lemire algorithm needs, the table is
+            /// computed and added to the module on first use
+            ///
+            /// @param `module` The LLVM Module to add the table to
+            /// @return `llvm::GlobalVariable *` The table, containing the high and low u64 of each power of five
+            static llvm::GlobalVariable *get_power_of_five_table(llvm::Module *module);
+
+            /// @function `generate_eisel_lemire_function`
+            /// @brief Generates the internal function computing the correctly rounded float bits of w * 10^q using the Eisel-Lemire
+            /// algorithm. It returns -1 for all results which are left to the fallback, like subnormals and overflows
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `module` The LLVM Module the function will be generated in
+            /// @param `bit_width` The width of the floating point number, either 32 or 64
+            /// @return `llvm::Function *` The generated function
+            static llvm::Function *generate_eisel_lemire_function( //
+                llvm::IRBuilder<> *builder,                        //
+                llvm::Module *module,                              //
+                const size_t bit_width                             //
             );
         }; // subclass Parse
 
@@ -4471,7 +5115,7 @@ class Generator {
             static std::optional<llvm::Value *> generate_string_addition(                                                     //
                 llvm::IRBuilder<> &builder,                                                                                   //
                 const std::shared_ptr<Scope> scope,                                                                           //
-                const std::unordered_map<std::string, llvm::Value *const> &allocations,                                       //
+                const AllocationMap &allocations,                                                                             //
                 std::unordered_map<unsigned int, std::vector<std::pair<std::shared_ptr<Type>, llvm::Value *const>>> &garbage, //
                 const unsigned int expr_depth,                                                                                //
                 llvm::Value *lhs,                                                                                             //
@@ -4844,6 +5488,9 @@ class Generator {
             /// @attention The map is not being cleared after the program module has been generated
             static inline std::unordered_map<std::string, llvm::Function *> typecast_functions = {
                 {"count_digits", nullptr},
+                {"write_digits", nullptr},
+                {"to_decimal", nullptr},
+                {"format_decimal", nullptr},
                 {"u8_to_str", nullptr},
                 {"i8_to_str", nullptr},
                 {"u16_to_str", nullptr},
@@ -5046,6 +5693,30 @@ class Generator {
             /// @param `module` The LLVM Module the function is generated in
             static void generate_count_digits_function(llvm::IRBuilder<> *builder, llvm::Module *module);
 
+            /// @function `generate_write_digits_function`
+            /// @brief Function to generate the `write_digits` helper function, which writes the decimal digits of an u64 value backwards
+            /// from the given end pointer, two digits at a time
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `module` The LLVM Module the function is generated in
+            static void generate_write_digits_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+            /// @function `generate_to_decimal_function`
+            /// @brief Function to generate the `to_decimal` helper function, which converts a binary floating point value `c * 2^q` into
+            /// the shortest decimal `digits * 10^exponent` that still rounds back to the same value
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `module` The LLVM Module the function is generated in
+            static void generate_to_decimal_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
+            /// @function `generate_format_decimal_function`
+            /// @brief Function to generate the `format_decimal` helper function, which writes a decimal `digits * 10^exponent` into a new
+            /// string, in fixed notation or in scientific notation for very small and very large values
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `module` The LLVM Module the function is generated in
+            static void generate_format_decimal_function(llvm::IRBuilder<> *builder, llvm::Module *module);
+
             /// @function `generate_bool_to_str`
             /// @brief Function to generate the `bool_to_str` typecast function
             ///
@@ -5096,21 +5767,15 @@ class Generator {
             /// @return `llvm::Value *` The converted u8 value
             static void generate_bool8_to_str_function(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations);
 
-            /// @function `generate_f32_to_str`
-            /// @brief Generates the `f32_to_str` function which is used to convert f32 values to str values
-            ///
-            /// @param `builder` The LLVM IRBuilder
-            /// @param `module` The LLVM Module in which the function is generated in
-            /// @param `only_declarations` Whether to actually generate the function or to only generate the declaration for it
-            static void generate_f32_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations);
-
-            /// @function `generate_f64_to_str`
-            /// @brief Generates the `f64_to_str` function which is used to convert f64 values to str values
+            /// @function `generate_fN_to_str`
+            /// @brief Generates the `f<N>_to_str` function which is used to convert floating point values to the shortest str value that
+            /// parses back to the same value
             ///
             /// @param `builder` The LLVM IRBuilder
             /// @param `module` The LLVM Module in which the function is generated in
             /// @param `only_declarations` Whether to actually generate the function or to only generate the declaration for it
-            static void generate_f64_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations);
+            /// @param `N` The bit width of the floating point value, either 32 or 64
+            static void generate_fN_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations, const size_t N);
 
             /// @function `generate_opaque_to_str`
             /// @brief Generates the `opaque_to_str` function which is used to convert opaque values (pointers) to str values
@@ -5119,6 +5784,48 @@ class Generator {
             /// @param `module` The LLVM Module in which the function is generated in
             /// @param `only_declarations` Whether to actually generate the function or to only generate the declaration for it
             static void generate_opaque_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations);
+
+          private:
+            /// @var `SMALLEST_CACHED_POWER`
+            /// @brief The smallest power of ten whose significand is cached, needed for the largest f64 values
+            static constexpr int SMALLEST_CACHED_POWER = -292;
+
+            /// @var `LARGEST_CACHED_POWER`
+            /// @brief The largest power of ten whose significand is cached, needed for the smallest f64 subnormals
+            static constexpr int LARGEST_CACHED_POWER = 324;
+
+            /// @function `get_powers_of_ten_table`
+            /// @brief Returns the table of all powers of ten fitting into an u64, creating it in the given module if it does not exist yet
+            ///
+            /// @param `module` The LLVM Module the table lives in
+            /// @return `llvm::GlobalVariable *` The `[20 x i64]` table
+            static llvm::GlobalVariable *get_powers_of_ten_table(llvm::Module *module);
+
+            /// @function `get_digit_pairs_table`
+            /// @brief Returns the table of the characters of all two-digit numbers, creating it in the given module if it does not exist
+            /// yet
+            ///
+            /// @param `module` The LLVM Module the table lives in
+            /// @return `llvm::GlobalVariable *` The `[200 x i8]` table
+            static llvm::GlobalVariable *get_digit_pairs_table(llvm::Module *module);
+
+            /// @function `get_power_of_ten_significand_table`
+            /// @brief Returns the table of the 128 bit significands of the powers of ten, rounded up, creating it in the given module if it
+            /// does not exist yet
+            ///
+            /// @param `module` The LLVM Module the table lives in
+            /// @return `llvm::GlobalVariable *` The table of high and low u64 halves
+            static llvm::GlobalVariable *get_power_of_ten_significand_table(llvm::Module *module);
+
+            /// @function `generate_round_to_odd`
+            /// @brief Generates the high 64 bits of the 192 bit product `g * cp`, with the lowest bit set if any of the dropped bits is set
+            ///
+            /// @param `builder` The LLVM IRBuilder
+            /// @param `g_high` The high 64 bits of the 128 bit significand
+            /// @param `g_low` The low 64 bits of the 128 bit significand
+            /// @param `cp` The value to multiply with
+            /// @return `llvm::Value *` The rounded to odd product
+            static llvm::Value *generate_round_to_odd(llvm::IRBuilder<> *builder, llvm::Value *g_high, llvm::Value *g_low, llvm::Value *cp);
         }; // subclass TypeCast
     }; // subclass Module
 };
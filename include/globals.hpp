@@ -24,6 +24,7 @@ extern bool FIP_ENABLED;
 extern bool PRINT_TOK_STREAM;
 extern bool PRINT_LINES;
 extern bool PRINT_PERFORMANCE;
+extern bool PRINT_FRONTEND_TIMINGS;
 extern bool PRINT_DEP_TREE;
 extern bool PRINT_AST;
 extern bool PRINT_IR_PROGRAM;
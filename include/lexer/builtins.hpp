@@ -441,6 +441,19 @@ enum CFunction {
     DUP2,
     FILENO,
     CLOSE,
+    STRCMP,
+    STRSTR,
+    QSORT,
+    FPRINTF,
+    MEMCHR,
+    FERROR,
+#ifndef __WIN32__
+    FORK,
+    WAITPID,
+    MMAP,
+    MUNMAP,
+    MADVISE,
+#endif
 };
 
 static const inline std::unordered_map<std::string_view, std::vector<std::string_view>> primitive_casting_table = {
@@ -19,13 +19,7 @@ class Lexer {
             file_id = UINT32_MAX;
             return;
         }
-        auto it = std::find(Resolver::file_ids.begin(), Resolver::file_ids.end(), file_hash);
-        if (it == Resolver::file_ids.end()) {
-            Resolver::file_ids.push_back(file_hash);
-            file_id = Resolver::file_ids.size() - 1;
-        } else {
-            file_id = static_cast<unsigned int>(std::distance(Resolver::file_ids.begin(), it));
-        }
+        file_id = Resolver::get_file_id(file_hash);
     }
 
     /// @function `scan`
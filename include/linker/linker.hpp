@@ -1,5 +1,7 @@
 #pragma once
 
+#include <llvm/Support/MemoryBufferRef.h>
+
 #include <filesystem>
 #include <optional>
 #include <vector>
@@ -25,6 +27,38 @@ class Linker {
         const bool is_static                                 //
     );
 
+    /// @function `link`
+    /// @brief Links together the given in-memory `program_object` with the given object files and all the needed libraries and creates
+    /// an executable at the `output_file`. The program object is only written to disk if the linker cannot be given an in-memory file
+    ///
+    /// @param `program_object` The contents of the object file of the program
+    /// @param `obj_files` The paths to additional object files to link into the executable
+    /// @param `output_file` The path to the executable to create
+    /// @param `flags` The flags used during linking
+    /// @param `is_static` Whether the executable should be static
+    /// @return `bool` Whether linking and creation of the executable was successful
+    static bool link(                                        //
+        const llvm::MemoryBufferRef program_object,          //
+        const std::vector<std::filesystem::path> &obj_files, //
+        const std::filesystem::path &output_file,            //
+        const std::vector<std::string> &flags,               //
+        const bool is_static                                 //
+    );
+
+    /// @function `get_object_file_ending`
+    /// @brief Returns the file ending of object files for the current compilation target
+    ///
+    /// @return `std::string` The file ending of object files, `.o` or `.obj`
+    static std::string get_object_file_ending();
+
+    /// @function `write_object_file`
+    /// @brief Writes the given object file contents to the given path
+    ///
+    /// @param `object` The contents of the object file
+    /// @param `obj_file` The path to write the object file to
+    /// @return `bool` Whether the object file could be written
+    static bool write_object_file(const llvm::MemoryBufferRef object, const std::filesystem::path &obj_file);
+
     /// @function `create_static_library`
     /// @brief Creates a static `.a` library from the given `.o` files
     ///
@@ -15,10 +15,14 @@ class CallableCallNodeBase : public CallNodeBase {
         std::vector<std::pair<std::unique_ptr<ExpressionNode>, bool>> &arguments, //
         const std::vector<std::shared_ptr<Type>> &error_types,                    //
         const std::shared_ptr<Type> &type,                                        //
-        const std::string &callable_variable                                      //
+        const std::string &callable_variable,                                     //
+        const std::shared_ptr<Type> &callable_type,                               //
+        const unsigned int callable_slot                                          //
         ) :
         CallNodeBase(nullptr, arguments, error_types, type),
-        callable_variable(callable_variable) {}
+        callable_variable(callable_variable),
+        callable_type(callable_type),
+        callable_slot(callable_slot) {}
 
     // deconstructor
     ~CallableCallNodeBase() = default;
@@ -33,6 +37,14 @@ class CallableCallNodeBase : public CallNodeBase {
     /// @brief The callable variable on which this callable call is executed at
     std::string callable_variable;
 
+    /// @var `callable_type`
+    /// @brief The function type of the callable variable
+    std::shared_ptr<Type> callable_type;
+
+    /// @var `callable_slot`
+    /// @brief The variable slot of the callable variable, resolved during parsing
+    unsigned int callable_slot;
+
   protected:
     CallableCallNodeBase() = default;
 };
@@ -79,4 +79,9 @@ class ErrorNode : public DefinitionNode {
     /// @var `error_id`
     /// @brief The ID of the error type, which is generated using hashing of the error type's name
     uint32_t error_id;
+
+    /// @var `dense_id`
+    /// @brief The dense ID of the error type, assigned once the whole program is analyzed. It indexes the error name tables, the ID `0` is
+    /// reserved for the base `anyerror` type
+    uint32_t dense_id{0};
 };
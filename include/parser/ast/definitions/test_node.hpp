@@ -89,6 +89,15 @@ class TestNode : public DefinitionNode {
         test_names.clear();
     }
 
+    /// @function `clear_test_names`
+    /// @brief Clears the test names of the given file
+    ///
+    /// @param `file_name` The name of the file whose test names to clear
+    static void clear_test_names(const std::string &file_name) {
+        std::lock_guard<std::mutex> lock(test_names_mutex);
+        test_names.erase(file_name);
+    }
+
   private:
     /// @var `test_names`
     /// @brief A map which maps each file name to a list of tests defined inside the file
@@ -15,10 +15,12 @@ class CallableCallNodeExpression : public ExpressionNode, public CallableCallNod
         std::vector<std::pair<std::unique_ptr<ExpressionNode>, bool>> &arguments, //
         const std::vector<std::shared_ptr<Type>> &error_types,                    //
         const std::shared_ptr<Type> &type,                                        //
-        const std::string &callable_variable                                      //
+        const std::string &callable_variable,                                     //
+        const std::shared_ptr<Type> &callable_type,                               //
+        const unsigned int callable_slot                                          //
         ) :
         ExpressionNode(hash, pos, true),
-        CallableCallNodeBase(arguments, error_types, type, callable_variable) {
+        CallableCallNodeBase(arguments, error_types, type, callable_variable, callable_type, callable_slot) {
         ExpressionNode::type = type;
     }
 
@@ -31,9 +33,9 @@ class CallableCallNodeExpression : public ExpressionNode, public CallableCallNod
         for (auto &[arg, is_reference] : arguments) {
             arguments_clone.emplace_back(arg->clone(scope_id), is_reference);
         }
-        return std::make_unique<CallableCallNodeExpression>(                      //
-            file_hash, PosTriple{line, column, length},                           //
-            arguments_clone, error_types, ExpressionNode::type, callable_variable //
+        return std::make_unique<CallableCallNodeExpression>(                                                    //
+            file_hash, PosTriple{line, column, length},                                                         //
+            arguments_clone, error_types, ExpressionNode::type, callable_variable, callable_type, callable_slot //
         );
     }
 
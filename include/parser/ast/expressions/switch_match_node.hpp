@@ -11,10 +11,12 @@ class SwitchMatchNode : public ExpressionNode {
         const PosTriple &pos,                   //
         const std::shared_ptr<Type> &type,      //
         const std::optional<std::string> &name, //
+        const unsigned int slot,                //
         const unsigned int id                   //
         ) :
         ExpressionNode(hash, pos, true),
         name(name),
+        slot(slot),
         id(id) {
         this->type = type;
     }
@@ -24,7 +26,7 @@ class SwitchMatchNode : public ExpressionNode {
     }
 
     std::unique_ptr<ExpressionNode> clone([[maybe_unused]] const unsigned int scope_id) const override {
-        return std::make_unique<SwitchMatchNode>(file_hash, PosTriple{line, column, length}, type, name, id);
+        return std::make_unique<SwitchMatchNode>(file_hash, PosTriple{line, column, length}, type, name, slot, id);
     }
 
     /// @var `name`
@@ -33,6 +35,10 @@ class SwitchMatchNode : public ExpressionNode {
     ///           - The variable through which an extracted variant is accessible, nullopt if the extracted variant is of type "void"
     std::optional<std::string> name;
 
+    /// @var `slot`
+    /// @brief The slot of the switch match variable within its function, only meaningful if the match has a name
+    unsigned int slot;
+
     /// @var `id`
     /// @brief The id of the switch match
     unsigned int id;
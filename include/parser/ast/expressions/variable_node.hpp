@@ -13,10 +13,12 @@ class VariableNode : public ExpressionNode {
         const PosTriple &pos,              //
         const std::string &name,           //
         const std::shared_ptr<Type> &type, //
-        const bool is_const                //
+        const bool is_const,               //
+        const unsigned int slot            //
         ) :
         ExpressionNode(hash, pos, is_const),
-        name(name) {
+        name(name),
+        slot(slot) {
         this->type = type;
     }
 
@@ -25,10 +27,15 @@ class VariableNode : public ExpressionNode {
     }
 
     std::unique_ptr<ExpressionNode> clone([[maybe_unused]] const unsigned int scope_id) const override {
-        return std::make_unique<VariableNode>(file_hash, PosTriple{line, column, length}, name, type, is_const);
+        return std::make_unique<VariableNode>(file_hash, PosTriple{line, column, length}, name, type, is_const, slot);
     }
 
     /// @var `name`
     /// @brief Name of the variable
     std::string name;
+
+    /// @var `slot`
+    /// @brief The slot of the variable within its function, resolved once when the node is created so the generator can index the
+    /// allocations of the function with it directly instead of looking the variable up by its name
+    unsigned int slot;
 };
@@ -7,6 +7,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -98,6 +99,11 @@ class Namespace {
     /// will stay relevant and correct over the program's lifetime
     FileNode *file_node{nullptr};
 
+    /// @var `types_mutex`
+    /// @brief Guards the `types` and `unknown_types` maps of the public symbols as well as the `types` map of the private symbols, because
+    /// types are still added to the namespace while function bodies are being parsed or analyzed in parallel
+    mutable std::shared_mutex types_mutex;
+
     /// @function `get_type_from_str`
     /// @brief Finds the type from the given string in this namespace's available types
     ///
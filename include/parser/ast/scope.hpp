@@ -22,6 +22,7 @@ class Scope {
         parent_scope(parent),
         parent_scope_segment(parent_scope_segment) {
         function = parent_scope->function;
+        variable_slot_count = parent_scope->variable_slot_count;
         clone_variables(parent);
     }
 
@@ -34,6 +35,7 @@ class Scope {
         parent_scope(parent),
         parent_scope_segment(parent_scope_segment) {
         function = parent_scope->function;
+        variable_slot_count = parent_scope->variable_slot_count;
     }
 
     /// @type `Variable`
@@ -92,6 +94,12 @@ class Scope {
         /// @brief The column where this variable was declared
         unsigned int column = 0;
 
+        /// @var `slot`
+        /// @brief The slot of this variable, which is unique among all variables of the function the variable is declared in and dense,
+        /// starting at 0. The generator keeps the allocations of all variables in a flat list indexed by this slot. It is assigned when
+        /// the variable is added to its scope and all nested scopes share the slot of the variable
+        unsigned int slot = 0;
+
         bool operator==(const Variable &other) const {
             return type->equals(other.type)                       //
                 && scope_id == other.scope_id                     //
@@ -125,6 +133,7 @@ class Scope {
     void set_parent(std::shared_ptr<Scope> parent) {
         parent_scope = parent;
         function = parent->function;
+        variable_slot_count = parent->variable_slot_count;
     }
 
     /// @function `clone_variable_types`
@@ -135,13 +144,31 @@ class Scope {
     bool clone_variables(const std::shared_ptr<Scope> other);
 
     /// @function `add_variable_type`
-    /// @brief Adds the given variable and its type to the list of variable types
+    /// @brief Adds the given variable and its type to the list of variable types. The variable gets the next free slot of the function
+    /// this scope belongs to
     ///
     /// @param `var_name` The name of the added variable
     /// @param `variable` The variable to insert
     /// @return `bool` Whether insertion of the variable type was successful. If not, this means a variable is shadowed
     bool add_variable(const std::string &var_name, const Variable &variable);
 
+    /// @function `reserve_variable_slot`
+    /// @brief Hands out the next free slot of the function this scope belongs to without adding a variable for it. Used for hidden
+    /// allocations like the index counter of an enhanced for loop whose index is discarded
+    ///
+    /// @return `unsigned int` The reserved slot
+    unsigned int reserve_variable_slot() {
+        return (*variable_slot_count)++;
+    }
+
+    /// @function `get_variable_slot_count`
+    /// @brief Returns the number of variable slots handed out in the function this scope belongs to so far
+    ///
+    /// @return `unsigned int` The number of variable slots
+    unsigned int get_variable_slot_count() const {
+        return *variable_slot_count;
+    }
+
     /// @function `get_variable_type`
     /// @brief Return the type of the given variable name, if it exists
     ///
@@ -198,6 +225,11 @@ class Scope {
     std::variant<FunctionNode *, TestNode *> function;
 
   private:
+    /// @var `variable_slot_count`
+    /// @brief The number of variable slots handed out so far. This counter is shared between the root scope of a function and all scopes
+    /// nested within it, so that every variable of the function gets its own slot
+    std::shared_ptr<unsigned int> variable_slot_count = std::make_shared<unsigned int>(0);
+
     /// @function `get_next_scope_id`
     /// @brief Returns the next scope id. Ensures that each scope gets its own id for the lifetime of the program
     static unsigned inline int get_next_scope_id() {
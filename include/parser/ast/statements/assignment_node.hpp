@@ -5,6 +5,7 @@
 #include "types.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -17,12 +18,14 @@ class AssignmentNode : public StatementNode {
         const token_slice &tokens,                   //
         const std::shared_ptr<Type> &type,           //
         const std::string &name,                     //
+        const std::optional<unsigned int> slot,      //
         std::unique_ptr<ExpressionNode> &expression, //
         const bool is_shorthand = false              //
         ) :
         StatementNode(hash, tokens),
         type(type),
         name(name),
+        slot(slot),
         expression(std::move(expression)),
         is_shorthand(is_shorthand) {}
 
@@ -49,6 +52,10 @@ class AssignmentNode : public StatementNode {
     /// @brief The name of the variable being assigned to
     std::string name;
 
+    /// @var `slot`
+    /// @brief The slot of the assigned variable within its function, nullopt for discard assignments `_ = expr`
+    std::optional<unsigned int> slot;
+
     /// @var `expression`
     /// @brief The expression to assign
     std::unique_ptr<ExpressionNode> expression;
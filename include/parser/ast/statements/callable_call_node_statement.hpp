@@ -13,10 +13,12 @@ class CallableCallNodeStatement : public StatementNode, public CallableCallNodeB
         std::vector<std::pair<std::unique_ptr<ExpressionNode>, bool>> &arguments, //
         const std::vector<std::shared_ptr<Type>> &error_types,                    //
         const std::shared_ptr<Type> &type,                                        //
-        const std::string &callable_variable                                      //
+        const std::string &callable_variable,                                     //
+        const std::shared_ptr<Type> &callable_type,                               //
+        const unsigned int callable_slot                                          //
         ) :
         StatementNode(hash, tokens),
-        CallableCallNodeBase(arguments, error_types, type, callable_variable) {}
+        CallableCallNodeBase(arguments, error_types, type, callable_variable, callable_type, callable_slot) {}
 
     Variation get_variation() const override {
         return Variation::CALLABLE_CALL;
@@ -15,11 +15,13 @@ class CatchNode : public StatementNode {
         const Hash &hash,                           //
         const token_slice &tokens,                  //
         const std::optional<std::string> &var_name, //
+        const unsigned int err_slot,                //
         const std::shared_ptr<Scope> &scope,        //
         CallNodeBase *const call_node               //
         ) :
         StatementNode(hash, tokens),
         var_name(var_name),
+        err_slot(err_slot),
         scope(scope),
         call_node(call_node) {}
 
@@ -42,6 +44,10 @@ class CatchNode : public StatementNode {
     /// @brief The name of the catch variable. Could be none too, then the catch block behaves differently
     std::optional<std::string> var_name;
 
+    /// @var `err_slot`
+    /// @brief The variable slot of the error value, either the slot of the catch variable or of the implicit switch's error value
+    unsigned int err_slot;
+
     /// @var `scope`
     /// @brief The scope of the catch block
     std::shared_ptr<Scope> scope;
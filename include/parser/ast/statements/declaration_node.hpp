@@ -17,12 +17,14 @@ class DeclarationNode : public StatementNode {
         const token_slice &tokens,                                  //
         const std::shared_ptr<Type> &type,                          //
         const std::string &name,                                    //
+        const unsigned int slot,                                    //
         const bool is_persistent,                                   //
         std::optional<std::unique_ptr<ExpressionNode>> &initializer //
         ) :
         StatementNode(hash, tokens),
         type(type),
         name(name),
+        slot(slot),
         is_persistent(is_persistent),
         initializer(std::move(initializer)) {}
 
@@ -49,6 +51,10 @@ class DeclarationNode : public StatementNode {
     /// @brief The name of the variable
     std::string name;
 
+    /// @var `slot`
+    /// @brief The slot of the declared variable within its function, resolved when the variable is added to its scope
+    unsigned int slot;
+
     /// @var `is_persistent`
     /// @brief Whether the declared variable is persistent
     bool is_persistent;
@@ -5,6 +5,7 @@
 #include "statement_node.hpp"
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <variant>
 
@@ -17,12 +18,16 @@ class EnhForLoopNode : public StatementNode {
         const Hash &hash,                                                                                              //
         const token_slice &tokens,                                                                                     //
         const std::variant<std::pair<std::optional<std::string>, std::optional<std::string>>, std::string> &iterators, //
+        const unsigned int index_slot,                                                                                 //
+        const std::optional<unsigned int> element_slot,                                                                //
         std::unique_ptr<ExpressionNode> &iterable,                                                                     //
         std::shared_ptr<Scope> &definition_scope,                                                                      //
         std::shared_ptr<Scope> &body                                                                                   //
         ) :
         StatementNode(hash, tokens),
         iterators(iterators),
+        index_slot(index_slot),
+        element_slot(element_slot),
         iterable(std::move(iterable)),
         definition_scope(std::move(definition_scope)),
         body(std::move(body)) {}
@@ -46,6 +51,15 @@ class EnhForLoopNode : public StatementNode {
     /// @brief Either a pair of index and element or a single value, which then is the tuple iteration
     std::variant<std::pair<std::optional<std::string>, std::optional<std::string>>, std::string> iterators;
 
+    /// @var `index_slot`
+    /// @brief The variable slot of the tuple for tuple iterations, otherwise the slot of the index variable. If the index is discarded
+    /// this is a reserved slot of the hidden index counter
+    unsigned int index_slot;
+
+    /// @var `element_slot`
+    /// @brief The variable slot of the element variable, if the element is not discarded and no tuple iteration is done
+    std::optional<unsigned int> element_slot;
+
     /// @var `iterable`
     /// @brief The iterable to iterate through
     std::unique_ptr<ExpressionNode> iterable;
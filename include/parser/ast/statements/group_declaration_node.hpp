@@ -16,10 +16,12 @@ class GroupDeclarationNode : public StatementNode {
         const Hash &hash,                                                            //
         const token_slice &tokens,                                                   //
         const std::vector<std::pair<std::shared_ptr<Type>, std::string>> &variables, //
+        const std::vector<unsigned int> &slots,                                      //
         std::unique_ptr<ExpressionNode> &initializer                                 //
         ) :
         StatementNode(hash, tokens),
         variables(variables),
+        slots(slots),
         initializer(std::move(initializer)) {}
 
     Variation get_variation() const override {
@@ -41,6 +43,11 @@ class GroupDeclarationNode : public StatementNode {
     /// @brief A list containing the types and names of the variables
     std::vector<std::pair<std::shared_ptr<Type>, std::string>> variables;
 
+    /// @var `slots`
+    /// @brief The slots of the declared variables within their function, in the same order as the `variables`. The slot of a discarded
+    /// variable is unused
+    std::vector<unsigned int> slots;
+
     /// @var `initializer`
     /// @brief The expression with which the group will be initialized with
     std::unique_ptr<ExpressionNode> initializer;
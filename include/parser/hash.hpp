@@ -6,6 +6,10 @@
 #include <array>
 #include <cstring>
 #include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
 
 /// @class `Hash`
 /// @brief A small wrapper class around the `array<char, 8>` hash type, to make it copy-constructible to be used as the key of a map
@@ -14,6 +18,60 @@
 /// characters (a-z, A-Z, 1-9) making it 61 characters in total, meaning the hash could map to 61^8 ~ 2^48 possible absolute paths
 struct Hash {
   private:
+    /// @struct `PathEntry`
+    /// @brief An entry of the `path_table`, containing everything a `Hash` needs from its file path
+    struct PathEntry {
+        /// @var `absolute_path`
+        /// @brief The absolute and lexically normalized path of the file
+        std::filesystem::path absolute_path;
+
+        /// @var `value`
+        /// @brief The hash value of the normalized file path
+        std::array<char, 8> value;
+    };
+
+    /// @var `path_table`
+    /// @brief Interns all file paths a hash has been created from, keyed by the canonical form of the path. Creating a hash from a path
+    /// needs multiple filesystem calls, and the same few paths are hashed over and over again (for every file, import and diagnostic).
+    /// Entries are never removed, so references to them stay valid
+    static inline std::unordered_map<std::string, PathEntry> path_table;
+
+    /// @var `path_spellings`
+    /// @brief Maps every spelling a path has been hashed with to its entry in the `path_table`, so that a path is only canonicalized the
+    /// first time it is seen and all spellings of the same file share a single entry
+    static inline std::unordered_map<std::string, const PathEntry *> path_spellings;
+
+    /// @var `path_table_mutex`
+    /// @brief A mutex for thread-safe access on the `path_table` and the `path_spellings`
+    static inline std::shared_mutex path_table_mutex;
+
+    /// @function `intern_path`
+    /// @brief Returns the path table entry of the given file path, creating it if the path is hashed for the first time
+    ///
+    /// @param `file_path` The non-empty file path to intern
+    /// @return `const PathEntry &` The interned entry of the file path
+    static const PathEntry &intern_path(const std::filesystem::path &file_path) {
+        const std::string spelling = file_path.string();
+        {
+            std::shared_lock<std::shared_mutex> lock(path_table_mutex);
+            const auto it = path_spellings.find(spelling);
+            if (it != path_spellings.end()) {
+                return *it->second;
+            }
+        }
+        // The path is canonicalized once, both the absolute path and the hash are derived from the canonical path
+        std::filesystem::path canonical_path = std::filesystem::absolute(file_path).lexically_normal();
+        std::string canonical_key = canonical_path.string();
+        std::unique_lock<std::shared_mutex> lock(path_table_mutex);
+        auto it = path_table.find(canonical_key);
+        if (it == path_table.end()) {
+            PathEntry entry{canonical_path, string_to_hash(normalize_path_for_hashing(canonical_path))};
+            it = path_table.emplace(std::move(canonical_key), std::move(entry)).first;
+        }
+        // Another thread could have interned the same spelling in the meantime, in that case the already stored entry is returned
+        return *path_spellings.emplace(spelling, &it->second).first->second;
+    }
+
     /// @function `normalize_path_for_hashing`
     /// @brief Normalizes a file path for hashing by converting it to a relative path from the current working directory.
     /// This ensures that the same source file produces the same hash regardless of where it's located on the filesystem.
@@ -44,9 +102,15 @@ struct Hash {
         path(""),
         value(string_to_hash(hash_string)) {}
 
-    explicit Hash(const std::filesystem::path &file_path) :
-        path(file_path.empty() ? file_path : std::filesystem::absolute(file_path)),
-        value(string_to_hash(normalize_path_for_hashing(file_path))) {}
+    explicit Hash(const std::filesystem::path &file_path) {
+        if (file_path.empty()) {
+            value = string_to_hash("");
+            return;
+        }
+        const PathEntry &entry = intern_path(file_path);
+        path = entry.absolute_path;
+        value = entry.value;
+    }
 
     /// @var `path`
     /// @brief The path this hash was used to be generated from
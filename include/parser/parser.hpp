@@ -57,7 +57,9 @@
 #include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <tuple>
+#include <unordered_set>
 #include <utility>
 
 /// @class `Parser`
@@ -132,20 +134,38 @@ class Parser {
         return source_code_lines;
     }
 
+    /// @function `get_file_path`
+    /// @brief Returns the path of the file this parser instance has parsed
+    ///
+    /// @return `const std::filesystem::path &` The path of the parsed file
+    const std::filesystem::path &get_file_path() const {
+        return file;
+    }
+
+    /// @function `get_source_code`
+    /// @brief Returns the complete source code this parser instance has parsed
+    ///
+    /// @return `const std::string &` The source code of the parsed file
+    const std::string &get_source_code() const {
+        return *source_code;
+    }
+
     /// @function `resolve_all_imports`
     /// @brief Resolves all imports and puts all public symbols of imported files into the private symbol list of the file's namespace. This
     /// also checks for multiple definitions of the same symbol in multiple imported files and prints that it has defined at multiple places
     ///
+    /// @param `first_instance` The index of the first instance whose imports to resolve, all instances before it are already resolved
     /// @return `bool` Whether everything went as expected
-    static bool resolve_all_imports();
+    static bool resolve_all_imports(const size_t first_instance = 0);
 
     /// @function `resolve_all_unknown_types`
     /// @brief Resolves all unknown types to point to real types
     ///
+    /// @param `first_instance` The index of the first instance whose unknown types to resolve, all instances before it are already resolved
     /// @return `bool` Whether all unknown types could be resolved correctly
     ///
     /// @note Also substitutes all unknown types if the unknown type is an aliased type
-    static bool resolve_all_unknown_types();
+    static bool resolve_all_unknown_types(const size_t first_instance = 0);
 
     /// @function `get_open_functions`
     /// @brief Returns all open functions whose bodies have not been parsed yet
@@ -221,6 +241,71 @@ class Parser {
     /// @return `bool` Wheter all objects were able to be parsed
     static bool parse_all_open_objects(const bool parse_parallel);
 
+    /// @typedef `open_function`
+    /// @brief An open function together with the parser instance it belongs to and the lines of its body
+    using open_function = std::tuple<Parser &, FunctionNode *, std::vector<Line>>;
+
+    /// @typedef `open_test`
+    /// @brief An open test together with the parser instance it belongs to and the lines of its body
+    using open_test = std::tuple<Parser &, TestNode *, std::vector<Line>>;
+
+    /// @struct `PhaseTiming`
+    /// @brief The timing of a single front-end phase. All phases up to and including the parsing of objects are separated by global
+    /// barriers, so their lower bound equals their wall time. Only in the pipelined body phase the files proceed independently of each
+    /// other, its lower bound is the slowest body followed by the slowest analysis range of any single file. This is not a traced
+    /// dependency chain, it is the wall time the phase could not go below even with unlimited workers
+    struct PhaseTiming {
+        /// @var `name`
+        /// @brief The name of the phase
+        std::string name;
+
+        /// @var `wall_ns`
+        /// @brief The wall-clock time the phase took, in nanoseconds
+        uint64_t wall_ns;
+
+        /// @var `lower_bound_ns`
+        /// @brief The lower bound of the wall-clock time of the phase, in nanoseconds
+        uint64_t lower_bound_ns;
+
+        /// @var `bounding_file`
+        /// @brief The name of the file which determines the lower bound, empty for barrier phases
+        std::string bounding_file;
+    };
+
+    /// @var `phase_timings`
+    /// @brief The timings of all front-end phases of the last `parse_program` call, in the order they were executed
+    static inline std::vector<PhaseTiming> phase_timings;
+
+    /// @function `print_phase_timings`
+    /// @brief Prints the timings of all front-end phases recorded in the `phase_timings` list
+    static void print_phase_timings();
+
+    /// @function `collect_open_functions`
+    /// @brief Collects all still open functions, refines their body lines and creates the anonymous error sets of all functions. After
+    /// this function returned, all signatures any function body could refer to are known
+    ///
+    /// @param `only_file` Only collect the functions from the given file hash
+    /// @return `std::optional<std::vector<open_function>>` All collected open functions, nullopt if creating an anonymous error set failed
+    static std::optional<std::vector<open_function>> collect_open_functions(const std::optional<Hash> &only_file = std::nullopt);
+
+    /// @function `collect_open_tests`
+    /// @brief Collects all still open tests and refines their body lines
+    ///
+    /// @return `std::vector<open_test>` All collected open tests
+    static std::vector<open_test> collect_open_tests();
+
+    /// @function `parse_and_analyze_bodies`
+    /// @brief Parses all open function and test bodies and analyzes all files as a task graph on the thread pool. Every body is its own
+    /// task and a file is analyzed as soon as all of its own bodies are parsed, so there is no barrier between the body parsing of one file
+    /// and the analysis of another. All errors are emitted in file order once the task graph has finished
+    ///
+    /// @param `is_test` Whether to parse the open tests too
+    /// @return `bool` Whether all bodies were parsed and all files were analyzed successfully
+    ///
+    /// @note All signatures (data, objects, function signatures and anonymous error sets) need to be resolved before calling this. The
+    /// import resolution, unknown type resolution and the parsing of data and objects before it still run as global barriers
+    static bool parse_and_analyze_bodies(const bool is_test);
+
     /// @function `parse_open_function`
     /// @brief Parses a single open function body
     ///
@@ -281,6 +366,15 @@ class Parser {
         }
     }
 
+    /// @function `remove_instances`
+    /// @brief Removes the parser instances of the given files and everything which refers to their nodes, while all other instances are
+    /// kept. The kept instances of all files which import one of the given files still refer to the nodes of the removed instances, so
+    /// the removed instances are returned to be kept alive for as long as those files are kept
+    ///
+    /// @param `file_hashes` The hashes of the files whose parser instances to remove
+    /// @return `std::vector<Parser>` The removed parser instances, with their open lists already cleared
+    static std::vector<Parser> remove_instances(const std::unordered_set<Hash> &file_hashes);
+
     /// @function `get_builtin_function`
     /// @brief Returns the module the builtin function is contained in, as well as the function overloads and possible aliases for it
     ///
@@ -390,7 +484,7 @@ class Parser {
     explicit Parser(const std::filesystem::path &file) :
         file(file),
         file_name(file.filename().string()),
-        file_hash(Hash(std::filesystem::absolute(file))) {
+        file_hash(Hash(file)) {
         if (!IO::file_exists_and_is_readable(file)) {
             throw std::runtime_error("The passed file '" + file.string() + "' could not be opened!");
         }
@@ -400,7 +494,7 @@ class Parser {
         source_code(std::make_unique<std::string>(file_content)),
         file(file),
         file_name(file.filename().string()),
-        file_hash(Hash(std::filesystem::absolute(file))) {}
+        file_hash(Hash(file)) {}
 
     /// @var `token_precedence`
     /// @brief
@@ -11,7 +11,9 @@ class AliasType : public Type {
   public:
     AliasType(const std::string &alias, const std::shared_ptr<Type> &type) :
         alias(alias),
-        type(type) {}
+        type(type) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::ALIAS;
@@ -29,12 +31,9 @@ class AliasType : public Type {
         return type->get_hash();
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::ALIAS) {
-            return type->equals(other);
-        }
-        const AliasType *const other_type = other->as<AliasType>();
-        return type->equals(other_type->type);
+    std::string get_intern_key() const override {
+        // An alias is the very same type as the type it aliases
+        return type->get_intern_key();
     }
 
     std::string to_string() const override {
@@ -15,6 +15,7 @@ class ArrayType : public Type {
         type(type),
         sizes(sizes) {
         ASSERT(!sizes.has_value() || dimensionality == sizes.value().size());
+        intern();
     }
 
     Variation get_variation() const override {
@@ -34,18 +35,14 @@ class ArrayType : public Type {
         return type->get_hash();
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::ARRAY) {
-            return false;
-        }
-        const ArrayType *other_type = other->as<ArrayType>();
-        if (dimensionality != other_type->dimensionality) {
-            return false;
-        }
-        if (sizes != other_type->sizes) {
-            return false;
+    std::string get_intern_key() const override {
+        std::string key = "a" + std::to_string(dimensionality) + ":" + std::to_string(type->get_interned_id());
+        if (sizes.has_value()) {
+            for (const size_t size : sizes.value()) {
+                key += "," + std::to_string(size);
+            }
         }
-        return type->equals(other_type->type);
+        return key;
     }
 
     std::string to_string() const override {
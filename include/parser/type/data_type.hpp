@@ -8,7 +8,9 @@
 class DataType : public Type {
   public:
     DataType(DataNode *const data_node) :
-        data_node(data_node) {}
+        data_node(data_node) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::DATA;
@@ -26,12 +28,8 @@ class DataType : public Type {
         return data_node->file_hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::DATA) {
-            return false;
-        }
-        const DataType *const other_type = other->as<DataType>();
-        return data_node == other_type->data_node;
+    std::string get_intern_key() const override {
+        return "d" + data_node->file_hash.to_string() + "." + data_node->name;
     }
 
     std::string to_string() const override {
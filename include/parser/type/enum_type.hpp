@@ -8,7 +8,9 @@
 class EnumType : public Type {
   public:
     EnumType(EnumNode *const enum_node) :
-        enum_node(enum_node) {}
+        enum_node(enum_node) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::ENUM;
@@ -26,12 +28,8 @@ class EnumType : public Type {
         return enum_node->file_hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::ENUM) {
-            return false;
-        }
-        const EnumType *const other_type = other->as<EnumType>();
-        return enum_node == other_type->enum_node;
+    std::string get_intern_key() const override {
+        return "e" + enum_node->file_hash.to_string() + "." + enum_node->name;
     }
 
     std::string to_string() const override {
@@ -8,7 +8,9 @@
 class ErrorSetType : public Type {
   public:
     ErrorSetType(ErrorNode *const error_node) :
-        error_node(error_node) {}
+        error_node(error_node) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::ERROR_SET;
@@ -26,12 +28,8 @@ class ErrorSetType : public Type {
         return error_node->file_hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::ERROR_SET) {
-            return false;
-        }
-        const ErrorSetType *const other_type = other->as<ErrorSetType>();
-        return error_node == other_type->error_node;
+    std::string get_intern_key() const override {
+        return "E" + error_node->file_hash.to_string() + "." + error_node->name;
     }
 
     std::string to_string() const override {
@@ -17,7 +17,9 @@ class FnType : public Type {
         ) :
         params(params),
         return_types(return_types),
-        error_types(error_types) {}
+        error_types(error_types) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::FN;
@@ -36,12 +38,17 @@ class FnType : public Type {
         return Hash(std::string(""));
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::FN) {
-            return false;
+    std::string get_intern_key() const override {
+        // The error types are not part of the identity of a fn type, only its parameters and its return types are
+        std::string key = "f(";
+        for (const auto &[param_type, is_mutable] : params) {
+            key += std::to_string(param_type->get_interned_id()) + (is_mutable ? "m," : ",");
+        }
+        key += ")";
+        for (const auto &return_type : return_types) {
+            key += std::to_string(return_type->get_interned_id()) + ",";
         }
-        const FnType *const other_type = other->as<FnType>();
-        return params == other_type->params && return_types == other_type->return_types;
+        return key;
     }
 
     std::string to_string() const override {
@@ -75,7 +82,7 @@ class FnType : public Type {
             }
         }
         ASSERT(!error_types.empty());
-        ASSERT(error_types.front()->to_string() == "anyerror");
+        ASSERT(error_types.front()->is(Type::Builtin::ANYERROR));
         if (error_types.size() > 1) {
             ss << " {";
             for (size_t i = 1; i < error_types.size(); i++) {
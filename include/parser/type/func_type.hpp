@@ -8,7 +8,9 @@
 class FuncType : public Type {
   public:
     FuncType(FuncNode *const func_node) :
-        func_node(func_node) {}
+        func_node(func_node) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::FUNC;
@@ -26,12 +28,8 @@ class FuncType : public Type {
         return func_node->file_hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::FUNC) {
-            return false;
-        }
-        const FuncType *const other_type = other->as<FuncType>();
-        return func_node == other_type->func_node;
+    std::string get_intern_key() const override {
+        return "F" + func_node->file_hash.to_string() + "." + func_node->name;
     }
 
     std::string to_string() const override {
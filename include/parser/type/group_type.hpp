@@ -11,7 +11,9 @@
 class GroupType : public Type {
   public:
     GroupType(const std::vector<std::shared_ptr<Type>> &types) :
-        types(types) {}
+        types(types) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::GROUP;
@@ -43,20 +45,12 @@ class GroupType : public Type {
         return value_hashes.front();
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::GROUP) {
-            return false;
-        }
-        const GroupType *const other_type = other->as<GroupType>();
-        if (types.size() != other_type->types.size()) {
-            return false;
-        }
-        for (size_t i = 0; i < types.size(); i++) {
-            if (!types.at(i)->equals(other_type->types.at(i))) {
-                return false;
-            }
+    std::string get_intern_key() const override {
+        std::string key = "g";
+        for (const auto &type : types) {
+            key += std::to_string(type->get_interned_id()) + ",";
         }
-        return true;
+        return key;
     }
 
     std::string to_string() const override {
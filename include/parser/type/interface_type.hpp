@@ -8,7 +8,9 @@
 class InterfaceType : public Type {
   public:
     InterfaceType(InterfaceNode *const interface_node) :
-        interface_node(interface_node) {}
+        interface_node(interface_node) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::INTERFACE;
@@ -26,12 +28,8 @@ class InterfaceType : public Type {
         return interface_node->file_hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::INTERFACE) {
-            return false;
-        }
-        const InterfaceType *const other_type = other->as<InterfaceType>();
-        return interface_node == other_type->interface_node;
+    std::string get_intern_key() const override {
+        return "i" + interface_node->file_hash.to_string() + "." + interface_node->name;
     }
 
     std::string to_string() const override {
@@ -8,7 +8,9 @@
 class ObjectType : public Type {
   public:
     ObjectType(ObjectNode *const object_node) :
-        object_node(object_node) {}
+        object_node(object_node) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::OBJECT;
@@ -26,12 +28,8 @@ class ObjectType : public Type {
         return object_node->file_hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::OBJECT) {
-            return false;
-        }
-        const ObjectType *const other_type = other->as<ObjectType>();
-        return object_node == other_type->object_node;
+    std::string get_intern_key() const override {
+        return "o" + object_node->file_hash.to_string() + "." + object_node->name;
     }
 
     std::string to_string() const override {
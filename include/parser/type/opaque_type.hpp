@@ -12,11 +12,15 @@ class OpaqueType : public Type {
   public:
     explicit OpaqueType(const std::string &name, const Hash &hash) :
         name(name),
-        hash(hash) {}
+        hash(hash) {
+        intern();
+    }
 
     explicit OpaqueType() :
         name(std::nullopt),
-        hash(Hash(std::string(""))) {}
+        hash(Hash(std::string(""))) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::OPAQUE;
@@ -36,12 +40,8 @@ class OpaqueType : public Type {
         return hash;
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::OPAQUE) {
-            return false;
-        }
-        const OpaqueType *const other_type = other->as<OpaqueType>();
-        return name == other_type->name;
+    std::string get_intern_key() const override {
+        return name.has_value() ? "O:" + name.value() : "O";
     }
 
     std::string to_string() const override {
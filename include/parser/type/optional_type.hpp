@@ -10,7 +10,9 @@
 class OptionalType : public Type {
   public:
     OptionalType(const std::shared_ptr<Type> &base_type) :
-        base_type(base_type) {}
+        base_type(base_type) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::OPTIONAL;
@@ -28,12 +30,8 @@ class OptionalType : public Type {
         return base_type->get_hash();
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::OPTIONAL) {
-            return false;
-        }
-        const OptionalType *const other_type = other->as<OptionalType>();
-        return base_type->equals(other_type->base_type);
+    std::string get_intern_key() const override {
+        return "?" + std::to_string(base_type->get_interned_id());
     }
 
     std::string to_string() const override {
@@ -8,14 +8,16 @@
 class PrimitiveType : public Type {
   public:
     PrimitiveType(const std::string &type_name) :
-        type_name(type_name) {}
+        type_name(type_name) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::PRIMITIVE;
     }
 
     bool is_freeable() const override {
-        return type_name == "str";
+        return is(Builtin::STR);
     }
 
     bool is_dima_managed() const override {
@@ -26,12 +28,8 @@ class PrimitiveType : public Type {
         return Hash(std::string(""));
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::PRIMITIVE) {
-            return false;
-        }
-        const PrimitiveType *const other_type = other->as<PrimitiveType>();
-        return type_name == other_type->type_name;
+    std::string get_intern_key() const override {
+        return "p" + type_name;
     }
 
     std::string to_string() const override {
@@ -8,7 +8,9 @@
 class RangeType : public Type {
   public:
     RangeType(const std::shared_ptr<Type> &bound_type) :
-        bound_type(bound_type) {}
+        bound_type(bound_type) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::RANGE;
@@ -26,12 +28,8 @@ class RangeType : public Type {
         return Hash(std::string(""));
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::RANGE) {
-            return false;
-        }
-        const RangeType *const other_type = other->as<RangeType>();
-        return bound_type->equals(other_type->bound_type);
+    std::string get_intern_key() const override {
+        return "r" + std::to_string(bound_type->get_interned_id());
     }
 
     std::string to_string() const override {
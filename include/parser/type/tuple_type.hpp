@@ -10,7 +10,9 @@
 class TupleType : public Type {
   public:
     TupleType(const std::vector<std::shared_ptr<Type>> &types) :
-        types(types) {}
+        types(types) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::TUPLE;
@@ -48,20 +50,12 @@ class TupleType : public Type {
         return value_hashes.front();
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::TUPLE) {
-            return false;
-        }
-        const TupleType *const other_type = other->as<TupleType>();
-        if (types.size() != other_type->types.size()) {
-            return false;
-        }
-        for (size_t i = 0; i < types.size(); i++) {
-            if (!types.at(i)->equals(other_type->types.at(i))) {
-                return false;
-            }
+    std::string get_intern_key() const override {
+        std::string key = "t";
+        for (const auto &type : types) {
+            key += std::to_string(type->get_interned_id()) + ",";
         }
-        return true;
+        return key;
     }
 
     std::string to_string() const override {
@@ -2,10 +2,13 @@
 
 #include "assert.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 // Forward-declaration of the hash to prevent circular dependencies
@@ -18,9 +21,51 @@ class Type {
   protected:
     Type() = default;
 
+    /// @function `Type`
+    /// @brief Copying a type does not copy its interned ID, because copies are usually modified right after being created. The copy is
+    /// interned when its ID is needed for the first time
+    Type(const Type &) {}
+
+    Type &operator=(const Type &) {
+        interned_id.store(0, std::memory_order_relaxed);
+        interned_epoch.store(0, std::memory_order_release);
+        return *this;
+    }
+
   public:
     virtual ~Type() = default;
 
+    /// @enum `Builtin`
+    /// @brief All builtin types which are checked for very often. Every type whose string representation matches one of these names gets
+    /// the enum value as its interned ID, so checking whether a type is one of these is a single integer comparison
+    enum class Builtin : uint32_t {
+        NONE = 0,
+        U8,
+        I8,
+        U16,
+        I16,
+        U32,
+        I32,
+        U64,
+        I64,
+        F32,
+        F64,
+        BOOL,
+        STR,
+        FLINT_STR,
+        STR_LIT,
+        DEFAULT,
+        VOID,
+        VOID_OPT,
+        VOID_PTR,
+        ANYERROR,
+        INT,
+        FLOAT,
+        BOOL8,
+        STR_ARRAY,
+        COUNT,
+    };
+
     /// @var `types`
     /// @brief A global type register map to track all currently active types
     static inline std::unordered_map<std::string, std::shared_ptr<Type>> types;
@@ -60,11 +105,22 @@ class Type {
     virtual Variation get_variation() const = 0;
 
     /// @function `equals`
-    /// @brief Function to check whether this type is equal to a different type
+    /// @brief Function to check whether this type is equal to a different type. Two types are equal exactly when their interned IDs are
+    /// equal, an ID which is out of date is interned again before it is compared
     ///
     /// @param `other` The other type to compare this type against
     /// @return `bool` Whether the types are equal
-    virtual bool equals(const std::shared_ptr<Type> &other) const = 0;
+    bool equals(const std::shared_ptr<Type> &other) const {
+        return get_interned_id() == other->get_interned_id();
+    }
+
+    /// @function `get_intern_key`
+    /// @brief Returns the key this type is interned with. Structural types build their key from the interned IDs of the types they
+    /// contain, nominal types from the hash of the file they are defined in and their name, so two types have the same key exactly when
+    /// they are the same type. The key of a nominal type stays the same when its file is parsed again
+    ///
+    /// @return `std::string` The intern key of this type
+    virtual std::string get_intern_key() const = 0;
 
     /// @function `is_freeable`
     /// @brief Whether this type is freeable, e.g. if freeing it needs special-case handling (for example for data, objects etc)
@@ -131,6 +187,41 @@ class Type {
     /// @return `uint32_t` The unique ID of this type
     uint32_t get_id() const;
 
+    /// @function `get_interned_id`
+    /// @brief Returns the interned ID of this type. Builtin types always have their `Builtin` enum value as their ID, all other types
+    /// have an ID above `Builtin::COUNT` which they share with all other types of the same intern key
+    ///
+    /// @return `uint32_t` The interned ID of this type
+    uint32_t get_interned_id() const {
+        const uint32_t epoch = intern_epoch.load(std::memory_order_acquire);
+        if (interned_epoch.load(std::memory_order_acquire) == epoch) {
+            return interned_id.load(std::memory_order_relaxed);
+        }
+        return refresh_interned_id(epoch);
+    }
+
+    /// @function `intern`
+    /// @brief Assigns the interned ID of this type from its intern key. Every type constructor calls this function, it needs to be called
+    /// again when a type contained in this type is replaced, for example when an unknown type is resolved. If the ID of the type changes,
+    /// all types which contain it are interned again lazily
+    void intern();
+
+    /// @function `is`
+    /// @brief Checks whether this type is the given builtin type without building its string representation
+    ///
+    /// @param `builtin` The builtin type to check against
+    /// @return `bool` Whether this type is the given builtin type
+    bool is(const Builtin builtin) const {
+        return get_interned_id() == static_cast<uint32_t>(builtin);
+    }
+
+    /// @function `get_builtin_name`
+    /// @brief Returns the string representation of the given builtin type
+    ///
+    /// @param `builtin` The builtin type to get the name from
+    /// @return `std::string_view` The string representation of the builtin type
+    static std::string_view get_builtin_name(const Builtin builtin);
+
     /// @function `is_reference`
     /// @brief Whether this type is a reference
     ///
@@ -143,7 +234,8 @@ class Type {
     static void init_types();
 
     /// @function `clear_types`
-    /// @brief Clears all the types from the type list
+    /// @brief Clears all the types from the type list and all intern keys. Types which outlive this call (for example the types of the
+    /// core modules in the language server) are interned again when their ID is needed the next time
     /// @note This function is only allowed to be called at the end of the program, calling it while the parser or codegen are active is
     /// actually...not good
     static void clear_types();
@@ -168,4 +260,44 @@ class Type {
     /// @param `type_str` The string representation of the full type
     /// @return `std::optional<std::shared_ptr<Type>>` The type from the types map, nullopt if the given type does not exist
     static std::optional<std::shared_ptr<Type>> get_type_from_str(const std::string &type_str);
+
+  private:
+    /// @function `get_interned_id_of_key`
+    /// @brief Returns the interned ID of the given intern key, a new ID is assigned if the key has not been seen yet
+    ///
+    /// @param `key` The intern key to get the ID of
+    /// @return `uint32_t` The interned ID of the key
+    uint32_t get_interned_id_of_key(const std::string &key) const;
+
+    /// @function `refresh_interned_id`
+    /// @brief Interns this type again from its current intern key, because its ID was assigned in an earlier intern epoch
+    ///
+    /// @param `epoch` The current intern epoch
+    /// @return `uint32_t` The interned ID of this type
+    uint32_t refresh_interned_id(const uint32_t epoch) const;
+
+    /// @var `interned_id`
+    /// @brief The interned ID of this type, 0 if it has not been interned yet
+    mutable std::atomic<uint32_t> interned_id{0};
+
+    /// @var `interned_epoch`
+    /// @brief The intern epoch in which the `interned_id` was assigned, 0 if the type has not been interned yet
+    mutable std::atomic<uint32_t> interned_epoch{0};
+
+    /// @var `intern_epoch`
+    /// @brief The current intern epoch. It is advanced whenever already assigned IDs could be out of date, which is when the intern keys
+    /// are cleared or when the ID of a type changes, as the keys of all types containing it were built from its old ID
+    static inline std::atomic<uint32_t> intern_epoch{1};
+
+    /// @var `interned_ids`
+    /// @brief Maps the intern keys of all types created since the last `clear_types` call to their interned IDs
+    static inline std::unordered_map<std::string, uint32_t> interned_ids;
+
+    /// @var `interned_ids_mutex`
+    /// @brief A mutex for thread-safe access on the `interned_ids` map and the `next_interned_id`
+    static inline std::shared_mutex interned_ids_mutex;
+
+    /// @var `next_interned_id`
+    /// @brief The next free interned ID for non-builtin types
+    static inline uint32_t next_interned_id = static_cast<uint32_t>(Builtin::COUNT) + 1;
 };
@@ -8,7 +8,9 @@
 class UnknownType : public Type {
   public:
     UnknownType(const std::string &type_str) :
-        type_str(type_str) {}
+        type_str(type_str) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::UNKNOWN;
@@ -26,12 +28,8 @@ class UnknownType : public Type {
         return Hash(std::string(""));
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::UNKNOWN) {
-            return false;
-        }
-        const UnknownType *const other_type = other->as<UnknownType>();
-        return type_str == other_type->type_str;
+    std::string get_intern_key() const override {
+        return "u" + type_str;
     }
 
     std::string to_string() const override {
@@ -13,7 +13,9 @@ class VariantType : public Type {
   public:
     VariantType(const std::variant<VariantNode *const, std::vector<std::shared_ptr<Type>>> &var_or_list, const bool is_err_variant) :
         is_err_variant(is_err_variant),
-        var_or_list(var_or_list) {}
+        var_or_list(var_or_list) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::VARIANT;
@@ -54,37 +56,17 @@ class VariantType : public Type {
         return value_hashes.front();
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::VARIANT) {
-            return false;
-        }
-        const VariantType *const other_type = other->as<VariantType>();
-        if (is_err_variant != other_type->is_err_variant) {
-            return false;
-        }
+    std::string get_intern_key() const override {
+        std::string key = is_err_variant ? "V" : "v";
         if (std::holds_alternative<VariantNode *const>(var_or_list)) {
-            if (!std::holds_alternative<VariantNode *const>(other_type->var_or_list)) {
-                return false;
-            }
-            VariantNode *const this_var = std::get<VariantNode *const>(var_or_list);
-            VariantNode *const other_var = std::get<VariantNode *const>(other_type->var_or_list);
-            return this_var == other_var;
-        } else {
-            if (std::holds_alternative<VariantNode *const>(other_type->var_or_list)) {
-                return false;
-            }
-            auto &this_list = std::get<std::vector<std::shared_ptr<Type>>>(var_or_list);
-            auto &other_list = std::get<std::vector<std::shared_ptr<Type>>>(other_type->var_or_list);
-            if (this_list.size() != other_list.size()) {
-                return false;
-            }
-            for (size_t i = 0; i < this_list.size(); i++) {
-                if (!this_list.at(i)->equals(other_list.at(i))) {
-                    return false;
-                }
-            }
-            return true;
+            const VariantNode *const variant_node = std::get<VariantNode *const>(var_or_list);
+            return key + variant_node->file_hash.to_string() + "." + variant_node->name;
+        }
+        key += "(";
+        for (const auto &type : std::get<std::vector<std::shared_ptr<Type>>>(var_or_list)) {
+            key += std::to_string(type->get_interned_id()) + ",";
         }
+        return key;
     }
 
     std::string to_string() const override {
@@ -11,7 +11,9 @@ class VectorType : public Type {
   public:
     VectorType(const std::shared_ptr<Type> &base_type, const unsigned int width) :
         base_type(base_type),
-        width(width) {}
+        width(width) {
+        intern();
+    }
 
     Variation get_variation() const override {
         return Variation::VECTOR;
@@ -29,15 +31,8 @@ class VectorType : public Type {
         return Hash(std::string(""));
     }
 
-    bool equals(const std::shared_ptr<Type> &other) const override {
-        if (other->get_variation() != Variation::VECTOR) {
-            return false;
-        }
-        const VectorType *const other_type = other->as<VectorType>();
-        if (width != other_type->width) {
-            return false;
-        }
-        return base_type->equals(other_type->base_type);
+    std::string get_intern_key() const override {
+        return "v" + std::to_string(base_type->get_interned_id()) + "x" + std::to_string(width);
     }
 
     std::string to_string() const override {
@@ -11,6 +11,7 @@
  */
 
 #include "debug.hpp"
+#include "time_trace.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -570,13 +571,15 @@ class CumulativeProfiler {
 };
 
 /// @def PROFILE_SCOPE(name)
-/// @brief Macro for creating a `ScopeProfiler` instance with a unique name.
+/// @brief Macro for creating a `ScopeProfiler` instance with a unique name. The scope is recorded in the time trace in all build modes.
 /// @param name Name of the task to profile.
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #ifdef DEBUG_BUILD
-#define PROFILE_SCOPE(name) ScopeProfiler CONCAT(sp_, __LINE__)(name)
+#define PROFILE_SCOPE(name)                                                                                                                \
+    ScopeProfiler CONCAT(sp_, __LINE__)(name);                                                                                             \
+    TIME_TRACE_SCOPE(name)
 #else
-#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_SCOPE(name) TIME_TRACE_SCOPE(name)
 #endif
 
 /// @def PROFILE_THREADED_SCOPE(name, parse_parallel)
@@ -588,9 +591,11 @@ class CumulativeProfiler {
 /// @param parse_parallel Boolean flag indicating if parallel work will occur
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #ifdef DEBUG_BUILD
-#define PROFILE_THREADED_SCOPE(name, parse_parallel) ThreadedScopeProfiler CONCAT(tsp_, __LINE__)(name, parse_parallel)
+#define PROFILE_THREADED_SCOPE(name, parse_parallel)                                                                                       \
+    ThreadedScopeProfiler CONCAT(tsp_, __LINE__)(name, parse_parallel);                                                                    \
+    TIME_TRACE_SCOPE(name)
 #else
-#define PROFILE_THREADED_SCOPE(name, parse_parallel) ((void)0)
+#define PROFILE_THREADED_SCOPE(name, parse_parallel) TIME_TRACE_SCOPE(name)
 #endif
 
 /// @def PROFILE_CUMULATIVE(key)
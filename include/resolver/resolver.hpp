@@ -4,11 +4,14 @@
 #include "parser/ast/file_node.hpp"
 #include "parser/hash.hpp"
 
+#include <deque>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 /// @struct `FileDependency`
@@ -70,10 +73,6 @@ class Resolver {
     /// absolute path
     static inline std::unordered_map<Hash, Namespace *> namespace_map;
 
-    /// @var `file_ids`
-    /// @brief A vector where the index of the element is equal to the file_id
-    static inline std::vector<Hash> file_ids;
-
     /// @var `namesapce_map_mutex`
     /// @brief A mutex for the `namespace_map` variable, to make accessing the `namespace_map` thread-safe
     static inline std::shared_mutex namespace_map_mutex;
@@ -107,6 +106,13 @@ class Resolver {
     /// @attention This method needs to be called before the LLVMContext responsible for all Modules get freed, everything else is UB
     static void clear();
 
+    /// @function `remove_files`
+    /// @brief Removes the given files from all maps of the resolver, so that they are parsed again once they are part of a dependency
+    /// graph the next time. All other files stay resolved
+    ///
+    /// @param `file_hashes` The hashes of the files to remove
+    static void remove_files(const std::unordered_set<Hash> &file_hashes);
+
     /// @function `file_generation_finished`
     /// @brief Adds the given file hash to the list of finished files to "remember" for which files code generation is already done
     ///
@@ -120,6 +126,20 @@ class Resolver {
     /// @return `bool` Whether the `generated_files` list contains the given `file_hash`
     static bool generated_files_contain(const Hash &file_hash);
 
+    /// @function `get_file_id`
+    /// @brief Returns the file ID of the given file hash. If the file hash has no ID yet, a new ID is assigned to it
+    ///
+    /// @param `file_hash` The hash of the file to get the ID of
+    /// @return `unsigned int` The file ID of the given file
+    static unsigned int get_file_id(const Hash &file_hash);
+
+    /// @function `get_file_hash`
+    /// @brief Returns the file hash belonging to the given file ID
+    ///
+    /// @param `file_id` The file ID to get the hash of
+    /// @return `const Hash &` The hash of the file with the given ID
+    static const Hash &get_file_hash(const unsigned int file_id);
+
     /// @function `get_namespace_from_hash`
     /// @brief Returns a reference to the namespace from the given `file_hash`
     ///
@@ -128,6 +148,19 @@ class Resolver {
     static Namespace *get_namespace_from_hash(const Hash &file_hash);
 
   private:
+    /// @var `file_ids`
+    /// @brief A deque where the index of the element is equal to the file_id. A deque is used so that references to its elements stay
+    /// valid when new files are added
+    static inline std::deque<Hash> file_ids;
+
+    /// @var `file_id_map`
+    /// @brief A map from file hashes to their index in the `file_ids` deque
+    static inline std::unordered_map<Hash, unsigned int> file_id_map;
+
+    /// @var `file_ids_mutex`
+    /// @brief A mutex for the `file_ids` and `file_id_map` variables, to make accessing them thread-safe
+    static inline std::shared_mutex file_ids_mutex;
+
     /// @var `generated_files`
     /// @brief A small list which contains the hashes of all files whose IR code has already been generated
     static inline std::vector<Hash> generated_files;
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @class `TimeTrace`
+/// @brief Records compile-time events of all threads and writes them as a Chrome trace-event JSON file, which can be opened in
+/// `chrome://tracing` or in Perfetto. Tracing is available in all build modes and is enabled with the `--time-trace <file>` flag.
+///
+/// Every thread records into its own fixed-size ring buffer without taking any lock, only registering the buffer of a new thread is
+/// locked. If a buffer overflows, its oldest events are overwritten
+class TimeTrace {
+  public:
+    TimeTrace() = delete;
+
+    /// @typedef `Clock`
+    /// @brief The clock used for all trace events, the same clock the `Profiler` uses
+    using Clock = std::chrono::high_resolution_clock;
+
+    /// @var `BUFFER_CAPACITY`
+    /// @brief The number of events every thread buffer is able to hold before it starts overwriting its oldest events
+    static constexpr size_t BUFFER_CAPACITY = 1 << 16;
+
+    /// @struct `Event`
+    /// @brief A single complete event of the trace
+    struct Event {
+        /// @var `name`
+        /// @brief The name of the event
+        std::string name;
+
+        /// @var `start_ns`
+        /// @brief The start of the event in nanoseconds since tracing was enabled
+        uint64_t start_ns;
+
+        /// @var `duration_ns`
+        /// @brief The duration of the event in nanoseconds
+        uint64_t duration_ns;
+    };
+
+    /// @function `enable`
+    /// @brief Enables the recording of trace events. All event timestamps are relative to the point in time this function was called at
+    static void enable();
+
+    /// @function `is_enabled`
+    /// @brief Whether tracing is enabled. This is checked before every recorded event, so it is kept as cheap as possible
+    ///
+    /// @return `bool` Whether tracing is enabled
+    static bool is_enabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /// @function `record`
+    /// @brief Records a complete event in the buffer of the calling thread
+    ///
+    /// @param `name` The name of the event
+    /// @param `start` The point in time the event started
+    /// @param `end` The point in time the event ended
+    static void record(std::string name, const Clock::time_point &start, const Clock::time_point &end);
+
+    /// @function `write`
+    /// @brief Writes all recorded events of all threads to the given file in the Chrome trace-event JSON format
+    ///
+    /// @param `file_path` The path of the trace file to write
+    /// @return `bool` Whether the trace file could be written
+    ///
+    /// @attention No thread is allowed to record events while the trace is written
+    static bool write(const std::filesystem::path &file_path);
+
+  private:
+    /// @struct `ThreadBuffer`
+    /// @brief The ring buffer of a single thread. Only the owning thread writes into it
+    struct ThreadBuffer {
+        /// @var `thread_id`
+        /// @brief The ID of the thread in the written trace, in the order the threads recorded their first event
+        uint32_t thread_id;
+
+        /// @var `events`
+        /// @brief The ring of recorded events, its size is `BUFFER_CAPACITY`
+        std::vector<Event> events;
+
+        /// @var `recorded`
+        /// @brief The total number of events recorded into this buffer, including the ones which were overwritten already
+        std::atomic<uint64_t> recorded{0};
+    };
+
+    /// @function `get_thread_buffer`
+    /// @brief Returns the buffer of the calling thread, registering a new buffer when the thread records its first event
+    ///
+    /// @return `ThreadBuffer &` The buffer of the calling thread
+    static ThreadBuffer &get_thread_buffer();
+
+    /// @var `enabled`
+    /// @brief Whether tracing is enabled
+    static inline std::atomic<bool> enabled{false};
+
+    /// @var `start_time`
+    /// @brief The point in time tracing was enabled at
+    static inline Clock::time_point start_time;
+
+    /// @var `buffers`
+    /// @brief The buffers of all threads which have recorded events. They are owned here so they outlive their threads
+    static inline std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    /// @var `buffers_mutex`
+    /// @brief A mutex for registering new thread buffers in the `buffers` list
+    static inline std::mutex buffers_mutex;
+};
+
+/// @class `TimeTraceScope`
+/// @brief RAII-based class recording a trace event spanning its lifetime. An empty name disables the scope
+class TimeTraceScope {
+  public:
+    explicit TimeTraceScope(std::string event_name) :
+        name(std::move(event_name)) {
+        if (!name.empty()) {
+            start = TimeTrace::Clock::now();
+        }
+    }
+
+    ~TimeTraceScope() {
+        if (!name.empty()) {
+            TimeTrace::record(std::move(name), start, TimeTrace::Clock::now());
+        }
+    }
+
+    TimeTraceScope(const TimeTraceScope &) = delete;
+    TimeTraceScope &operator=(const TimeTraceScope &) = delete;
+    TimeTraceScope(TimeTraceScope &&) = delete;
+    TimeTraceScope &operator=(TimeTraceScope &&) = delete;
+
+  private:
+    std::string name;                   ///< Name of the traced event, empty if tracing was disabled when the scope was entered
+    TimeTrace::Clock::time_point start; ///< Start time of the traced event
+};
+
+/// @def TIME_TRACE_SCOPE(name)
+/// @brief Macro for recording a trace event for the current scope. The name is only evaluated if tracing is enabled
+/// @param name Name of the traced event
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define TIME_TRACE_SCOPE(name)                                                                                                             \
+    TimeTraceScope TIME_TRACE_CONCAT(tts_, __LINE__)(TimeTrace::is_enabled() ? std::string(name) : std::string())
+
+/// @def TIME_TRACE_CONCAT(a, b)
+/// @brief Macro for concatenating two tokens, this header has its own one to not depend on the profiler header
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define TIME_TRACE_CONCAT(a, b) TIME_TRACE_CONCAT_INNER(a, b)
+
+/// @def TIME_TRACE_CONCAT_INNER(a, b)
+/// @brief Inner macro for token concatenation
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define TIME_TRACE_CONCAT_INNER(a, b) a##b
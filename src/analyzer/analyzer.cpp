@@ -58,7 +58,54 @@
 #include "profiler.hpp"
 #include "resolver/resolver.hpp"
 
+#include <vector>
+
+bool Analyzer::analyze_program() {
+    PROFILE_SCOPE("Analyze all files");
+    for (auto &instance : Parser::instances) {
+        if (!analyze_file(instance)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::pair<size_t, size_t>> Analyzer::get_analysis_ranges(const Parser &parser) {
+    const size_t definition_count = parser.file_node_ptr->file_namespace->public_symbols.definitions.size();
+    if (definition_count < PARALLEL_SPLIT_THRESHOLD) {
+        return {{0, definition_count}};
+    }
+    std::vector<std::pair<size_t, size_t>> ranges;
+    ranges.reserve(definition_count);
+    for (size_t i = 0; i < definition_count; i++) {
+        ranges.emplace_back(i, i + 1);
+    }
+    return ranges;
+}
+
+void Analyzer::assign_dense_error_ids() {
+    uint32_t next_id = 1;
+    for (const auto &[module_name, module_namespace] : Parser::core_namespaces) {
+        for (auto &definition : module_namespace->public_symbols.definitions) {
+            if (definition->get_variation() == DefinitionNode::Variation::ERROR) {
+                definition->as<ErrorNode>()->dense_id = next_id++;
+            }
+        }
+    }
+    for (auto &instance : Parser::instances) {
+        for (auto &definition : instance.file_node_ptr->file_namespace->public_symbols.definitions) {
+            if (definition->get_variation() == DefinitionNode::Variation::ERROR) {
+                definition->as<ErrorNode>()->dense_id = next_id++;
+            }
+        }
+    }
+}
+
 bool Analyzer::analyze_file(Parser &parser) {
+    return analyze_definitions(parser, 0, parser.file_node_ptr->file_namespace->public_symbols.definitions.size());
+}
+
+bool Analyzer::analyze_definitions(Parser &parser, const size_t begin, const size_t end) {
     PROFILE_SCOPE("analyze '" + parser.file_name + "'");
     Context ctx = Context{
         .level = ContextLevel::INTERNAL,
@@ -70,7 +117,9 @@ bool Analyzer::analyze_file(Parser &parser) {
         .parser = parser,
         .return_type = std::nullopt,
     };
-    for (auto &node : parser.file_node_ptr->file_namespace->public_symbols.definitions) {
+    auto &definitions = parser.file_node_ptr->file_namespace->public_symbols.definitions;
+    for (size_t i = begin; i < end; i++) {
+        auto &node = definitions[i];
         ctx.line = node->line;
         ctx.column = node->column;
         ctx.length = node->length;
@@ -634,13 +683,13 @@ bool Analyzer::analyze_binop(const Analyzer::Context &ctx, std::unique_ptr<Expre
     }
 
     // Finally check if one of the two sides are string literals, if they are they need to become a string variable
-    if (node->left->type->to_string() == "type.flint.str.lit") {
+    if (node->left->type->is(Type::Builtin::STR_LIT)) {
         node->left = std::make_unique<TypeCastNode>(                                                       //
             node->file_hash, ASTNode::PosTriple{node->left->line, node->left->column, node->left->length}, //
             Type::get_primitive_type("str"), node->left                                                    //
         );
     }
-    if (node->right->type->to_string() == "type.flint.str.lit") {
+    if (node->right->type->is(Type::Builtin::STR_LIT)) {
         node->right = std::make_unique<TypeCastNode>(                                                         //
             node->file_hash, ASTNode::PosTriple{node->right->line, node->right->column, node->right->length}, //
             Type::get_primitive_type("str"), node->right                                                      //
@@ -1314,7 +1363,7 @@ bool Analyzer::analyze_type(                      //
         case Type::Variation::POINTER: {
             // void* is allowed even in non-extern places because it's the type of the 'null' literal and cannot come up anywhere else in
             // Flint, ever
-            if (type_to_analyze->to_string() != "void*"                                           //
+            if (!type_to_analyze->is(Type::Builtin::VOID_PTR)                                     //
                 && (ctx.level == ContextLevel::INTERNAL || ctx.level == ContextLevel::CONST_DATA) //
             ) {
                 if (ctx.is_function_definition_context) {
@@ -37,7 +37,7 @@ bool Analyzer::Castability::resolve_comptime_type_of_expr(  //
     const std::optional<std::shared_ptr<Type>> &target_type //
 ) {
     const std::string &type_str = expr->type->to_string();
-    if ((type_str == "int" || type_str == "float") && target_type.has_value() && target_type.value()->to_string() == "str") {
+    if ((type_str == "int" || type_str == "float") && target_type.has_value() && target_type.value()->is(Type::Builtin::STR)) {
         assert(expr->get_variation() == ExpressionNode::Variation::LITERAL);
         LiteralNode *const literal = expr->as<LiteralNode>();
         const std::string str_value = type_str == "int"          //
@@ -104,6 +104,7 @@ bool Analyzer::Castability::resolve_comptime_type_of_expr(  //
     if (!contains_literal || expr->get_variation() != ExpressionNode::Variation::GROUP_EXPRESSION) {
         return false;
     }
+    group_type->intern();
     std::shared_ptr<Type> result_type = group_type;
     if (!parser.file_node_ptr->file_namespace->add_type(group_type)) {
         result_type = parser.file_node_ptr->file_namespace->get_type_from_str(group_type->to_string()).value();
@@ -356,9 +357,9 @@ Analyzer::Castability::CastDirection Analyzer::Castability::check_castability( /
         } else if (lhs_mult == nullptr && rhs_mult != nullptr && is_castable_to(rhs_mult->base_type, lhs_type)) {
             return CastDirection::lhs_to_rhs();
         }
-        if (lhs_type->to_string() == "type.flint.str.lit" && rhs_type->to_string() == "str") {
+        if (lhs_type->is(Type::Builtin::STR_LIT) && rhs_type->is(Type::Builtin::STR)) {
             return CastDirection::lhs_to_rhs();
-        } else if (lhs_type->to_string() == "str" && rhs_type->to_string() == "type.flint.str.lit") {
+        } else if (lhs_type->is(Type::Builtin::STR) && rhs_type->is(Type::Builtin::STR_LIT)) {
             return CastDirection::rhs_to_lhs();
         }
         // Check one or both of the sides are optional types
@@ -675,7 +676,7 @@ Analyzer::Castability::BinopMatchResult Analyzer::Castability::match_binop_opera
         // All elements of the lhs group must match the rhs type, otherwise it's not a homogenous group
         const GroupType *lhs_group_type = lhs_type->as<GroupType>();
         GroupExpressionNode *lhs_group_expr = dynamic_cast<GroupExpressionNode *>(rhs.get());
-        const bool rhs_is_literal = rhs_type->to_string() == "int" || rhs_type->to_string() == "float";
+        const bool rhs_is_literal = rhs_type->is(Type::Builtin::INT) || rhs_type->is(Type::Builtin::FLOAT);
         const std::shared_ptr<Type> cmp_type = rhs_is_literal ? lhs_group_type->types.front() : rhs_type;
         for (size_t i = 0; i < lhs_group_type->types.size(); i++) {
             const auto &type = lhs_group_type->types.at(i);
@@ -699,7 +700,7 @@ Analyzer::Castability::BinopMatchResult Analyzer::Castability::match_binop_opera
         // All elements of the rhs group must match the lhs type or be castable to it, otherwise it's not a homogenous group
         const GroupType *rhs_group_type = rhs_type->as<GroupType>();
         GroupExpressionNode *rhs_group_expr = dynamic_cast<GroupExpressionNode *>(rhs.get());
-        const bool lhs_is_literal = lhs_type->to_string() == "int" || lhs_type->to_string() == "float";
+        const bool lhs_is_literal = lhs_type->is(Type::Builtin::INT) || lhs_type->is(Type::Builtin::FLOAT);
         const std::shared_ptr<Type> cmp_type = lhs_is_literal ? rhs_group_type->types.front() : lhs_type;
         for (size_t i = 0; i < rhs_group_type->types.size(); i++) {
             const auto &type = rhs_group_type->types.at(i);
@@ -922,7 +923,7 @@ bool Analyzer::Castability::check_castability(Parser &parser, const std::shared_
         }
         case Type::Variation::VECTOR: {
             const auto *vector_type = target_type->as<VectorType>();
-            if (vector_type->to_string() == "bool8" && expr->type->to_string() == "u8") {
+            if (vector_type->is(Type::Builtin::BOOL8) && expr->type->is(Type::Builtin::U8)) {
                 expr = std::make_unique<TypeCastNode>(parser.file_hash, expr_pos, target_type, expr);
                 return true;
             }
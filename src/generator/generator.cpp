@@ -10,6 +10,7 @@
 #include "parser/type/error_set_type.hpp"
 #include "profiler.hpp"
 #include "resolver/resolver.hpp"
+#include "time_trace.hpp"
 
 #include <llvm/Analysis/CGSCCPassManager.h>
 #include <llvm/BinaryFormat/Dwarf.h>
@@ -23,6 +24,7 @@
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/PassInstrumentation.h>
 #include <llvm/IR/PassManager.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/ValueSymbolTable.h>
@@ -45,6 +47,7 @@
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <unordered_map>
@@ -82,17 +85,16 @@ std::filesystem::path Generator::get_flintc_cache_path() {
 }
 
 std::optional<llvm::TargetMachine *> Generator::init_target_machine(llvm::Module *module) {
-    // Initialize LLVM targets (should only be called once in the compiler)
-    static bool initialized = false;
-    if (!initialized) {
+    // Initialize LLVM targets (should only be called once in the compiler, even when modules are compiled from multiple threads)
+    static std::once_flag initialized;
+    std::call_once(initialized, []() {
         PROFILE_SCOPE("Initialize LLVM");
         LLVMInitializeX86TargetInfo();
         LLVMInitializeX86Target();
         LLVMInitializeX86TargetMC();
         LLVMInitializeX86AsmParser();
         LLVMInitializeX86AsmPrinter();
-        initialized = true;
-    }
+    });
 
     // Get the target triple (architecture, OS, etc.)
     std::string target_triple = "";
@@ -149,37 +151,24 @@ bool Generator::compile_program(              //
 ) {
     PROFILE_SCOPE("Compile program " + module->getName().str());
 
-    // Direct linking with LDD
-    if (!Generator::compile_module(module, binary_file)) {
+    // The object file of the program is emitted into memory and directly handed to LLD
+    llvm::SmallVector<char, 0> object;
+    if (!Generator::compile_module(module, object)) {
         llvm::errs() << "Compilation of program '" << binary_file.string() << "' failed\n";
         return false;
     }
-
-    std::string obj_file = binary_file.string();
-    std::string file_ending = "";
-    switch (COMPILATION_TARGET) {
-        case Target::NATIVE:
-#ifdef __WIN32__
-            file_ending = ".obj";
-#else
-            file_ending = ".o";
-#endif
-            break;
-        case Target::LINUX:
-            file_ending = ".o";
-            break;
-        case Target::WINDOWS:
-            file_ending = ".obj";
-            break;
+    const std::string file_ending = Linker::get_object_file_ending();
+    const std::string obj_file = binary_file.string() + file_ending;
+    const llvm::MemoryBufferRef object_buffer(llvm::StringRef(object.data(), object.size()), obj_file);
+    if (DEBUG_MODE && !Linker::write_object_file(object_buffer, obj_file)) {
+        return false;
     }
-    obj_file += file_ending;
 
     Profiler::start_task("Linking " + obj_file + " to a binary");
-    std::vector<std::filesystem::path> obj_files{obj_file};
+    std::vector<std::filesystem::path> obj_files;
     std::optional<std::vector<std::array<char, 9>>> fip_objects = FIP::gather_objects();
     if (!fip_objects.has_value()) {
         Profiler::end_task("Linking " + obj_file + " to a binary");
-        IO::remove_with_retry(std::filesystem::path(obj_file));
         return false;
     }
     for (const auto &fip_obj : fip_objects.value()) {
@@ -187,7 +176,8 @@ bool Generator::compile_program(              //
         obj_files.emplace_back(fip_obj_path);
     }
     bool link_success = Linker::link( //
-        obj_files,                    // input object files
+        object_buffer,                // in-memory program object
+        obj_files,                    // additional input object files
         binary_file,                  // output executable
         flags,                        // linking flags
         is_static                     // debug flag
@@ -198,15 +188,26 @@ bool Generator::compile_program(              //
         llvm::errs() << "Linking failed with LLD\n";
         return false;
     }
+    return true;
+}
 
-    // Clean up object file
-    if (!DEBUG_MODE) {
-        IO::remove_with_retry(std::filesystem::path(obj_file));
+bool Generator::compile_module(llvm::Module *module, const std::filesystem::path &module_path) {
+    llvm::SmallVector<char, 0> object;
+    if (!compile_module(module, object)) {
+        return false;
+    }
+    const std::string obj_file = module_path.string() + Linker::get_object_file_ending();
+    if (!Linker::write_object_file(llvm::MemoryBufferRef(llvm::StringRef(object.data(), object.size()), obj_file), obj_file)) {
+        return false;
+    }
+    if (DEBUG_MODE) {
+        std::cout << YELLOW << "[Debug Info] Code generation status" << DEFAULT << std::endl;
+        std::cout << "-- Machine code generated: " << obj_file << "\n" << std::endl;
     }
     return true;
 }
 
-bool Generator::compile_module(llvm::Module *module, const std::filesystem::path &module_path) {
+bool Generator::compile_module(llvm::Module *module, llvm::SmallVector<char, 0> &object) {
     PROFILE_SCOPE("Compile module " + module->getName().str());
 
     const std::optional<llvm::TargetMachine *> target_machine = init_target_machine(module);
@@ -214,29 +215,9 @@ bool Generator::compile_module(llvm::Module *module, const std::filesystem::path
         return false;
     }
 
-    // Create an output file
-    std::error_code EC;
-    std::string obj_file = module_path.string();
-    switch (COMPILATION_TARGET) {
-        case Target::NATIVE:
-#ifdef __WIN32__
-            obj_file += ".obj";
-#else
-            obj_file += ".o";
-#endif
-            break;
-        case Target::LINUX:
-            obj_file += ".o";
-            break;
-        case Target::WINDOWS:
-            obj_file += ".obj";
-            break;
-    }
-    llvm::raw_fd_ostream dest(obj_file, EC, llvm::sys::fs::OF_None);
-    if (EC) {
-        llvm::errs() << "Could not open file: " << EC.message() << "\n";
-        return false;
-    }
+    // The object file is emitted into memory, it is up to the caller whether it is written to disk at all
+    object.clear();
+    llvm::raw_svector_ostream dest(object);
 
     if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
         llvm::LoopAnalysisManager LAM;
@@ -244,7 +225,25 @@ bool Generator::compile_module(llvm::Module *module, const std::filesystem::path
         llvm::CGSCCAnalysisManager CGAM;
         llvm::ModuleAnalysisManager MAM;
 
-        llvm::PassBuilder PB(target_machine.value());
+        // Every module-level pass is recorded in the time trace. Function passes are not recorded one by one since there would be far too
+        // many of them, they show up as the module-level adaptor passes running them. Passes can nest, so their start times form a stack
+        llvm::PassInstrumentationCallbacks PIC;
+        std::vector<TimeTrace::Clock::time_point> pass_starts;
+        if (TimeTrace::is_enabled()) {
+            PIC.registerBeforeNonSkippedPassCallback([&pass_starts](llvm::StringRef, const llvm::Any &ir) {
+                if (llvm::any_cast<const llvm::Module *>(&ir) != nullptr) {
+                    pass_starts.emplace_back(TimeTrace::Clock::now());
+                }
+            });
+            PIC.registerAfterPassCallback([&pass_starts](llvm::StringRef pass_name, const llvm::Any &ir, const llvm::PreservedAnalyses &) {
+                if (llvm::any_cast<const llvm::Module *>(&ir) != nullptr && !pass_starts.empty()) {
+                    TimeTrace::record(pass_name.str(), pass_starts.back(), TimeTrace::Clock::now());
+                    pass_starts.pop_back();
+                }
+            });
+        }
+
+        llvm::PassBuilder PB(target_machine.value(), llvm::PipelineTuningOptions(), {}, &PIC);
         PB.registerModuleAnalyses(MAM);
         PB.registerCGSCCAnalyses(CGAM);
         PB.registerFunctionAnalyses(FAM);
@@ -252,7 +251,10 @@ bool Generator::compile_module(llvm::Module *module, const std::filesystem::path
         PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
 
         llvm::ModulePassManager MPM = PB.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2);
-        MPM.run(*module, MAM);
+        {
+            PROFILE_SCOPE("Optimize module " + module->getName().str());
+            MPM.run(*module, MAM);
+        }
 
         if (DEBUG_MODE && PRINT_IR_PROGRAM_OPTIMIZED) {
             std::cout << YELLOW << "[Debug Info] Generated IR code of the whole program AFTER optimizations\n"
@@ -278,14 +280,8 @@ bool Generator::compile_module(llvm::Module *module, const std::filesystem::path
     // Run the passes to generate machine code
     Profiler::start_task("Generate machine code");
     pass.run(*module);
-    dest.flush();
     delete target_machine.value();
     Profiler::end_task("Generate machine code");
-
-    if (DEBUG_MODE) {
-        std::cout << YELLOW << "[Debug Info] Code generation status" << DEFAULT << std::endl;
-        std::cout << "-- Machine code generated: " << obj_file << "\n" << std::endl;
-    }
     return true;
 }
 
@@ -529,8 +525,8 @@ std::optional<std::unique_ptr<llvm::Module>> Generator::generate_program_ir( //
     Memory::generate_free_callable_function(builder.get(), module.get(), false);
     Memory::generate_clone_callable_function(builder.get(), module.get(), false);
 
-    // Generate all the object dispatch functions
-    IR::generate_object_dispatch_functions(module.get());
+    // Generate all the object vtables
+    IR::generate_object_vtables(module.get());
 
     // Start with the tips of the dependency graph and then work towards the root node. First, get all tips of the graph:
     std::vector<std::weak_ptr<DepNode>> tips;
@@ -892,6 +888,31 @@ std::string Generator::get_module_ir_string(const llvm::Module *module) {
     return ir_string;
 }
 
+std::string Generator::get_cold_path_statistics(const llvm::Module *module) {
+    size_t cold_function_count = 0;
+    size_t cold_block_count = 0;
+    size_t cold_instruction_count = 0;
+    size_t total_instruction_count = 0;
+    for (const llvm::Function &function : module->functions()) {
+        if (function.isDeclaration()) {
+            continue;
+        }
+        const size_t instruction_count = function.getInstructionCount();
+        total_instruction_count += instruction_count;
+        if (function.hasFnAttribute(llvm::Attribute::Cold)) {
+            cold_function_count++;
+            cold_block_count += function.size();
+            cold_instruction_count += instruction_count;
+        }
+    }
+    std::stringstream stats;
+    stats << "; Cold path statistics:\n";
+    stats << ";   outlined cold functions:    " << cold_function_count << "\n";
+    stats << ";   outlined cold blocks:       " << cold_block_count << "\n";
+    stats << ";   outlined cold instructions: " << cold_instruction_count << " of " << total_instruction_count << "\n";
+    return stats.str();
+}
+
 std::string Generator::resolve_ir_comments(const std::string &ir_string) {
     PROFILE_SCOPE("Resolving IR comments");
     // Check if the whole ir_string even contains a single comment at all. If it doesnt, we return the ir_string as is
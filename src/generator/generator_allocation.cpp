@@ -19,10 +19,10 @@ std::optional<llvm::StructType *> Generator::Allocation::generate_function_alloc
     llvm::IRBuilder<> &builder,                                                         //
     llvm::Function *parent,                                                             //
     const FunctionNode *function,                                                       //
-    std::unordered_map<std::string, llvm::Value *const> &allocations                    //
+    AllocationMap &allocations                                                          //
 ) {
     ASSERT(function->scope.has_value() && !function->is_extern);
-    std::vector<std::pair<std::string, llvm::Type *const>> types_list;
+    std::vector<FrameField> types_list;
 
     // We start with all the return values of the function for the type list for the function frame
     llvm::StructType *const ts_fn_ty = type_map.at("type.ts.function");
@@ -30,16 +30,17 @@ std::optional<llvm::StructType *> Generator::Allocation::generate_function_alloc
         const auto &ret_type = function->return_types.at(ret_id);
         const IR::TypeStorageInfo &ret_ty_info = IR::get_type(parent->getParent(), ret_type);
         const std::string ret_name = "flint.ret." + std::to_string(ret_id);
-        types_list.emplace_back(ret_name, ret_ty_info.is_complex ? PTR_TY : ret_ty_info.type);
+        types_list.push_back({ret_name, ret_ty_info.is_complex ? PTR_TY : ret_ty_info.type});
     }
 
     // Then we move on to the function parameters for the allocation map
     for (size_t param_id = 0; param_id < function->parameters.size(); param_id++) {
         const auto &param = function->parameters.at(param_id);
         const std::string param_name = "s" + std::to_string(function->scope.value()->scope_id) + "::" + param.name;
+        const unsigned int param_slot = function->scope.value()->variables.at(param.name).slot;
         const IR::TypeStorageInfo &param_type_info = IR::get_type(parent->getParent(), function->parameters.at(param_id).type);
         ASSERT(param_type_info.type != nullptr);
-        types_list.emplace_back(param_name, param_type_info.is_complex ? PTR_TY : param_type_info.type);
+        types_list.push_back({param_name, param_type_info.is_complex ? PTR_TY : param_type_info.type, param_slot});
     }
 
     std::string frame_type_name = function->file_hash.to_string() + ".type.ts." + function->name;
@@ -47,8 +48,8 @@ std::optional<llvm::StructType *> Generator::Allocation::generate_function_alloc
         return std::nullopt;
     }
     std::vector<llvm::Type *> type_list = {ts_fn_ty};
-    for (const auto &[_, type] : types_list) {
-        type_list.emplace_back(type);
+    for (const auto &field : types_list) {
+        type_list.emplace_back(field.type);
     }
 
     for (size_t i = 0; i < function->parameters.size(); i++) {
@@ -77,7 +78,7 @@ std::optional<llvm::StructType *> Generator::Allocation::generate_function_alloc
         });
     std::vector<llvm::Constant *> frame_elems = {ts_fn_default};
     for (auto type_it = types_list.begin(); type_it != types_list.end(); ++type_it) {
-        frame_elems.push_back(IR::get_default_value_of_type(type_it->second));
+        frame_elems.push_back(IR::get_default_value_of_type(type_it->type));
     }
     llvm::Constant *frame_default = llvm::ConstantStruct::get(frame_type, frame_elems);
 #pragma GCC diagnostic push
@@ -91,10 +92,18 @@ std::optional<llvm::StructType *> Generator::Allocation::generate_function_alloc
     // Finally add all the struct GEPs to the allocations map
     allocations.emplace("flint.stack", parent->arg_begin());
     for (auto type_it = types_list.begin(); type_it != types_list.end(); ++type_it) {
-        const std::string &alloca_name = type_it->first;
-        ASSERT(allocations.find(alloca_name) == allocations.end());
+        const std::string &alloca_name = type_it->name;
         const size_t idx = std::distance(types_list.begin(), type_it);
-        allocations.emplace(alloca_name, builder.CreateStructGEP(frame_type, parent->arg_begin(), idx + 1, alloca_name));
+        llvm::Value *const field_ptr = builder.CreateStructGEP(frame_type, parent->arg_begin(), idx + 1, alloca_name);
+        if (type_it->slot.has_value()) {
+            ASSERT(!allocations.has_variable(type_it->slot.value()));
+            allocations.set_variable(type_it->slot.value(), field_ptr);
+        } else if (type_it->index_array_length > 0) {
+            allocations.set_index_array(type_it->index_array_length, field_ptr);
+        } else {
+            ASSERT(!allocations.contains(alloca_name));
+            allocations.emplace(alloca_name, field_ptr);
+        }
     }
     llvm::Value *const ts_ptr = IR::aligned_load(builder, PTR_TY, parent->arg_begin(), "ts_ptr");
     allocations.emplace("flint.stack.root", ts_ptr);
@@ -131,11 +140,11 @@ std::optional<llvm::StructType *> Generator::Allocation::generate_function_alloc
     return frame_type;
 }
 
-bool Generator::Allocation::generate_allocations(                        //
-    llvm::IRBuilder<> &builder,                                          //
-    llvm::Function *parent,                                              //
-    const std::shared_ptr<Scope> scope,                                  //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types //
+bool Generator::Allocation::generate_allocations( //
+    llvm::IRBuilder<> &builder,                   //
+    llvm::Function *parent,                       //
+    const std::shared_ptr<Scope> scope,           //
+    std::vector<FrameField> &struct_types         //
 ) {
     for (const auto &statement : scope->body) {
         switch (statement->get_variation()) {
@@ -271,7 +280,7 @@ bool Generator::Allocation::generate_allocations(                        //
                 // expressions by itself, but only one of the groups is needed at the same time, so we iterate through the "indexing
                 // expressions" and call the `generate_array_indexing_allocation` on all of them.
                 const auto &base_expr_ty = node->base_expr->type;
-                const uint32_t dimensionality = base_expr_ty->to_string() == "str" ? 1 : base_expr_ty->as<ArrayType>()->dimensionality;
+                const uint32_t dimensionality = base_expr_ty->is(Type::Builtin::STR) ? 1 : base_expr_ty->as<ArrayType>()->dimensionality;
                 for (const auto &expr : node->indexing_expressions) {
                     switch (expr->type->get_variation()) {
                         default:
@@ -369,12 +378,12 @@ bool Generator::Allocation::generate_allocations(                        //
     return true;
 }
 
-bool Generator::Allocation::generate_call_allocations(                    //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    const std::shared_ptr<Scope> scope,                                   //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const CallNodeBase *call_node                                         //
+bool Generator::Allocation::generate_call_allocations( //
+    llvm::IRBuilder<> &builder,                        //
+    llvm::Function *parent,                            //
+    const std::shared_ptr<Scope> scope,                //
+    std::vector<FrameField> &struct_types,             //
+    const CallNodeBase *call_node                      //
 ) {
     // Generate the allocations of all the parameter expressions of the call node
     for (const auto &arg : call_node->arguments) {
@@ -389,11 +398,11 @@ bool Generator::Allocation::generate_call_allocations(                    //
     return true;
 }
 
-bool Generator::Allocation::generate_if_allocations(                      //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const IfNode *if_node                                                 //
+bool Generator::Allocation::generate_if_allocations( //
+    llvm::IRBuilder<> &builder,                      //
+    llvm::Function *parent,                          //
+    std::vector<FrameField> &struct_types,           //
+    const IfNode *if_node                            //
 ) {
     while (if_node != nullptr) {
         if (!generate_expression_allocations(                                                               //
@@ -424,40 +433,31 @@ bool Generator::Allocation::generate_if_allocations(                      //
     return true;
 }
 
-bool Generator::Allocation::generate_enh_for_allocations(                 //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const EnhForLoopNode *for_node                                        //
+bool Generator::Allocation::generate_enh_for_allocations( //
+    llvm::IRBuilder<> &builder,                           //
+    llvm::Function *parent,                               //
+    std::vector<FrameField> &struct_types,                //
+    const EnhForLoopNode *for_node                        //
 ) {
     if (!generate_expression_allocations(builder, parent, for_node->definition_scope, struct_types, for_node->iterable.get())) {
         THROW_BASIC_ERR(ERR_GENERATING);
         return false;
     }
+    const unsigned int scope_id = for_node->definition_scope->scope_id;
     if (std::holds_alternative<std::string>(for_node->iterators)) {
         const std::string it_name = std::get<std::string>(for_node->iterators);
         const auto it_variable = for_node->definition_scope->variables.at(it_name);
         llvm::Type *const it_type = IR::get_type(parent->getParent(), it_variable.type).type;
-        const unsigned int scope_id = for_node->definition_scope->scope_id;
         std::string alloca_name = "s" + std::to_string(scope_id) + "::" + it_name;
-        struct_types.emplace_back(alloca_name, it_type);
+        struct_types.push_back({alloca_name, it_type, for_node->index_slot});
     } else {
         const auto iterators = std::get<std::pair<std::optional<std::string>, std::optional<std::string>>>(for_node->iterators);
-        const unsigned int scope_id = for_node->definition_scope->scope_id;
-        if (iterators.first.has_value()) {
-            const std::string index_name = iterators.first.value();
-            const std::string index_alloca_name = "s" + std::to_string(scope_id) + "::" + index_name;
-            struct_types.emplace_back(index_alloca_name, builder.getInt64Ty());
-        } else {
-            const std::string index_alloca_name = "s" + std::to_string(scope_id) + "::IDX";
-            struct_types.emplace_back(index_alloca_name, builder.getInt64Ty());
-        }
-        if (iterators.second.has_value()) {
-            const std::string element_name = iterators.second.value();
-            const std::string element_alloca_name = "s" + std::to_string(scope_id) + "::" + element_name;
-            if (for_node->iterable->type->get_variation() == Type::Variation::RANGE) {
-                struct_types.emplace_back(element_alloca_name, builder.getInt64Ty());
-            }
+        // A discarded index still gets its hidden counter in the reserved index slot
+        const std::string index_alloca_name = "s" + std::to_string(scope_id) + "::" + iterators.first.value_or("IDX");
+        struct_types.push_back({index_alloca_name, builder.getInt64Ty(), for_node->index_slot});
+        if (for_node->element_slot.has_value() && for_node->iterable->type->get_variation() == Type::Variation::RANGE) {
+            const std::string element_alloca_name = "s" + std::to_string(scope_id) + "::" + iterators.second.value();
+            struct_types.push_back({element_alloca_name, builder.getInt64Ty(), for_node->element_slot.value()});
         }
     }
     if (!generate_allocations(builder, parent, for_node->body, struct_types)) {
@@ -467,12 +467,12 @@ bool Generator::Allocation::generate_enh_for_allocations(                 //
     return true;
 }
 
-bool Generator::Allocation::generate_switch_statement_allocations(        //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    const std::shared_ptr<Scope> scope,                                   //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const SwitchStatement *switch_statement                               //
+bool Generator::Allocation::generate_switch_statement_allocations( //
+    llvm::IRBuilder<> &builder,                                    //
+    llvm::Function *parent,                                        //
+    const std::shared_ptr<Scope> scope,                            //
+    std::vector<FrameField> &struct_types,                         //
+    const SwitchStatement *switch_statement                        //
 ) {
     if (!generate_expression_allocations(builder, parent, scope, struct_types, switch_statement->switcher.get())) {
         THROW_BASIC_ERR(ERR_GENERATING);
@@ -493,12 +493,12 @@ bool Generator::Allocation::generate_switch_statement_allocations(        //
     return true;
 }
 
-bool Generator::Allocation::generate_switch_expression_allocations(       //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    const std::shared_ptr<Scope> scope,                                   //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const SwitchExpression *switch_expression                             //
+bool Generator::Allocation::generate_switch_expression_allocations( //
+    llvm::IRBuilder<> &builder,                                     //
+    llvm::Function *parent,                                         //
+    const std::shared_ptr<Scope> scope,                             //
+    std::vector<FrameField> &struct_types,                          //
+    const SwitchExpression *switch_expression                       //
 ) {
     if (!generate_expression_allocations(builder, parent, scope, struct_types, switch_expression->switcher.get())) {
         THROW_BASIC_ERR(ERR_GENERATING);
@@ -519,12 +519,12 @@ bool Generator::Allocation::generate_switch_expression_allocations(       //
     return true;
 }
 
-bool Generator::Allocation::generate_declaration_allocations(             //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    const std::shared_ptr<Scope> scope,                                   //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const DeclarationNode *declaration_node                               //
+bool Generator::Allocation::generate_declaration_allocations( //
+    llvm::IRBuilder<> &builder,                               //
+    llvm::Function *parent,                                   //
+    const std::shared_ptr<Scope> scope,                       //
+    std::vector<FrameField> &struct_types,                    //
+    const DeclarationNode *declaration_node                   //
 ) {
     CallNodeExpression *call_node_expr = nullptr;
     if (declaration_node->initializer.has_value()) {
@@ -558,38 +558,39 @@ bool Generator::Allocation::generate_declaration_allocations(             //
 
     const std::string var_name = "s" + std::to_string(scope->scope_id) + "::" + declaration_node->name;
     const IR::TypeStorageInfo &type_info = IR::get_type(parent->getParent(), declaration_node->type);
-    struct_types.emplace_back(var_name, type_info.is_complex ? PTR_TY : type_info.type);
+    struct_types.push_back({var_name, type_info.is_complex ? PTR_TY : type_info.type, declaration_node->slot});
 
     return true;
 }
 
-bool Generator::Allocation::generate_group_declaration_allocations(       //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    const std::shared_ptr<Scope> scope,                                   //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const GroupDeclarationNode *group_declaration_node                    //
+bool Generator::Allocation::generate_group_declaration_allocations( //
+    llvm::IRBuilder<> &builder,                                     //
+    llvm::Function *parent,                                         //
+    const std::shared_ptr<Scope> scope,                             //
+    std::vector<FrameField> &struct_types,                          //
+    const GroupDeclarationNode *group_declaration_node              //
 ) {
     if (!generate_expression_allocations(builder, parent, scope, struct_types, group_declaration_node->initializer.get())) {
         THROW_BASIC_ERR(ERR_GENERATING);
         return false;
     }
 
-    for (const auto &variable : group_declaration_node->variables) {
+    for (size_t i = 0; i < group_declaration_node->variables.size(); i++) {
+        const auto &variable = group_declaration_node->variables.at(i);
         if (variable.second.empty()) {
             // Skipping discarded result "variables"
             continue;
         }
         const std::string var_name = "s" + std::to_string(scope->scope_id) + "::" + variable.second;
         const IR::TypeStorageInfo &type_info = IR::get_type(parent->getParent(), variable.first);
-        struct_types.emplace_back(var_name, type_info.is_complex ? PTR_TY : type_info.type);
+        struct_types.push_back({var_name, type_info.is_complex ? PTR_TY : type_info.type, group_declaration_node->slots.at(i)});
     }
     return true;
 }
 
 void Generator::Allocation::generate_array_indexing_allocation(              //
     llvm::IRBuilder<> &builder,                                              //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types,    //
+    std::vector<FrameField> &struct_types,                                   //
     const std::vector<std::unique_ptr<ExpressionNode>> &indexing_expressions //
 ) {
     size_t idx_size = indexing_expressions.size();
@@ -599,22 +600,23 @@ void Generator::Allocation::generate_array_indexing_allocation(              //
             break;
         }
     }
-    const std::string alloca_name = "arr::idx::" + std::to_string(idx_size);
-    if (std::find_if(struct_types.begin(), struct_types.end(), [&](const auto &p) { return p.first == alloca_name; }) //
-        != struct_types.end()                                                                                         //
+    // All accesses with the same number of indices share one index array
+    if (std::find_if(struct_types.begin(), struct_types.end(), [&](const auto &p) { return p.index_array_length == idx_size; }) //
+        != struct_types.end()                                                                                                    //
     ) {
         return;
     }
     llvm::Type *length_array_type = llvm::ArrayType::get(builder.getInt64Ty(), idx_size);
-    struct_types.emplace_back(alloca_name, length_array_type);
+    const std::string alloca_name = "arr::idx::" + std::to_string(idx_size);
+    struct_types.push_back({alloca_name, length_array_type, std::nullopt, static_cast<unsigned int>(idx_size)});
 }
 
-bool Generator::Allocation::generate_expression_allocations(              //
-    llvm::IRBuilder<> &builder,                                           //
-    llvm::Function *parent,                                               //
-    const std::shared_ptr<Scope> scope,                                   //
-    std::vector<std::pair<std::string, llvm::Type *const>> &struct_types, //
-    const ExpressionNode *expression                                      //
+bool Generator::Allocation::generate_expression_allocations( //
+    llvm::IRBuilder<> &builder,                              //
+    llvm::Function *parent,                                  //
+    const std::shared_ptr<Scope> scope,                      //
+    std::vector<FrameField> &struct_types,                   //
+    const ExpressionNode *expression                         //
 ) {
     switch (expression->get_variation()) {
         case ExpressionNode::Variation::ARRAY_ACCESS: {
@@ -691,7 +693,7 @@ bool Generator::Allocation::generate_expression_allocations(              //
             // expressions by itself, but only one of the groups is needed at the same time, so we iterate through the "indexing
             // expressions" and call the `generate_array_indexing_allocation` on all of them.
             const auto &base_expr_ty = node->base_expr->type;
-            const uint32_t dimensionality = base_expr_ty->to_string() == "str" ? 1 : base_expr_ty->as<ArrayType>()->dimensionality;
+            const uint32_t dimensionality = base_expr_ty->is(Type::Builtin::STR) ? 1 : base_expr_ty->as<ArrayType>()->dimensionality;
             for (const auto &expr : node->indexing_expressions) {
                 switch (expr->type->get_variation()) {
                     default:
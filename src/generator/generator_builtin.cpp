@@ -13,15 +13,15 @@ bool Generator::Builtin::init_global_variables( //
 ) {
     // Build a scope and allocations map for the shared data globals so generate_expression can resolve them
     std::shared_ptr<Scope> init_scope = std::make_shared<Scope>();
-    std::unordered_map<std::string, llvm::Value *const> allocations;
+    AllocationMap allocations;
     for (const auto &file : Parser::instances) {
         const Namespace *ns = file.file_node_ptr->file_namespace.get();
         for (const auto &global : ns->public_symbols.globals) {
-            init_scope->variables[global.first] = global.second;
-            allocations.emplace("s0::" + global.first, shared_globals.at(global.first));
+            init_scope->add_variable(global.first, global.second);
+            allocations.set_variable(init_scope->variables.at(global.first).slot, shared_globals.at(global.first));
         }
     }
-    if (allocations.empty()) {
+    if (init_scope->variables.empty()) {
         return true;
     }
 
@@ -86,13 +86,13 @@ bool Generator::Builtin::init_global_variables( //
                     continue;
                 }
                 const std::string mangled_name = data_node->file_hash.to_string() + ".shared." + data_node->name + "." + field.name;
-                const auto gvar_it = allocations.find("s0::" + mangled_name);
-                if (gvar_it == allocations.end()) {
+                const auto gvar_it = init_scope->variables.find(mangled_name);
+                if (gvar_it == init_scope->variables.end()) {
                     continue;
                 }
                 Expression::garbage_type garbage;
                 ExpressionNode *const init_expr = field.initializer.value().get();
-                if (init_expr->type->to_string() == "int" || init_expr->type->to_string() == "float") {
+                if (init_expr->type->is(Type::Builtin::INT) || init_expr->type->is(Type::Builtin::FLOAT)) {
                     init_expr->type = field.type;
                 }
                 auto result = Expression::generate_expression(*builder, ctx, garbage, 0, init_expr);
@@ -103,7 +103,7 @@ bool Generator::Builtin::init_global_variables( //
                     return false;
                 }
                 llvm::Value *init_val = result.value().front();
-                if (field.type->to_string() == "str" && init_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
+                if (field.type->is(Type::Builtin::STR) && init_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
                     const auto *lit_node = init_expr->as<LiteralNode>();
                     if (std::holds_alternative<LitStr>(lit_node->value)) {
                         const std::string &str_val = std::get<LitStr>(lit_node->value).value;
@@ -111,7 +111,7 @@ bool Generator::Builtin::init_global_variables( //
                         init_val = builder->CreateCall(init_str_fn, {init_val, builder->getInt64(str_val.length())}, "init_str_value");
                     }
                 }
-                IR::aligned_store(*builder, init_val, gvar_it->second);
+                IR::aligned_store(*builder, init_val, allocations.get_variable(gvar_it->second.slot));
             }
         }
     }
@@ -317,7 +317,7 @@ bool Generator::Builtin::generate_builtin_main(llvm::IRBuilder<> *builder, llvm:
     builder->SetInsertPoint(current_block);
 
     // Check if the main function returned an error and branch accordingly
-    builder->CreateCondBr(main_call, catch_block, merge_block)
+    builder->CreateCondBr(main_call, catch_block, merge_block, IR::generate_weights(1, 100))
         ->setMetadata("comment",
             llvm::MDNode::get(context,
                 llvm::MDString::get(context, "Branch to '" + catch_block->getName().str() + "' if 'main' returned error")));
@@ -997,6 +997,154 @@ void Generator::Builtin::generate_c_functions(llvm::Module *module) {
         );
         c_functions[CLOSE] = close_fn;
     }
+    // strcmp
+    {
+        llvm::FunctionType *strcmp_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                       // return i32
+            {
+                PTR_TY, // char* lhs
+                PTR_TY  // char* rhs
+            },          //
+            false       // No vaarg
+        );
+        llvm::Function *strcmp_fn = llvm::Function::Create(strcmp_type, llvm::Function::ExternalLinkage, "strcmp", module);
+        c_functions[STRCMP] = strcmp_fn;
+    }
+    // strstr
+    {
+        llvm::FunctionType *strstr_type = llvm::FunctionType::get( //
+            PTR_TY,                                                // return char*
+            {
+                PTR_TY, // char* haystack
+                PTR_TY  // char* needle
+            },          //
+            false       // No vaarg
+        );
+        llvm::Function *strstr_fn = llvm::Function::Create(strstr_type, llvm::Function::ExternalLinkage, "strstr", module);
+        c_functions[STRSTR] = strstr_fn;
+    }
+    // qsort
+    {
+        llvm::FunctionType *qsort_type = llvm::FunctionType::get( //
+            llvm::Type::getVoidTy(context),                       // return void
+            {
+                PTR_TY,                          // void* base
+                llvm::Type::getInt64Ty(context), // u64 count
+                llvm::Type::getInt64Ty(context), // u64 size
+                PTR_TY                           // int (*compare)(const void*, const void*)
+            },                                   //
+            false                                // No vaarg
+        );
+        llvm::Function *qsort_fn = llvm::Function::Create(qsort_type, llvm::Function::ExternalLinkage, "qsort", module);
+        c_functions[QSORT] = qsort_fn;
+    }
+    // fprintf
+    {
+        llvm::FunctionType *fprintf_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                        // return i32
+            {
+                PTR_TY, // FILE* stream
+                PTR_TY  // char* format
+            },          //
+            true        // Variadic arguments
+        );
+        llvm::Function *fprintf_fn = llvm::Function::Create(fprintf_type, llvm::Function::ExternalLinkage, "fprintf", module);
+        c_functions[FPRINTF] = fprintf_fn;
+    }
+    // memchr
+    {
+        llvm::FunctionType *memchr_type = llvm::FunctionType::get( //
+            PTR_TY,                                                // return void*
+            {
+                PTR_TY,                          // void* buffer
+                llvm::Type::getInt32Ty(context), // i32 character
+                llvm::Type::getInt64Ty(context)  // u64 size
+            },                                   //
+            false                                // No vaarg
+        );
+        llvm::Function *memchr_fn = llvm::Function::Create(memchr_type, llvm::Function::ExternalLinkage, "memchr", module);
+        c_functions[MEMCHR] = memchr_fn;
+    }
+    // ferror
+    {
+        llvm::FunctionType *ferror_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                      // return i32
+            {PTR_TY},                                             // FILE* stream
+            false                                                 // No vaarg
+        );
+        llvm::Function *ferror_fn = llvm::Function::Create(ferror_type, llvm::Function::ExternalLinkage, "ferror", module);
+        c_functions[FERROR] = ferror_fn;
+    }
+#ifndef __WIN32__
+    // fork
+    {
+        llvm::FunctionType *fork_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                     // return i32 (pid_t)
+            {},                                                  //
+            false                                                // No vaarg
+        );
+        llvm::Function *fork_fn = llvm::Function::Create(fork_type, llvm::Function::ExternalLinkage, "fork", module);
+        c_functions[FORK] = fork_fn;
+    }
+    // waitpid
+    {
+        llvm::FunctionType *waitpid_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                        // return i32 (pid_t)
+            {
+                llvm::Type::getInt32Ty(context), // i32 pid
+                PTR_TY,                          // i32* status
+                llvm::Type::getInt32Ty(context)  // i32 options
+            },                                   //
+            false                                // No vaarg
+        );
+        llvm::Function *waitpid_fn = llvm::Function::Create(waitpid_type, llvm::Function::ExternalLinkage, "waitpid", module);
+        c_functions[WAITPID] = waitpid_fn;
+    }
+    // mmap
+    {
+        llvm::FunctionType *mmap_type = llvm::FunctionType::get( //
+            PTR_TY,                                              // return void*
+            {
+                PTR_TY,                          // void* address
+                llvm::Type::getInt64Ty(context), // u64 length
+                llvm::Type::getInt32Ty(context), // i32 protection
+                llvm::Type::getInt32Ty(context), // i32 flags
+                llvm::Type::getInt32Ty(context), // i32 fd
+                llvm::Type::getInt64Ty(context)  // i64 offset
+            },                                   //
+            false                                // No vaarg
+        );
+        llvm::Function *mmap_fn = llvm::Function::Create(mmap_type, llvm::Function::ExternalLinkage, "mmap", module);
+        c_functions[MMAP] = mmap_fn;
+    }
+    // munmap
+    {
+        llvm::FunctionType *munmap_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                       // return i32
+            {
+                PTR_TY,                         // void* address
+                llvm::Type::getInt64Ty(context) // u64 length
+            },                                  //
+            false                               // No vaarg
+        );
+        llvm::Function *munmap_fn = llvm::Function::Create(munmap_type, llvm::Function::ExternalLinkage, "munmap", module);
+        c_functions[MUNMAP] = munmap_fn;
+    }
+    // madvise
+    {
+        llvm::FunctionType *madvise_type = llvm::FunctionType::get( //
+            llvm::Type::getInt32Ty(context),                        // return i32
+            {
+                PTR_TY,                          // void* address
+                llvm::Type::getInt64Ty(context), // u64 length
+                llvm::Type::getInt32Ty(context)  // i32 advice
+            },                                   //
+            false                                // No vaarg
+        );
+        llvm::Function *madvise_fn = llvm::Function::Create(madvise_type, llvm::Function::ExternalLinkage, "madvise", module);
+        c_functions[MADVISE] = madvise_fn;
+    }
+#endif
 }
 
 bool Generator::Builtin::refresh_c_functions(llvm::Module *module) {
@@ -1057,6 +1205,19 @@ bool Generator::Builtin::refresh_c_functions(llvm::Module *module) {
     c_functions[FILENO] = module->getFunction("fileno");
 #endif
     c_functions[CLOSE] = module->getFunction("close");
+    c_functions[STRCMP] = module->getFunction("strcmp");
+    c_functions[STRSTR] = module->getFunction("strstr");
+    c_functions[QSORT] = module->getFunction("qsort");
+    c_functions[FPRINTF] = module->getFunction("fprintf");
+    c_functions[MEMCHR] = module->getFunction("memchr");
+    c_functions[FERROR] = module->getFunction("ferror");
+#ifndef __WIN32__
+    c_functions[FORK] = module->getFunction("fork");
+    c_functions[WAITPID] = module->getFunction("waitpid");
+    c_functions[MMAP] = module->getFunction("mmap");
+    c_functions[MUNMAP] = module->getFunction("munmap");
+    c_functions[MADVISE] = module->getFunction("madvise");
+#endif
     for (auto &c_function : c_functions) {
         if (c_function.second == nullptr) {
             return false;
@@ -1228,8 +1389,691 @@ llvm::Function *Generator::Builtin::generate_visible_width_function(llvm::IRBuil
     return visible_width_fn;
 }
 
+llvm::Value *Generator::Builtin::generate_elapsed_ms( //
+    llvm::IRBuilder<> *builder,                       //
+    llvm::Module *module,                             //
+    llvm::Value *start_stamp,                         //
+    llvm::Value *end_stamp                            //
+) {
+    // The time stamps are read and released directly, going through `duration` and `as_unit` would allocate yet another value for
+    // every single sample. The DIMA head of the time stamps lives in the builtins library, so it only needs to be declared here
+    const std::string head_name = Hash(std::string("time")).to_string() + ".dima.head.data.TimeStamp";
+    llvm::GlobalVariable *timestamp_head = module->getGlobalVariable(head_name);
+    if (timestamp_head == nullptr) {
+        timestamp_head = new llvm::GlobalVariable(*module, PTR_TY, false, llvm::GlobalValue::ExternalLinkage, nullptr, head_name);
+    }
+    llvm::StructType *const timestamp_type = Module::Time::time_data_types.at("TimeStamp");
+    llvm::Value *const start_value_ptr = builder->CreateStructGEP(timestamp_type, start_stamp, 0, "start_value_ptr");
+    llvm::Value *const start_value = IR::aligned_load(*builder, builder->getInt64Ty(), start_value_ptr, "start_value");
+    llvm::Value *const end_value_ptr = builder->CreateStructGEP(timestamp_type, end_stamp, 0, "end_value_ptr");
+    llvm::Value *const end_value = IR::aligned_load(*builder, builder->getInt64Ty(), end_value_ptr, "end_value");
+    llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
+    builder->CreateCall(dima_release_fn, {timestamp_head, start_stamp});
+    builder->CreateCall(dima_release_fn, {timestamp_head, end_stamp});
+    llvm::Value *const elapsed_ns = builder->CreateSub(end_value, start_value, "elapsed_ns");
+    llvm::Value *const elapsed_ns_f64 = builder->CreateUIToFP(elapsed_ns, builder->getDoubleTy(), "elapsed_ns_f64");
+    return builder->CreateFDiv(elapsed_ns_f64, llvm::ConstantFP::get(builder->getDoubleTy(), 1000000.0), "elapsed_ms");
+}
+
+llvm::Function *Generator::Builtin::generate_measure_perf_test_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // int measure_perf(bool (*test_fn)(void *), void *stack, void *snapshot, size_t frame_size, double first_ms, double **samples_out) {
+    //     int capacity = perf_min_time > 0.0 ? MAX_PERF_SAMPLES : perf_iterations;
+    //     double *samples = (double *)malloc(capacity * sizeof(double));
+    //     *samples_out = samples;
+    //     int count = 0;
+    //     double measured = 0.0;
+    //     if (perf_warmup == 0) {
+    //         samples[count++] = first_ms;
+    //         measured = first_ms;
+    //     }
+    //     // The output of all repetitions is captured and thrown away, only the output of the first run is shown
+    //     start_capture();
+    //     for (int run = 1; count < capacity && (count < perf_iterations || measured < perf_min_time); run++) {
+    //         // Every run starts with the same frame the first run started with
+    //         memcpy(stack, snapshot, frame_size);
+    //         TimeStamp *start = now();
+    //         test_fn(stack);
+    //         TimeStamp *end = now();
+    //         double ms = elapsed_ms(start, end);
+    //         if (run >= perf_warmup) {
+    //             samples[count++] = ms;
+    //             measured += ms;
+    //         }
+    //     }
+    //     free(end_capture());
+    //     return count;
+    // }
+    llvm::Type *const i32_type = builder->getInt32Ty();
+    llvm::Type *const f64_type = builder->getDoubleTy();
+    llvm::FunctionType *const measure_type = llvm::FunctionType::get( //
+        i32_type,                                                     // The number of samples
+        {
+            PTR_TY,                // void* test_fn_ptr
+            PTR_TY,                // void* stack
+            PTR_TY,                // void* snapshot
+            builder->getInt64Ty(), // u64 frame_size
+            f64_type,              // f64 first_ms
+            PTR_TY                 // f64** samples_out
+        },                         //
+        false                      //
+    );
+    llvm::Function *const measure_fn = llvm::Function::Create(                        //
+        measure_type, llvm::Function::ExternalLinkage, "test.measure_perf", module //
+    );
+    llvm::Argument *const arg_test_fn_ptr = measure_fn->getArg(0);
+    arg_test_fn_ptr->setName("test_fn_ptr");
+    llvm::Argument *const arg_stack = measure_fn->getArg(1);
+    arg_stack->setName("stack");
+    llvm::Argument *const arg_snapshot = measure_fn->getArg(2);
+    arg_snapshot->setName("snapshot");
+    llvm::Argument *const arg_frame_size = measure_fn->getArg(3);
+    arg_frame_size->setName("frame_size");
+    llvm::Argument *const arg_first_ms = measure_fn->getArg(4);
+    arg_first_ms->setName("first_ms");
+    llvm::Argument *const arg_samples_out = measure_fn->getArg(5);
+    arg_samples_out->setName("samples_out");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", measure_fn);
+    llvm::BasicBlock *const first_sample_block = llvm::BasicBlock::Create(context, "first_sample", measure_fn);
+    llvm::BasicBlock *const repeat_block = llvm::BasicBlock::Create(context, "repeat", measure_fn);
+    llvm::BasicBlock *const loop_cond_block = llvm::BasicBlock::Create(context, "loop_cond", measure_fn);
+    llvm::BasicBlock *const check_done_block = llvm::BasicBlock::Create(context, "check_done", measure_fn);
+    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", measure_fn);
+    llvm::BasicBlock *const store_sample_block = llvm::BasicBlock::Create(context, "store_sample", measure_fn);
+    llvm::BasicBlock *const loop_inc_block = llvm::BasicBlock::Create(context, "loop_inc", measure_fn);
+    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", measure_fn);
+
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const count_alloca = builder->CreateAlloca(i32_type, nullptr, "count");
+    llvm::AllocaInst *const measured_alloca = builder->CreateAlloca(f64_type, nullptr, "measured");
+    llvm::AllocaInst *const run_alloca = builder->CreateAlloca(i32_type, nullptr, "run");
+    IR::aligned_store(*builder, builder->getInt32(0), count_alloca);
+    IR::aligned_store(*builder, llvm::ConstantFP::get(f64_type, 0.0), measured_alloca);
+    IR::aligned_store(*builder, builder->getInt32(1), run_alloca);
+    llvm::Value *const warmup = IR::aligned_load(*builder, i32_type, test_variables.at("perf_warmup"), "warmup");
+    llvm::Value *const iterations = IR::aligned_load(*builder, i32_type, test_variables.at("perf_iterations"), "iterations");
+    llvm::Value *const min_time = IR::aligned_load(*builder, f64_type, test_variables.at("perf_min_time"), "min_time");
+    llvm::Value *const has_min_time = builder->CreateFCmpOGT(min_time, llvm::ConstantFP::get(f64_type, 0.0), "has_min_time");
+    llvm::Value *const capacity = builder->CreateSelect(has_min_time, builder->getInt32(MAX_PERF_SAMPLES), iterations, "capacity");
+    llvm::Value *const capacity_i64 = builder->CreateZExt(capacity, builder->getInt64Ty(), "capacity_i64");
+    llvm::Value *const samples_size = builder->CreateMul(capacity_i64, builder->getInt64(sizeof(double)), "samples_size");
+    llvm::Value *const samples = builder->CreateCall(c_functions.at(MALLOC), {samples_size}, "samples");
+    IR::aligned_store(*builder, samples, arg_samples_out);
+    llvm::Value *const has_no_warmup = builder->CreateICmpEQ(warmup, builder->getInt32(0), "has_no_warmup");
+    builder->CreateCondBr(has_no_warmup, first_sample_block, repeat_block);
+
+    builder->SetInsertPoint(first_sample_block);
+    IR::aligned_store(*builder, arg_first_ms, samples);
+    IR::aligned_store(*builder, builder->getInt32(1), count_alloca);
+    IR::aligned_store(*builder, arg_first_ms, measured_alloca);
+    builder->CreateBr(repeat_block);
+
+    // The output of all repetitions is captured and thrown away, only the output of the first run is shown
+    builder->SetInsertPoint(repeat_block);
+    builder->CreateCall(Module::System::system_functions.at("start_capture"), {});
+    builder->CreateBr(loop_cond_block);
+
+    builder->SetInsertPoint(loop_cond_block);
+    llvm::Value *const count = IR::aligned_load(*builder, i32_type, count_alloca, "count_value");
+    llvm::Value *const has_capacity = builder->CreateICmpSLT(count, capacity, "has_capacity");
+    builder->CreateCondBr(has_capacity, check_done_block, return_block);
+
+    builder->SetInsertPoint(check_done_block);
+    llvm::Value *const measured = IR::aligned_load(*builder, f64_type, measured_alloca, "measured_value");
+    llvm::Value *const needs_iterations = builder->CreateICmpSLT(count, iterations, "needs_iterations");
+    llvm::Value *const needs_time = builder->CreateFCmpOLT(measured, min_time, "needs_time");
+    builder->CreateCondBr(builder->CreateOr(needs_iterations, needs_time, "needs_run"), loop_body_block, return_block);
+
+    // Every run starts with the same frame the first run started with
+    builder->SetInsertPoint(loop_body_block);
+    builder->CreateCall(c_functions.at(MEMCPY), {arg_stack, arg_snapshot, arg_frame_size});
+    llvm::Function *const time_now_fn = Module::Time::time_functions.at("now");
+    llvm::Value *const start_stamp = builder->CreateCall(time_now_fn, {}, "start_stamp");
+    llvm::FunctionType *const test_function_type = llvm::FunctionType::get(builder->getInt1Ty(), {PTR_TY}, false);
+    llvm::CallInst *const test_call = builder->CreateCall(llvm::FunctionCallee(test_function_type, arg_test_fn_ptr), {arg_stack});
+    if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
+#ifndef __WIN32__
+        test_call->addParamAttr(0, llvm::Attribute::InReg);
+#endif
+    }
+    llvm::Value *const end_stamp = builder->CreateCall(time_now_fn, {}, "end_stamp");
+    llvm::Value *const sample = generate_elapsed_ms(builder, module, start_stamp, end_stamp);
+    llvm::Value *const run = IR::aligned_load(*builder, i32_type, run_alloca, "run_value");
+    llvm::Value *const is_measured = builder->CreateICmpSGE(run, warmup, "is_measured");
+    builder->CreateCondBr(is_measured, store_sample_block, loop_inc_block);
+
+    builder->SetInsertPoint(store_sample_block);
+    llvm::Value *const sample_ptr = builder->CreateGEP(f64_type, samples, count, "sample_ptr");
+    IR::aligned_store(*builder, sample, sample_ptr);
+    IR::aligned_store(*builder, builder->CreateAdd(count, builder->getInt32(1), "count_p1"), count_alloca);
+    IR::aligned_store(*builder, builder->CreateFAdd(measured, sample, "new_measured"), measured_alloca);
+    builder->CreateBr(loop_inc_block);
+
+    builder->SetInsertPoint(loop_inc_block);
+    IR::aligned_store(*builder, builder->CreateAdd(run, builder->getInt32(1), "run_p1"), run_alloca);
+    builder->CreateBr(loop_cond_block);
+
+    builder->SetInsertPoint(return_block);
+    llvm::Value *const discarded_output = builder->CreateCall(                           //
+        Module::System::system_functions.at("end_capture"), {}, "discarded_output" //
+    );
+    Memory::generate_free_call(builder, module, discarded_output, Type::get_primitive_type("str"));
+    llvm::Value *const sample_count = IR::aligned_load(*builder, i32_type, count_alloca, "sample_count");
+    builder->CreateRet(sample_count);
+
+    return measure_fn;
+}
+
+llvm::Function *Generator::Builtin::generate_perf_stats_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // int compare_f64(const void *lhs, const void *rhs) {
+    //     double a = *(const double *)lhs;
+    //     double b = *(const double *)rhs;
+    //     return (a > b) - (a < b);
+    // }
+    //
+    // void perf_stats(double *samples, int count, double *stats) {
+    //     qsort(samples, count, sizeof(double), compare_f64);
+    //     double sum = 0.0;
+    //     for (int i = 0; i < count; i++) {
+    //         sum += samples[i];
+    //     }
+    //     double mean = sum / count;
+    //     double squares = 0.0;
+    //     for (int i = 0; i < count; i++) {
+    //         squares += (samples[i] - mean) * (samples[i] - mean);
+    //     }
+    //     stats[0] = samples[0];
+    //     stats[1] = (samples[(count - 1) / 2] + samples[count / 2]) / 2.0;
+    //     stats[2] = mean;
+    //     stats[3] = count > 1 ? sqrt(squares / (count - 1)) : 0.0;
+    //     // The nearest rank, e.g. the smallest sample which is at least as large as 99% of all samples
+    //     stats[4] = samples[(count * 99 + 99) / 100 - 1];
+    // }
+    llvm::Type *const i32_type = builder->getInt32Ty();
+    llvm::Type *const f64_type = builder->getDoubleTy();
+
+    llvm::FunctionType *const compare_type = llvm::FunctionType::get(i32_type, {PTR_TY, PTR_TY}, false);
+    llvm::Function *const compare_fn = llvm::Function::Create(                        //
+        compare_type, llvm::Function::InternalLinkage, "test.compare_f64", module //
+    );
+    builder->SetInsertPoint(llvm::BasicBlock::Create(context, "entry", compare_fn));
+    llvm::Value *const lhs = IR::aligned_load(*builder, f64_type, compare_fn->getArg(0), "lhs");
+    llvm::Value *const rhs = IR::aligned_load(*builder, f64_type, compare_fn->getArg(1), "rhs");
+    llvm::Value *const is_gt = builder->CreateZExt(builder->CreateFCmpOGT(lhs, rhs), i32_type, "is_gt");
+    llvm::Value *const is_lt = builder->CreateZExt(builder->CreateFCmpOLT(lhs, rhs), i32_type, "is_lt");
+    builder->CreateRet(builder->CreateSub(is_gt, is_lt, "ordering"));
+
+    llvm::FunctionType *const stats_type = llvm::FunctionType::get( //
+        builder->getVoidTy(),                                       //
+        {
+            PTR_TY,   // f64* samples
+            i32_type, // i32 count
+            PTR_TY    // f64* stats
+        },            //
+        false         //
+    );
+    llvm::Function *const stats_fn = llvm::Function::Create(                      //
+        stats_type, llvm::Function::ExternalLinkage, "test.perf_stats", module //
+    );
+    llvm::Argument *const arg_samples = stats_fn->getArg(0);
+    arg_samples->setName("samples");
+    llvm::Argument *const arg_count = stats_fn->getArg(1);
+    arg_count->setName("count");
+    llvm::Argument *const arg_stats = stats_fn->getArg(2);
+    arg_stats->setName("stats");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", stats_fn);
+    llvm::BasicBlock *const sum_cond_block = llvm::BasicBlock::Create(context, "sum_cond", stats_fn);
+    llvm::BasicBlock *const sum_body_block = llvm::BasicBlock::Create(context, "sum_body", stats_fn);
+    llvm::BasicBlock *const mean_block = llvm::BasicBlock::Create(context, "mean", stats_fn);
+    llvm::BasicBlock *const squares_cond_block = llvm::BasicBlock::Create(context, "squares_cond", stats_fn);
+    llvm::BasicBlock *const squares_body_block = llvm::BasicBlock::Create(context, "squares_body", stats_fn);
+    llvm::BasicBlock *const stats_block = llvm::BasicBlock::Create(context, "stats", stats_fn);
+
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const i_alloca = builder->CreateAlloca(i32_type, nullptr, "i");
+    llvm::AllocaInst *const sum_alloca = builder->CreateAlloca(f64_type, nullptr, "sum");
+    IR::aligned_store(*builder, builder->getInt32(0), i_alloca);
+    IR::aligned_store(*builder, llvm::ConstantFP::get(f64_type, 0.0), sum_alloca);
+    llvm::Value *const count_i64 = builder->CreateZExt(arg_count, builder->getInt64Ty(), "count_i64");
+    builder->CreateCall(c_functions.at(QSORT), {arg_samples, count_i64, builder->getInt64(sizeof(double)), compare_fn});
+    llvm::Value *const count_f64 = builder->CreateUIToFP(arg_count, f64_type, "count_f64");
+    builder->CreateBr(sum_cond_block);
+
+    builder->SetInsertPoint(sum_cond_block);
+    llvm::Value *i_value = IR::aligned_load(*builder, i32_type, i_alloca, "i_value");
+    builder->CreateCondBr(builder->CreateICmpSLT(i_value, arg_count, "i_lt_count"), sum_body_block, mean_block);
+
+    builder->SetInsertPoint(sum_body_block);
+    llvm::Value *sample_ptr = builder->CreateGEP(f64_type, arg_samples, i_value, "sample_ptr");
+    llvm::Value *sample = IR::aligned_load(*builder, f64_type, sample_ptr, "sample");
+    llvm::Value *sum = IR::aligned_load(*builder, f64_type, sum_alloca, "sum_value");
+    IR::aligned_store(*builder, builder->CreateFAdd(sum, sample, "new_sum"), sum_alloca);
+    IR::aligned_store(*builder, builder->CreateAdd(i_value, builder->getInt32(1), "i_p1"), i_alloca);
+    builder->CreateBr(sum_cond_block);
+
+    // The sum is re-used for the sum of all squared deviations from the mean
+    builder->SetInsertPoint(mean_block);
+    llvm::Value *const total = IR::aligned_load(*builder, f64_type, sum_alloca, "total");
+    llvm::Value *const mean = builder->CreateFDiv(total, count_f64, "mean");
+    IR::aligned_store(*builder, builder->getInt32(0), i_alloca);
+    IR::aligned_store(*builder, llvm::ConstantFP::get(f64_type, 0.0), sum_alloca);
+    builder->CreateBr(squares_cond_block);
+
+    builder->SetInsertPoint(squares_cond_block);
+    i_value = IR::aligned_load(*builder, i32_type, i_alloca, "i_value");
+    builder->CreateCondBr(builder->CreateICmpSLT(i_value, arg_count, "i_lt_count"), squares_body_block, stats_block);
+
+    builder->SetInsertPoint(squares_body_block);
+    sample_ptr = builder->CreateGEP(f64_type, arg_samples, i_value, "sample_ptr");
+    sample = IR::aligned_load(*builder, f64_type, sample_ptr, "sample");
+    llvm::Value *const deviation = builder->CreateFSub(sample, mean, "deviation");
+    llvm::Value *const square = builder->CreateFMul(deviation, deviation, "square");
+    sum = IR::aligned_load(*builder, f64_type, sum_alloca, "sum_value");
+    IR::aligned_store(*builder, builder->CreateFAdd(sum, square, "new_sum"), sum_alloca);
+    IR::aligned_store(*builder, builder->CreateAdd(i_value, builder->getInt32(1), "i_p1"), i_alloca);
+    builder->CreateBr(squares_cond_block);
+
+    builder->SetInsertPoint(stats_block);
+    const auto load_sample = [&](llvm::Value *index, const std::string &name) {
+        llvm::Value *const ptr = builder->CreateGEP(f64_type, arg_samples, index, name + "_ptr");
+        return IR::aligned_load(*builder, f64_type, ptr, name);
+    };
+    const auto store_stat = [&](const unsigned int index, llvm::Value *stat) {
+        IR::aligned_store(*builder, stat, builder->CreateGEP(f64_type, arg_stats, builder->getInt32(index), "stat_ptr"));
+    };
+    store_stat(0, load_sample(builder->getInt32(0), "min"));
+    llvm::Value *const lower_middle_idx = builder->CreateSDiv(builder->CreateSub(arg_count, builder->getInt32(1)), builder->getInt32(2));
+    llvm::Value *const upper_middle_idx = builder->CreateSDiv(arg_count, builder->getInt32(2), "upper_middle_idx");
+    llvm::Value *const lower_middle = load_sample(lower_middle_idx, "lower_middle");
+    llvm::Value *const upper_middle = load_sample(upper_middle_idx, "upper_middle");
+    llvm::Value *const middle_sum = builder->CreateFAdd(lower_middle, upper_middle, "middle_sum");
+    store_stat(1, builder->CreateFDiv(middle_sum, llvm::ConstantFP::get(f64_type, 2.0), "median"));
+    store_stat(2, mean);
+    llvm::Value *const squares = IR::aligned_load(*builder, f64_type, sum_alloca, "squares");
+    llvm::Value *const count_m1 = builder->CreateSub(arg_count, builder->getInt32(1), "count_m1");
+    llvm::Value *const variance = builder->CreateFDiv(squares, builder->CreateUIToFP(count_m1, f64_type), "variance");
+    llvm::Value *const sample_stddev = builder->CreateCall(c_functions.at(SQRT), {variance}, "sample_stddev");
+    llvm::Value *const has_deviation = builder->CreateICmpSGT(arg_count, builder->getInt32(1), "has_deviation");
+    store_stat(3, builder->CreateSelect(has_deviation, sample_stddev, llvm::ConstantFP::get(f64_type, 0.0), "stddev"));
+    // The nearest rank, e.g. the smallest sample which is at least as large as 99% of all samples
+    llvm::Value *const rank = builder->CreateSDiv(                                                          //
+        builder->CreateAdd(builder->CreateMul(arg_count, builder->getInt32(99)), builder->getInt32(99)), //
+        builder->getInt32(100), "rank"                                                                   //
+    );
+    store_stat(4, load_sample(builder->CreateSub(rank, builder->getInt32(1), "p99_idx"), "p99"));
+    builder->CreateRetVoid();
+
+    return stats_fn;
+}
+
+llvm::Function *Generator::Builtin::generate_escape_perf_name_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // void escape_perf_name(char *dest, const char *name, bool json) {
+    //     // A quoted CSV field doubles its quotes, a JSON string escapes quotes and backslashes with a backslash
+    //     for (; *name != '\0'; name++) {
+    //         if (*name == '"' || (json && *name == '\\')) {
+    //             *dest++ = json ? '\\' : '"';
+    //         }
+    //         *dest++ = *name;
+    //     }
+    //     *dest = '\0';
+    // }
+    llvm::Type *const i8_type = builder->getInt8Ty();
+    llvm::FunctionType *const escape_type = llvm::FunctionType::get( //
+        builder->getVoidTy(),                                        //
+        {
+            PTR_TY,               // char* dest
+            PTR_TY,               // char* name
+            builder->getInt1Ty()  // bool json
+        },                        //
+        false                     //
+    );
+    llvm::Function *const escape_fn = llvm::Function::Create(                         //
+        escape_type, llvm::Function::ExternalLinkage, "test.escape_perf_name", module //
+    );
+    llvm::Argument *const arg_dest = escape_fn->getArg(0);
+    arg_dest->setName("dest");
+    llvm::Argument *const arg_name = escape_fn->getArg(1);
+    arg_name->setName("name");
+    llvm::Argument *const arg_json = escape_fn->getArg(2);
+    arg_json->setName("json");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", escape_fn);
+    llvm::BasicBlock *const loop_block = llvm::BasicBlock::Create(context, "loop", escape_fn);
+    llvm::BasicBlock *const check_block = llvm::BasicBlock::Create(context, "check", escape_fn);
+    llvm::BasicBlock *const escape_block = llvm::BasicBlock::Create(context, "escape", escape_fn);
+    llvm::BasicBlock *const copy_block = llvm::BasicBlock::Create(context, "copy", escape_fn);
+    llvm::BasicBlock *const end_block = llvm::BasicBlock::Create(context, "end", escape_fn);
+
+    builder->SetInsertPoint(entry_block);
+    builder->CreateBr(loop_block);
+
+    builder->SetInsertPoint(loop_block);
+    llvm::PHINode *const name_idx = builder->CreatePHI(builder->getInt64Ty(), 2, "name_idx");
+    name_idx->addIncoming(builder->getInt64(0), entry_block);
+    llvm::PHINode *const dest_idx = builder->CreatePHI(builder->getInt64Ty(), 2, "dest_idx");
+    dest_idx->addIncoming(builder->getInt64(0), entry_block);
+    llvm::Value *const char_ptr = builder->CreateGEP(i8_type, arg_name, name_idx, "char_ptr");
+    llvm::Value *const current_char = IR::aligned_load(*builder, i8_type, char_ptr, "current_char");
+    builder->CreateCondBr(builder->CreateICmpEQ(current_char, builder->getInt8(0), "is_end"), end_block, check_block);
+
+    // A quoted CSV field doubles its quotes, a JSON string escapes quotes and backslashes with a backslash
+    builder->SetInsertPoint(check_block);
+    llvm::Value *const is_quote = builder->CreateICmpEQ(current_char, builder->getInt8('"'), "is_quote");
+    llvm::Value *const is_backslash = builder->CreateICmpEQ(current_char, builder->getInt8('\\'), "is_backslash");
+    llvm::Value *const needs_escape = builder->CreateOr(is_quote, builder->CreateAnd(arg_json, is_backslash), "needs_escape");
+    builder->CreateCondBr(needs_escape, escape_block, copy_block);
+
+    builder->SetInsertPoint(escape_block);
+    llvm::Value *const escape_char = builder->CreateSelect(arg_json, builder->getInt8('\\'), builder->getInt8('"'), "escape_char");
+    IR::aligned_store(*builder, escape_char, builder->CreateGEP(i8_type, arg_dest, dest_idx, "escape_ptr"));
+    llvm::Value *const escaped_idx = builder->CreateAdd(dest_idx, builder->getInt64(1), "escaped_idx");
+    builder->CreateBr(copy_block);
+
+    builder->SetInsertPoint(copy_block);
+    llvm::PHINode *const copy_idx = builder->CreatePHI(builder->getInt64Ty(), 2, "copy_idx");
+    copy_idx->addIncoming(dest_idx, check_block);
+    copy_idx->addIncoming(escaped_idx, escape_block);
+    IR::aligned_store(*builder, current_char, builder->CreateGEP(i8_type, arg_dest, copy_idx, "copy_ptr"));
+    name_idx->addIncoming(builder->CreateAdd(name_idx, builder->getInt64(1), "next_name_idx"), copy_block);
+    dest_idx->addIncoming(builder->CreateAdd(copy_idx, builder->getInt64(1), "next_dest_idx"), copy_block);
+    builder->CreateBr(loop_block);
+
+    builder->SetInsertPoint(end_block);
+    IR::aligned_store(*builder, builder->getInt8(0), builder->CreateGEP(i8_type, arg_dest, dest_idx, "terminator_ptr"));
+    builder->CreateRetVoid();
+
+    return escape_fn;
+}
+
+llvm::Function *Generator::Builtin::generate_perf_baseline_function( //
+    llvm::IRBuilder<> *builder,                                      //
+    llvm::Module *module,                                            //
+    llvm::Function *escape_name_fn                                   //
+) {
+    // THE C IMPLEMENTATION:
+    // double perf_baseline_median(char *name) {
+    //     if (perf_baseline == NULL) {
+    //         return -1.0;
+    //     }
+    //     FILE *file = fopen(perf_baseline, "r");
+    //     if (file == NULL) {
+    //         return -1.0;
+    //     }
+    //     // The baseline can be in either format, independent from the format of this run
+    //     const size_t name_len = strlen(name);
+    //     char escaped[name_len * 2 + 1];
+    //     char csv_prefix[name_len * 2 + 4];
+    //     char json_prefix[name_len * 2 + 12];
+    //     escape_perf_name(escaped, name, false);
+    //     const size_t csv_prefix_len = snprintf(csv_prefix, sizeof(csv_prefix), "\"%s\",", escaped);
+    //     escape_perf_name(escaped, name, true);
+    //     const size_t json_prefix_len = snprintf(json_prefix, sizeof(json_prefix), "{\"name\":\"%s\",", escaped);
+    //     char line[1024];
+    //     double median = -1.0;
+    //     while (json_prefix_len < sizeof(line) && fgets(line, sizeof(line), file) != NULL) {
+    //         if (line[0] == '{') {
+    //             // JSON lines contain a `"median_ms":` key
+    //             if (memcmp(line, json_prefix, json_prefix_len) == 0) {
+    //                 char *median_key = strstr(line, "\"median_ms\":");
+    //                 if (median_key != NULL) {
+    //                     char *end;
+    //                     double value = strtod(median_key + 12, &end);
+    //                     if (*end == ',' || *end == '}') {
+    //                         median = value;
+    //                     }
+    //                 }
+    //                 break;
+    //             }
+    //         } else if (memcmp(line, csv_prefix, csv_prefix_len) == 0) {
+    //             // CSV lines are `"name",iterations,min_ms,median_ms,...`, so the median is the fourth field
+    //             char *end;
+    //             strtoul(line + csv_prefix_len, &end, 10);
+    //             if (*end == ',') {
+    //                 strtod(end + 1, &end);
+    //                 if (*end == ',') {
+    //                     double value = strtod(end + 1, &end);
+    //                     if (*end == ',') {
+    //                         median = value;
+    //                     }
+    //                 }
+    //             }
+    //             break;
+    //         }
+    //     }
+    //     fclose(file);
+    //     return median;
+    // }
+    llvm::Type *const f64_type = builder->getDoubleTy();
+    llvm::Type *const i8_type = builder->getInt8Ty();
+    llvm::FunctionType *const baseline_type = llvm::FunctionType::get(f64_type, {PTR_TY}, false);
+    llvm::Function *const baseline_fn = llvm::Function::Create(                                 //
+        baseline_type, llvm::Function::ExternalLinkage, "test.perf_baseline_median", module //
+    );
+    llvm::Argument *const arg_name = baseline_fn->getArg(0);
+    arg_name->setName("name");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", baseline_fn);
+    llvm::BasicBlock *const open_block = llvm::BasicBlock::Create(context, "open", baseline_fn);
+    llvm::BasicBlock *const opened_block = llvm::BasicBlock::Create(context, "opened", baseline_fn);
+    llvm::BasicBlock *const read_line_block = llvm::BasicBlock::Create(context, "read_line", baseline_fn);
+    llvm::BasicBlock *const check_format_block = llvm::BasicBlock::Create(context, "check_format", baseline_fn);
+    llvm::BasicBlock *const compare_json_block = llvm::BasicBlock::Create(context, "compare_json", baseline_fn);
+    llvm::BasicBlock *const found_json_block = llvm::BasicBlock::Create(context, "found_json", baseline_fn);
+    llvm::BasicBlock *const json_median_block = llvm::BasicBlock::Create(context, "json_median", baseline_fn);
+    llvm::BasicBlock *const json_store_block = llvm::BasicBlock::Create(context, "json_store", baseline_fn);
+    llvm::BasicBlock *const compare_csv_block = llvm::BasicBlock::Create(context, "compare_csv", baseline_fn);
+    llvm::BasicBlock *const found_csv_block = llvm::BasicBlock::Create(context, "found_csv", baseline_fn);
+    llvm::BasicBlock *const csv_min_block = llvm::BasicBlock::Create(context, "csv_min", baseline_fn);
+    llvm::BasicBlock *const csv_median_block = llvm::BasicBlock::Create(context, "csv_median", baseline_fn);
+    llvm::BasicBlock *const csv_store_block = llvm::BasicBlock::Create(context, "csv_store", baseline_fn);
+    llvm::BasicBlock *const close_block = llvm::BasicBlock::Create(context, "close", baseline_fn);
+    llvm::BasicBlock *const no_baseline_block = llvm::BasicBlock::Create(context, "no_baseline", baseline_fn);
+
+    constexpr unsigned int line_size = 1024;
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const line = builder->CreateAlloca(llvm::ArrayType::get(i8_type, line_size), nullptr, "line");
+    llvm::AllocaInst *const end_alloca = builder->CreateAlloca(PTR_TY, nullptr, "end");
+    llvm::AllocaInst *const median_alloca = builder->CreateAlloca(f64_type, nullptr, "median");
+    IR::aligned_store(*builder, llvm::ConstantFP::get(f64_type, -1.0), median_alloca);
+    llvm::Value *const baseline = IR::aligned_load(*builder, PTR_TY, test_variables.at("perf_baseline"), "baseline");
+    builder->CreateCondBr(builder->CreateIsNull(baseline, "has_no_baseline"), no_baseline_block, open_block);
+
+    builder->SetInsertPoint(open_block);
+    llvm::Value *const read_mode = IR::generate_const_string(module, "r");
+    llvm::Value *const file = builder->CreateCall(c_functions.at(FOPEN), {baseline, read_mode}, "file");
+    builder->CreateCondBr(builder->CreateIsNull(file, "is_open_failed"), no_baseline_block, opened_block);
+
+    // The baseline can be in either format, independent from the format of this run, so the line prefix of both formats is built
+    builder->SetInsertPoint(opened_block);
+    llvm::Value *const name_len = builder->CreateCall(c_functions.at(STRLEN), {arg_name}, "name_len");
+    llvm::Value *const escaped_len = builder->CreateShl(name_len, builder->getInt64(1), "escaped_len");
+    llvm::Value *const escaped = builder->CreateAlloca(i8_type, builder->CreateAdd(escaped_len, builder->getInt64(1)), "escaped");
+    llvm::Value *const csv_prefix_size = builder->CreateAdd(escaped_len, builder->getInt64(4), "csv_prefix_size");
+    llvm::Value *const csv_prefix = builder->CreateAlloca(i8_type, csv_prefix_size, "csv_prefix");
+    llvm::Value *const json_prefix_size = builder->CreateAdd(escaped_len, builder->getInt64(12), "json_prefix_size");
+    llvm::Value *const json_prefix = builder->CreateAlloca(i8_type, json_prefix_size, "json_prefix");
+    builder->CreateCall(escape_name_fn, {escaped, arg_name, builder->getFalse()});
+    llvm::Value *const csv_prefix_len = builder->CreateSExt(                                                             //
+        builder->CreateCall(c_functions.at(SNPRINTF),                                                                    //
+            {csv_prefix, csv_prefix_size, IR::generate_const_string(module, "\"%s\","), escaped}, "csv_prefix_written"), //
+        builder->getInt64Ty(), "csv_prefix_len"                                                                          //
+    );
+    builder->CreateCall(escape_name_fn, {escaped, arg_name, builder->getTrue()});
+    llvm::Value *const json_prefix_len = builder->CreateSExt(                                                                         //
+        builder->CreateCall(c_functions.at(SNPRINTF),                                                                                 //
+            {json_prefix, json_prefix_size, IR::generate_const_string(module, "{\"name\":\"%s\","), escaped}, "json_prefix_written"), //
+        builder->getInt64Ty(), "json_prefix_len"                                                                                      //
+    );
+    llvm::Value *const name_fits = builder->CreateICmpULT(json_prefix_len, builder->getInt64(line_size), "name_fits");
+    builder->CreateCondBr(name_fits, read_line_block, close_block);
+
+    builder->SetInsertPoint(read_line_block);
+    llvm::Value *const read = builder->CreateCall(c_functions.at(FGETS), {line, builder->getInt32(line_size), file}, "read");
+    builder->CreateCondBr(builder->CreateIsNull(read, "is_eof"), close_block, check_format_block);
+
+    builder->SetInsertPoint(check_format_block);
+    llvm::Value *const first_char = IR::aligned_load(*builder, i8_type, line, "first_char");
+    builder->CreateCondBr(builder->CreateICmpEQ(first_char, builder->getInt8('{'), "is_json_line"), compare_json_block, compare_csv_block);
+
+    builder->SetInsertPoint(compare_json_block);
+    llvm::Value *const json_cmp = builder->CreateCall(c_functions.at(MEMCMP), {line, json_prefix, json_prefix_len}, "json_cmp");
+    builder->CreateCondBr(builder->CreateICmpEQ(json_cmp, builder->getInt32(0), "is_json_match"), found_json_block, read_line_block);
+
+    // JSON lines contain a `"median_ms":` key
+    builder->SetInsertPoint(found_json_block);
+    llvm::Value *const median_key = builder->CreateCall(                                                  //
+        c_functions.at(STRSTR), {line, IR::generate_const_string(module, "\"median_ms\":")}, "median_key" //
+    );
+    builder->CreateCondBr(builder->CreateIsNull(median_key, "has_no_median"), close_block, json_median_block);
+
+    // A field is only valid if the number is followed directly by the separator, otherwise the line is malformed and there is no baseline
+    const auto field_ends_with = [&](const char separator) {
+        llvm::Value *const field_end = IR::aligned_load(*builder, PTR_TY, end_alloca, "field_end");
+        llvm::Value *const end_char = IR::aligned_load(*builder, i8_type, field_end, "end_char");
+        return builder->CreateICmpEQ(end_char, builder->getInt8(separator), "is_field_end");
+    };
+
+    builder->SetInsertPoint(json_median_block);
+    llvm::Value *const median_field = builder->CreateGEP(i8_type, median_key, builder->getInt64(12), "median_field");
+    llvm::Value *const json_median = builder->CreateCall(c_functions.at(STRTOD), {median_field, end_alloca}, "json_median");
+    llvm::Value *const is_json_median_valid = builder->CreateOr(field_ends_with(','), field_ends_with('}'), "is_json_median_valid");
+    builder->CreateCondBr(is_json_median_valid, json_store_block, close_block);
+
+    builder->SetInsertPoint(json_store_block);
+    IR::aligned_store(*builder, json_median, median_alloca);
+    builder->CreateBr(close_block);
+
+    builder->SetInsertPoint(compare_csv_block);
+    llvm::Value *const csv_cmp = builder->CreateCall(c_functions.at(MEMCMP), {line, csv_prefix, csv_prefix_len}, "csv_cmp");
+    builder->CreateCondBr(builder->CreateICmpEQ(csv_cmp, builder->getInt32(0), "is_csv_match"), found_csv_block, read_line_block);
+
+    // CSV lines are `"name",iterations,min_ms,median_ms,...`, so the median is the fourth field
+    builder->SetInsertPoint(found_csv_block);
+    const auto next_field = [&]() {
+        llvm::Value *const field_end = IR::aligned_load(*builder, PTR_TY, end_alloca, "field_end");
+        return builder->CreateGEP(i8_type, field_end, builder->getInt64(1), "next_field");
+    };
+    llvm::Value *const iterations_field = builder->CreateGEP(i8_type, line, csv_prefix_len, "iterations_field");
+    builder->CreateCall(c_functions.at(STRTOUL), {iterations_field, end_alloca, builder->getInt32(10)});
+    builder->CreateCondBr(field_ends_with(','), csv_min_block, close_block);
+
+    builder->SetInsertPoint(csv_min_block);
+    builder->CreateCall(c_functions.at(STRTOD), {next_field(), end_alloca});
+    builder->CreateCondBr(field_ends_with(','), csv_median_block, close_block);
+
+    builder->SetInsertPoint(csv_median_block);
+    llvm::Value *const csv_median = builder->CreateCall(c_functions.at(STRTOD), {next_field(), end_alloca}, "csv_median");
+    builder->CreateCondBr(field_ends_with(','), csv_store_block, close_block);
+
+    builder->SetInsertPoint(csv_store_block);
+    IR::aligned_store(*builder, csv_median, median_alloca);
+    builder->CreateBr(close_block);
+
+    builder->SetInsertPoint(close_block);
+    builder->CreateCall(c_functions.at(FCLOSE), {file});
+    builder->CreateRet(IR::aligned_load(*builder, f64_type, median_alloca, "result"));
+
+    builder->SetInsertPoint(no_baseline_block);
+    builder->CreateRet(llvm::ConstantFP::get(f64_type, -1.0));
+
+    return baseline_fn;
+}
+
+llvm::Function *Generator::Builtin::generate_write_perf_result_function( //
+    llvm::IRBuilder<> *builder,                                          //
+    llvm::Module *module,                                                //
+    llvm::Function *escape_name_fn                                       //
+) {
+    // THE C IMPLEMENTATION:
+    // void write_perf_result(char *name, int count, double *stats) {
+    //     if (perf_output == NULL) {
+    //         return;
+    //     }
+    //     // The file is opened in append mode, since the result of every perf test is written right after it has been measured
+    //     FILE *file = fopen(perf_output, "a");
+    //     if (file == NULL) {
+    //         return;
+    //     }
+    //     char escaped[strlen(name) * 2 + 1];
+    //     escape_perf_name(escaped, name, perf_json);
+    //     fprintf(file, perf_json ? json_fmt : csv_fmt, escaped, count, stats[0], stats[1], stats[2], stats[3], stats[4]);
+    //     fclose(file);
+    // }
+    llvm::FunctionType *const write_type = llvm::FunctionType::get( //
+        builder->getVoidTy(),                                       //
+        {
+            PTR_TY,                // char* name
+            builder->getInt32Ty(), // i32 count
+            PTR_TY                 // f64* stats
+        },                         //
+        false                      //
+    );
+    llvm::Function *const write_fn = llvm::Function::Create(                             //
+        write_type, llvm::Function::ExternalLinkage, "test.write_perf_result", module //
+    );
+    llvm::Argument *const arg_name = write_fn->getArg(0);
+    arg_name->setName("name");
+    llvm::Argument *const arg_count = write_fn->getArg(1);
+    arg_count->setName("count");
+    llvm::Argument *const arg_stats = write_fn->getArg(2);
+    arg_stats->setName("stats");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", write_fn);
+    llvm::BasicBlock *const open_block = llvm::BasicBlock::Create(context, "open", write_fn);
+    llvm::BasicBlock *const write_block = llvm::BasicBlock::Create(context, "write", write_fn);
+    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", write_fn);
+
+    builder->SetInsertPoint(entry_block);
+    llvm::Value *const output = IR::aligned_load(*builder, PTR_TY, test_variables.at("perf_output"), "output");
+    builder->CreateCondBr(builder->CreateIsNull(output, "has_no_output"), return_block, open_block);
+
+    // The file is opened in append mode, since the result of every perf test is written right after it has been measured
+    builder->SetInsertPoint(open_block);
+    llvm::Value *const append_mode = IR::generate_const_string(module, "a");
+    llvm::Value *const file = builder->CreateCall(c_functions.at(FOPEN), {output, append_mode}, "file");
+    builder->CreateCondBr(builder->CreateIsNull(file, "is_open_failed"), return_block, write_block);
+
+    // Test names may contain quotes, commas and backslashes, so the name is escaped for the output format
+    builder->SetInsertPoint(write_block);
+    llvm::Value *const perf_json = IR::aligned_load(*builder, builder->getInt1Ty(), test_variables.at("perf_json"), "perf_json");
+    llvm::Value *const name_len = builder->CreateCall(c_functions.at(STRLEN), {arg_name}, "name_len");
+    llvm::Value *const escaped_size = builder->CreateAdd(                                        //
+        builder->CreateShl(name_len, builder->getInt64(1)), builder->getInt64(1), "escaped_size" //
+    );
+    llvm::Value *const escaped = builder->CreateAlloca(builder->getInt8Ty(), escaped_size, "escaped");
+    builder->CreateCall(escape_name_fn, {escaped, arg_name, perf_json});
+    llvm::Value *const csv_fmt = IR::generate_const_string(module, "\"%s\",%d,%.6f,%.6f,%.6f,%.6f,%.6f\n");
+    llvm::Value *const json_fmt = IR::generate_const_string(module,
+        "{\"name\":\"%s\",\"iterations\":%d,\"min_ms\":%.6f,\"median_ms\":%.6f,\"mean_ms\":%.6f,\"stddev_ms\":%.6f,"
+        "\"p99_ms\":%.6f}\n" //
+    );
+    std::vector<llvm::Value *> fprintf_args = {file, builder->CreateSelect(perf_json, json_fmt, csv_fmt, "fmt"), escaped, arg_count};
+    for (unsigned int i = 0; i < 5; i++) {
+        llvm::Value *const stat_ptr = builder->CreateGEP(builder->getDoubleTy(), arg_stats, builder->getInt32(i), "stat_ptr");
+        fprintf_args.emplace_back(IR::aligned_load(*builder, builder->getDoubleTy(), stat_ptr, "stat"));
+    }
+    builder->CreateCall(c_functions.at(FPRINTF), fprintf_args);
+    builder->CreateCall(c_functions.at(FCLOSE), {file});
+    builder->CreateBr(return_block);
+
+    builder->SetInsertPoint(return_block);
+    builder->CreateRetVoid();
+
+    return write_fn;
+}
+
 llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
     llvm::Function *visible_width_fn = generate_visible_width_function(builder, module);
+    llvm::Function *measure_perf_fn = generate_measure_perf_test_function(builder, module);
+    llvm::Function *perf_stats_fn = generate_perf_stats_function(builder, module);
+    llvm::Function *escape_perf_name_fn = generate_escape_perf_name_function(builder, module);
+    llvm::Function *perf_baseline_fn = generate_perf_baseline_function(builder, module, escape_perf_name_fn);
+    llvm::Function *write_perf_result_fn = generate_write_perf_result_function(builder, module, escape_perf_name_fn);
+    llvm::Type *i64_type = llvm::Type::getInt64Ty(context);
     llvm::Type *i32_type = llvm::Type::getInt32Ty(context);
     llvm::Type *i1_type = llvm::Type::getInt1Ty(context);
     llvm::FunctionType *exec_type = llvm::FunctionType::get( //
@@ -1237,10 +2081,11 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
         {
             PTR_TY,   // void* test_fn_ptr
             PTR_TY,   // void* stack
+            i64_type, // u64 frame_size
             PTR_TY,   // char* test_name_value
             PTR_TY,   // char* success_fmt
             PTR_TY,   // char* fail_fmt
-            PTR_TY,   // char* perf_fmt
+            PTR_TY,   // char* perf_prefix
             PTR_TY,   // char* output_begin
             PTR_TY,   // char* output_line
             PTR_TY,   // char *output_end
@@ -1260,14 +2105,16 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
     arg_test_fn_ptr->setName("test_fn_ptr");
     llvm::Argument *arg_stack = arg_it++;
     arg_stack->setName("stack");
+    llvm::Argument *arg_frame_size = arg_it++;
+    arg_frame_size->setName("frame_size");
     llvm::Argument *arg_test_name_value = arg_it++;
     arg_test_name_value->setName("test_name_value");
     llvm::Argument *arg_success_fmt = arg_it++;
     arg_success_fmt->setName("success_fmt");
     llvm::Argument *arg_fail_fmt = arg_it++;
     arg_fail_fmt->setName("fail_fmt");
-    llvm::Argument *arg_perf_fmt = arg_it++;
-    arg_perf_fmt->setName("perf_fmt");
+    llvm::Argument *arg_perf_prefix = arg_it++;
+    arg_perf_prefix->setName("perf_prefix");
     llvm::Argument *arg_output_begin_fmt = arg_it++;
     arg_output_begin_fmt->setName("output_begin_fmt");
     llvm::Argument *arg_output_line_fmt = arg_it++;
@@ -1291,6 +2138,10 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
     llvm::BasicBlock *const perf_test_start_merge_block = llvm::BasicBlock::Create(context, "perf_test_start_merge", exec_fn);
     llvm::BasicBlock *const perf_test_end_block = llvm::BasicBlock::Create(context, "perf_test_end", exec_fn);
     llvm::BasicBlock *const perf_test_end_merge_block = llvm::BasicBlock::Create(context, "perf_test_end_merge", exec_fn);
+    llvm::BasicBlock *const perf_measure_block = llvm::BasicBlock::Create(context, "perf_measure", exec_fn);
+    llvm::BasicBlock *const perf_repeat_block = llvm::BasicBlock::Create(context, "perf_repeat", exec_fn);
+    llvm::BasicBlock *const perf_measure_merge_block = llvm::BasicBlock::Create(context, "perf_measure_merge", exec_fn);
+    llvm::BasicBlock *const check_result_block = llvm::BasicBlock::Create(context, "check_result", exec_fn);
     llvm::BasicBlock *const succeed_block = llvm::BasicBlock::Create(context, "test_success", exec_fn);
     llvm::BasicBlock *const fail_block = llvm::BasicBlock::Create(context, "test_fail", exec_fn);
     llvm::BasicBlock *const print_output_block = llvm::BasicBlock::Create(context, "print_output", exec_fn);
@@ -1332,20 +2183,34 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
     );
     llvm::BasicBlock *const check_perf_print_block = llvm::BasicBlock::Create(context, "check_perf_print", exec_fn);
     llvm::BasicBlock *const perf_print_results_block = llvm::BasicBlock::Create(context, "perf_print_result", exec_fn);
+    llvm::BasicBlock *const perf_print_single_block = llvm::BasicBlock::Create(context, "perf_print_single", exec_fn);
+    llvm::BasicBlock *const perf_print_stats_block = llvm::BasicBlock::Create(context, "perf_print_stats", exec_fn);
+    llvm::BasicBlock *const perf_print_end_block = llvm::BasicBlock::Create(context, "perf_print_end", exec_fn);
     llvm::BasicBlock *const merge_block = llvm::BasicBlock::Create(context, "merge", exec_fn);
 
     llvm::Function *printf_fn = c_functions.at(PRINTF);
 
     builder->SetInsertPoint(entry_block);
     llvm::AllocaInst *perf_start_point = builder->CreateAlloca(PTR_TY, nullptr, "perf_start_TimePoint");
-    llvm::AllocaInst *perf_end_point = builder->CreateAlloca(PTR_TY, nullptr, "perf_end_TimePoint");
+    llvm::AllocaInst *perf_first_ms = builder->CreateAlloca(builder->getDoubleTy(), nullptr, "perf_first_ms");
+    llvm::AllocaInst *perf_snapshot = builder->CreateAlloca(PTR_TY, nullptr, "perf_snapshot");
+    llvm::AllocaInst *perf_samples = builder->CreateAlloca(PTR_TY, nullptr, "perf_samples");
+    llvm::AllocaInst *perf_count = builder->CreateAlloca(i32_type, nullptr, "perf_count");
+    llvm::AllocaInst *perf_stats = builder->CreateAlloca(llvm::ArrayType::get(builder->getDoubleTy(), 5), nullptr, "perf_stats");
+    llvm::AllocaInst *perf_baseline = builder->CreateAlloca(builder->getDoubleTy(), nullptr, "perf_baseline");
+    llvm::AllocaInst *perf_regressed = builder->CreateAlloca(i1_type, nullptr, "perf_regressed");
+    llvm::AllocaInst *test_passed = builder->CreateAlloca(i1_type, nullptr, "test_passed");
     // Start capturing the output
     llvm::Function *start_capture_fn = Module::System::system_functions.at("start_capture");
     builder->CreateCall(start_capture_fn, {});
     builder->CreateCondBr(arg_is_perf_test, perf_test_start_block, perf_test_start_merge_block);
 
-    // Store the current time in the test_start allocation
+    // Keep a copy of the initial frame of the test, every repetition of a perf test starts with the same frame as the first run
     builder->SetInsertPoint(perf_test_start_block);
+    llvm::Value *snapshot = builder->CreateCall(c_functions.at(MALLOC), {arg_frame_size}, "snapshot");
+    builder->CreateCall(c_functions.at(MEMCPY), {snapshot, arg_stack, arg_frame_size});
+    IR::aligned_store(*builder, snapshot, perf_snapshot);
+    // Store the current time in the test_start allocation
     llvm::Function *time_now_fn = Module::Time::time_functions.at("now");
     llvm::Value *now = builder->CreateCall(time_now_fn, {}, "start_val");
     IR::aligned_store(*builder, now, perf_start_point);
@@ -1366,9 +2231,10 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
     builder->CreateCondBr(arg_is_perf_test, perf_test_end_block, perf_test_end_merge_block);
 
     builder->SetInsertPoint(perf_test_end_block);
-    // Store the current time in the test_end allocation
+    // Store the duration of the first run, it is the first sample unless there are warmup runs
     now = builder->CreateCall(time_now_fn, {}, "end_val");
-    IR::aligned_store(*builder, now, perf_end_point);
+    llvm::Value *start_stamp = IR::aligned_load(*builder, PTR_TY, perf_start_point, "start_stamp");
+    IR::aligned_store(*builder, generate_elapsed_ms(builder, module, start_stamp, now), perf_first_ms);
     builder->CreateBr(perf_test_end_merge_block);
 
     builder->SetInsertPoint(perf_test_end_merge_block);
@@ -1380,7 +2246,51 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
     // If the test should fail then the condition is flipped
     llvm::Value *test_ok = builder->CreateNot(test_fail, "test_ok");
     llvm::Value *comparison_value = builder->CreateSelect(arg_should_fail, test_fail, test_ok, "test_succeed");
-    builder->CreateCondBr(comparison_value, succeed_block, fail_block);
+    IR::aligned_store(*builder, comparison_value, test_passed);
+    IR::aligned_store(*builder, builder->getInt32(1), perf_count);
+    IR::aligned_store(*builder, builder->getFalse(), perf_regressed);
+    IR::aligned_store(*builder, llvm::ConstantFP::get(builder->getDoubleTy(), -1.0), perf_baseline);
+    builder->CreateCondBr(arg_is_perf_test, perf_measure_block, check_result_block);
+
+    // Only passing perf tests are repeated, a failing test only reports the duration of its single run
+    builder->SetInsertPoint(perf_measure_block);
+    builder->CreateCondBr(comparison_value, perf_repeat_block, perf_measure_merge_block);
+
+    builder->SetInsertPoint(perf_repeat_block);
+    snapshot = IR::aligned_load(*builder, PTR_TY, perf_snapshot, "snapshot");
+    llvm::Value *first_ms = IR::aligned_load(*builder, builder->getDoubleTy(), perf_first_ms, "first_ms");
+    llvm::Value *sample_count = builder->CreateCall(measure_perf_fn,
+        {arg_test_fn_ptr, arg_stack, snapshot, arg_frame_size, first_ms, perf_samples}, "sample_count" //
+    );
+    IR::aligned_store(*builder, sample_count, perf_count);
+    llvm::Value *samples = IR::aligned_load(*builder, PTR_TY, perf_samples, "samples");
+    builder->CreateCall(perf_stats_fn, {samples, sample_count, perf_stats});
+    builder->CreateCall(c_functions.at(FREE), {samples});
+    builder->CreateCall(write_perf_result_fn, {arg_test_name_value, sample_count, perf_stats});
+    // A median which is slower than the median of the baseline by more than the threshold fails the test
+    llvm::Value *baseline = builder->CreateCall(perf_baseline_fn, {arg_test_name_value}, "baseline");
+    IR::aligned_store(*builder, baseline, perf_baseline);
+    llvm::Value *median_ptr = builder->CreateConstGEP2_32(perf_stats->getAllocatedType(), perf_stats, 0, 1, "median_ptr");
+    llvm::Value *median = IR::aligned_load(*builder, builder->getDoubleTy(), median_ptr, "median");
+    llvm::Value *threshold = IR::aligned_load(*builder, builder->getDoubleTy(), test_variables.at("perf_threshold"), "threshold");
+    llvm::Value *tolerance = builder->CreateFDiv(threshold, llvm::ConstantFP::get(builder->getDoubleTy(), 100.0), "tolerance");
+    tolerance = builder->CreateFAdd(tolerance, llvm::ConstantFP::get(builder->getDoubleTy(), 1.0), "tolerance");
+    llvm::Value *limit = builder->CreateFMul(baseline, tolerance, "limit");
+    llvm::Value *has_baseline = builder->CreateFCmpOGE(baseline, llvm::ConstantFP::get(builder->getDoubleTy(), 0.0), "has_baseline");
+    llvm::Value *is_slower = builder->CreateFCmpOGT(median, limit, "is_slower");
+    llvm::Value *regressed = builder->CreateAnd(has_baseline, is_slower, "regressed");
+    IR::aligned_store(*builder, regressed, perf_regressed);
+    IR::aligned_store(*builder, builder->CreateNot(regressed, "not_regressed"), test_passed);
+    builder->CreateBr(perf_measure_merge_block);
+
+    builder->SetInsertPoint(perf_measure_merge_block);
+    snapshot = IR::aligned_load(*builder, PTR_TY, perf_snapshot, "snapshot");
+    builder->CreateCall(c_functions.at(FREE), {snapshot});
+    builder->CreateBr(check_result_block);
+
+    builder->SetInsertPoint(check_result_block);
+    llvm::Value *passed = IR::aligned_load(*builder, i1_type, test_passed, "passed");
+    builder->CreateCondBr(passed, succeed_block, fail_block);
 
     builder->SetInsertPoint(succeed_block);
     builder->CreateCall(printf_fn, {arg_success_fmt, arg_longest_name, arg_test_name_value});
@@ -1504,36 +2414,807 @@ llvm::Function *Generator::Builtin::generate_execute_test_function(llvm::IRBuild
     builder->SetInsertPoint(check_perf_print_block);
     builder->CreateCondBr(arg_is_perf_test, perf_print_results_block, merge_block);
 
+    // Print the perf test result, a single run is printed as it is and multiple runs are printed with their statistics
     builder->SetInsertPoint(perf_print_results_block);
-    // Print the perf test result
-    llvm::Function *time_duration_fn = Module::Time::time_functions.at("duration");
-    llvm::Value *perf_test_start = IR::aligned_load(*builder, PTR_TY, perf_start_point, "start_point_value");
-    llvm::Value *perf_test_end = IR::aligned_load(*builder, PTR_TY, perf_end_point, "end_point_value");
-    llvm::Value *duration = builder->CreateCall(time_duration_fn, {perf_test_start, perf_test_end}, "perf_test_duration");
-
-    llvm::Function *time_as_unit_fn = Module::Time::time_functions.at("as_unit");
-    llvm::Value *as_unit = builder->CreateCall(time_as_unit_fn, {duration, builder->getInt32(2)}, "as_unit");
-    builder->CreateCall(printf_fn, {arg_perf_fmt, as_unit});
+    builder->CreateCall(printf_fn, {IR::generate_const_string(module, "%s"), arg_perf_prefix});
+    llvm::Value *count = IR::aligned_load(*builder, i32_type, perf_count, "count");
+    llvm::Value *is_single_run = builder->CreateICmpEQ(count, builder->getInt32(1), "is_single_run");
+    builder->CreateCondBr(is_single_run, perf_print_single_block, perf_print_stats_block);
+
+    builder->SetInsertPoint(perf_print_single_block);
+    first_ms = IR::aligned_load(*builder, builder->getDoubleTy(), perf_first_ms, "first_ms");
+    builder->CreateCall(printf_fn, {IR::generate_const_string(module, "Test took \033[34m%lf ms\033[0m"), first_ms});
+    builder->CreateBr(perf_print_end_block);
+
+    builder->SetInsertPoint(perf_print_stats_block);
+    llvm::Value *stats_fmt = IR::generate_const_string(module,
+        "%d runs: min %.3lf ms, median \033[34m%.3lf ms\033[0m, mean %.3lf ms, stddev %.3lf ms, p99 %.3lf ms" //
+    );
+    std::vector<llvm::Value *> stats_args = {stats_fmt, count};
+    for (unsigned int i = 0; i < 5; i++) {
+        llvm::Value *stat_ptr = builder->CreateConstGEP2_32(perf_stats->getAllocatedType(), perf_stats, 0, i, "stat_ptr");
+        stats_args.emplace_back(IR::aligned_load(*builder, builder->getDoubleTy(), stat_ptr, "stat"));
+    }
+    builder->CreateCall(printf_fn, stats_args);
+    builder->CreateBr(perf_print_end_block);
+
+    builder->SetInsertPoint(perf_print_end_block);
+    llvm::Value *is_regressed = IR::aligned_load(*builder, i1_type, perf_regressed, "is_regressed");
+    llvm::Value *regressed_fmt = IR::generate_const_string(module, " \033[31m(regressed, baseline median %.3lf ms)\033[0m\n");
+    llvm::Value *end_fmt = builder->CreateSelect(is_regressed, regressed_fmt, IR::generate_const_string(module, "\n"), "end_fmt");
+    baseline = IR::aligned_load(*builder, builder->getDoubleTy(), perf_baseline, "baseline");
+    builder->CreateCall(printf_fn, {end_fmt, baseline});
     builder->CreateBr(merge_block);
 
     builder->SetInsertPoint(merge_block);
     const auto array_type = Type::get_type_from_str("str[]").value();
-    llvm::Value *type_id = builder->getInt32(array_type->get_id());
-    builder->CreateCall(Memory::memory_functions.at("free"), {captured_output, type_id});
-    llvm::Value *was_failure = builder->CreateNot(comparison_value, "was_failure");
+    Memory::generate_free_call(builder, module, captured_output, array_type);
+    llvm::Value *was_failure = builder->CreateNot(passed, "was_failure");
     builder->CreateRet(was_failure);
 
     return exec_fn;
 }
 
+void Generator::Builtin::generate_test_runner_variables(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    llvm::Type *const i32_ty = builder->getInt32Ty();
+    const auto create_variable = [module](const std::string &name, llvm::Type *type, llvm::Constant *initializer) {
+        test_variables[name] = new llvm::GlobalVariable(                                          //
+            *module, type, false, llvm::GlobalValue::InternalLinkage, initializer, "test." + name //
+        );
+    };
+    create_variable("shard_index", i32_ty, builder->getInt32(0));
+    create_variable("shard_count", i32_ty, builder->getInt32(1));
+    create_variable("jobs", i32_ty, builder->getInt32(1));
+    create_variable("filter", PTR_TY, llvm::ConstantPointerNull::get(PTR_TY));
+    // The index of the file whose header has been printed last, -1 as long as no header has been printed
+    create_variable("last_file", i32_ty, builder->getInt32(-1));
+    // The options of the performance tests. The output and baseline are the paths to the files, null if not set
+    llvm::Type *const f64_ty = builder->getDoubleTy();
+    create_variable("perf_warmup", i32_ty, builder->getInt32(0));
+    create_variable("perf_iterations", i32_ty, builder->getInt32(1));
+    create_variable("perf_min_time", f64_ty, llvm::ConstantFP::get(f64_ty, 0.0));
+    create_variable("perf_output", PTR_TY, llvm::ConstantPointerNull::get(PTR_TY));
+    create_variable("perf_json", builder->getInt1Ty(), builder->getInt1(false));
+    create_variable("perf_baseline", PTR_TY, llvm::ConstantPointerNull::get(PTR_TY));
+    create_variable("perf_threshold", f64_ty, llvm::ConstantFP::get(f64_ty, 10.0));
+#ifndef __WIN32__
+    // The number of started workers. The n-th started worker always runs in the slot `n % jobs`, so the slot which is re-used next
+    // always belongs to the oldest running worker
+    create_variable("started", i32_ty, builder->getInt32(0));
+    llvm::ArrayType *const i32_arr_ty = llvm::ArrayType::get(i32_ty, MAX_TEST_JOBS);
+    llvm::ArrayType *const ptr_arr_ty = llvm::ArrayType::get(PTR_TY, MAX_TEST_JOBS);
+    create_variable("slot_pids", i32_arr_ty, llvm::ConstantAggregateZero::get(i32_arr_ty));
+    create_variable("slot_files", ptr_arr_ty, llvm::ConstantAggregateZero::get(ptr_arr_ty));
+    create_variable("slot_names", ptr_arr_ty, llvm::ConstantAggregateZero::get(ptr_arr_ty));
+    create_variable("slot_fail_fmts", ptr_arr_ty, llvm::ConstantAggregateZero::get(ptr_arr_ty));
+    create_variable("slot_longest_names", i32_arr_ty, llvm::ConstantAggregateZero::get(i32_arr_ty));
+#endif
+}
+
+llvm::Function *Generator::Builtin::generate_parse_test_args_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // void parse_args(int argc, char **argv) {
+    //     for (int i = 1; i < argc; i += 2) {
+    //         if (i + 1 >= argc) {
+    //             goto usage;
+    //         }
+    //         char *option = argv[i];
+    //         char *value = argv[i + 1];
+    //         char *end;
+    //         if (strcmp(option, "--shard") == 0) {
+    //             unsigned long index = strtoul(value, &end, 10);
+    //             if (*end != '/') {
+    //                 goto usage;
+    //             }
+    //             unsigned long count = strtoul(end + 1, &end, 10);
+    //             if (*end != '\0' || count == 0 || index >= count) {
+    //                 goto usage;
+    //             }
+    //             shard_index = index;
+    //             shard_count = count;
+    //         } else if (strcmp(option, "--filter") == 0) {
+    //             filter = value;
+    //         } else if (strcmp(option, "--jobs") == 0 || strcmp(option, "-j") == 0) {
+    //             unsigned long count = strtoul(value, &end, 10);
+    //             if (*end != '\0' || count == 0) {
+    //                 goto usage;
+    //             }
+    //             jobs = count > MAX_TEST_JOBS ? MAX_TEST_JOBS : count;
+    //         } else if (strcmp(option, "--perf-warmup") == 0) {
+    //             unsigned long count = strtoul(value, &end, 10);
+    //             if (*end != '\0' || count > INT_MAX) {
+    //                 goto usage;
+    //             }
+    //             perf_warmup = count;
+    //         } else if (strcmp(option, "--perf-iterations") == 0) {
+    //             unsigned long count = strtoul(value, &end, 10);
+    //             if (*end != '\0' || count == 0 || count > MAX_PERF_SAMPLES) {
+    //                 goto usage;
+    //             }
+    //             perf_iterations = count;
+    //         } else if (strcmp(option, "--perf-min-time") == 0) {
+    //             double ms = strtod(value, &end);
+    //             if (*end != '\0' || !(ms >= 0.0)) {
+    //                 goto usage;
+    //             }
+    //             perf_min_time = ms;
+    //         } else if (strcmp(option, "--perf-output") == 0) {
+    //             perf_output = value;
+    //         } else if (strcmp(option, "--perf-format") == 0) {
+    //             if (strcmp(value, "json") == 0) {
+    //                 perf_json = true;
+    //             } else if (strcmp(value, "csv") == 0) {
+    //                 perf_json = false;
+    //             } else {
+    //                 goto usage;
+    //             }
+    //         } else if (strcmp(option, "--perf-baseline") == 0) {
+    //             perf_baseline = value;
+    //         } else if (strcmp(option, "--perf-threshold") == 0) {
+    //             double percent = strtod(value, &end);
+    //             if (*end != '\0' || !(percent >= 0.0)) {
+    //                 goto usage;
+    //             }
+    //             perf_threshold = percent;
+    //         } else {
+    //             goto usage;
+    //         }
+    //     }
+    //     // The results of all perf tests are appended to the output file one by one, so it is truncated once here
+    //     if (perf_output != NULL) {
+    //         FILE *file = fopen(perf_output, "w");
+    //         if (file == NULL) {
+    //             printf("Could not open the performance output file '%s'\n", perf_output);
+    //             exit(2);
+    //         }
+    //         if (!perf_json) {
+    //             fprintf(file, "name,iterations,min_ms,median_ms,mean_ms,stddev_ms,p99_ms\n");
+    //         }
+    //         fclose(file);
+    //     }
+    //     return;
+    // usage:
+    //     printf("Usage: %s [--shard <index>/<count>] [--filter <name>] [--jobs <count>] ...\n", argv[0]);
+    //     exit(2);
+    // }
+    llvm::FunctionType *const parse_args_type = llvm::FunctionType::get( //
+        builder->getVoidTy(), {builder->getInt32Ty(), PTR_TY}, false     //
+    );
+    llvm::Function *const parse_args_fn = llvm::Function::Create(                    //
+        parse_args_type, llvm::Function::ExternalLinkage, "test.parse_args", module //
+    );
+    llvm::Argument *const arg_argc = parse_args_fn->getArg(0);
+    arg_argc->setName("argc");
+    llvm::Argument *const arg_argv = parse_args_fn->getArg(1);
+    arg_argv->setName("argv");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_args_fn);
+    llvm::BasicBlock *const loop_cond_block = llvm::BasicBlock::Create(context, "loop_cond", parse_args_fn);
+    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", parse_args_fn);
+    llvm::BasicBlock *const check_shard_block = llvm::BasicBlock::Create(context, "check_shard", parse_args_fn);
+    llvm::BasicBlock *const shard_block = llvm::BasicBlock::Create(context, "shard", parse_args_fn);
+    llvm::BasicBlock *const shard_count_block = llvm::BasicBlock::Create(context, "shard_count", parse_args_fn);
+    llvm::BasicBlock *const shard_store_block = llvm::BasicBlock::Create(context, "shard_store", parse_args_fn);
+    llvm::BasicBlock *const check_filter_block = llvm::BasicBlock::Create(context, "check_filter", parse_args_fn);
+    llvm::BasicBlock *const filter_block = llvm::BasicBlock::Create(context, "filter", parse_args_fn);
+    llvm::BasicBlock *const check_jobs_block = llvm::BasicBlock::Create(context, "check_jobs", parse_args_fn);
+    llvm::BasicBlock *const jobs_block = llvm::BasicBlock::Create(context, "jobs", parse_args_fn);
+    llvm::BasicBlock *const jobs_store_block = llvm::BasicBlock::Create(context, "jobs_store", parse_args_fn);
+    llvm::BasicBlock *const check_perf_block = llvm::BasicBlock::Create(context, "check_perf", parse_args_fn);
+    llvm::BasicBlock *const next_option_block = llvm::BasicBlock::Create(context, "next_option", parse_args_fn);
+    llvm::BasicBlock *const usage_block = llvm::BasicBlock::Create(context, "usage", parse_args_fn);
+    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", parse_args_fn);
+
+    llvm::Function *const strcmp_fn = c_functions.at(STRCMP);
+    llvm::Function *const strtoul_fn = c_functions.at(STRTOUL);
+
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const i_alloca = builder->CreateAlloca(builder->getInt32Ty(), nullptr, "i");
+    llvm::AllocaInst *const end_alloca = builder->CreateAlloca(PTR_TY, nullptr, "end");
+    IR::aligned_store(*builder, builder->getInt32(1), i_alloca);
+    builder->CreateBr(loop_cond_block);
+
+    builder->SetInsertPoint(loop_cond_block);
+    llvm::Value *const i_value = IR::aligned_load(*builder, builder->getInt32Ty(), i_alloca, "i_value");
+    llvm::Value *const i_lt_argc = builder->CreateICmpSLT(i_value, arg_argc, "i_lt_argc");
+    builder->CreateCondBr(i_lt_argc, loop_body_block, return_block);
+
+    // Every option takes exactly one value
+    builder->SetInsertPoint(loop_body_block);
+    llvm::Value *const value_index = builder->CreateAdd(i_value, builder->getInt32(1), "value_index");
+    llvm::Value *const has_value = builder->CreateICmpSLT(value_index, arg_argc, "has_value");
+    builder->CreateCondBr(has_value, check_shard_block, usage_block);
+
+    builder->SetInsertPoint(check_shard_block);
+    llvm::Value *const option_ptr = builder->CreateGEP(PTR_TY, arg_argv, i_value, "option_ptr");
+    llvm::Value *const option = IR::aligned_load(*builder, PTR_TY, option_ptr, "option");
+    llvm::Value *const value_ptr = builder->CreateGEP(PTR_TY, arg_argv, value_index, "value_ptr");
+    llvm::Value *const value = IR::aligned_load(*builder, PTR_TY, value_ptr, "value");
+    llvm::Value *const shard_cmp = builder->CreateCall(strcmp_fn, {option, IR::generate_const_string(module, "--shard")}, "shard_cmp");
+    llvm::Value *const is_shard = builder->CreateICmpEQ(shard_cmp, builder->getInt32(0), "is_shard");
+    builder->CreateCondBr(is_shard, shard_block, check_filter_block);
+
+    // The shard is given as `<index>/<count>`
+    builder->SetInsertPoint(shard_block);
+    llvm::Value *const shard_index = builder->CreateCall(strtoul_fn, {value, end_alloca, builder->getInt32(10)}, "shard_index");
+    llvm::Value *const index_end = IR::aligned_load(*builder, PTR_TY, end_alloca, "index_end");
+    llvm::Value *const index_end_char = IR::aligned_load(*builder, builder->getInt8Ty(), index_end, "index_end_char");
+    llvm::Value *const is_slash = builder->CreateICmpEQ(index_end_char, builder->getInt8('/'), "is_slash");
+    builder->CreateCondBr(is_slash, shard_count_block, usage_block);
+
+    builder->SetInsertPoint(shard_count_block);
+    llvm::Value *const count_start = builder->CreateGEP(builder->getInt8Ty(), index_end, builder->getInt64(1), "count_start");
+    llvm::Value *const shard_count = builder->CreateCall(strtoul_fn, {count_start, end_alloca, builder->getInt32(10)}, "shard_count");
+    llvm::Value *const count_end = IR::aligned_load(*builder, PTR_TY, end_alloca, "count_end");
+    llvm::Value *const count_end_char = IR::aligned_load(*builder, builder->getInt8Ty(), count_end, "count_end_char");
+    llvm::Value *const is_count_end = builder->CreateICmpEQ(count_end_char, builder->getInt8(0), "is_count_end");
+    llvm::Value *const is_count_nonzero = builder->CreateICmpNE(shard_count, builder->getInt64(0), "is_count_nonzero");
+    llvm::Value *const is_index_in_range = builder->CreateICmpULT(shard_index, shard_count, "is_index_in_range");
+    llvm::Value *is_shard_valid = builder->CreateAnd(is_count_end, is_count_nonzero, "is_shard_valid");
+    is_shard_valid = builder->CreateAnd(is_shard_valid, is_index_in_range, "is_shard_valid");
+    builder->CreateCondBr(is_shard_valid, shard_store_block, usage_block);
+
+    builder->SetInsertPoint(shard_store_block);
+    llvm::Value *const shard_index_i32 = builder->CreateTrunc(shard_index, builder->getInt32Ty(), "shard_index_i32");
+    llvm::Value *const shard_count_i32 = builder->CreateTrunc(shard_count, builder->getInt32Ty(), "shard_count_i32");
+    IR::aligned_store(*builder, shard_index_i32, test_variables.at("shard_index"));
+    IR::aligned_store(*builder, shard_count_i32, test_variables.at("shard_count"));
+    builder->CreateBr(next_option_block);
+
+    builder->SetInsertPoint(check_filter_block);
+    llvm::Value *const filter_cmp = builder->CreateCall(strcmp_fn, {option, IR::generate_const_string(module, "--filter")}, "filter_cmp");
+    llvm::Value *const is_filter = builder->CreateICmpEQ(filter_cmp, builder->getInt32(0), "is_filter");
+    builder->CreateCondBr(is_filter, filter_block, check_jobs_block);
+
+    builder->SetInsertPoint(filter_block);
+    IR::aligned_store(*builder, value, test_variables.at("filter"));
+    builder->CreateBr(next_option_block);
+
+    builder->SetInsertPoint(check_jobs_block);
+    llvm::Value *const jobs_cmp = builder->CreateCall(strcmp_fn, {option, IR::generate_const_string(module, "--jobs")}, "jobs_cmp");
+    llvm::Value *const j_cmp = builder->CreateCall(strcmp_fn, {option, IR::generate_const_string(module, "-j")}, "j_cmp");
+    llvm::Value *const is_jobs_long = builder->CreateICmpEQ(jobs_cmp, builder->getInt32(0), "is_jobs_long");
+    llvm::Value *const is_jobs_short = builder->CreateICmpEQ(j_cmp, builder->getInt32(0), "is_jobs_short");
+    llvm::Value *const is_jobs = builder->CreateOr(is_jobs_long, is_jobs_short, "is_jobs");
+    builder->CreateCondBr(is_jobs, jobs_block, check_perf_block);
+
+    builder->SetInsertPoint(jobs_block);
+    llvm::Value *const jobs = builder->CreateCall(strtoul_fn, {value, end_alloca, builder->getInt32(10)}, "jobs");
+    llvm::Value *const jobs_end = IR::aligned_load(*builder, PTR_TY, end_alloca, "jobs_end");
+    llvm::Value *const jobs_end_char = IR::aligned_load(*builder, builder->getInt8Ty(), jobs_end, "jobs_end_char");
+    llvm::Value *const is_jobs_end = builder->CreateICmpEQ(jobs_end_char, builder->getInt8(0), "is_jobs_end");
+    llvm::Value *const is_jobs_nonzero = builder->CreateICmpNE(jobs, builder->getInt64(0), "is_jobs_nonzero");
+    llvm::Value *const is_jobs_valid = builder->CreateAnd(is_jobs_end, is_jobs_nonzero, "is_jobs_valid");
+    builder->CreateCondBr(is_jobs_valid, jobs_store_block, usage_block);
+
+    builder->SetInsertPoint(jobs_store_block);
+    llvm::Value *const max_jobs = builder->getInt64(MAX_TEST_JOBS);
+    llvm::Value *const jobs_gt_max = builder->CreateICmpUGT(jobs, max_jobs, "jobs_gt_max");
+    llvm::Value *const clamped_jobs = builder->CreateSelect(jobs_gt_max, max_jobs, jobs, "clamped_jobs");
+    llvm::Value *const clamped_jobs_i32 = builder->CreateTrunc(clamped_jobs, builder->getInt32Ty(), "clamped_jobs_i32");
+    IR::aligned_store(*builder, clamped_jobs_i32, test_variables.at("jobs"));
+    builder->CreateBr(next_option_block);
+
+    // The options of the performance tests are checked one after another, the check after the last option falls through to the usage
+    llvm::BasicBlock *next_check_block = check_perf_block;
+    const auto begin_option = [&](const std::string &name) {
+        builder->SetInsertPoint(next_check_block);
+        llvm::Value *const option_cmp = builder->CreateCall(strcmp_fn, {option, IR::generate_const_string(module, name)}, "option_cmp");
+        llvm::Value *const is_option = builder->CreateICmpEQ(option_cmp, builder->getInt32(0), "is_option");
+        llvm::BasicBlock *const option_block = llvm::BasicBlock::Create(context, name.substr(2), parse_args_fn);
+        next_check_block = llvm::BasicBlock::Create(context, "check_option", parse_args_fn);
+        builder->CreateCondBr(is_option, option_block, next_check_block);
+        builder->SetInsertPoint(option_block);
+    };
+    // Stores the value of the option into the given variable if the value has been parsed completely and it is valid
+    const auto store_if_valid = [&](const std::string &variable, llvm::Value *parsed_value, llvm::Value *is_valid) {
+        llvm::Value *const parsed_end = IR::aligned_load(*builder, PTR_TY, end_alloca, "parsed_end");
+        llvm::Value *const parsed_end_char = IR::aligned_load(*builder, builder->getInt8Ty(), parsed_end, "parsed_end_char");
+        llvm::Value *const is_parsed = builder->CreateICmpEQ(parsed_end_char, builder->getInt8(0), "is_parsed");
+        llvm::BasicBlock *const store_block = llvm::BasicBlock::Create(context, "store_" + variable, parse_args_fn);
+        builder->CreateCondBr(builder->CreateAnd(is_parsed, is_valid, "is_valid"), store_block, usage_block);
+        builder->SetInsertPoint(store_block);
+        IR::aligned_store(*builder, parsed_value, test_variables.at(variable));
+        builder->CreateBr(next_option_block);
+    };
+    const auto parse_count = [&](const std::string &variable, const unsigned int min, const unsigned int max) {
+        llvm::Value *const count = builder->CreateCall(strtoul_fn, {value, end_alloca, builder->getInt32(10)}, "count");
+        llvm::Value *const is_count_ge_min = builder->CreateICmpUGE(count, builder->getInt64(min), "is_count_ge_min");
+        llvm::Value *const is_count_le_max = builder->CreateICmpULE(count, builder->getInt64(max), "is_count_le_max");
+        llvm::Value *const count_i32 = builder->CreateTrunc(count, builder->getInt32Ty(), "count_i32");
+        store_if_valid(variable, count_i32, builder->CreateAnd(is_count_ge_min, is_count_le_max, "is_count_in_range"));
+    };
+    const auto parse_non_negative = [&](const std::string &variable) {
+        llvm::Value *const number = builder->CreateCall(c_functions.at(STRTOD), {value, end_alloca}, "number");
+        // The ordered comparison also rejects NaN
+        llvm::Value *const is_non_negative = builder->CreateFCmpOGE(number, llvm::ConstantFP::get(builder->getDoubleTy(), 0.0));
+        store_if_valid(variable, number, is_non_negative);
+    };
+    begin_option("--perf-warmup");
+    parse_count("perf_warmup", 0, INT32_MAX);
+    begin_option("--perf-iterations");
+    parse_count("perf_iterations", 1, MAX_PERF_SAMPLES);
+    begin_option("--perf-min-time");
+    parse_non_negative("perf_min_time");
+    begin_option("--perf-output");
+    IR::aligned_store(*builder, value, test_variables.at("perf_output"));
+    builder->CreateBr(next_option_block);
+    begin_option("--perf-format");
+    llvm::Value *const json_cmp = builder->CreateCall(strcmp_fn, {value, IR::generate_const_string(module, "json")}, "json_cmp");
+    llvm::Value *const csv_cmp = builder->CreateCall(strcmp_fn, {value, IR::generate_const_string(module, "csv")}, "csv_cmp");
+    llvm::Value *const is_json = builder->CreateICmpEQ(json_cmp, builder->getInt32(0), "is_json");
+    llvm::Value *const is_csv = builder->CreateICmpEQ(csv_cmp, builder->getInt32(0), "is_csv");
+    llvm::BasicBlock *const format_store_block = llvm::BasicBlock::Create(context, "format_store", parse_args_fn);
+    builder->CreateCondBr(builder->CreateOr(is_json, is_csv, "is_format"), format_store_block, usage_block);
+    builder->SetInsertPoint(format_store_block);
+    IR::aligned_store(*builder, is_json, test_variables.at("perf_json"));
+    builder->CreateBr(next_option_block);
+    begin_option("--perf-baseline");
+    IR::aligned_store(*builder, value, test_variables.at("perf_baseline"));
+    builder->CreateBr(next_option_block);
+    begin_option("--perf-threshold");
+    parse_non_negative("perf_threshold");
+    builder->SetInsertPoint(next_check_block);
+    builder->CreateBr(usage_block);
+
+    builder->SetInsertPoint(next_option_block);
+    llvm::Value *const i_p2 = builder->CreateAdd(i_value, builder->getInt32(2), "i_p2");
+    IR::aligned_store(*builder, i_p2, i_alloca);
+    builder->CreateBr(loop_cond_block);
+
+    builder->SetInsertPoint(usage_block);
+    llvm::Value *const program_name = IR::aligned_load(*builder, PTR_TY, arg_argv, "program_name");
+    llvm::Value *const usage_fmt = IR::generate_const_string(module,
+        "Usage: %s [--shard <index>/<count>] [--filter <name>] [--jobs <count>]\n"
+        "          [--perf-warmup <count>] [--perf-iterations <count>] [--perf-min-time <ms>]\n"
+        "          [--perf-output <file>] [--perf-format csv|json] [--perf-baseline <file>] [--perf-threshold <percent>]\n" //
+    );
+    builder->CreateCall(c_functions.at(PRINTF), {usage_fmt, program_name});
+    builder->CreateCall(c_functions.at(EXIT), {builder->getInt32(2)});
+    builder->CreateUnreachable();
+
+    // The results of all perf tests are appended to the output file one by one, so it is truncated once here
+    builder->SetInsertPoint(return_block);
+    llvm::BasicBlock *const open_output_block = llvm::BasicBlock::Create(context, "open_output", parse_args_fn);
+    llvm::BasicBlock *const output_error_block = llvm::BasicBlock::Create(context, "output_error", parse_args_fn);
+    llvm::BasicBlock *const output_opened_block = llvm::BasicBlock::Create(context, "output_opened", parse_args_fn);
+    llvm::BasicBlock *const csv_header_block = llvm::BasicBlock::Create(context, "csv_header", parse_args_fn);
+    llvm::BasicBlock *const close_output_block = llvm::BasicBlock::Create(context, "close_output", parse_args_fn);
+    llvm::BasicBlock *const done_block = llvm::BasicBlock::Create(context, "done", parse_args_fn);
+    llvm::Value *const perf_output = IR::aligned_load(*builder, PTR_TY, test_variables.at("perf_output"), "perf_output");
+    llvm::Value *const has_output = builder->CreateIsNotNull(perf_output, "has_output");
+    builder->CreateCondBr(has_output, open_output_block, done_block);
+
+    builder->SetInsertPoint(open_output_block);
+    llvm::Value *const write_mode = IR::generate_const_string(module, "w");
+    llvm::Value *const output_file = builder->CreateCall(c_functions.at(FOPEN), {perf_output, write_mode}, "output_file");
+    builder->CreateCondBr(builder->CreateIsNull(output_file, "is_open_failed"), output_error_block, output_opened_block);
+
+    builder->SetInsertPoint(output_error_block);
+    llvm::Value *const output_error_fmt = IR::generate_const_string(module, "Could not open the performance output file '%s'\n");
+    builder->CreateCall(c_functions.at(PRINTF), {output_error_fmt, perf_output});
+    builder->CreateCall(c_functions.at(EXIT), {builder->getInt32(2)});
+    builder->CreateUnreachable();
+
+    builder->SetInsertPoint(output_opened_block);
+    llvm::Value *const perf_json = IR::aligned_load(*builder, builder->getInt1Ty(), test_variables.at("perf_json"), "perf_json");
+    builder->CreateCondBr(perf_json, close_output_block, csv_header_block);
+
+    builder->SetInsertPoint(csv_header_block);
+    llvm::Value *const csv_header = IR::generate_const_string(module, "name,iterations,min_ms,median_ms,mean_ms,stddev_ms,p99_ms\n");
+    builder->CreateCall(c_functions.at(FPRINTF), {output_file, csv_header});
+    builder->CreateBr(close_output_block);
+
+    builder->SetInsertPoint(close_output_block);
+    builder->CreateCall(c_functions.at(FCLOSE), {output_file});
+    builder->CreateBr(done_block);
+
+    builder->SetInsertPoint(done_block);
+    builder->CreateRetVoid();
+
+    return parse_args_fn;
+}
+
+#ifndef __WIN32__
+llvm::Function *Generator::Builtin::generate_drain_test_slot_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // int drain_slot(int slot) {
+    //     if (slot_pids[slot] == 0) {
+    //         return 0;
+    //     }
+    //     int status;
+    //     waitpid(slot_pids[slot], &status, 0);
+    //     slot_pids[slot] = 0;
+    //     FILE *file = slot_files[slot];
+    //     rewind(file);
+    //     char buffer[4096];
+    //     size_t n;
+    //     while ((n = fread(buffer, 1, 4096, file)) > 0) {
+    //         fwrite(buffer, 1, n, stdout);
+    //     }
+    //     fclose(file);
+    //     if ((status & 0x7f) != 0) {
+    //         // The worker has been killed by a signal before it could print the result of its test
+    //         printf(slot_fail_fmts[slot], slot_longest_names[slot], slot_names[slot]);
+    //     }
+    //     return status != 0;
+    // }
+    llvm::FunctionType *const drain_slot_type = llvm::FunctionType::get(builder->getInt32Ty(), {builder->getInt32Ty()}, false);
+    llvm::Function *const drain_slot_fn = llvm::Function::Create(                    //
+        drain_slot_type, llvm::Function::ExternalLinkage, "test.drain_slot", module //
+    );
+    llvm::Argument *const arg_slot = drain_slot_fn->getArg(0);
+    arg_slot->setName("slot");
+    llvm::GlobalVariable *stdout_gv = module->getGlobalVariable("stdout");
+    if (stdout_gv == nullptr) {
+        stdout_gv = new llvm::GlobalVariable(*module, PTR_TY, false, llvm::GlobalValue::ExternalLinkage, nullptr, "stdout");
+    }
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", drain_slot_fn);
+    llvm::BasicBlock *const empty_block = llvm::BasicBlock::Create(context, "empty", drain_slot_fn);
+    llvm::BasicBlock *const wait_block = llvm::BasicBlock::Create(context, "wait", drain_slot_fn);
+    llvm::BasicBlock *const copy_cond_block = llvm::BasicBlock::Create(context, "copy_cond", drain_slot_fn);
+    llvm::BasicBlock *const copy_body_block = llvm::BasicBlock::Create(context, "copy_body", drain_slot_fn);
+    llvm::BasicBlock *const copy_merge_block = llvm::BasicBlock::Create(context, "copy_merge", drain_slot_fn);
+    llvm::BasicBlock *const crashed_block = llvm::BasicBlock::Create(context, "crashed", drain_slot_fn);
+    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", drain_slot_fn);
+
+    const auto get_slot_ptr = [&](const std::string &name) -> llvm::Value * {
+        llvm::GlobalVariable *const slots = test_variables.at(name);
+        return builder->CreateInBoundsGEP(slots->getValueType(), slots, {builder->getInt32(0), arg_slot}, name + "_ptr");
+    };
+
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const status_alloca = builder->CreateAlloca(builder->getInt32Ty(), nullptr, "status");
+    llvm::AllocaInst *const buffer = builder->CreateAlloca(llvm::ArrayType::get(builder->getInt8Ty(), 4096), nullptr, "buffer");
+    llvm::Value *const pid_ptr = get_slot_ptr("slot_pids");
+    llvm::Value *const pid = IR::aligned_load(*builder, builder->getInt32Ty(), pid_ptr, "pid");
+    llvm::Value *const is_empty = builder->CreateICmpEQ(pid, builder->getInt32(0), "is_empty");
+    builder->CreateCondBr(is_empty, empty_block, wait_block);
+
+    builder->SetInsertPoint(empty_block);
+    builder->CreateRet(builder->getInt32(0));
+
+    builder->SetInsertPoint(wait_block);
+    IR::aligned_store(*builder, builder->getInt32(0), status_alloca);
+    builder->CreateCall(c_functions.at(WAITPID), {pid, status_alloca, builder->getInt32(0)});
+    IR::aligned_store(*builder, builder->getInt32(0), pid_ptr);
+    llvm::Value *const file = IR::aligned_load(*builder, PTR_TY, get_slot_ptr("slot_files"), "file");
+    builder->CreateCall(c_functions.at(REWIND), {file});
+    builder->CreateBr(copy_cond_block);
+
+    builder->SetInsertPoint(copy_cond_block);
+    llvm::Value *const read_count = builder->CreateCall(                                                 //
+        c_functions.at(FREAD), {buffer, builder->getInt64(1), builder->getInt64(4096), file}, "read_count" //
+    );
+    llvm::Value *const has_read = builder->CreateICmpNE(read_count, builder->getInt64(0), "has_read");
+    builder->CreateCondBr(has_read, copy_body_block, copy_merge_block);
+
+    builder->SetInsertPoint(copy_body_block);
+    // The output is written as raw bytes, so output containing NUL bytes is passed through completely
+    llvm::Value *const stdout_file = IR::aligned_load(*builder, PTR_TY, stdout_gv, "stdout_file");
+    builder->CreateCall(c_functions.at(FWRITE), {buffer, builder->getInt64(1), read_count, stdout_file});
+    builder->CreateBr(copy_cond_block);
+
+    builder->SetInsertPoint(copy_merge_block);
+    builder->CreateCall(c_functions.at(FCLOSE), {file});
+    llvm::Value *const status = IR::aligned_load(*builder, builder->getInt32Ty(), status_alloca, "status_value");
+    llvm::Value *const term_signal = builder->CreateAnd(status, builder->getInt32(0x7f), "term_signal");
+    llvm::Value *const is_crashed = builder->CreateICmpNE(term_signal, builder->getInt32(0), "is_crashed");
+    builder->CreateCondBr(is_crashed, crashed_block, return_block);
+
+    builder->SetInsertPoint(crashed_block);
+    llvm::Value *const fail_fmt = IR::aligned_load(*builder, PTR_TY, get_slot_ptr("slot_fail_fmts"), "fail_fmt");
+    llvm::Value *const longest_name = IR::aligned_load(*builder, builder->getInt32Ty(), get_slot_ptr("slot_longest_names"), "longest_name");
+    llvm::Value *const test_name = IR::aligned_load(*builder, PTR_TY, get_slot_ptr("slot_names"), "test_name");
+    builder->CreateCall(c_functions.at(PRINTF), {fail_fmt, longest_name, test_name});
+    builder->CreateBr(return_block);
+
+    builder->SetInsertPoint(return_block);
+    llvm::Value *const has_failed = builder->CreateICmpNE(status, builder->getInt32(0), "has_failed");
+    builder->CreateRet(builder->CreateZExt(has_failed, builder->getInt32Ty(), "failed"));
+
+    return drain_slot_fn;
+}
+
+llvm::Function *Generator::Builtin::generate_drain_all_test_slots_function( //
+    llvm::IRBuilder<> *builder,                                             //
+    llvm::Module *module,                                                   //
+    llvm::Function *drain_slot_fn                                           //
+) {
+    // THE C IMPLEMENTATION:
+    // int drain_all(void) {
+    //     int failed = 0;
+    //     for (int i = 0; i < jobs; i++) {
+    //         failed += drain_slot((started + i) % jobs);
+    //     }
+    //     return failed;
+    // }
+    llvm::FunctionType *const drain_all_type = llvm::FunctionType::get(builder->getInt32Ty(), {}, false);
+    llvm::Function *const drain_all_fn = llvm::Function::Create(                   //
+        drain_all_type, llvm::Function::ExternalLinkage, "test.drain_all", module //
+    );
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", drain_all_fn);
+    llvm::BasicBlock *const loop_cond_block = llvm::BasicBlock::Create(context, "loop_cond", drain_all_fn);
+    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", drain_all_fn);
+    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", drain_all_fn);
+
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const i_alloca = builder->CreateAlloca(builder->getInt32Ty(), nullptr, "i");
+    llvm::AllocaInst *const failed_alloca = builder->CreateAlloca(builder->getInt32Ty(), nullptr, "failed");
+    IR::aligned_store(*builder, builder->getInt32(0), i_alloca);
+    IR::aligned_store(*builder, builder->getInt32(0), failed_alloca);
+    llvm::Value *const jobs = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("jobs"), "jobs");
+    llvm::Value *const started = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("started"), "started");
+    builder->CreateBr(loop_cond_block);
+
+    builder->SetInsertPoint(loop_cond_block);
+    llvm::Value *const i_value = IR::aligned_load(*builder, builder->getInt32Ty(), i_alloca, "i_value");
+    llvm::Value *const i_lt_jobs = builder->CreateICmpSLT(i_value, jobs, "i_lt_jobs");
+    builder->CreateCondBr(i_lt_jobs, loop_body_block, return_block);
+
+    builder->SetInsertPoint(loop_body_block);
+    llvm::Value *const slot_sum = builder->CreateAdd(started, i_value, "slot_sum");
+    llvm::Value *const slot = builder->CreateURem(slot_sum, jobs, "slot");
+    llvm::Value *const slot_failed = builder->CreateCall(drain_slot_fn, {slot}, "slot_failed");
+    llvm::Value *const failed_value = IR::aligned_load(*builder, builder->getInt32Ty(), failed_alloca, "failed_value");
+    llvm::Value *const new_failed = builder->CreateAdd(failed_value, slot_failed, "new_failed");
+    IR::aligned_store(*builder, new_failed, failed_alloca);
+    llvm::Value *const i_p1 = builder->CreateAdd(i_value, builder->getInt32(1), "i_p1");
+    IR::aligned_store(*builder, i_p1, i_alloca);
+    builder->CreateBr(loop_cond_block);
+
+    builder->SetInsertPoint(return_block);
+    llvm::Value *const failed = IR::aligned_load(*builder, builder->getInt32Ty(), failed_alloca, "failed_result");
+    builder->CreateRet(failed);
+
+    return drain_all_fn;
+}
+#endif
+
+llvm::Function *Generator::Builtin::generate_dispatch_test_function( //
+    llvm::IRBuilder<> *builder,                                      //
+    llvm::Module *module,                                            //
+    llvm::Function *execute_test_fn                                  //
+) {
+    // THE C IMPLEMENTATION:
+    // int dispatch_test(<all arguments of execute_test>, char *file_header, int file_index, int test_index) {
+    //     if (test_index % shard_count != shard_index || (filter != NULL && strstr(test_name, filter) == NULL)) {
+    //         return 0;
+    //     }
+    //     // The header of a file is printed right before its first selected test, the very first header has no leading newline
+    //     char *header = "";
+    //     if (file_index != last_file) {
+    //         header = last_file == -1 ? file_header + 1 : file_header;
+    //         last_file = file_index;
+    //     }
+    //     int failed = 0;
+    //     if (jobs > 1 && is_perf_test) {
+    //         // Perf tests are measured in this process once no worker is running anymore, so no other test skews their timings
+    //         failed = drain_all();
+    //     } else if (jobs > 1) {
+    //         int slot = started % jobs;
+    //         started++;
+    //         failed = drain_slot(slot);
+    //         FILE *file = tmpfile();
+    //         fflush(NULL);
+    //         pid_t pid = file == NULL ? -1 : fork();
+    //         if (pid == 0) {
+    //             dup2(fileno(file), 1);
+    //             printf("%s", header);
+    //             exit(execute_test(...));
+    //         }
+    //         if (pid > 0) {
+    //             slot_pids[slot] = pid;
+    //             slot_files[slot] = file;
+    //             slot_names[slot] = test_name;
+    //             slot_fail_fmts[slot] = fail_fmt;
+    //             slot_longest_names[slot] = longest_name;
+    //             return failed;
+    //         }
+    //         // The worker could not be started, so the test runs in this process once all earlier tests are printed
+    //         if (file != NULL) {
+    //             fclose(file);
+    //         }
+    //         failed += drain_all();
+    //     }
+    //     printf("%s", header);
+    //     return failed + execute_test(...);
+    // }
+#ifndef __WIN32__
+    llvm::Function *const drain_slot_fn = generate_drain_test_slot_function(builder, module);
+    llvm::Function *const drain_all_fn = generate_drain_all_test_slots_function(builder, module, drain_slot_fn);
+#endif
+
+    llvm::FunctionType *const execute_test_type = execute_test_fn->getFunctionType();
+    std::vector<llvm::Type *> dispatch_param_types(execute_test_type->param_begin(), execute_test_type->param_end());
+    dispatch_param_types.emplace_back(PTR_TY);                // char* file_header
+    dispatch_param_types.emplace_back(builder->getInt32Ty()); // i32 file_index
+    dispatch_param_types.emplace_back(builder->getInt32Ty()); // i32 test_index
+    llvm::FunctionType *const dispatch_type = llvm::FunctionType::get(builder->getInt32Ty(), dispatch_param_types, false);
+    llvm::Function *const dispatch_fn = llvm::Function::Create(                      //
+        dispatch_type, llvm::Function::ExternalLinkage, "test.dispatch_test", module //
+    );
+
+    // The first arguments are forwarded to the `execute_test` function as they are
+    std::vector<llvm::Value *> execute_args;
+    for (unsigned int i = 0; i < execute_test_fn->arg_size(); i++) {
+        llvm::Argument *const arg = dispatch_fn->getArg(i);
+        arg->setName(execute_test_fn->getArg(i)->getName());
+        execute_args.emplace_back(arg);
+    }
+    llvm::Argument *const arg_test_name = dispatch_fn->getArg(3);
+    llvm::Argument *const arg_fail_fmt = dispatch_fn->getArg(5);
+    llvm::Argument *const arg_longest_name = dispatch_fn->getArg(10);
+    llvm::Argument *const arg_is_perf_test = dispatch_fn->getArg(11);
+    llvm::Argument *const arg_file_header = dispatch_fn->getArg(execute_test_fn->arg_size());
+    arg_file_header->setName("file_header");
+    llvm::Argument *const arg_file_index = dispatch_fn->getArg(execute_test_fn->arg_size() + 1);
+    arg_file_index->setName("file_index");
+    llvm::Argument *const arg_test_index = dispatch_fn->getArg(execute_test_fn->arg_size() + 2);
+    arg_test_index->setName("test_index");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", dispatch_fn);
+    llvm::BasicBlock *const check_filter_block = llvm::BasicBlock::Create(context, "check_filter", dispatch_fn);
+    llvm::BasicBlock *const apply_filter_block = llvm::BasicBlock::Create(context, "apply_filter", dispatch_fn);
+    llvm::BasicBlock *const skip_block = llvm::BasicBlock::Create(context, "skip", dispatch_fn);
+    llvm::BasicBlock *const selected_block = llvm::BasicBlock::Create(context, "selected", dispatch_fn);
+    llvm::BasicBlock *const new_file_block = llvm::BasicBlock::Create(context, "new_file", dispatch_fn);
+    llvm::BasicBlock *const header_merge_block = llvm::BasicBlock::Create(context, "header_merge", dispatch_fn);
+    llvm::BasicBlock *const run_block = llvm::BasicBlock::Create(context, "run", dispatch_fn);
+
+    llvm::Function *const printf_fn = c_functions.at(PRINTF);
+    llvm::Value *const header_fmt = IR::generate_const_string(module, "%s");
+
+    // Tests are assigned to the shards round-robin, which balances the shards even if the tests of a single file are slow
+    builder->SetInsertPoint(entry_block);
+    llvm::AllocaInst *const header_alloca = builder->CreateAlloca(PTR_TY, nullptr, "header");
+    llvm::AllocaInst *const failed_alloca = builder->CreateAlloca(builder->getInt32Ty(), nullptr, "failed");
+    IR::aligned_store(*builder, IR::generate_const_string(module, ""), header_alloca);
+    IR::aligned_store(*builder, builder->getInt32(0), failed_alloca);
+    llvm::Value *const shard_count = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("shard_count"), "shard_count");
+    llvm::Value *const shard_index = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("shard_index"), "shard_index");
+    llvm::Value *const test_shard = builder->CreateURem(arg_test_index, shard_count, "test_shard");
+    llvm::Value *const is_in_shard = builder->CreateICmpEQ(test_shard, shard_index, "is_in_shard");
+    builder->CreateCondBr(is_in_shard, check_filter_block, skip_block);
+
+    builder->SetInsertPoint(check_filter_block);
+    llvm::Value *const filter = IR::aligned_load(*builder, PTR_TY, test_variables.at("filter"), "filter");
+    llvm::Value *const has_filter = builder->CreateICmpNE(filter, llvm::ConstantPointerNull::get(PTR_TY), "has_filter");
+    builder->CreateCondBr(has_filter, apply_filter_block, selected_block);
+
+    builder->SetInsertPoint(apply_filter_block);
+    llvm::Value *const match = builder->CreateCall(c_functions.at(STRSTR), {arg_test_name, filter}, "match");
+    llvm::Value *const is_match = builder->CreateICmpNE(match, llvm::ConstantPointerNull::get(PTR_TY), "is_match");
+    builder->CreateCondBr(is_match, selected_block, skip_block);
+
+    builder->SetInsertPoint(skip_block);
+    builder->CreateRet(builder->getInt32(0));
+
+    builder->SetInsertPoint(selected_block);
+    llvm::Value *const last_file = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("last_file"), "last_file");
+    llvm::Value *const is_new_file = builder->CreateICmpNE(arg_file_index, last_file, "is_new_file");
+    builder->CreateCondBr(is_new_file, new_file_block, header_merge_block);
+
+    builder->SetInsertPoint(new_file_block);
+    llvm::Value *const is_first_file = builder->CreateICmpEQ(last_file, builder->getInt32(-1), "is_first_file");
+    llvm::Value *const header_without_newline = builder->CreateGEP(                           //
+        builder->getInt8Ty(), arg_file_header, builder->getInt64(1), "header_without_newline" //
+    );
+    llvm::Value *const header = builder->CreateSelect(is_first_file, header_without_newline, arg_file_header, "header_value");
+    IR::aligned_store(*builder, header, header_alloca);
+    IR::aligned_store(*builder, arg_file_index, test_variables.at("last_file"));
+    builder->CreateBr(header_merge_block);
+
+    builder->SetInsertPoint(header_merge_block);
+#ifndef __WIN32__
+    llvm::BasicBlock *const check_perf_block = llvm::BasicBlock::Create(context, "check_perf", dispatch_fn, run_block);
+    llvm::BasicBlock *const perf_serial_block = llvm::BasicBlock::Create(context, "perf_serial", dispatch_fn, run_block);
+    llvm::BasicBlock *const start_worker_block = llvm::BasicBlock::Create(context, "start_worker", dispatch_fn, run_block);
+    llvm::BasicBlock *const worker_block = llvm::BasicBlock::Create(context, "worker", dispatch_fn, run_block);
+    llvm::BasicBlock *const check_started_block = llvm::BasicBlock::Create(context, "check_started", dispatch_fn, run_block);
+    llvm::BasicBlock *const check_parent_block = llvm::BasicBlock::Create(context, "check_parent", dispatch_fn, run_block);
+    llvm::BasicBlock *const started_block = llvm::BasicBlock::Create(context, "started", dispatch_fn, run_block);
+    llvm::BasicBlock *const close_file_block = llvm::BasicBlock::Create(context, "close_file", dispatch_fn, run_block);
+    llvm::BasicBlock *const fallback_block = llvm::BasicBlock::Create(context, "fallback", dispatch_fn, run_block);
+    llvm::Value *const jobs = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("jobs"), "jobs");
+    llvm::Value *const is_parallel = builder->CreateICmpUGT(jobs, builder->getInt32(1), "is_parallel");
+    builder->CreateCondBr(is_parallel, check_perf_block, run_block);
+
+    builder->SetInsertPoint(check_perf_block);
+    builder->CreateCondBr(arg_is_perf_test, perf_serial_block, start_worker_block);
+
+    // Perf tests are measured in this process once all running workers are finished, so no other test skews their timings
+    builder->SetInsertPoint(perf_serial_block);
+    llvm::Value *const perf_drained_failed = builder->CreateCall(drain_all_fn, {}, "perf_drained_failed");
+    IR::aligned_store(*builder, perf_drained_failed, failed_alloca);
+    builder->CreateBr(run_block);
+
+    // Wait for the oldest worker if all slots are taken, then fork the worker of this test. Its output is written to a temporary file
+    // which is printed once all earlier tests have been printed
+    builder->SetInsertPoint(start_worker_block);
+    llvm::Value *const started = IR::aligned_load(*builder, builder->getInt32Ty(), test_variables.at("started"), "started");
+    llvm::Value *const slot = builder->CreateURem(started, jobs, "slot");
+    llvm::Value *const started_p1 = builder->CreateAdd(started, builder->getInt32(1), "started_p1");
+    IR::aligned_store(*builder, started_p1, test_variables.at("started"));
+    llvm::Value *const drained_failed = builder->CreateCall(drain_slot_fn, {slot}, "drained_failed");
+    IR::aligned_store(*builder, drained_failed, failed_alloca);
+    llvm::Value *const file = builder->CreateCall(c_functions.at(TMPFILE), {}, "file");
+    // Flush all streams before forking, otherwise buffered output would be printed by both processes
+    builder->CreateCall(c_functions.at(FFLUSH), {llvm::ConstantPointerNull::get(PTR_TY)});
+    llvm::Value *const has_file = builder->CreateICmpNE(file, llvm::ConstantPointerNull::get(PTR_TY), "has_file");
+    builder->CreateCondBr(has_file, check_started_block, fallback_block);
+
+    builder->SetInsertPoint(check_started_block);
+    llvm::Value *const pid = builder->CreateCall(c_functions.at(FORK), {}, "pid");
+    llvm::Value *const is_worker = builder->CreateICmpEQ(pid, builder->getInt32(0), "is_worker");
+    llvm::Value *const is_started = builder->CreateICmpSGT(pid, builder->getInt32(0), "is_started");
+    builder->CreateCondBr(is_worker, worker_block, check_parent_block);
+
+    builder->SetInsertPoint(check_parent_block);
+    builder->CreateCondBr(is_started, started_block, close_file_block);
+
+    builder->SetInsertPoint(worker_block);
+    llvm::Value *const file_fileno = builder->CreateCall(c_functions.at(FILENO), {file}, "file_fileno");
+    builder->CreateCall(c_functions.at(DUP2), {file_fileno, builder->getInt32(1)});
+    llvm::Value *const worker_header = IR::aligned_load(*builder, PTR_TY, header_alloca, "worker_header");
+    builder->CreateCall(printf_fn, {header_fmt, worker_header});
+    llvm::Value *const worker_failed = builder->CreateCall(execute_test_fn, execute_args, "worker_failed");
+    llvm::Value *const worker_exit_code = builder->CreateZExt(worker_failed, builder->getInt32Ty(), "worker_exit_code");
+    builder->CreateCall(c_functions.at(EXIT), {worker_exit_code});
+    builder->CreateUnreachable();
+
+    builder->SetInsertPoint(started_block);
+    const auto store_slot = [&](const std::string &name, llvm::Value *value) {
+        llvm::GlobalVariable *const slots = test_variables.at(name);
+        llvm::Value *const slot_ptr = builder->CreateInBoundsGEP(slots->getValueType(), slots, {builder->getInt32(0), slot}, name + "_ptr");
+        IR::aligned_store(*builder, value, slot_ptr);
+    };
+    store_slot("slot_pids", pid);
+    store_slot("slot_files", file);
+    store_slot("slot_names", arg_test_name);
+    store_slot("slot_fail_fmts", arg_fail_fmt);
+    store_slot("slot_longest_names", arg_longest_name);
+    builder->CreateRet(drained_failed);
+
+    builder->SetInsertPoint(close_file_block);
+    builder->CreateCall(c_functions.at(FCLOSE), {file});
+    builder->CreateBr(fallback_block);
+
+    // The worker could not be started, so the test runs in this process once all earlier tests have been printed
+    builder->SetInsertPoint(fallback_block);
+    llvm::Value *const all_drained_failed = builder->CreateCall(drain_all_fn, {}, "all_drained_failed");
+    llvm::Value *const fallback_failed = builder->CreateAdd(drained_failed, all_drained_failed, "fallback_failed");
+    IR::aligned_store(*builder, fallback_failed, failed_alloca);
+    builder->CreateBr(run_block);
+#else
+    // There is no `fork` on Windows, so the tests always run in this process there
+    builder->CreateBr(run_block);
+#endif
+
+    builder->SetInsertPoint(run_block);
+    llvm::Value *const run_header = IR::aligned_load(*builder, PTR_TY, header_alloca, "run_header");
+    builder->CreateCall(printf_fn, {header_fmt, run_header});
+    llvm::Value *const test_failed = builder->CreateCall(execute_test_fn, execute_args, "test_failed");
+    llvm::Value *const test_failed_i32 = builder->CreateZExt(test_failed, builder->getInt32Ty(), "test_failed_i32");
+    llvm::Value *const failed_before = IR::aligned_load(*builder, builder->getInt32Ty(), failed_alloca, "failed_before");
+    builder->CreateRet(builder->CreateAdd(failed_before, test_failed_i32, "failed_total"));
+
+    return dispatch_fn;
+}
+
 bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    generate_test_runner_variables(builder, module);
+    llvm::Function *parse_args_fn = generate_parse_test_args_function(builder, module);
     llvm::Function *execute_test_fn = generate_execute_test_function(builder, module);
+    llvm::Function *dispatch_test_fn = generate_dispatch_test_function(builder, module, execute_test_fn);
 
     llvm::Value *zero = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), 0);
     llvm::Value *one = llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), 1);
     llvm::FunctionType *main_type = llvm::FunctionType::get( //
         llvm::Type::getInt32Ty(context),                     // Return type: int
-        {},                                                  // Takes nothing
+        {llvm::Type::getInt32Ty(context), PTR_TY},           // Takes int argc, char *argv[]
         false                                                // no varargs
     );
     llvm::Function *main_function = llvm::Function::Create( //
@@ -1550,6 +3231,7 @@ bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm:
         main_function                                         //
     );
     builder->SetInsertPoint(entry_block);
+    builder->CreateCall(parse_args_fn, {main_function->getArg(0), main_function->getArg(1)});
 
 #ifdef __WIN32__
     // Setting the console output to UTF-8 that the tree characters render correctly
@@ -1628,16 +3310,17 @@ bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm:
         return lhs_path < rhs_path; // lexicographic order
     });
 
-    // Go through all files for all tests
-    size_t i = 0;
+    // Go through all files for all tests. Every test gets a global index, which determines the shard it belongs to
+    unsigned int file_index = 0;
+    unsigned int test_index = 0;
     for (const auto &[file_hash, test_list] : sorted_tests) {
         // Print which file we are currently at
         llvm::Value *const success_fmt_middle = IR::generate_const_string(module, " ├─ %-*s \033[32m✓ passed\033[0m\n");
         llvm::Value *const success_fmt_end = IR::generate_const_string(module, " └─ %-*s \033[32m✓ passed\033[0m\n");
         llvm::Value *const fail_fmt_middle = IR::generate_const_string(module, " ├─ %-*s \033[31m✗ failed\033[0m\n");
         llvm::Value *const fail_fmt_end = IR::generate_const_string(module, " └─ %-*s \033[31m✗ failed\033[0m\n");
-        llvm::Value *const perf_fmt_middle = IR::generate_const_string(module, " │   └─ Test took \033[34m%lf ms\033[0m\n");
-        llvm::Value *const perf_fmt_end = IR::generate_const_string(module, "     └─ Test took \033[34m%lf ms\033[0m\n");
+        llvm::Value *const perf_prefix_middle = IR::generate_const_string(module, " │   └─ ");
+        llvm::Value *const perf_prefix_end = IR::generate_const_string(module, "     └─ ");
         llvm::Value *const output_begin_fmt_middle = IR::generate_const_string(module, " │   ├─ Output ─");
         llvm::Value *const output_line_fmt_middle = IR::generate_const_string(module, " │   │ %.*s%*s│\n");
         llvm::Value *const output_end_fmt_middle = IR::generate_const_string(module, " │   └──────────");
@@ -1647,10 +3330,9 @@ bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm:
         llvm::Value *const output_end_fmt_end = IR::generate_const_string(module, "     └──────────");
         llvm::Value *const output_end_fmt_end_2 = IR::generate_const_string(module, "     ├──────────");
 
+        // The header is printed by the test runner right before the first test of the file which is actually run
         const std::string file_path = std::filesystem::relative(file_hash.path, std::filesystem::current_path()).string();
-        llvm::Value *const file_name_value = IR::generate_const_string(module, (i == 0 ? "" : "\n") + file_path + ":\n");
-        i++;
-        builder->CreateCall(c_functions.at(PRINTF), {file_name_value});
+        llvm::Value *const file_header_value = IR::generate_const_string(module, "\n" + file_path + ":\n");
 
         // Find out the longest test name, to be able to align the passed / failed outputs
         unsigned int longest_name = 0;
@@ -1670,7 +3352,7 @@ bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm:
             const bool output_never = test_node->contains_annotation(AnnotationKind::TEST_OUTPUT_NEVER);
             llvm::Value *const success_fmt = is_end ? success_fmt_end : success_fmt_middle;
             llvm::Value *const fail_fmt = is_end ? fail_fmt_end : fail_fmt_middle;
-            llvm::Value *const perf_fmt = is_end ? perf_fmt_end : perf_fmt_middle;
+            llvm::Value *const perf_prefix = is_end ? perf_prefix_end : perf_prefix_middle;
             llvm::Value *const output_begin_fmt = is_end ? output_begin_fmt_end : output_begin_fmt_middle;
             llvm::Value *const output_line_fmt = is_end ? output_line_fmt_end : output_line_fmt_middle;
             llvm::Value *const output_end_fmt = is_end                       //
@@ -1715,15 +3397,17 @@ bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm:
             llvm::Value *test_frame = IR::aligned_load(*builder, test_frame_type, test_default_value, "test_frame_default");
             test_frame = builder->CreateInsertValue(test_frame, ts_ptr, {0, Module::ThreadStack::FUNCTION::THREAD_STACK});
             IR::aligned_store(*builder, test_frame, ts_stack_data_ptr);
+            const uint64_t frame_size = module->getDataLayout().getTypeAllocSize(test_frame_type);
 
-            llvm::Value *test_ret = builder->CreateCall(execute_test_fn,
+            llvm::Value *test_failed_count = builder->CreateCall(dispatch_test_fn,
                 {
                     test_function,                   // void* test_fn_ptr
                     ts_stack_data_ptr,               // void* stack
+                    builder->getInt64(frame_size),   // u64 frame_size
                     test_name_value,                 // char* test_name_value
                     success_fmt,                     // char* success_fmt
                     fail_fmt,                        // char* fail_fmt
-                    perf_fmt,                        // char* perf_fmt
+                    perf_prefix,                     // char* perf_prefix
                     output_begin_fmt,                // char* output_begin
                     output_line_fmt,                 // char* output_line
                     output_end_fmt,                  // char *output_end
@@ -1731,20 +3415,31 @@ bool Generator::Builtin::generate_builtin_test(llvm::IRBuilder<> *builder, llvm:
                     builder->getInt1(is_perf_test),  // i1 is_perf_test
                     builder->getInt1(should_fail),   // i1 should_fail
                     builder->getInt1(output_always), // i1 output_always
-                    builder->getInt1(output_never)   // i1 output_never
+                    builder->getInt1(output_never),  // i1 output_never
+                    file_header_value,               // char* file_header
+                    builder->getInt32(file_index),   // i32 file_index
+                    builder->getInt32(test_index)    // i32 test_index
                 },                                   //
-                "test_ret"                           //
+                "test_failed_count"                  //
             );
 
-            // Increment the fail counter only if the test has failed
+            // Add all failed tests whose results have been collected by the dispatch to the fail counter
             llvm::LoadInst *counter_value = IR::aligned_load(*builder, builder->getInt32Ty(), counter, "counter_val");
-            llvm::Value *counter_p1 = builder->CreateAdd(counter_value, builder->getInt32(1), "counter_p1");
-            llvm::Value *new_counter_value = builder->CreateSelect(test_ret, counter_p1, counter_value, "new_counter_value");
+            llvm::Value *new_counter_value = builder->CreateAdd(counter_value, test_failed_count, "new_counter_value");
             IR::aligned_store(*builder, new_counter_value, counter);
             index++;
+            test_index++;
         }
+        file_index++;
     }
 
+#ifndef __WIN32__
+    // Wait for all workers which are still running and print their results
+    llvm::Value *const drained_failed_count = builder->CreateCall(module->getFunction("test.drain_all"), {}, "drained_failed_count");
+    llvm::Value *const counter_before_drain = IR::aligned_load(*builder, builder->getInt32Ty(), counter, "counter_before_drain");
+    IR::aligned_store(*builder, builder->CreateAdd(counter_before_drain, drained_failed_count, "counter_drained"), counter);
+#endif
+
     // Create the comparison with zero
     llvm::Value *counter_value = IR::aligned_load(*builder, llvm::Type::getInt32Ty(context), counter, "counter_value");
     llvm::Value *is_zero = builder->CreateICmpEQ(counter_value, zero);
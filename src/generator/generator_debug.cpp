@@ -890,7 +890,7 @@ llvm::DIType *Generator::Debug::create_debug_type_variant(llvm::Module *const mo
         uint64_t value_size;
         uint32_t value_align;
 
-        if (variant_value_type->to_string() == "void") {
+        if (variant_value_type->is(Type::Builtin::VOID)) {
             value_debug_type = DIB->createStructType(                                               //
                 file, "", file, 0, static_cast<size_t>(0), 1, llvm::DINode::FlagZero, nullptr,      //
                 DIB->getOrCreateArray({}), 0, nullptr, llvm_type_str + "." + variant_name + ".void" //
@@ -1035,12 +1035,12 @@ llvm::DIType *Generator::Debug::get_or_create_debug_type(llvm::Module *const mod
     return di_type;
 }
 
-void Generator::Debug::generate_variable_debug_info(                        //
-    llvm::IRBuilder<> &builder,                                             //
-    llvm::Function *parent,                                                 //
-    const std::shared_ptr<Scope> scope,                                     //
-    const std::unordered_map<std::string, llvm::Value *const> &allocations, //
-    const Hash &hash_key                                                    //
+void Generator::Debug::generate_variable_debug_info( //
+    llvm::IRBuilder<> &builder,                      //
+    llvm::Function *parent,                          //
+    const std::shared_ptr<Scope> scope,              //
+    const AllocationMap &allocations,                //
+    const Hash &hash_key                             //
 ) {
     llvm::DISubprogram *const sp = parent->getSubprogram();
     if (sp == nullptr || DIB == nullptr) {
@@ -1055,8 +1055,7 @@ void Generator::Debug::generate_variable_debug_info(                        //
         switch (stmt->get_variation()) {
             case StatementNode::Variation::DECLARATION: {
                 const auto *decl = stmt->as<DeclarationNode>();
-                const std::string alloca_name = "s" + std::to_string(scope->scope_id) + "::" + decl->name;
-                llvm::Value *const alloca = allocations.at(alloca_name);
+                llvm::Value *const alloca = allocations.get_variable(decl->slot);
                 llvm::DIType *const debug_type = get_or_create_debug_type(parent->getParent(), decl->type);
                 llvm::DILocalVariable *const var = DIB->createAutoVariable(sp, decl->name, file_meta, decl->line, debug_type, true);
                 llvm::DILocation *const diloc = llvm::DILocation::get(Generator::context, sp->getLine(), 0, sp);
@@ -1129,12 +1128,12 @@ void Generator::Debug::generate_variable_debug_info(                        //
     }
 }
 
-void Generator::Debug::generate_parameter_debug_info(                       //
-    llvm::IRBuilder<> &builder,                                             //
-    llvm::Function *parent,                                                 //
-    const FunctionNode *function_node,                                      //
-    const std::unordered_map<std::string, llvm::Value *const> &allocations, //
-    const Hash &hash_key                                                    //
+void Generator::Debug::generate_parameter_debug_info( //
+    llvm::IRBuilder<> &builder,                       //
+    llvm::Function *parent,                           //
+    const FunctionNode *function_node,                //
+    const AllocationMap &allocations,                 //
+    const Hash &hash_key                              //
 ) {
     llvm::DISubprogram *const sp = parent->getSubprogram();
     if (sp == nullptr || DIB == nullptr) {
@@ -1147,8 +1146,7 @@ void Generator::Debug::generate_parameter_debug_info(                       //
 
     for (size_t i = 0; i < function_node->parameters.size(); i++) {
         const auto &[param_type, param_name, param_mutable] = function_node->parameters.at(i);
-        const std::string alloca_name = "s" + std::to_string(function_node->scope.value()->scope_id) + "::" + param_name;
-        llvm::Value *const alloca = allocations.at(alloca_name);
+        llvm::Value *const alloca = allocations.get_variable(function_node->scope.value()->variables.at(param_name).slot);
         llvm::DIType *const debug_type = get_or_create_debug_type(parent->getParent(), param_type);
         llvm::DILocalVariable *const var = DIB->createParameterVariable(            //
             sp, param_name, i + 1, file_meta, function_node->line, debug_type, true //
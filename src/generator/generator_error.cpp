@@ -2,12 +2,180 @@
 #include "parser/parser.hpp"
 
 void Generator::Error::generate_error_functions(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    generate_error_tables(module);
+    generate_get_err_type_index_function(builder, module);
     generate_get_err_type_str_function(builder, module);
     generate_get_err_val_str_function(builder, module);
     generate_get_err_str_function(builder, module);
 }
 
+llvm::GlobalVariable *Generator::Error::create_error_table( //
+    llvm::Module *module,                                   //
+    llvm::Constant *table_data,                             //
+    const std::string &table_name                           //
+) {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    llvm::GlobalVariable *const table = new llvm::GlobalVariable(                                       //
+        *module, table_data->getType(), true, llvm::GlobalValue::PrivateLinkage, table_data, table_name //
+    );
+#pragma GCC diagnostic pop
+    return table;
+}
+
+void Generator::Error::generate_error_tables(llvm::Module *module) {
+    // The dense IDs are assigned in the same order as the errors are returned, the ID 0 is the base 'anyerror' type
+    const std::vector<const ErrorNode *> errors = Parser::get_all_errors();
+    const size_t type_count = errors.size() + 1;
+
+    // All names are pooled into a single null-separated blob, names which occur multiple times are only stored once
+    std::string name_pool;
+    std::unordered_map<std::string, uint32_t> pooled_names;
+    const auto pool_name = [&name_pool, &pooled_names](const std::string &name) -> uint32_t {
+        const auto [it, inserted] = pooled_names.emplace(name, static_cast<uint32_t>(name_pool.size()));
+        if (inserted) {
+            name_pool.append(name);
+            name_pool.push_back('\0');
+        }
+        return it->second;
+    };
+
+    std::vector<uint32_t> type_names(type_count, 0);
+    std::vector<uint32_t> value_bases(type_count, 0);
+    std::vector<uint32_t> value_counts(type_count, 0);
+    std::vector<uint32_t> value_names;
+    // The 'anyerror' value name is pooled first, so 'get_err_val_str' can return the start of the pool for it
+    pool_name("anyerror");
+    type_names[0] = pool_name("error");
+    for (const ErrorNode *error : errors) {
+        ASSERT(error->dense_id > 0 && error->dense_id < type_count);
+        type_names[error->dense_id] = pool_name(error->name);
+        // Collect the inheritance chain, the values of the root set come first
+        std::vector<const ErrorNode *> chain{error};
+        for (auto parent = error->get_parent_node(); parent.has_value(); parent = parent.value()->get_parent_node()) {
+            chain.emplace_back(parent.value());
+        }
+        value_bases[error->dense_id] = static_cast<uint32_t>(value_names.size());
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+            for (const std::string &value : (*it)->values) {
+                value_names.emplace_back(pool_name(value));
+            }
+        }
+        value_counts[error->dense_id] = static_cast<uint32_t>(value_names.size()) - value_bases[error->dense_id];
+    }
+
+    // The hash table mapping the hashed type IDs to dense IDs. The hashed ID 0 never occurs, so it marks an empty slot
+    size_t slot_count = 2;
+    while (slot_count < 2 * type_count) {
+        slot_count *= 2;
+    }
+    std::vector<uint32_t> slot_hashes(slot_count, 0);
+    std::vector<uint32_t> slot_ids(slot_count, 0);
+    for (const ErrorNode *error : errors) {
+        size_t slot = error->error_id & (slot_count - 1);
+        while (slot_hashes[slot] != 0) {
+            slot = (slot + 1) & (slot_count - 1);
+        }
+        slot_hashes[slot] = error->error_id;
+        slot_ids[slot] = error->dense_id;
+    }
+
+    create_error_table(module, llvm::ConstantDataArray::getString(context, name_pool, false), "flint.err_names");
+    create_error_table(module, llvm::ConstantDataArray::get(context, type_names), "flint.err_type_names");
+    create_error_table(module, llvm::ConstantDataArray::get(context, value_bases), "flint.err_value_bases");
+    create_error_table(module, llvm::ConstantDataArray::get(context, value_counts), "flint.err_value_counts");
+    create_error_table(module, llvm::ConstantDataArray::get(context, value_names), "flint.err_value_names");
+    create_error_table(module, llvm::ConstantDataArray::get(context, slot_hashes), "flint.err_slot_hashes");
+    create_error_table(module, llvm::ConstantDataArray::get(context, slot_ids), "flint.err_slot_ids");
+}
+
+void Generator::Error::generate_get_err_type_index_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // uint32_t get_err_type_index(const uint32_t err_type) {
+    //     if (err_type == 0) {
+    //         return 0;
+    //     }
+    //     size_t slot = err_type & SLOT_MASK;
+    //     while (err_slot_hashes[slot] != err_type) {
+    //         if (err_slot_hashes[slot] == 0) {
+    //             printf("Unknown error type hash: %u\n", err_type);
+    //             abort();
+    //         }
+    //         slot = (slot + 1) & SLOT_MASK;
+    //     }
+    //     return err_slot_ids[slot];
+    // }
+    llvm::GlobalVariable *const slot_hashes = module->getNamedGlobal("flint.err_slot_hashes");
+    llvm::GlobalVariable *const slot_ids = module->getNamedGlobal("flint.err_slot_ids");
+    const uint64_t slot_count = slot_hashes->getValueType()->getArrayNumElements();
+
+    llvm::FunctionType *get_err_type_index_type = llvm::FunctionType::get( //
+        llvm::Type::getInt32Ty(context),                                   // returns the dense id
+        {llvm::Type::getInt32Ty(context)},                                 // Takes the type of the error
+        false                                                              // No vaargs
+    );
+    llvm::Function *get_err_type_index_fn = llvm::Function::Create( //
+        get_err_type_index_type,                                    //
+        llvm::Function::InternalLinkage,                            //
+        "flint.get_err_type_index",                                 //
+        module                                                      //
+    );
+    error_functions["get_err_type_index"] = get_err_type_index_fn;
+    get_err_type_index_fn->addFnAttr(llvm::Attribute::Cold);
+
+    llvm::BasicBlock *entry_block = llvm::BasicBlock::Create(context, "entry", get_err_type_index_fn);
+    llvm::BasicBlock *anyerror_block = llvm::BasicBlock::Create(context, "anyerror", get_err_type_index_fn);
+    llvm::BasicBlock *probe_block = llvm::BasicBlock::Create(context, "probe", get_err_type_index_fn);
+    llvm::BasicBlock *mismatch_block = llvm::BasicBlock::Create(context, "mismatch", get_err_type_index_fn);
+    llvm::BasicBlock *found_block = llvm::BasicBlock::Create(context, "found", get_err_type_index_fn);
+    llvm::BasicBlock *unknown_block = llvm::BasicBlock::Create(context, "unknown", get_err_type_index_fn);
+
+    llvm::Argument *arg_err_type = get_err_type_index_fn->arg_begin();
+    arg_err_type->setName("err_type");
+
+    builder->SetInsertPoint(entry_block);
+    llvm::Value *slot_mask = builder->getInt32(static_cast<uint32_t>(slot_count - 1));
+    llvm::Value *start_slot = builder->CreateAnd(arg_err_type, slot_mask, "start_slot");
+    llvm::Value *is_anyerror = builder->CreateICmpEQ(arg_err_type, builder->getInt32(0), "is_anyerror");
+    builder->CreateCondBr(is_anyerror, anyerror_block, probe_block);
+
+    builder->SetInsertPoint(anyerror_block);
+    builder->CreateRet(builder->getInt32(0));
+
+    builder->SetInsertPoint(probe_block);
+    llvm::PHINode *slot = builder->CreatePHI(builder->getInt32Ty(), 2, "slot");
+    slot->addIncoming(start_slot, entry_block);
+    llvm::Value *slot_hash_ptr = builder->CreateGEP(builder->getInt32Ty(), slot_hashes, slot, "slot_hash_ptr");
+    llvm::Value *slot_hash = IR::aligned_load(*builder, builder->getInt32Ty(), slot_hash_ptr, "slot_hash");
+    llvm::Value *is_match = builder->CreateICmpEQ(slot_hash, arg_err_type, "is_match");
+    builder->CreateCondBr(is_match, found_block, mismatch_block, IR::generate_weights(100, 1));
+
+    builder->SetInsertPoint(mismatch_block);
+    llvm::Value *is_empty = builder->CreateICmpEQ(slot_hash, builder->getInt32(0), "is_empty");
+    llvm::Value *next_slot = builder->CreateAnd(builder->CreateAdd(slot, builder->getInt32(1)), slot_mask, "next_slot");
+    slot->addIncoming(next_slot, mismatch_block);
+    builder->CreateCondBr(is_empty, unknown_block, probe_block, IR::generate_weights(1, 100));
+
+    builder->SetInsertPoint(found_block);
+    llvm::Value *slot_id_ptr = builder->CreateGEP(builder->getInt32Ty(), slot_ids, slot, "slot_id_ptr");
+    builder->CreateRet(IR::aligned_load(*builder, builder->getInt32Ty(), slot_id_ptr, "dense_id"));
+
+    builder->SetInsertPoint(unknown_block);
+    llvm::Value *unknown_err_msg = IR::generate_const_string(module, "Unknown error type hash: %u\n");
+    builder->CreateCall(c_functions.at(PRINTF), {unknown_err_msg, arg_err_type});
+    builder->CreateCall(c_functions.at(ABORT), {});
+    builder->CreateUnreachable();
+}
+
 void Generator::Error::generate_get_err_type_str_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // const char *get_err_type_str(const uint32_t err_type) {
+    //     return err_names + err_type_names[get_err_type_index(err_type)];
+    // }
+    llvm::Function *get_err_type_index_fn = error_functions.at("get_err_type_index");
+    llvm::GlobalVariable *const names = module->getNamedGlobal("flint.err_names");
+    llvm::GlobalVariable *const type_names = module->getNamedGlobal("flint.err_type_names");
+
     llvm::FunctionType *get_err_type_str_type = llvm::FunctionType::get( //
         PTR_TY,                                                          // returns char*
         {llvm::Type::getInt32Ty(context)},                               // Takes the type of the error
@@ -20,51 +188,40 @@ void Generator::Error::generate_get_err_type_str_function(llvm::IRBuilder<> *bui
         module                                                    //
     );
     error_functions["get_err_type_str"] = get_err_type_str_fn;
+    // Error names are only ever needed once an error is reported, so keep them out of line and away from the hot code
+    get_err_type_str_fn->addFnAttr(llvm::Attribute::Cold);
+    get_err_type_str_fn->addFnAttr(llvm::Attribute::NoInline);
 
-    // Create basic blocks
     llvm::BasicBlock *entry_block = llvm::BasicBlock::Create(context, "entry", get_err_type_str_fn);
-    llvm::BasicBlock *default_block = llvm::BasicBlock::Create(context, "default", get_err_type_str_fn);
-    llvm::BasicBlock *zero_block = llvm::BasicBlock::Create(context, "zero_case", get_err_type_str_fn);
-
-    // Get the parameter (err_type)
     llvm::Argument *arg_err_type = get_err_type_str_fn->arg_begin();
     arg_err_type->setName("err_type");
 
-    // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
-
-    // Get all errors
-    std::vector<const ErrorNode *> errors = Parser::get_all_errors();
-
-    // Create the switch instruction (we'll add cases to it)
-    // Number of cases = 1 (for zero) + number of errors
-    llvm::SwitchInst *switch_inst = builder->CreateSwitch(arg_err_type, default_block, 1 + errors.size());
-
-    // Add case for hash 0 -> return "error"
-    switch_inst->addCase(llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), 0), zero_block);
-    builder->SetInsertPoint(zero_block);
-    llvm::Value *error_str = IR::generate_const_string(module, "error");
-    builder->CreateRet(error_str);
-
-    // Add cases for each error type
-    for (const ErrorNode *error : errors) {
-        llvm::BasicBlock *case_block = llvm::BasicBlock::Create(context, "case_" + error->name, get_err_type_str_fn);
-        switch_inst->addCase(builder->getInt32(error->error_id), case_block);
-
-        builder->SetInsertPoint(case_block);
-        llvm::Value *type_str = IR::generate_const_string(module, error->name);
-        builder->CreateRet(type_str);
-    }
-
-    // Default case: print error message and abort
-    builder->SetInsertPoint(default_block);
-    llvm::Value *unknown_err_msg = IR::generate_const_string(module, "Unknown error type hash: %u\n");
-    builder->CreateCall(c_functions.at(PRINTF), {unknown_err_msg, arg_err_type});
-    builder->CreateCall(c_functions.at(ABORT), {});
-    builder->CreateUnreachable();
+    llvm::Value *dense_id = builder->CreateCall(get_err_type_index_fn, {arg_err_type}, "dense_id");
+    llvm::Value *name_offset_ptr = builder->CreateGEP(builder->getInt32Ty(), type_names, dense_id, "name_offset_ptr");
+    llvm::Value *name_offset = IR::aligned_load(*builder, builder->getInt32Ty(), name_offset_ptr, "name_offset");
+    builder->CreateRet(builder->CreateGEP(builder->getInt8Ty(), names, name_offset, "type_name"));
 }
 
 void Generator::Error::generate_get_err_val_str_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // THE C IMPLEMENTATION:
+    // const char *get_err_val_str(const uint32_t err_type, const uint32_t err_val) {
+    //     if (err_type == 0) {
+    //         return err_names; // "anyerror" is always the first pooled name
+    //     }
+    //     const uint32_t dense_id = get_err_type_index(err_type);
+    //     if (err_val >= err_value_counts[dense_id]) {
+    //         printf("Unknown error value '%u' on error id '%u'\n", err_val, err_type);
+    //         abort();
+    //     }
+    //     return err_names + err_value_names[err_value_bases[dense_id] + err_val];
+    // }
+    llvm::Function *get_err_type_index_fn = error_functions.at("get_err_type_index");
+    llvm::GlobalVariable *const names = module->getNamedGlobal("flint.err_names");
+    llvm::GlobalVariable *const value_bases = module->getNamedGlobal("flint.err_value_bases");
+    llvm::GlobalVariable *const value_counts = module->getNamedGlobal("flint.err_value_counts");
+    llvm::GlobalVariable *const value_names = module->getNamedGlobal("flint.err_value_names");
+
     llvm::FunctionType *get_err_val_str_type = llvm::FunctionType::get( //
         PTR_TY,                                                         // returns char*
         {
@@ -80,97 +237,46 @@ void Generator::Error::generate_get_err_val_str_function(llvm::IRBuilder<> *buil
         module                                                   //
     );
     error_functions["get_err_val_str"] = get_err_val_str_fn;
+    get_err_val_str_fn->addFnAttr(llvm::Attribute::Cold);
+    get_err_val_str_fn->addFnAttr(llvm::Attribute::NoInline);
 
-    // Create basic blocks
     llvm::BasicBlock *entry_block = llvm::BasicBlock::Create(context, "entry", get_err_val_str_fn);
-    llvm::BasicBlock *default_block = llvm::BasicBlock::Create(context, "default", get_err_val_str_fn);
-    llvm::BasicBlock *zero_block = llvm::BasicBlock::Create(context, "zero_case", get_err_val_str_fn);
+    llvm::BasicBlock *anyerror_block = llvm::BasicBlock::Create(context, "anyerror", get_err_val_str_fn);
+    llvm::BasicBlock *typed_block = llvm::BasicBlock::Create(context, "typed", get_err_val_str_fn);
+    llvm::BasicBlock *in_range_block = llvm::BasicBlock::Create(context, "in_range", get_err_val_str_fn);
+    llvm::BasicBlock *unknown_block = llvm::BasicBlock::Create(context, "unknown", get_err_val_str_fn);
 
-    // Get the parameter (err_type)
     llvm::Argument *arg_err_type = get_err_val_str_fn->arg_begin();
     arg_err_type->setName("err_type");
-
-    // Get the parameter (err_val)
     llvm::Argument *arg_err_val = get_err_val_str_fn->arg_begin() + 1;
     arg_err_val->setName("err_val");
 
-    // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
-
-    // Get all errors
-    std::vector<const ErrorNode *> errors = Parser::get_all_errors();
-
-    // Create the switch instruction (we'll add cases to it)
-    // Number of cases = 1 (for zero) + number of errors
-    llvm::SwitchInst *switch_inst = builder->CreateSwitch(arg_err_type, default_block, 1 + errors.size());
-
-    // Add case for hash 0 -> return "error"
-    switch_inst->addCase(builder->getInt32(0), zero_block);
-    builder->SetInsertPoint(zero_block);
-    llvm::Value *error_str = IR::generate_const_string(module, "anyerror");
-    builder->CreateRet(error_str);
-
-    // Add cases for each error type
-    for (const ErrorNode *error : errors) {
-        llvm::BasicBlock *case_block = llvm::BasicBlock::Create(context, "case_" + error->name, get_err_val_str_fn);
-        switch_inst->addCase(builder->getInt32(error->error_id), case_block);
-
-        // Now we do a small check if the error set is inherited from a different error set. If it is then we check if the error value is
-        // inside the base error's range of values. If it is then we call the same function recursively with the new hash of the inherited
-        // error. If the value is bigger or equal to the number of values in the base error then we switch on it. It cannot be outside the
-        // range of the values, this should not be possible so we abort in that case too
-        builder->SetInsertPoint(case_block);
-        const std::optional<const ErrorNode *> parent_error = error->get_parent_node();
-        llvm::Value *normalized_err_val = arg_err_val;
-        if (parent_error.has_value()) {
-            const unsigned int value_count = parent_error.value()->get_value_count();
-            llvm::Value *parent_value_count = builder->getInt32(value_count);
-            llvm::Value *is_parent_err = builder->CreateICmpULT(arg_err_val, parent_value_count);
-            llvm::BasicBlock *is_parent_error_block = llvm::BasicBlock::Create(context, "case_" + error->name + "_is_parent_error");
-            llvm::BasicBlock *is_this_error_block = llvm::BasicBlock::Create(context, "case_" + error->name + "_is_this_error");
-            builder->CreateCondBr(is_parent_err, is_parent_error_block, is_this_error_block);
-            is_parent_error_block->insertInto(get_err_val_str_fn);
-            is_this_error_block->insertInto(get_err_val_str_fn);
-
-            // Recrusively call itself with the error id of the parent error and the error value forwarded as-is
-            builder->SetInsertPoint(is_parent_error_block);
-            llvm::Value *new_parent_id = builder->getInt32(parent_error.value()->error_id);
-            llvm::Value *value_from_parent = builder->CreateCall(get_err_val_str_fn, {new_parent_id, arg_err_val}, "value_from_parent");
-            builder->CreateRet(value_from_parent);
-
-            // Continue with normal flow, but we need to substract the number of values in the parent from the error value to make the
-            // switch below able to work
-            builder->SetInsertPoint(is_this_error_block);
-            normalized_err_val = builder->CreateSub(arg_err_val, parent_value_count, "normalized_err_val");
-        }
-
-        // We switch on the normalized error value and depending on it's value we return one of the possible error values, so we need to
-        // prepare a switch for all possible values
-        llvm::BasicBlock *default_value_block = llvm::BasicBlock::Create(context, "case_" + error->name + "_default");
-        llvm::SwitchInst *value_switch_inst = builder->CreateSwitch(normalized_err_val, default_value_block, error->values.size());
-
-        for (size_t i = 0; i < error->values.size(); i++) {
-            const std::string &value = error->values.at(i);
-            llvm::BasicBlock *value_case_block = llvm::BasicBlock::Create(                        //
-                context, "case_" + error->name + "_case_" + std::to_string(i), get_err_val_str_fn //
-            );
-            builder->SetInsertPoint(value_case_block);
-            value_switch_inst->addCase(builder->getInt32(i), value_case_block);
-            builder->CreateRet(IR::generate_const_string(module, value));
-        }
-
-        default_value_block->insertInto(get_err_val_str_fn);
-        builder->SetInsertPoint(default_value_block);
-        llvm::Value *unknown_err_msg = IR::generate_const_string(module, "Unknown error value '%u' on error id '%u'\n");
-        builder->CreateCall(c_functions.at(PRINTF), {unknown_err_msg, arg_err_val, arg_err_type});
-        builder->CreateCall(c_functions.at(ABORT), {});
-        builder->CreateUnreachable();
-    }
-
-    // Default case: print error message and abort
-    builder->SetInsertPoint(default_block);
-    llvm::Value *unknown_err_msg = IR::generate_const_string(module, "Unknown error type hash: %u\n");
-    builder->CreateCall(c_functions.at(PRINTF), {unknown_err_msg, arg_err_type});
+    llvm::Value *is_anyerror = builder->CreateICmpEQ(arg_err_type, builder->getInt32(0), "is_anyerror");
+    builder->CreateCondBr(is_anyerror, anyerror_block, typed_block);
+
+    builder->SetInsertPoint(anyerror_block);
+    builder->CreateRet(names);
+
+    // The values of all parent sets are stored in front of the values of the set itself, so the value ID directly indexes the values
+    builder->SetInsertPoint(typed_block);
+    llvm::Value *dense_id = builder->CreateCall(get_err_type_index_fn, {arg_err_type}, "dense_id");
+    llvm::Value *value_count_ptr = builder->CreateGEP(builder->getInt32Ty(), value_counts, dense_id, "value_count_ptr");
+    llvm::Value *value_count = IR::aligned_load(*builder, builder->getInt32Ty(), value_count_ptr, "value_count");
+    llvm::Value *is_in_range = builder->CreateICmpULT(arg_err_val, value_count, "is_in_range");
+    builder->CreateCondBr(is_in_range, in_range_block, unknown_block, IR::generate_weights(100, 1));
+
+    builder->SetInsertPoint(in_range_block);
+    llvm::Value *value_base_ptr = builder->CreateGEP(builder->getInt32Ty(), value_bases, dense_id, "value_base_ptr");
+    llvm::Value *value_base = IR::aligned_load(*builder, builder->getInt32Ty(), value_base_ptr, "value_base");
+    llvm::Value *value_index = builder->CreateAdd(value_base, arg_err_val, "value_index");
+    llvm::Value *name_offset_ptr = builder->CreateGEP(builder->getInt32Ty(), value_names, value_index, "name_offset_ptr");
+    llvm::Value *name_offset = IR::aligned_load(*builder, builder->getInt32Ty(), name_offset_ptr, "name_offset");
+    builder->CreateRet(builder->CreateGEP(builder->getInt8Ty(), names, name_offset, "value_name"));
+
+    builder->SetInsertPoint(unknown_block);
+    llvm::Value *unknown_err_msg = IR::generate_const_string(module, "Unknown error value '%u' on error id '%u'\n");
+    builder->CreateCall(c_functions.at(PRINTF), {unknown_err_msg, arg_err_val, arg_err_type});
     builder->CreateCall(c_functions.at(ABORT), {});
     builder->CreateUnreachable();
 }
@@ -196,6 +302,7 @@ void Generator::Error::generate_get_err_str_function(llvm::IRBuilder<> *builder,
         module                                               //
     );
     error_functions["get_err_str"] = get_err_str_fn;
+    get_err_str_fn->addFnAttr(llvm::Attribute::NoInline);
 
     // Create basic blocks
     llvm::BasicBlock *entry_block = llvm::BasicBlock::Create(context, "entry", get_err_str_fn);
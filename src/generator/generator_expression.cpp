@@ -29,6 +29,8 @@
 #include "llvm/IR/DerivedTypes.h"
 
 #include <llvm/IR/Instructions.h>
+
+#include <algorithm>
 #include <string>
 #include <variant>
 
@@ -428,14 +430,8 @@ std::optional<llvm::Value *> Generator::Expression::generate_variable( //
     }
 
     // Because every variable, no matter if it's a fn parameter or a local variable, now is stored in the TS, the approach can be unified a
-    // lot
-    if (ctx.scope->variables.find(variable_node->name) == ctx.scope->variables.end()) {
-        // Error: Undeclared Variable
-        THROW_BASIC_ERR(ERR_GENERATING);
-        return std::nullopt;
-    }
-    const unsigned int variable_decl_scope = ctx.scope->variables.at(variable_node->name).scope_id;
-    llvm::Value *const variable = ctx.allocations.at("s" + std::to_string(variable_decl_scope) + "::" + variable_node->name);
+    // lot. The parser only creates variable nodes for declared variables and already resolved their slot
+    llvm::Value *const variable = ctx.allocations.get_variable(variable_node->slot);
 
     // If a reference is requested we return the variable allocation directly
     if (is_reference) {
@@ -479,7 +475,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_string_interpolatio
     } else {
         // Currently only the first output of a group is supported in string interpolation, as there currently is no group printing yet
         ExpressionNode *expr = std::get<std::unique_ptr<ExpressionNode>>(*it).get();
-        ASSERT(expr->type->to_string() == "str");
+        ASSERT(expr->type->is(Type::Builtin::STR));
         group_mapping res = generate_expression(builder, ctx, garbage, expr_depth, expr);
         if (!res.has_value()) {
             THROW_BASIC_ERR(ERR_GENERATING);
@@ -504,7 +500,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_string_interpolatio
             str_value = builder.CreateCall(add_str_lit, {str_value, lit_str, builder.getInt64(lit_string.length())});
         } else {
             ExpressionNode *expr = std::get<std::unique_ptr<ExpressionNode>>(*it).get();
-            ASSERT(expr->type->to_string() == "str");
+            ASSERT(expr->type->is(Type::Builtin::STR));
             group_mapping res = generate_expression(builder, ctx, garbage, expr_depth, expr);
             if (!res.has_value()) {
                 return std::nullopt;
@@ -550,7 +546,7 @@ void Generator::Expression::convert_type_to_ext( //
             return;
         }
         case Type::Variation::PRIMITIVE:
-            if (type->to_string() == "str") {
+            if (type->is(Type::Builtin::STR)) {
                 llvm::Type *const str_type = IR::get_type(ctx.parent->getParent(), Type::get_primitive_type("type.flint.str")).type;
                 llvm::Value *const str_ptr = is_reference ? IR::aligned_load(builder, PTR_TY, value, "loaded_str") : value;
                 args.emplace_back(builder.CreateStructGEP(str_type, str_ptr, 1, "char_ptr"));
@@ -665,7 +661,7 @@ void Generator::Expression::convert_type_to_ext( //
             return;
         }
         case Type::Variation::PRIMITIVE:
-            if (type->to_string() == "str") {
+            if (type->is(Type::Builtin::STR)) {
                 llvm::Type *const str_type = IR::get_type(ctx.parent->getParent(), Type::get_primitive_type("type.flint.str")).type;
                 llvm::Value *const str_ptr = is_reference ? IR::aligned_load(builder, PTR_TY, value, "loaded_str") : value;
                 args.emplace_back(builder.CreateStructGEP(str_type, str_ptr, 1, "char_ptr"));
@@ -1038,7 +1034,7 @@ void Generator::Expression::convert_type_from_ext( //
             return;
         }
         case Type::Variation::PRIMITIVE:
-            if (type->to_string() == "str") {
+            if (type->is(Type::Builtin::STR)) {
                 llvm::Value *str_len = builder.CreateCall(c_functions.at(STRLEN), value, "str_len");
                 value = builder.CreateCall(Module::String::string_manip_functions.at("init_str"), {value, str_len}, "str");
             }
@@ -1165,7 +1161,7 @@ void Generator::Expression::convert_type_from_ext( //
             break;
         }
         case Type::Variation::PRIMITIVE:
-            if (type->to_string() == "str") {
+            if (type->is(Type::Builtin::STR)) {
                 llvm::Value *str_len = builder.CreateCall(c_functions.at(STRLEN), value, "str_len");
                 value = builder.CreateCall(Module::String::string_manip_functions.at("init_str"), {value, str_len}, "str");
             }
@@ -1424,7 +1420,7 @@ Generator::group_mapping Generator::Expression::generate_extern_call( //
     llvm::Value *sret_alloc = nullptr;
     size_t return_size = 0;
     size_t scratchspace_offset = 0;
-    if (call_node->type->to_string() != "void") {
+    if (!call_node->type->is(Type::Builtin::VOID)) {
         llvm::Type *const return_type = IR::get_type(ctx.parent->getParent(), call_node->type, false).type;
         return_size = Allocation::get_type_size(ctx.parent->getParent(), return_type);
 #ifdef __WIN32__
@@ -1453,7 +1449,7 @@ Generator::group_mapping Generator::Expression::generate_extern_call( //
         );
     }
     auto result = Function::get_function_definition(ctx.parent, call_node);
-    if (call_node->type->to_string() == "void") {
+    if (call_node->type->is(Type::Builtin::VOID)) {
         llvm::CallInst *call = builder.CreateCall(result.first.value(), converted_args);
 #ifndef __WIN32__
         // Add byval attributes for > 16 byte input parameters
@@ -2327,17 +2323,14 @@ Generator::group_mapping Generator::Expression::generate_callable_call( //
     std::vector<llvm::Value *> args;
     garbage_type garbage;
     const std::string &fn_name = call_node->callable_variable;
-    const Scope::Variable variable = ctx.scope->variables.at(fn_name);
-    ASSERT(variable.type->get_variation() == Type::Variation::FN);
-    const FnType *fn_type = variable.type->as<FnType>();
+    ASSERT(call_node->callable_type->get_variation() == Type::Variation::FN);
+    const FnType *fn_type = call_node->callable_type->as<FnType>();
     if (!generate_call_arg_prep(builder, ctx, args, garbage, call_node->arguments, fn_type->params)) {
         return std::nullopt;
     }
 
     // Then we are loading the pointer to the allocated stack frame from the callable variable's allocation
-    const unsigned int callable_scope_id = ctx.scope->variables.at(fn_name).scope_id;
-    const std::string callable_var_str = "s" + std::to_string(callable_scope_id) + "::" + fn_name;
-    llvm::Value *const callable_alloca = ctx.allocations.at(callable_var_str);
+    llvm::Value *const callable_alloca = ctx.allocations.get_variable(call_node->callable_slot);
     llvm::Value *const callable_value = IR::aligned_load(builder, PTR_TY, callable_alloca, "callable_value");
 
     // Get the pointer to the callable frame
@@ -2491,23 +2484,27 @@ Generator::group_mapping Generator::Expression::generate_instance_call( //
                 return std::nullopt;
             }
 
-            // TODO: Either add it here or in the dispatch function, a capacity check of the TS
+            // TODO: Either add it here or in the setup function, a capacity check of the TS
 
-            // Set up the frame by calling the dispatch function in setup-mode
+            // Set up the frame by calling the setup function of the called function, which is loaded from the vtable of the instance
             llvm::Value *const next_stack_frame = ctx.allocations.at("flint.stack.next");
             const InterfaceType *interface_type = call_node->instance_variable->type->as<InterfaceType>();
             llvm::StructType *const interface_ty = type_map.at(interface_type->get_type_string());
-            llvm::Value *const fn_id = builder.getInt64(call_node->function->get_id());
             llvm::Value *const object_ptr_ptr = builder.CreateStructGEP(interface_ty, interface_instance, 0, "object_ptr_ptr");
             llvm::Value *const object_ptr = IR::aligned_load(builder, PTR_TY, object_ptr_ptr, "object_ptr");
-            llvm::Value *const dispatch_fn_ptr = builder.CreateStructGEP(interface_ty, interface_instance, 1, "dispatch_fn_ptr");
-            llvm::Value *const dispatch_fn_raw = IR::aligned_load(builder, PTR_TY, dispatch_fn_ptr, "dispatch_fn");
-            llvm::FunctionType *const dispatch_fn_ty = llvm::FunctionType::get(            //
-                PTR_TY, {PTR_TY, PTR_TY, builder.getInt64Ty(), builder.getInt1Ty()}, false //
-            );
-            llvm::FunctionCallee dispatch_fn(dispatch_fn_ty, dispatch_fn_raw);
-            llvm::CallInst *const setup_call = builder.CreateCall(                                     //
-                dispatch_fn, {next_stack_frame, object_ptr, fn_id, builder.getInt1(true)}, "arg_start" //
+            llvm::Value *const vtable_ptr = builder.CreateStructGEP(interface_ty, interface_instance, 1, "vtable_ptr");
+            llvm::Value *const vtable = IR::aligned_load(builder, PTR_TY, vtable_ptr, "vtable");
+            const auto &interface_functions = interface_type->interface_node->functions;
+            const auto function_it = std::find(interface_functions.begin(), interface_functions.end(), call_node->function);
+            ASSERT(function_it != interface_functions.end());
+            const uint64_t slot = 2 * static_cast<uint64_t>(std::distance(interface_functions.begin(), function_it));
+            llvm::FunctionType *const vtable_fn_ty = llvm::FunctionType::get(PTR_TY, {PTR_TY, PTR_TY}, false);
+            // The vtables are constant, so their entries may be hoisted out of loops or folded once the vtable itself is known
+            llvm::Value *const setup_fn_ptr = builder.CreateConstInBoundsGEP1_64(PTR_TY, vtable, slot, "setup_fn_ptr");
+            llvm::LoadInst *const setup_fn = IR::aligned_load(builder, PTR_TY, setup_fn_ptr, "setup_fn");
+            setup_fn->setMetadata(llvm::LLVMContext::MD_invariant_load, llvm::MDNode::get(context, {}));
+            llvm::CallInst *const setup_call = builder.CreateCall(                                        //
+                llvm::FunctionCallee(vtable_fn_ty, setup_fn), {next_stack_frame, object_ptr}, "arg_start" //
             );
 #ifndef __WIN32__
             setup_call->addParamAttr(0, llvm::Attribute::InReg);
@@ -2540,14 +2537,16 @@ Generator::group_mapping Generator::Expression::generate_instance_call( //
                 arg_ptr = builder.CreateGEP(arg_value->getType(), arg_ptr, builder.getInt32(1), "arg_ptr_" + std::to_string(i + 1));
             }
 
-            // Call dispatch function in execute mode to actually call the targetted function
-            llvm::CallInst *call = builder.CreateCall(                         //
-                dispatch_fn,                                                   //
-                {next_stack_frame, object_ptr, fn_id, builder.getInt1(false)}, //
-                interface_type->interface_node->name + "_dispatch__call"       //
+            // Call the execute function from the vtable to actually call the targetted function
+            llvm::Value *const execute_fn_ptr = builder.CreateConstInBoundsGEP1_64(PTR_TY, vtable, slot + 1, "execute_fn_ptr");
+            llvm::LoadInst *const execute_fn = IR::aligned_load(builder, PTR_TY, execute_fn_ptr, "execute_fn");
+            execute_fn->setMetadata(llvm::LLVMContext::MD_invariant_load, llvm::MDNode::get(context, {}));
+            llvm::CallInst *call = builder.CreateCall(                                          //
+                llvm::FunctionCallee(vtable_fn_ty, execute_fn), {next_stack_frame, object_ptr}, //
+                interface_type->interface_node->name + "_vtable__call"                          //
             );
             call->setMetadata("comment",
-                llvm::MDNode::get(context, llvm::MDString::get(context, "Call of dispatch function '" + call_node->function->name + "'")));
+                llvm::MDNode::get(context, llvm::MDString::get(context, "Call of interface function '" + call_node->function->name + "'")));
 #ifndef __WIN32__
             call->addParamAttr(0, llvm::Attribute::InReg);
             if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
@@ -2661,37 +2660,21 @@ void Generator::Expression::generate_rethrow( //
                 llvm::MDString::get(context,
                     "Branch to '" + catch_block->getName().str() + "' if '" + function_name + "' returned error")));
 
-    // Generate the body of the catch block, it only contains re-throwing the error
+    // Generate the body of the catch block, it only contains re-throwing the error. Copying the error is outlined, so the catch block
+    // only consists of a call and the return
     builder.SetInsertPoint(catch_block);
-    // Copy of the generate_throw function
-    {
-        // Load error value
-        llvm::StructType *error_type = type_map.at("type.flint.err");
-        llvm::Value *const stack_frame = last_err_values.second;
-        llvm::Value *const err_var = builder.CreateStructGEP(                                           //
-            type_map.at("type.ts.function"), stack_frame, Module::ThreadStack::FUNCTION::ERR, "err_var" //
-        );
-        llvm::LoadInst *err_val = IR::aligned_load(builder,                   //
-            error_type,                                                       //
-            err_var,                                                          //
-            function_name + "_" + std::to_string(call_node->call_id) + "_val" //
-        );
-        err_val->setMetadata("comment",
-            llvm::MDNode::get(context,
-                llvm::MDString::get(context, "Load err val of call '" + function_name + "::" + std::to_string(call_node->call_id) + "'")));
-
-        // Store the error value in the error field of the current function
-        llvm::Value *error_ptr = builder.CreateStructGEP(                                                          //
-            type_map.at("type.ts.function"), ctx.allocations.at("flint.stack"), Module::ThreadStack::FUNCTION::ERR //
-        );
-        IR::aligned_store(builder, err_val, error_ptr);
-        if (ctx.is_global) {
-            // For now just return 1 when a call in a global initializer scope failed
-            // TODO: Add proper error printing etc like it exists when calling the main function
-            builder.CreateRet(builder.getInt32(1));
-        } else {
-            builder.CreateRet(builder.getInt1(true));
-        }
+    llvm::CallInst *rethrow_call = IR::generate_cold_rethrow(                                       //
+        builder, ctx.parent->getParent(), last_err_values.second, ctx.allocations.at("flint.stack") //
+    );
+    rethrow_call->setMetadata("comment",
+        llvm::MDNode::get(context,
+            llvm::MDString::get(context, "Rethrow err of call '" + function_name + "::" + std::to_string(call_node->call_id) + "'")));
+    if (ctx.is_global) {
+        // For now just return 1 when a call in a global initializer scope failed
+        // TODO: Add proper error printing etc like it exists when calling the main function
+        builder.CreateRet(builder.getInt32(1));
+    } else {
+        builder.CreateRet(builder.getInt1(true));
     }
 
     // Add branch to the merge block from the catch block if it does not contain a terminator (return or throw)
@@ -2939,13 +2922,12 @@ Generator::group_mapping Generator::Expression::generate_optional_switch_express
         return std::nullopt;
     }
     const auto *switcher_var_node = switch_expression->switcher->as<VariableNode>();
-    const unsigned int switcher_scope_id = ctx.scope->variables.at(switcher_var_node->name).scope_id;
-    const std::string switcher_var_str = "s" + std::to_string(switcher_scope_id) + "::" + switcher_var_node->name;
+    const unsigned int switcher_slot = switcher_var_node->slot;
     llvm::StructType *const opt_struct_type = IR::add_and_or_get_type(ctx.parent->getParent(), switch_expression->switcher->type, false);
     if (switch_value->getType()->isPointerTy()) {
         switch_value = IR::aligned_load(builder, opt_struct_type, switch_value, "loaded_rhs");
     }
-    llvm::Value *const var_alloca = ctx.allocations.at(switcher_var_str);
+    llvm::Value *const var_alloca = ctx.allocations.get_variable(switcher_slot);
 
     // Get the current block
     llvm::BasicBlock *const pred_block = builder.GetInsertBlock();
@@ -2983,9 +2965,9 @@ Generator::group_mapping Generator::Expression::generate_optional_switch_express
 
         if (branch.matches.front()->get_variation() == ExpressionNode::Variation::SWITCH_MATCH) {
             const auto *match_node = branch.matches.front()->as<SwitchMatchNode>();
-            const std::string var_str = "s" + std::to_string(branch.scope->scope_id) + "::" + match_node->name.value();
+            const unsigned int match_slot = match_node->slot;
             llvm::Value *real_value_reference = builder.CreateStructGEP(opt_struct_type, var_alloca, 1, "value_reference");
-            ctx.allocations.emplace(var_str, real_value_reference);
+            ctx.allocations.set_variable(match_slot, real_value_reference);
             value_block_idx = i;
         }
         ctx.scope = branch.scope;
@@ -3061,8 +3043,7 @@ Generator::group_mapping Generator::Expression::generate_variant_switch_expressi
         return std::nullopt;
     }
     const auto *const switcher_var_node = switch_expression->switcher->as<VariableNode>();
-    const unsigned int switcher_scope_id = ctx.scope->variables.at(switcher_var_node->name).scope_id;
-    const std::string switcher_var_str = "s" + std::to_string(switcher_scope_id) + "::" + switcher_var_node->name;
+    const unsigned int switcher_slot = switcher_var_node->slot;
     llvm::StructType *const variant_struct_type = IR::add_and_or_get_type( //
         ctx.parent->getParent(), switch_expression->switcher->type, false  //
     );
@@ -3070,7 +3051,7 @@ Generator::group_mapping Generator::Expression::generate_variant_switch_expressi
         switch_value = IR::aligned_load(builder, variant_struct_type, switch_value, "loaded_rhs");
     }
     switch_value = builder.CreateExtractValue(switch_value, {0}, "variant_flag");
-    llvm::Value *const var_alloca = ctx.allocations.at(switcher_var_str);
+    llvm::Value *const var_alloca = ctx.allocations.get_variable(switcher_slot);
 
     // First pass: create all branch blocks and detect default case
     for (size_t i = 0; i < switch_expression->branches.size(); i++) {
@@ -3095,9 +3076,9 @@ Generator::group_mapping Generator::Expression::generate_variant_switch_expressi
 
         if (match_node->name.has_value()) {
             // Add a reference to the 'value' of the variant to the block the switch expression takes place in
-            const std::string var_str = "s" + std::to_string(branch.scope->scope_id) + "::" + match_node->name.value();
+            const unsigned int match_slot = match_node->slot;
             llvm::Value *real_value_reference = builder.CreateStructGEP(variant_struct_type, var_alloca, 1, "value_reference");
-            ctx.allocations.emplace(var_str, real_value_reference);
+            ctx.allocations.set_variable(match_slot, real_value_reference);
         }
         ctx.scope = branch.scope;
 
@@ -3112,7 +3093,7 @@ Generator::group_mapping Generator::Expression::generate_variant_switch_expressi
 
         generate_switch_branch_garbage_cleanup(builder, garbage, garbage_before, branch_value);
 
-        phi_values.emplace_back(branch_value, branch_blocks[i]);
+        phi_values.emplace_back(branch_value, builder.GetInsertBlock());
         if (builder.GetInsertBlock()->getTerminator() == nullptr) {
             builder.CreateBr(merge_block);
         }
@@ -3191,6 +3172,26 @@ Generator::group_mapping Generator::Expression::generate_switch_expression( //
             break;
     }
 
+    // Strings are first dispatched to the index of the matching literal, the switch itself then switches over these indices
+    const bool is_string_switch = switch_expression->switcher->type->is(Type::Builtin::STR);
+    std::vector<std::string_view> string_literals;
+    if (is_string_switch) {
+        for (const auto &branch : switch_expression->branches) {
+            if (branch.matches.front()->get_variation() == ExpressionNode::Variation::DEFAULT) {
+                continue;
+            }
+            for (const auto &match : branch.matches) {
+                const std::optional<std::string_view> literal = Logical::get_string_literal(match.get());
+                if (!literal.has_value()) {
+                    THROW_BASIC_ERR(ERR_GENERATING);
+                    return std::nullopt;
+                }
+                string_literals.emplace_back(literal.value());
+            }
+        }
+        switch_value = Logical::generate_string_switch_index(builder, switch_value, string_literals);
+    }
+
     // Get the current block
     llvm::BasicBlock *const pred_block = builder.GetInsertBlock();
 
@@ -3271,6 +3272,7 @@ Generator::group_mapping Generator::Expression::generate_switch_expression( //
     switch_inst->setMetadata("comment", llvm::MDNode::get(context, llvm::MDString::get(context, "Switch expression")));
 
     // Add the cases to the switch instruction
+    size_t string_literal_idx = 0;
     for (size_t i = 0; i < switch_expression->branches.size(); i++) {
         const auto &branch = switch_expression->branches[i];
         // Skip the default node
@@ -3280,6 +3282,15 @@ Generator::group_mapping Generator::Expression::generate_switch_expression( //
 
         // Generate the case value
         for (const auto &match : branch.matches) {
+            if (is_string_switch) {
+                // A literal listed multiple times only matches at its first occurrence
+                const size_t literal_idx = string_literal_idx++;
+                const auto first_it = std::find(string_literals.begin(), string_literals.end(), string_literals[literal_idx]);
+                if (static_cast<size_t>(std::distance(string_literals.begin(), first_it)) == literal_idx) {
+                    switch_inst->addCase(builder.getInt32(static_cast<uint32_t>(literal_idx)), branch_blocks[i]);
+                }
+                continue;
+            }
             if (match->get_variation() == ExpressionNode::Variation::LITERAL) {
                 const auto *literal_node = match->as<LiteralNode>();
                 if (std::holds_alternative<LitError>(literal_node->value)) {
@@ -3329,7 +3340,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_inline_array_initia
     const unsigned int expr_depth,                                                     //
     const InlineArrayInitializerNode *initializer                                      //
 ) {
-    // Generate all length expressions and store them into arr::idx::N
+    // Generate all length expressions and store them into the index array of their count
     std::vector<llvm::Value *> length_expressions;
     for (auto &expr : initializer->length_expressions) {
         group_mapping result = generate_expression(builder, ctx, garbage, expr_depth, expr.get());
@@ -3343,7 +3354,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_inline_array_initia
         llvm::Value *index_i64 = generate_type_cast(builder, ctx, result.value().front(), expr->type, Type::get_primitive_type("u64"));
         length_expressions.emplace_back(index_i64);
     }
-    llvm::Value *const length_array = ctx.allocations.at("arr::idx::" + std::to_string(length_expressions.size()));
+    llvm::Value *const length_array = ctx.allocations.get_index_array(length_expressions.size());
     for (size_t i = 0; i < length_expressions.size(); i++) {
         llvm::Value *array_element_ptr = builder.CreateGEP(builder.getInt64Ty(), length_array, builder.getInt64(i));
         IR::aligned_store(builder, length_expressions.at(i), array_element_ptr);
@@ -3443,7 +3454,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_array_initializer(
         llvm::Value *index_i64 = generate_type_cast(builder, ctx, result.value().front(), expr->type, Type::get_primitive_type("u64"));
         length_expressions.emplace_back(index_i64);
     }
-    llvm::Value *const length_array = ctx.allocations.at("arr::idx::" + std::to_string(length_expressions.size()));
+    llvm::Value *const length_array = ctx.allocations.get_index_array(length_expressions.size());
     for (size_t i = 0; i < length_expressions.size(); i++) {
         llvm::Value *array_element_ptr = builder.CreateGEP(builder.getInt64Ty(), length_array, builder.getInt64(i));
         IR::aligned_store(builder, length_expressions.at(i), array_element_ptr);
@@ -3573,7 +3584,7 @@ Generator::group_mapping Generator::Expression::generate_grouped_array_access( /
     const auto &base_expr_ty = access->base_expr->type;
     [[maybe_unused]] uint32_t dimensionality = 1;
     std::shared_ptr<Type> base_type{nullptr};
-    if (base_expr_ty->to_string() == "str") {
+    if (base_expr_ty->is(Type::Builtin::STR)) {
         base_type = Type::get_primitive_type("u8");
     } else {
         const auto *arr_ty = base_expr_ty->as<ArrayType>();
@@ -3623,7 +3634,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_array_access( //
         base_type = base_type->as<OptionalType>()->base_type;
     }
     const bool is_slice = result_type->get_variation() == Type::Variation::ARRAY //
-        || (result_type->to_string() == "str" && base_type->to_string() == "str");
+        || (result_type->is(Type::Builtin::STR) && base_type->is(Type::Builtin::STR));
     // First, generate the index expressions
     std::vector<std::array<llvm::Value *, 2>> index_expressions;
     for (auto &index_expression : indexing_expressions) {
@@ -3672,7 +3683,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_array_access( //
         }
         array_ptr = base_expression.value().front();
     }
-    if (base_type->to_string() == "str") {
+    if (base_type->is(Type::Builtin::STR)) {
         // "Array" accesses on strings dont need all the things below, they are much simpler to handle
         if (index_expressions.size() > 1) {
             THROW_BASIC_ERR(ERR_GENERATING);
@@ -3687,7 +3698,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_array_access( //
         }
     }
     const size_t idx_size = indexing_expressions.size() * (static_cast<size_t>(is_slice) + 1);
-    llvm::Value *const temp_array_indices = ctx.allocations.at("arr::idx::" + std::to_string(idx_size));
+    llvm::Value *const temp_array_indices = ctx.allocations.get_index_array(idx_size);
     // Save all the indices in the temp array
     for (size_t i = 0; i < index_expressions.size(); i++) {
         if (!is_slice) {
@@ -3829,7 +3840,7 @@ Generator::group_mapping Generator::Expression::generate_data_access( //
     }
     llvm::Value *expr_val = base_expr.value().front();
     // Get the type of the data variable to access
-    if (data_access->base_expr->type->to_string() == "str") {
+    if (data_access->base_expr->type->is(Type::Builtin::STR)) {
         if (data_access->field_name != "length" && data_access->field_name != "len") {
             THROW_BASIC_ERR(ERR_GENERATING);
             return std::nullopt;
@@ -3839,7 +3850,7 @@ Generator::group_mapping Generator::Expression::generate_data_access( //
         llvm::Value *length = IR::aligned_load(builder, builder.getInt64Ty(), length_ptr, "length");
         return std::vector<llvm::Value *>{length};
     }
-    if (data_access->base_expr->type->to_string() == "anyerror") {
+    if (data_access->base_expr->type->is(Type::Builtin::ANYERROR)) {
         expr_val = builder.CreateExtractValue(expr_val, data_access->field_id, "anyerror_id_" + std::to_string(data_access->field_id));
         return std::vector<llvm::Value *>{expr_val};
     }
@@ -3877,7 +3888,7 @@ Generator::group_mapping Generator::Expression::generate_data_access( //
             const auto *vector_type = data_access->base_expr->type->as<VectorType>();
             ASSERT(!is_reference);
             std::vector<llvm::Value *> values;
-            if (vector_type->base_type->to_string() == "bool") {
+            if (vector_type->base_type->is(Type::Builtin::BOOL)) {
                 // Special case for accessing an "element" on a bool8 type
                 values.emplace_back(get_bool8_element_at(builder, expr_val, data_access->field_id));
             } else {
@@ -3967,7 +3978,7 @@ Generator::group_mapping Generator::Expression::generate_grouped_data_access( //
     std::vector<llvm::Value *> return_values;
     return_values.reserve(group_type->types.size());
     // Its a grouped access on a bool8 variable, we need to handle this specially
-    if (grouped_data_access->base_expr->type->to_string() == "bool8") {
+    if (grouped_data_access->base_expr->type->is(Type::Builtin::BOOL8)) {
         for (auto it = grouped_data_access->field_ids.begin(); it != grouped_data_access->field_ids.end(); ++it) {
             return_values.push_back(get_bool8_element_at(builder, expr, *it));
         }
@@ -4081,7 +4092,8 @@ Generator::group_mapping Generator::Expression::generate_optional_chain( //
         return std::vector<llvm::Value *>{result_value};
     }
 
-    // It's definitely the top-level chain element
+    // It's definitely the top-level chain element. The access itself may have split the happy path, so the phi takes the block it ended in
+    llvm::BasicBlock *const happy_path_end = builder.GetInsertBlock();
     llvm::BasicBlock *merge_block = llvm::BasicBlock::Create(context, "merge_block");
     builder.CreateBr(merge_block);
 
@@ -4096,7 +4108,7 @@ Generator::group_mapping Generator::Expression::generate_optional_chain( //
     merge_block->insertInto(ctx.parent);
     builder.SetInsertPoint(merge_block);
     llvm::PHINode *selected_value = builder.CreatePHI(result_type, 2, "selected_value");
-    selected_value->addIncoming(result_value, happy_path);
+    selected_value->addIncoming(result_value, happy_path_end);
     selected_value->addIncoming(sc_value, ctx.short_circuit_block.value());
 
     // Lastly reset the short-circuit block
@@ -4156,10 +4168,7 @@ Generator::group_mapping Generator::Expression::generate_optional_unwrap( //
 
     // The crash block, in the case of a bad optional access
     builder.SetInsertPoint(has_no_value);
-    llvm::Value *err_msg = IR::generate_const_string(ctx.parent->getParent(), "Bad optional access occurred\n");
-    builder.CreateCall(c_functions.at(PRINTF), {err_msg});
-    builder.CreateCall(c_functions.at(ABORT), {});
-    builder.CreateUnreachable();
+    IR::generate_cold_crash(builder, ctx.parent->getParent(), "bad_optional_access", "Bad optional access occurred\n");
 
     // The merge block, when the optional access was okay
     builder.SetInsertPoint(merge);
@@ -4180,8 +4189,7 @@ Generator::group_mapping Generator::Expression::generate_variant_extraction( //
     const VariantExtractionNode *extraction                                  //
 ) {
     const auto *variable_node = extraction->base_expr->as<VariableNode>();
-    const unsigned int variable_decl_scope = ctx.scope->variables.at(variable_node->name).scope_id;
-    llvm::Value *const variable = ctx.allocations.at("s" + std::to_string(variable_decl_scope) + "::" + variable_node->name);
+    llvm::Value *const variable = ctx.allocations.get_variable(variable_node->slot);
     const auto *result_type_ptr = extraction->type->as<OptionalType>();
     const std::shared_ptr<Type> &extract_type_ptr = result_type_ptr->base_type;
     llvm::Type *const element_type = IR::get_type(ctx.parent->getParent(), extract_type_ptr).type;
@@ -4284,10 +4292,7 @@ Generator::group_mapping Generator::Expression::generate_variant_unwrap( //
 
     // The crash block, in the case of a bad variant unwrap
     builder.SetInsertPoint(holds_wrong_type);
-    llvm::Value *const err_msg = IR::generate_const_string(ctx.parent->getParent(), "Bad variant unwrap occurred\n");
-    builder.CreateCall(c_functions.at(PRINTF), {err_msg});
-    builder.CreateCall(c_functions.at(ABORT), {});
-    builder.CreateUnreachable();
+    IR::generate_cold_crash(builder, ctx.parent->getParent(), "bad_variant_unwrap", "Bad variant unwrap occurred\n");
 
     // The merge block, when the variant access is okay
     builder.SetInsertPoint(merge);
@@ -4339,13 +4344,13 @@ Generator::group_mapping Generator::Expression::generate_type_cast( //
             to_type = type_cast_node->type;
             break;
         case Type::Variation::PRIMITIVE:
-            if (type_cast_node->type->to_string() == "str" && type_cast_node->expr->type->get_variation() == Type::Variation::GROUP) {
+            if (type_cast_node->type->is(Type::Builtin::STR) && type_cast_node->expr->type->get_variation() == Type::Variation::GROUP) {
                 const GroupType *group_type = type_cast_node->expr->type->as<GroupType>();
                 std::vector<llvm::Value *> str_values;
                 std::vector<size_t> temporaries;
                 for (size_t i = 0; i < group_type->types.size(); i++) {
                     const auto &elem_type = group_type->types.at(i);
-                    if (elem_type->to_string() == "str") {
+                    if (elem_type->is(Type::Builtin::STR)) {
                         str_values.emplace_back(expr.at(i));
                         continue;
                     }
@@ -4412,8 +4417,8 @@ Generator::group_mapping Generator::Expression::generate_type_cast( //
         }
         case Type::Variation::VECTOR: {
             const auto *vector_type = type_cast_node->type->as<VectorType>();
-            if (type_cast_node->type->to_string() == "bool8") {
-                ASSERT(type_cast_node->expr->type->to_string() == "u8");
+            if (type_cast_node->type->is(Type::Builtin::BOOL8)) {
+                ASSERT(type_cast_node->expr->type->is(Type::Builtin::U8));
                 ASSERT(expr.size() == 1);
                 std::vector<llvm::Value *> result;
                 result.emplace_back(expr.at(0));
@@ -4462,7 +4467,7 @@ Generator::group_mapping Generator::Expression::generate_type_cast( //
             }
         }
     }
-    if (to_type->to_string() == "str" && type_cast_node->expr->type->to_string() == "type.flint.str.lit") {
+    if (to_type->is(Type::Builtin::STR) && type_cast_node->expr->type->is(Type::Builtin::STR_LIT)) {
         ASSERT(expr.size() == 1);
         expr[0] = Module::String::generate_string_declaration(builder, expr[0], type_cast_node->expr.get());
         return expr;
@@ -4545,18 +4550,18 @@ llvm::Value *Generator::Expression::generate_type_cast( //
         }
         return func_value;
     } else if (from_type->get_variation() == Type::Variation::OBJECT && to_type->get_variation() == Type::Variation::INTERFACE) {
-        // We "cast" an object to an interface by storing the pointer to the object alongside the pointer to the dispatch function and the
-        // ID of the object in a new structure.
+        // We "cast" an object to an interface by storing the pointer to the object alongside the pointer to the vtable of the object for
+        // this interface and the pointer to the DIMA head of the object in a new structure.
         const ObjectType *object_type = from_type->as<ObjectType>();
         llvm::Value *interface_value = IR::get_default_value_of_type(builder, ctx.parent->getParent(), to_type);
         const std::string &cast_name = object_type->to_string() + "_to_" + to_type->to_string();
-        llvm::Function *const object_dispatch_fn = object_dispatch_functions.at(object_type->get_id());
+        llvm::GlobalVariable *const object_vtable = object_vtables.at(object_type->get_id()).at(to_type->get_id());
         const std::string head_key = object_type->object_node->file_hash.to_string() + "." + object_type->object_node->name;
         llvm::Value *const object_dima_head = Module::DIMA::dima_heads.at(head_key);
         llvm::Function *const dima_retain_fn = Module::DIMA::dima_functions.at("retain");
         builder.CreateCall(dima_retain_fn, {expr});
         interface_value = builder.CreateInsertValue(interface_value, expr, 0);
-        interface_value = builder.CreateInsertValue(interface_value, object_dispatch_fn, 1);
+        interface_value = builder.CreateInsertValue(interface_value, object_vtable, 1);
         interface_value = builder.CreateInsertValue(interface_value, object_dima_head, 2, cast_name);
         return interface_value;
     } else if (from_type->get_variation() == Type::Variation::ARRAY && to_type->get_variation() == Type::Variation::ARRAY) {
@@ -4928,7 +4933,7 @@ llvm::Value *Generator::Expression::generate_type_cast( //
         llvm::Value *cast_value = builder.CreateCall(init_str_fn, {name_str, name_len}, "cast_enum");
         return cast_value;
     }
-    if (from_type->get_variation() == Type::Variation::ERROR_SET || from_type->to_string() == "anyerror") {
+    if (from_type->get_variation() == Type::Variation::ERROR_SET || from_type->is(Type::Builtin::ANYERROR)) {
         if (to_type_str == "str") {
             llvm::Function *get_err_str_fn = Error::error_functions.at("get_err_str");
             return builder.CreateCall(get_err_str_fn, {expr}, "err_to_str");
@@ -4987,68 +4992,18 @@ Generator::group_mapping Generator::Expression::generate_unary_op_expression( //
                 operand.at(i) = Logical::generate_not(builder, operand.at(i));
                 break;
             case TOK_INCREMENT:
-                if (expression_type == "i32") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt32Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateAdd(operand.at(i), one, "add_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("i32_safe_add"), {operand.at(i), one}, "safe_add_res" //
-                          );
-                } else if (expression_type == "i64") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt64Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateAdd(operand.at(i), one, "add_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("i64_safe_add"), {operand.at(i), one}, "safe_add_res" //
-                          );
-                } else if (expression_type == "u32") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt32Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateAdd(operand.at(i), one, "add_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("u32_safe_add"), {operand.at(0), one}, "safe_add_res" //
-                          );
-                } else if (expression_type == "u64") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt64Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateAdd(operand.at(i), one, "add_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("u64_safe_add"), {operand.at(0), one}, "safe_add_res" //
-                          );
+                if (expression_type == "i32" || expression_type == "i64" || expression_type == "u32" || expression_type == "u64") {
+                    llvm::Value *one = llvm::ConstantInt::get(operand.at(i)->getType(), 1);
+                    operand.at(i) = Module::Arithmetic::generate_inline_safe_op(builder, TOK_PLUS, expression_type, operand.at(i), one);
                 } else if (expression_type == "f32" || expression_type == "f64") {
                     llvm::Value *one = llvm::ConstantFP::get(operand.at(i)->getType(), 1.0);
                     operand.at(i) = builder.CreateFAdd(operand.at(i), one);
                 }
                 break;
             case TOK_DECREMENT:
-                if (expression_type == "i32") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt32Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateSub(operand.at(i), one, "sub_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("i32_safe_sub"), {operand.at(i), one}, "safe_sub_res" //
-                          );
-                } else if (expression_type == "i64") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt64Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateSub(operand.at(i), one, "sub_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("i64_safe_sub"), {operand.at(i), one}, "safe_sub_res" //
-                          );
-                } else if (expression_type == "u32") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt32Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateSub(operand.at(i), one, "sub_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("u32_safe_sub"), {operand.at(0), one}, "safe_sub_res" //
-                          );
-                } else if (expression_type == "u64") {
-                    llvm::Value *one = llvm::ConstantInt::get(builder.getInt64Ty(), 1);
-                    operand.at(i) = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                        ? builder.CreateSub(operand.at(i), one, "sub_res")
-                        : builder.CreateCall(                                                                                   //
-                              Module::Arithmetic::arithmetic_functions.at("u64_safe_sub"), {operand.at(0), one}, "safe_sub_res" //
-                          );
+                if (expression_type == "i32" || expression_type == "i64" || expression_type == "u32" || expression_type == "u64") {
+                    llvm::Value *one = llvm::ConstantInt::get(operand.at(i)->getType(), 1);
+                    operand.at(i) = Module::Arithmetic::generate_inline_safe_op(builder, TOK_MINUS, expression_type, operand.at(i), one);
                 } else if (expression_type == "f32" || expression_type == "f64") {
                     llvm::Value *one = llvm::ConstantFP::get(operand.at(i)->getType(), 1.0);
                     operand.at(i) = builder.CreateFSub(operand.at(i), one);
@@ -5192,16 +5147,41 @@ Generator::group_mapping Generator::Expression::generate_binary_op( //
         return std::vector<llvm::Value *>{phi};
     }
 
+    // String comparisons against a string literal are lowered inline against the constant literal, so the literal side is never
+    // generated at all. This way no 'str' needs to be allocated for it
+    bool is_str_cmp = false;
+    switch (bin_op_node->operator_token) {
+        default:
+            break;
+        case TOK_EQUAL_EQUAL:
+        case TOK_NOT_EQUAL:
+        case TOK_LESS:
+        case TOK_GREATER:
+        case TOK_LESS_EQUAL:
+        case TOK_GREATER_EQUAL:
+            is_str_cmp = bin_op_node->left->type->is(Type::Builtin::STR) && bin_op_node->right->type->is(Type::Builtin::STR);
+            break;
+    }
+    const bool skip_lhs = is_str_cmp && Logical::get_string_literal(bin_op_node->left.get()).has_value();
+    const bool skip_rhs = is_str_cmp && Logical::get_string_literal(bin_op_node->right.get()).has_value();
+
     // For all other operators, evaluate both sides
-    const bool lhs_is_reference = bin_op_node->left->type->get_variation() == Type::Variation::VARIANT;
-    auto lhs_maybe = generate_expression(builder, ctx, garbage, expr_depth + 1, bin_op_node->left.get(), lhs_is_reference);
-    if (!lhs_maybe.has_value()) {
-        THROW_BASIC_ERR(ERR_GENERATING);
-        return std::nullopt;
+    std::vector<llvm::Value *> lhs;
+    if (skip_lhs) {
+        lhs = std::vector<llvm::Value *>{nullptr};
+    } else {
+        const bool lhs_is_reference = bin_op_node->left->type->get_variation() == Type::Variation::VARIANT;
+        auto lhs_maybe = generate_expression(builder, ctx, garbage, expr_depth + 1, bin_op_node->left.get(), lhs_is_reference);
+        if (!lhs_maybe.has_value()) {
+            THROW_BASIC_ERR(ERR_GENERATING);
+            return std::nullopt;
+        }
+        lhs = lhs_maybe.value();
     }
-    std::vector<llvm::Value *> lhs = lhs_maybe.value();
     std::vector<llvm::Value *> rhs;
-    if (bin_op_node->operator_token != TOK_CATCH) {
+    if (skip_rhs) {
+        rhs = std::vector<llvm::Value *>{nullptr};
+    } else if (bin_op_node->operator_token != TOK_CATCH) {
         const bool rhs_is_reference = bin_op_node->right->type->get_variation() == Type::Variation::VARIANT;
         auto rhs_maybe = generate_expression(builder, ctx, garbage, expr_depth + 1, bin_op_node->right.get(), rhs_is_reference);
         if (!rhs_maybe.has_value()) {
@@ -5363,6 +5343,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_set_cmp(
         // Branch to the first other block if result is true, otherwise to the merge block
         builder.CreateCondBr(result_maybe.value(), blocks.front(), blocks.back());
     }
+    llvm::BasicBlock *last_cmp_block = blocks[blocks.size() - 2];
     for (size_t i = 0; i < blocks.size() - 1; i++) {
         builder.SetInsertPoint(blocks[i]);
         result_maybe = generate_binary_op_scalar(                                                                            //
@@ -5371,6 +5352,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_set_cmp(
         if (!result_maybe.has_value()) {
             return std::nullopt;
         }
+        last_cmp_block = builder.GetInsertBlock();
         // Now we simply branch according to the result, either to the next block or to the merge block. To which block we branch, again,
         // depends on the 'or' or 'and' operation. The 'and' operation just means that we have gone through all blocks successfully
         if (is_or_cmp) {
@@ -5387,7 +5369,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_set_cmp(
     // The result is either true or false, depending from which block we come from
     builder.SetInsertPoint(merge);
     llvm::PHINode *phi_node = builder.CreatePHI(builder.getInt1Ty(), group_value.size(), "set_cmp_result");
-    phi_node->addIncoming(builder.getInt1(!is_or_cmp), blocks[blocks.size() - 2]);
+    phi_node->addIncoming(builder.getInt1(!is_or_cmp), last_cmp_block);
     phi_node->addIncoming(builder.getInt1(is_or_cmp), blocks.back());
     return phi_node;
 }
@@ -5423,7 +5405,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
     llvm::Value *rhs                                                           //
 ) {
     const auto &check_for_string_lit_garbage = [lhs, rhs, bin_op_node, &garbage, expr_depth]() {
-        if (bin_op_node->left->type->to_string() == "str") {
+        if (bin_op_node->left->type->is(Type::Builtin::STR)) {
             const bool left_is_literal =                                                       //
                 bin_op_node->left->get_variation() == ExpressionNode::Variation::LITERAL       //
                 || (bin_op_node->left->get_variation() == ExpressionNode::Variation::TYPE_CAST //
@@ -5437,7 +5419,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 }
             }
         }
-        if (bin_op_node->right->type->to_string() == "str") {
+        if (bin_op_node->right->type->is(Type::Builtin::STR)) {
             const bool right_is_literal =                                                       //
                 bin_op_node->right->get_variation() == ExpressionNode::Variation::LITERAL       //
                 || (bin_op_node->right->get_variation() == ExpressionNode::Variation::TYPE_CAST //
@@ -5463,7 +5445,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
             if (type_str == "u8" || type_str == "u16" || type_str == "u32" || type_str == "u64"    //
                 || type_str == "i8" || type_str == "i16" || type_str == "i32" || type_str == "i64" //
             ) {
-                return builder.CreateCall(Module::Arithmetic::arithmetic_functions.at(type_str + "_safe_add"), {lhs, rhs}, "safe_add_res");
+                return Module::Arithmetic::generate_inline_safe_op(builder, TOK_PLUS, type_str, lhs, rhs);
             } else if (type_str == "f32" || type_str == "f64") {
                 return builder.CreateFAdd(lhs, rhs, "faddtmp");
             } else if (type_str == "flint") {
@@ -5487,7 +5469,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
             if (type_str == "u8" || type_str == "u16" || type_str == "u32" || type_str == "u64"    //
                 || type_str == "i8" || type_str == "i16" || type_str == "i32" || type_str == "i64" //
             ) {
-                return builder.CreateCall(Module::Arithmetic::arithmetic_functions.at(type_str + "_safe_sub"), {lhs, rhs}, "safe_sub_res");
+                return Module::Arithmetic::generate_inline_safe_op(builder, TOK_MINUS, type_str, lhs, rhs);
             } else if (type_str == "f32" || type_str == "f64") {
                 return builder.CreateFSub(lhs, rhs, "fsubtmp");
             } else if (type_str == "flint") {
@@ -5502,7 +5484,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
             if (type_str == "u8" || type_str == "u16" || type_str == "u32" || type_str == "u64"    //
                 || type_str == "i8" || type_str == "i16" || type_str == "i32" || type_str == "i64" //
             ) {
-                return builder.CreateCall(Module::Arithmetic::arithmetic_functions.at(type_str + "_safe_mul"), {lhs, rhs}, "safe_mul_res");
+                return Module::Arithmetic::generate_inline_safe_op(builder, TOK_MULT, type_str, lhs, rhs);
             } else if (type_str == "f32" || type_str == "f64") {
                 return builder.CreateFMul(lhs, rhs, "fmultmp");
             } else if (type_str == "flint") {
@@ -5559,7 +5541,6 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 THROW_BASIC_ERR(ERR_NOT_IMPLEMENTED_YET);
                 return std::nullopt;
             } else if (type_str == "str") {
-                check_for_string_lit_garbage();
                 return Logical::generate_string_cmp_lt(builder, lhs, bin_op_node->left, rhs, bin_op_node->right);
             }
             break;
@@ -5574,7 +5555,6 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 THROW_BASIC_ERR(ERR_NOT_IMPLEMENTED_YET);
                 return std::nullopt;
             } else if (type_str == "str") {
-                check_for_string_lit_garbage();
                 return Logical::generate_string_cmp_gt(builder, lhs, bin_op_node->left, rhs, bin_op_node->right);
             }
             break;
@@ -5589,7 +5569,6 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 THROW_BASIC_ERR(ERR_NOT_IMPLEMENTED_YET);
                 return std::nullopt;
             } else if (type_str == "str") {
-                check_for_string_lit_garbage();
                 return Logical::generate_string_cmp_le(builder, lhs, bin_op_node->left, rhs, bin_op_node->right);
             }
             break;
@@ -5604,7 +5583,6 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 THROW_BASIC_ERR(ERR_NOT_IMPLEMENTED_YET);
                 return std::nullopt;
             } else if (type_str == "str") {
-                check_for_string_lit_garbage();
                 return Logical::generate_string_cmp_ge(builder, lhs, bin_op_node->left, rhs, bin_op_node->right);
             }
             break;
@@ -5621,7 +5599,6 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 THROW_BASIC_ERR(ERR_NOT_IMPLEMENTED_YET);
                 return std::nullopt;
             } else if (type_str == "str") {
-                check_for_string_lit_garbage();
                 return Logical::generate_string_cmp_eq(builder, lhs, bin_op_node->left, rhs, bin_op_node->right);
             }
             switch (bin_op_node->left->type->get_variation()) {
@@ -5833,12 +5810,14 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_scalar( /
                 return std::nullopt;
             }
             rhs = rhs_value.value().front();
+            // Generating the rhs may have split the catch block, e.g. for checked arithmetic
+            llvm::BasicBlock *const catch_expr_end_block = builder.GetInsertBlock();
             builder.CreateBr(catch_expr_merge_block);
 
             builder.SetInsertPoint(catch_expr_merge_block);
             llvm::PHINode *expr_result = builder.CreatePHI(lhs->getType(), 2, "catch_expr_result");
             expr_result->addIncoming(lhs, current_block);
-            expr_result->addIncoming(rhs, catch_expr_block);
+            expr_result->addIncoming(rhs, catch_expr_end_block);
             return expr_result;
         }
         case TOK_AND:
@@ -5862,14 +5841,14 @@ std::optional<llvm::Value *> Generator::Expression::generate_optional_cmp( //
     const bool eq                                                          //
 ) {
     // If both sides are the 'none' literal, we can return a constant as the result directly
-    if (lhs_expr->type->to_string() == "void?" && rhs_expr->type->to_string() == "void?") {
+    if (lhs_expr->type->is(Type::Builtin::VOID_OPT) && rhs_expr->type->is(Type::Builtin::VOID_OPT)) {
         return builder.getInt1(eq ? 1 : 0);
     }
     // First, we check if one of the sides is a TypeCast Node, and if one side is a TypeCast we can check if the base type
     // is of type `void?`, indicating that we check if one side is the 'none' literal.
     if (lhs_expr->get_variation() == ExpressionNode::Variation::TYPE_CAST) {
         const auto *lhs_type_cast = lhs_expr->as<TypeCastNode>();
-        if (lhs_type_cast->expr->type->to_string() == "void?") {
+        if (lhs_type_cast->expr->type->is(Type::Builtin::VOID_OPT)) {
             // We can just extract the first bit of the rhs and return it's (negated) value directly
             if (lhs->getType()->isPointerTy()) {
                 // The optional is a function argument
@@ -5887,7 +5866,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_optional_cmp( //
     }
     if (rhs_expr->get_variation() == ExpressionNode::Variation::TYPE_CAST) {
         const auto *rhs_type_cast = rhs_expr->as<TypeCastNode>();
-        if (rhs_type_cast->expr->type->to_string() == "void?") {
+        if (rhs_type_cast->expr->type->is(Type::Builtin::VOID_OPT)) {
             // We can just extract the first bit of the rhs and return it's (negated) value directly
             if (lhs->getType()->isPointerTy()) {
                 // The optional is a function argument
@@ -5971,13 +5950,14 @@ std::optional<llvm::Value *> Generator::Expression::generate_optional_cmp( //
         THROW_BASIC_ERR(ERR_GENERATING);
         return std::nullopt;
     }
+    llvm::BasicBlock *const both_value_end_block = builder.GetInsertBlock();
     builder.CreateBr(merge_block);
 
     // In the merge block we check from which block we come and choose the boolean value to use accordingly through phi nodes
     builder.SetInsertPoint(merge_block);
     llvm::PHINode *selected_value = builder.CreatePHI(builder.getInt1Ty(), 2, "result");
     selected_value->addIncoming(both_empty, one_no_value_block);
-    selected_value->addIncoming(result_value.value(), both_value_block);
+    selected_value->addIncoming(result_value.value(), both_value_end_block);
     return selected_value;
 }
 
@@ -6032,7 +6012,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_variant_cmp( //
     for (auto type_it = possible_types.begin(); type_it != possible_types.end(); ++type_it) {
         const unsigned int idx = std::distance(possible_types.begin(), type_it);
         builder.SetInsertPoint(type_switch_blocks.at(idx));
-        if (type_it->second->to_string() == "void") {
+        if (type_it->second->is(Type::Builtin::VOID)) {
             switch_values.push_back(builder.getInt64(0));
             builder.CreateBr(switch_merge);
             continue;
@@ -6089,7 +6069,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_vector( /
                 THROW_BASIC_ERR(ERR_GENERATING);
                 return std::nullopt;
             }
-            return builder.CreateCall(Module::Arithmetic::arithmetic_functions.at(type_str + "_safe_add"), {lhs, rhs}, "safe_add_res");
+            return Module::Arithmetic::generate_inline_safe_op(builder, TOK_PLUS, type_str, lhs, rhs);
             break;
         case TOK_MINUS:
             if (is_float) {
@@ -6102,7 +6082,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_vector( /
                 THROW_BASIC_ERR(ERR_GENERATING);
                 return std::nullopt;
             }
-            return builder.CreateCall(Module::Arithmetic::arithmetic_functions.at(type_str + "_safe_sub"), {lhs, rhs}, "safe_sub_res");
+            return Module::Arithmetic::generate_inline_safe_op(builder, TOK_MINUS, type_str, lhs, rhs);
             break;
         case TOK_MULT:
             if (is_float) {
@@ -6115,7 +6095,7 @@ std::optional<llvm::Value *> Generator::Expression::generate_binary_op_vector( /
                 THROW_BASIC_ERR(ERR_GENERATING);
                 return std::nullopt;
             }
-            return builder.CreateCall(Module::Arithmetic::arithmetic_functions.at(type_str + "_safe_mul"), {lhs, rhs}, "safe_mul_res");
+            return Module::Arithmetic::generate_inline_safe_op(builder, TOK_MULT, type_str, lhs, rhs);
             break;
         case TOK_DIV:
             if (is_float) {
@@ -140,16 +140,16 @@ bool Generator::Function::generate_function_setup(llvm::Module *module, const Fu
     }
 
     // Create all the functions allocations (declarations, etc.) at the beginning, before the actual function body
-    // The key is a combination of the scope id and the variable name, e.g. 1::var1, 2::var2
+    // Variables are keyed by their slot, index arrays by their length and all other allocations by their name, e.g. flint.stack.root
     // Because of the thread stack, these "allocations" are now fixed pointer offsets (GEPs) into the function structure, nothing more and
     // nothing less
-    std::unordered_map<std::string, llvm::Value *const> allocations;
+    AllocationMap allocations;
     // Inject all global variables into the allocations map
     for (const auto &var : function_node->scope.value()->variables) {
         if (!var.second.is_global) {
             continue;
         }
-        allocations.emplace("s0::" + var.first, shared_globals.at(var.first));
+        allocations.set_variable(var.second.slot, shared_globals.at(var.first));
     }
     const auto fn_ty = Allocation::generate_function_allocations(builder, function, function_node, allocations);
     if (!fn_ty.has_value()) {
@@ -281,13 +281,13 @@ std::optional<llvm::Function *> Generator::Function::generate_test_function(
         fake_fn_scope,                   //
         fake_fn_mangle_id                //
     );
-    std::unordered_map<std::string, llvm::Value *const> allocations;
+    AllocationMap allocations;
     // Inject all global variables into the allocations map
     for (const auto &var : test_node->scope->variables) {
         if (!var.second.is_global) {
             continue;
         }
-        allocations.emplace("s0::" + var.first, shared_globals.at(var.first));
+        allocations.set_variable(var.second.slot, shared_globals.at(var.first));
     }
     const auto fn_ty = Allocation::generate_function_allocations(builder, test_function, &fake_fn, allocations);
     if (!fn_ty.has_value()) {
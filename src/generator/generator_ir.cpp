@@ -149,6 +149,67 @@ llvm::MDNode *Generator::IR::generate_weights(unsigned int true_weight, unsigned
         });
 }
 
+void Generator::IR::generate_cold_crash( //
+    llvm::IRBuilder<> &builder,          //
+    llvm::Module *module,                //
+    const std::string &name,             //
+    const std::string &message           //
+) {
+    const std::string crash_fn_name = "flint.cold." + name;
+    llvm::Function *crash_fn = module->getFunction(crash_fn_name);
+    if (crash_fn == nullptr) {
+        llvm::FunctionType *crash_type = llvm::FunctionType::get(llvm::Type::getVoidTy(context), false);
+        crash_fn = llvm::Function::Create(crash_type, llvm::Function::InternalLinkage, crash_fn_name, module);
+        crash_fn->addFnAttr(llvm::Attribute::Cold);
+        crash_fn->addFnAttr(llvm::Attribute::NoInline);
+        crash_fn->addFnAttr(llvm::Attribute::NoReturn);
+        crash_fn->addFnAttr(llvm::Attribute::NoUnwind);
+
+        // The crash function gets its own builder to not disturb the insertion point of the hot function
+        llvm::IRBuilder<> crash_builder(llvm::BasicBlock::Create(context, "entry", crash_fn));
+        llvm::Value *crash_message = generate_const_string(module, message);
+        crash_builder.CreateCall(c_functions.at(PRINTF), {crash_message});
+        crash_builder.CreateCall(c_functions.at(ABORT), {});
+        crash_builder.CreateUnreachable();
+    }
+    llvm::CallInst *crash_call = builder.CreateCall(crash_fn, {});
+    crash_call->setDoesNotReturn();
+    builder.CreateUnreachable();
+}
+
+llvm::CallInst *Generator::IR::generate_cold_rethrow( //
+    llvm::IRBuilder<> &builder,                       //
+    llvm::Module *module,                             //
+    llvm::Value *callee_frame,                        //
+    llvm::Value *current_frame                        //
+) {
+    // THE C IMPLEMENTATION:
+    // void rethrow(ts_function *callee_frame, ts_function *current_frame) {
+    //     current_frame->err = callee_frame->err;
+    // }
+    llvm::Function *rethrow_fn = module->getFunction("flint.cold.rethrow");
+    if (rethrow_fn == nullptr) {
+        llvm::FunctionType *rethrow_type = llvm::FunctionType::get(llvm::Type::getVoidTy(context), {PTR_TY, PTR_TY}, false);
+        rethrow_fn = llvm::Function::Create(rethrow_type, llvm::Function::InternalLinkage, "flint.cold.rethrow", module);
+        rethrow_fn->addFnAttr(llvm::Attribute::Cold);
+        rethrow_fn->addFnAttr(llvm::Attribute::NoInline);
+        rethrow_fn->addFnAttr(llvm::Attribute::NoUnwind);
+        llvm::Argument *arg_callee_frame = rethrow_fn->arg_begin();
+        arg_callee_frame->setName("callee_frame");
+        llvm::Argument *arg_current_frame = rethrow_fn->arg_begin() + 1;
+        arg_current_frame->setName("current_frame");
+
+        llvm::IRBuilder<> rethrow_builder(llvm::BasicBlock::Create(context, "entry", rethrow_fn));
+        llvm::StructType *ts_fn_type = type_map.at("type.ts.function");
+        llvm::Value *callee_err_ptr = rethrow_builder.CreateStructGEP(ts_fn_type, arg_callee_frame, Module::ThreadStack::FUNCTION::ERR);
+        llvm::Value *err_val = aligned_load(rethrow_builder, type_map.at("type.flint.err"), callee_err_ptr, "err_val");
+        llvm::Value *current_err_ptr = rethrow_builder.CreateStructGEP(ts_fn_type, arg_current_frame, Module::ThreadStack::FUNCTION::ERR);
+        aligned_store(rethrow_builder, err_val, current_err_ptr);
+        rethrow_builder.CreateRetVoid();
+    }
+    return builder.CreateCall(rethrow_fn, {callee_frame, current_frame});
+}
+
 void Generator::IR::generate_forward_declarations(llvm::Module *module, const FileNode &file_node) {
     file_function_names[file_node.file_name] = {};
     for (const std::unique_ptr<DefinitionNode> &node : file_node.file_namespace->public_symbols.definitions) {
@@ -170,248 +231,162 @@ void Generator::IR::generate_forward_declarations(llvm::Module *module, const Fi
     }
 }
 
-void Generator::IR::generate_object_dispatch_functions(llvm::Module *module) {
-    llvm::FunctionType *const dispatch_fn_type = llvm::FunctionType::get( //
-        PTR_TY,                                                           // ptr to argument start or whether an error happened
+std::pair<llvm::Function *, llvm::Function *> Generator::IR::generate_vtable_entry( //
+    llvm::Module *module,                                                          //
+    const ObjectNode *object,                                                      //
+    const FuncNode *func,                                                          //
+    const FunctionNode *function_node                                              //
+) {
+    llvm::FunctionType *const entry_fn_type = llvm::FunctionType::get( //
+        PTR_TY,                                                        // ptr to argument start or whether an error happened
         {
-            PTR_TY,                          // ptr inreg stack
-            PTR_TY,                          // ptr object
-            llvm::Type::getInt64Ty(context), // u64 fn_id
-            llvm::Type::getInt1Ty(context)   // bool is_setup
-        },                                   //
-        false                                //
+            PTR_TY, // ptr inreg stack
+            PTR_TY  // ptr object
+        },          //
+        false       //
     );
-
-    for (const ObjectNode *object : Parser::get_all_objects()) {
-        if (object->interfaces.empty()) {
-            // Only objects implementing any interfaces need a dispatch function
-            continue;
-        }
-        const std::string dispatch_fn_name = object->file_hash.to_string() + "." + object->name + ".dispatch";
-        llvm::Function *const dispatch_fn = llvm::Function::Create(                     //
-            dispatch_fn_type, llvm::Function::ExternalLinkage, dispatch_fn_name, module //
-        );
-
-        llvm::Argument *const arg_stack = dispatch_fn->args().begin();
-        arg_stack->setName("stack");
+    const size_t fn_id = function_node->get_id();
+    const std::string object_name = object->file_hash.to_string() + "." + object->name;
+    const std::string entry_name = object_name + "." + function_node->name + "." + std::to_string(fn_id);
+    llvm::Function *const setup_fn = llvm::Function::Create(                          //
+        entry_fn_type, llvm::Function::InternalLinkage, entry_name + ".setup", module //
+    );
+    llvm::Function *const execute_fn = llvm::Function::Create(                          //
+        entry_fn_type, llvm::Function::InternalLinkage, entry_name + ".execute", module //
+    );
+    for (llvm::Function *const entry_fn : {setup_fn, execute_fn}) {
+        entry_fn->getArg(0)->setName("stack");
+        entry_fn->getArg(1)->setName("object");
         if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
 #ifndef __WIN32__
-            arg_stack->addAttr(llvm::Attribute::InReg);
-            dispatch_fn->setCallingConv(llvm::CallingConv::Tail);
+            entry_fn->getArg(0)->addAttr(llvm::Attribute::InReg);
+            entry_fn->setCallingConv(llvm::CallingConv::Tail);
 #endif
         }
+    }
+    llvm::StructType *const called_fn_frame_ty = Module::ThreadStack::ts_frames.at(fn_id);
 
-        llvm::Argument *const arg_object = dispatch_fn->args().begin() + 1;
-        arg_object->setName("object");
-
-        llvm::Argument *const arg_fn_id = dispatch_fn->args().begin() + 2;
-        arg_fn_id->setName("fn_id");
-
-        llvm::Argument *const arg_is_setup = dispatch_fn->args().begin() + 3;
-        arg_is_setup->setName("is_setup");
-
-        // We need a switch instructions with as many branches as functions defined across all functions of the object
-        llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", dispatch_fn);
-        llvm::BasicBlock *const setup_entry_block = llvm::BasicBlock::Create(context, "setup_entry", dispatch_fn);
-        llvm::BasicBlock *const execute_entry_block = llvm::BasicBlock::Create(context, "execute_entry", dispatch_fn);
-        llvm::BasicBlock *const default_block = llvm::BasicBlock::Create(context, "default", dispatch_fn);
-
-        llvm::IRBuilder<> builder(entry_block);
-        builder.CreateCondBr(arg_is_setup, setup_entry_block, execute_entry_block);
-
-        builder.SetInsertPoint(setup_entry_block);
-        llvm::SwitchInst *const setup_switch = builder.CreateSwitch(arg_fn_id, default_block);
-        builder.SetInsertPoint(execute_entry_block);
-        llvm::SwitchInst *const execute_switch = builder.CreateSwitch(arg_fn_id, default_block);
+    // The setup function stores the default function frame in the TS and returns the pointer to the argument start. Func component
+    // functions get the required data of the object as their implicit parameters, object functions get the object itself
+    llvm::IRBuilder<> builder(llvm::BasicBlock::Create(context, "entry", setup_fn));
+    llvm::Argument *arg_stack = setup_fn->getArg(0);
+    llvm::GlobalVariable *const default_frame = Module::ThreadStack::ts_defaults.at(fn_id);
+    llvm::Value *const loaded_default = IR::aligned_load(builder, called_fn_frame_ty, default_frame, "default_frame");
+    IR::aligned_store(builder, loaded_default, arg_stack);
+    const uint32_t implicit_count = func == nullptr ? 1 : func->required_data.size();
+    const uint32_t field_id = 1 + function_node->return_types.size() + implicit_count;
+    const uint32_t safe_field_id = std::min(field_id, called_fn_frame_ty->getNumElements() - 1);
+    llvm::Value *const arg_start_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, safe_field_id, "arg_start_ptr");
+    builder.CreateRet(arg_start_ptr);
 
-        // Generate all basic block targets
-        std::unordered_map<const FunctionNode *, std::pair<llvm::BasicBlock *, llvm::BasicBlock *>> branches;
-        for (const FuncNode *func : object->func_components) {
-            for (const FunctionNode *function_node : func->functions) {
-                std::string branch_name = "_case_" + function_node->name;
-                for (size_t i = func->required_data.size(); i < function_node->parameters.size(); i++) {
-                    if (i == func->required_data.size()) {
-                        branch_name += "_";
-                    }
-                    branch_name += "_" + function_node->parameters.at(i).type->to_string();
-                }
-                llvm::BasicBlock *const setup_block = llvm::BasicBlock::Create(context, "setup" + branch_name, dispatch_fn);
-                llvm::BasicBlock *const execute_block = llvm::BasicBlock::Create(context, "execute" + branch_name, dispatch_fn);
-                branches[function_node] = {setup_block, execute_block};
-            }
-        }
-        for (const FunctionNode *function_node : object->functions) {
-            std::string branch_name = "_case_" + function_node->name;
-            for (size_t i = 1; i < function_node->parameters.size(); i++) {
-                if (i == 1) {
-                    branch_name += "_";
-                }
-                branch_name += "_" + function_node->parameters.at(i).type->to_string();
-            }
-            llvm::BasicBlock *const setup_block = llvm::BasicBlock::Create(context, "setup" + branch_name, dispatch_fn);
-            llvm::BasicBlock *const execute_block = llvm::BasicBlock::Create(context, "execute" + branch_name, dispatch_fn);
-            branches[function_node] = {setup_block, execute_block};
-        }
+    // The execute function stores the implicit parameters in the frame and calls the linked-to function
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", execute_fn));
+    arg_stack = execute_fn->getArg(0);
+    llvm::Argument *const arg_object = execute_fn->getArg(1);
+    std::string function_name = function_node->file_hash.to_string() + "." + function_node->name;
+    if (function_node->mangle_id.has_value()) {
+        ASSERT(!function_node->is_extern);
+        function_name += "." + std::to_string(function_node->mangle_id.value());
+    }
+    llvm::Function *const function = module->getFunction(function_name);
+    ASSERT(function != nullptr);
 
-        // Let all interface functions branch to their respective destination blocks
-        for (const auto &interface : object->interfaces) {
-            for (const auto &[src, dest] : interface.mapping) {
-                std::string branch_name = "_case_" + dest->name;
-                for (size_t i = 1; i < dest->parameters.size(); i++) {
-                    if (i == 1) {
-                        branch_name += "_";
-                    }
-                    branch_name += "_" + dest->parameters.at(i).type->to_string();
+    std::vector<std::pair<llvm::Value *, llvm::Value *>> data_ptr_pairs;
+    if (func == nullptr) {
+        // Store the object value in the called object-function
+        const size_t arg_ptr_id = 1 + function_node->return_types.size();
+        llvm::Value *const arg_self_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, arg_ptr_id, "arg_self_ptr");
+        IR::aligned_store(builder, arg_object, arg_self_ptr);
+    } else {
+        // Store the data values of the object inside the implicit parameters of the targetted function
+        for (size_t i = 0; i < func->required_data.size(); i++) {
+            const auto &required_data = func->required_data.at(i);
+            size_t data_id = 0;
+            for (; data_id < object->data_modules.size(); data_id++) {
+                // Since data nodes are generated as unique pointers, the raw pointers can be compared directly
+                if (object->data_modules.at(data_id).first == required_data.type->as<DataType>()->data_node) {
+                    break;
                 }
-                setup_switch->addCase(builder.getInt64(src->get_id()), branches.at(dest).first);
-                execute_switch->addCase(builder.getInt64(src->get_id()), branches.at(dest).second);
             }
+            // The required data definitely should be part of the object, otherwise the parser would have crashed
+            ASSERT(data_id != object->data_modules.size());
+            // Load the data pointer from the passed-in object
+            llvm::Value *const data_ptr_ptr = builder.CreateGEP(PTR_TY, arg_object, builder.getInt32(data_id), "data_ptr_ptr");
+            llvm::Value *const data_ptr = IR::aligned_load(builder, PTR_TY, data_ptr_ptr, "data_ptr_" + std::to_string(i));
+            const std::string arg_ptr_str = "arg_" + std::to_string(i) + "_ptr";
+            const size_t arg_ptr_id = 1 + function_node->return_types.size() + i;
+            llvm::Value *const fn_frame_arg_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, arg_ptr_id, arg_ptr_str);
+            IR::aligned_store(builder, data_ptr, fn_frame_arg_ptr);
+            data_ptr_pairs.emplace_back(data_ptr_ptr, fn_frame_arg_ptr);
         }
+    }
 
-        // Generate all the bodies of the basic blocks, being the setups of the frames & returning the pointer to the argument start
-        for (const FuncNode *func : object->func_components) {
-            for (const FunctionNode *function_node : func->functions) {
-                const size_t fn_id = function_node->get_id();
-                setup_switch->addCase(builder.getInt64(fn_id), branches.at(function_node).first);
-                builder.SetInsertPoint(branches.at(function_node).first);
+    // Now that the implicit parameters are stored in the function frame, we can call the targetted function
+    llvm::CallInst *const call_err = builder.CreateCall(function, {arg_stack}, "call_err");
+#ifndef __WIN32__
+    call_err->addParamAttr(0, llvm::Attribute::InReg);
+    if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
+        call_err->setCallingConv(llvm::CallingConv::Tail);
+        call_err->setTailCall();
+    }
+#endif
 
-                // Store the default function frame in the TS
-                llvm::StructType *const called_fn_frame_ty = Module::ThreadStack::ts_frames.at(fn_id);
-                llvm::GlobalVariable *const default_frame = Module::ThreadStack::ts_defaults.at(fn_id);
-                llvm::Value *const loaded_default = IR::aligned_load(builder, called_fn_frame_ty, default_frame, "default_frame");
-                IR::aligned_store(builder, loaded_default, arg_stack);
-                const uint32_t field_id = 1 + function_node->return_types.size() + func->required_data.size();
-                const uint32_t safe_field_id = std::min(field_id, called_fn_frame_ty->getNumElements() - 1);
-                llvm::Value *const arg_start_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, safe_field_id, "arg_start_ptr");
-                builder.CreateRet(arg_start_ptr);
-            }
-        }
-        // Generate all the bodies of the basic blocks, being the setups of the frames & returning the pointer to the argument start
-        for (const FunctionNode *function_node : object->functions) {
-            const size_t fn_id = function_node->get_id();
-            ASSERT(branches.find(function_node) != branches.end());
-            setup_switch->addCase(builder.getInt64(fn_id), branches.at(function_node).first);
-            builder.SetInsertPoint(branches.at(function_node).first);
+    // Store back the data values of the function frame to the object if the local data has been overwritten
+    for (const auto &[object_data, fn_frame_data] : data_ptr_pairs) {
+        llvm::Value *const new_data = IR::aligned_load(builder, PTR_TY, fn_frame_data, "new_data");
+        IR::aligned_store(builder, new_data, object_data);
+    }
+    // We return "garbage" in the case of error, nullpointer if no error happened. This return value of the execute function should
+    // *never* be read other than for checking whether an error happened
+    llvm::Value *const err_ptr = builder.CreateSelect(call_err, arg_stack, llvm::ConstantPointerNull::get(PTR_TY), "err_ptr");
+    builder.CreateRet(err_ptr);
+    return {setup_fn, execute_fn};
+}
 
-            // Store the default function frame in the TS
-            llvm::StructType *const called_fn_frame_ty = Module::ThreadStack::ts_frames.at(fn_id);
-            llvm::GlobalVariable *const default_frame = Module::ThreadStack::ts_defaults.at(fn_id);
-            llvm::Value *const loaded_default = IR::aligned_load(builder, called_fn_frame_ty, default_frame, "default_frame");
-            IR::aligned_store(builder, loaded_default, arg_stack);
-            const uint32_t field_id = 1 + function_node->return_types.size() + 1;
-            const uint32_t safe_field_id = std::min(field_id, called_fn_frame_ty->getNumElements() - 1);
-            llvm::Value *const arg_start_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, safe_field_id, "arg_start_ptr");
-            builder.CreateRet(arg_start_ptr);
+void Generator::IR::generate_object_vtables(llvm::Module *module) {
+    for (const ObjectNode *object : Parser::get_all_objects()) {
+        if (object->interfaces.empty()) {
+            // Only objects implementing any interfaces need vtables
+            continue;
         }
-
-        // Generate all the bodies of the basic blocks, being the calls to the linked-to functions
+        // Find out which func component every function of the object belongs to, object functions belong to no func component
+        std::unordered_map<const FunctionNode *, const FuncNode *> function_owners;
         for (const FuncNode *func : object->func_components) {
             for (const FunctionNode *function_node : func->functions) {
-                const size_t fn_id = function_node->get_id();
-                execute_switch->addCase(builder.getInt64(fn_id), branches.at(function_node).second);
-                builder.SetInsertPoint(branches.at(function_node).second);
-                std::string function_name = function_node->file_hash.to_string() + "." + function_node->name;
-                if (function_node->mangle_id.has_value()) {
-                    ASSERT(!function_node->is_extern);
-                    function_name += "." + std::to_string(function_node->mangle_id.value());
-                }
-                llvm::Function *const function = module->getFunction(function_name);
-                ASSERT(function != nullptr);
-
-                // Store the data values of the object inside the implicit parameters of the targetted function
-                llvm::StructType *const called_fn_frame_ty = Module::ThreadStack::ts_frames.at(fn_id);
-                std::vector<std::pair<llvm::Value *, llvm::Value *>> data_ptr_pairs;
-                for (size_t i = 0; i < func->required_data.size(); i++) {
-                    const auto &required_data = func->required_data.at(i);
-                    size_t data_id = 0;
-                    for (; data_id < object->data_modules.size(); data_id++) {
-                        // Since data nodes are generated as unique pointers, the raw pointers can be compared directly
-                        if (object->data_modules.at(data_id).first == required_data.type->as<DataType>()->data_node) {
-                            break;
-                        }
-                    }
-                    // The required data definitely should be part of the object, otherwise the parser would have crashed
-                    ASSERT(data_id != object->data_modules.size());
-                    // Load the data pointer from the passed-in object
-                    llvm::Value *const data_ptr_ptr = builder.CreateGEP(PTR_TY, arg_object, builder.getInt32(data_id), "data_ptr_ptr");
-                    llvm::Value *const data_ptr = IR::aligned_load(builder, PTR_TY, data_ptr_ptr, "data_ptr_" + std::to_string(i));
-                    const std::string arg_ptr_str = "arg_" + std::to_string(i) + "_ptr";
-                    const size_t arg_ptr_id = 1 + function_node->return_types.size() + i;
-                    llvm::Value *const fn_frame_arg_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, arg_ptr_id, arg_ptr_str);
-                    IR::aligned_store(builder, data_ptr, fn_frame_arg_ptr);
-                    data_ptr_pairs.emplace_back(data_ptr_ptr, fn_frame_arg_ptr);
-                }
-
-                // Now that the required data is stored in the function frame, we can call the targetted function
-                llvm::CallInst *const call_err = builder.CreateCall(function, {arg_stack}, "call_err");
-#ifndef __WIN32__
-                call_err->addParamAttr(0, llvm::Attribute::InReg);
-                if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
-                    call_err->setCallingConv(llvm::CallingConv::Tail);
-                    call_err->setTailCall();
-                }
-#endif
-
-                // Store back the data values of the function frame to the object if the local data has been overwritten
-                for (const auto &[object_data, fn_frame_data] : data_ptr_pairs) {
-                    llvm::Value *const new_data = IR::aligned_load(builder, PTR_TY, fn_frame_data, "new_data");
-                    IR::aligned_store(builder, new_data, object_data);
-                }
-                // We return "garbage" in the case of error, nullpointer if no error happened. This return value of the dispatch function
-                // should *never* be read when calling the dispatch function in execute mode
-                llvm::Value *const err_ptr = builder.CreateSelect(call_err, arg_stack, llvm::ConstantPointerNull::get(PTR_TY), "err_ptr");
-                builder.CreateRet(err_ptr);
+                function_owners[function_node] = func;
             }
         }
-        // Generate all the bodies of the object branches
         for (const FunctionNode *function_node : object->functions) {
-            const size_t fn_id = function_node->get_id();
-            ASSERT(branches.find(function_node) != branches.end());
-            execute_switch->addCase(builder.getInt64(fn_id), branches.at(function_node).second);
-            builder.SetInsertPoint(branches.at(function_node).second);
-            std::string function_name = function_node->file_hash.to_string() + "." + function_node->name;
-            if (function_node->mangle_id.has_value()) {
-                ASSERT(!function_node->is_extern);
-                function_name += "." + std::to_string(function_node->mangle_id.value());
-            }
-            llvm::Function *const function = module->getFunction(function_name);
-            ASSERT(function != nullptr);
-
-            // Store the object value in the called object-function
-            // Store the data values of the object inside the implicit parameters of the targetted function
-            llvm::StructType *const called_fn_frame_ty = Module::ThreadStack::ts_frames.at(fn_id);
-            const std::string arg_ptr_str = "arg_self_ptr";
-            const size_t arg_ptr_id = 1 + function_node->return_types.size();
-            llvm::Value *const arg_self_ptr = builder.CreateStructGEP(called_fn_frame_ty, arg_stack, arg_ptr_id, "arg_self_ptr");
-            IR::aligned_store(builder, arg_object, arg_self_ptr);
-
-            // Now that the object is stored in the function frame, we can call the function
-            llvm::CallInst *const call_err = builder.CreateCall(function, {arg_stack}, "call_err");
-#ifndef __WIN32__
-            call_err->addParamAttr(0, llvm::Attribute::InReg);
-            if (OPTIMIZE_MODE != OptimizeMode::DEBUG) {
-                call_err->setCallingConv(llvm::CallingConv::Tail);
-                call_err->setTailCall();
-            }
-#endif
-
-            // We return "garbage" in the case of error, nullpointer if no error happened. This return value of the dispatch function
-            // should *never* be read when calling the dispatch function in execute mode
-            llvm::Value *const err_ptr = builder.CreateSelect(call_err, arg_stack, llvm::ConstantPointerNull::get(PTR_TY), "err_ptr");
-            builder.CreateRet(err_ptr);
+            function_owners[function_node] = nullptr;
         }
 
-        // The default block is an error block since that type ID should not be possible
-        builder.SetInsertPoint(default_block);
-        llvm::Value *dispatch_err_msg = IR::generate_const_string(module, "Error: Unknown function ID in dispatch: %lu\n");
-        builder.CreateCall(c_functions.at(PRINTF), {dispatch_err_msg, arg_fn_id});
-        builder.CreateCall(c_functions.at(ABORT), {});
-        builder.CreateUnreachable();
-
+        // A function linked to by multiple interfaces only gets its setup and execute functions once
+        std::unordered_map<const FunctionNode *, std::pair<llvm::Function *, llvm::Function *>> entries;
         // It is safe to cast away the const here using `const_cast` since the lifetime of the object type is *very* short
         const uint32_t object_type_id = std::make_shared<ObjectType>(const_cast<ObjectNode *const>(object))->get_id();
-        ASSERT(object_dispatch_functions.find(object_type_id) == object_dispatch_functions.end());
-        object_dispatch_functions[object_type_id] = dispatch_fn;
+        for (const auto &interface : object->interfaces) {
+            // The vtable contains the setup and execute function of every interface function, in the order the interface defines them
+            const InterfaceNode *interface_node = interface.type->as<InterfaceType>()->interface_node;
+            std::vector<llvm::Constant *> slots;
+            for (FunctionNode *const interface_function : interface_node->functions) {
+                const FunctionNode *target = interface.mapping.at(interface_function);
+                if (entries.find(target) == entries.end()) {
+                    ASSERT(function_owners.find(target) != function_owners.end());
+                    entries[target] = generate_vtable_entry(module, object, function_owners.at(target), target);
+                }
+                slots.emplace_back(entries.at(target).first);
+                slots.emplace_back(entries.at(target).second);
+            }
+            llvm::ArrayType *const vtable_type = llvm::ArrayType::get(PTR_TY, slots.size());
+            const std::string vtable_name = object->file_hash.to_string() + "." + object->name + ".vtable." + interface_node->name;
+            llvm::GlobalVariable *const vtable = new llvm::GlobalVariable(      //
+                *module, vtable_type, true, llvm::GlobalValue::InternalLinkage, //
+                llvm::ConstantArray::get(vtable_type, slots), vtable_name       //
+            );
+            vtable->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+            ASSERT(object_vtables[object_type_id].find(interface.type->get_id()) == object_vtables[object_type_id].end());
+            object_vtables[object_type_id][interface.type->get_id()] = vtable;
+        }
     }
 }
 
@@ -447,7 +422,7 @@ std::optional<llvm::Type *> Generator::IR::get_extern_type( //
         || type_variation == Type::Variation::GROUP  //
         || type_variation == Type::Variation::VECTOR //
     ) {
-        if (type_variation == Type::Variation::VECTOR && type->to_string() == "bool8") {
+        if (type_variation == Type::Variation::VECTOR && type->is(Type::Builtin::BOOL8)) {
             // The `bool8` type is handled by the normal `get_type` function (it's just an `i8`)
             return std::nullopt;
         }
@@ -897,7 +872,7 @@ Generator::IR::TypeStorageInfo Generator::IR::get_type( //
             // Because an interface can only exist through an object being stored on it, an interface is a rather simple structure
             // contianing of:
             // - A pointer to the object assigned to the interface instance
-            // - A pointer to the object dispatch function to call
+            // - A pointer to the vtable of the object for this interface
             // - A pointer to the objects DIMA head
             std::vector<llvm::Type *> field_types = {PTR_TY, PTR_TY, PTR_TY};
             type_map[type_str] = IR::create_struct_type(type_str, field_types);
@@ -905,7 +880,7 @@ Generator::IR::TypeStorageInfo Generator::IR::get_type( //
         }
         case Type::Variation::VECTOR: {
             const auto *vector_type = type->as<VectorType>();
-            if (type->to_string() == "bool8") {
+            if (type->is(Type::Builtin::BOOL8)) {
                 return {.type = llvm::Type::getInt8Ty(context), .is_complex = false, .is_reference = false, .is_indirect = false};
             }
             llvm::Type *const element_type = get_type(module, vector_type->base_type).type;
@@ -1016,7 +991,7 @@ Generator::IR::TypeStorageInfo Generator::IR::get_type( //
                 if (std::holds_alternative<VariantNode *const>(variant_type->var_or_list)) {
                     const auto &possible_types = std::get<VariantNode *const>(variant_type->var_or_list)->possible_types;
                     for (const auto &[_, variation] : possible_types) {
-                        if (variation->to_string() == "void") {
+                        if (variation->is(Type::Builtin::VOID)) {
                             continue;
                         }
                         llvm::Type *const ty = get_type(module, variation).type;
@@ -1206,15 +1181,42 @@ llvm::Value *Generator::IR::generate_err_value( //
     const unsigned int err_value,               //
     const std::string &err_message              //
 ) {
+    // THE C IMPLEMENTATION:
+    // err create_err(const uint32_t type_id, const uint32_t value_id, const char *message, const size_t message_len) {
+    //     return (err){type_id, value_id, init_str(message, message_len)};
+    // }
     llvm::StructType *err_type = type_map.at("type.flint.err");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-    llvm::Value *err_struct = get_default_value_of_type(err_type);
-    err_struct = builder.CreateInsertValue(err_struct, builder.getInt32(err_id), {0}, "insert_err_type_id");
-    err_struct = builder.CreateInsertValue(err_struct, builder.getInt32(err_value), {1}, "insert_err_value");
+    llvm::Function *create_err_fn = module->getFunction("flint.cold.create_err");
+    if (create_err_fn == nullptr) {
+        llvm::FunctionType *create_err_type = llvm::FunctionType::get( //
+            err_type,                                                  //
+            {
+                llvm::Type::getInt32Ty(context), // u32 type_id
+                llvm::Type::getInt32Ty(context), // u32 value_id
+                PTR_TY,                          // char* message
+                llvm::Type::getInt64Ty(context)  // u64 message_len
+            },                                   //
+            false                                // No vaargs
+        );
+        create_err_fn = llvm::Function::Create(create_err_type, llvm::Function::InternalLinkage, "flint.cold.create_err", module);
+        create_err_fn->addFnAttr(llvm::Attribute::Cold);
+        create_err_fn->addFnAttr(llvm::Attribute::NoInline);
+
+        llvm::IRBuilder<> create_err_builder(llvm::BasicBlock::Create(context, "entry", create_err_fn));
+        llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
+        llvm::Argument *args = create_err_fn->arg_begin();
+        llvm::Value *err_struct = get_default_value_of_type(err_type);
+        err_struct = create_err_builder.CreateInsertValue(err_struct, args, {0}, "insert_err_type_id");
+        err_struct = create_err_builder.CreateInsertValue(err_struct, args + 1, {1}, "insert_err_value");
+        llvm::Value *error_message = create_err_builder.CreateCall(init_str_fn, {args + 2, args + 3}, "err_message");
+        err_struct = create_err_builder.CreateInsertValue(err_struct, error_message, {2}, "insert_err_message");
+        create_err_builder.CreateRet(err_struct);
+    }
     llvm::Value *message_str = IR::generate_const_string(module, err_message);
-    llvm::Value *error_message = builder.CreateCall(init_str_fn, {message_str, builder.getInt64(err_message.size())}, "err_message");
-    err_struct = builder.CreateInsertValue(err_struct, error_message, {2}, "insert_err_message");
-    return err_struct;
+    return builder.CreateCall(create_err_fn,                                                                          //
+        {builder.getInt32(err_id), builder.getInt32(err_value), message_str, builder.getInt64(err_message.size())}, //
+        "err_value"                                                                                                 //
+    );
 }
 
 void Generator::IR::generate_debug_print(    //
@@ -1,5 +1,10 @@
 #include "generator/generator.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+
 llvm::Value *Generator::Logical::generate_not(llvm::IRBuilder<> &builder, llvm::Value *value_to_negate) {
     if (value_to_negate->getType()->isIntegerTy(1)) {
         // For i1 types, we can use direct NOT
@@ -16,6 +21,267 @@ llvm::Value *Generator::Logical::generate_not(llvm::IRBuilder<> &builder, llvm::
     return builder.CreateICmpEQ(value_to_negate, llvm::ConstantInt::get(value_to_negate->getType(), 0), "not");
 }
 
+std::optional<std::string_view> Generator::Logical::get_string_literal(const ExpressionNode *expr) {
+    if (expr->get_variation() == ExpressionNode::Variation::TYPE_CAST) {
+        const auto *type_cast = expr->as<TypeCastNode>();
+        if (!type_cast->type->is(Type::Builtin::STR)) {
+            return std::nullopt;
+        }
+        expr = type_cast->expr.get();
+    }
+    if (expr->get_variation() != ExpressionNode::Variation::LITERAL) {
+        return std::nullopt;
+    }
+    const auto *literal = expr->as<LiteralNode>();
+    if (!std::holds_alternative<LitStr>(literal->value)) {
+        return std::nullopt;
+    }
+    return std::get<LitStr>(literal->value).value;
+}
+
+int32_t Generator::Logical::compare_string_literals(const std::string_view lhs, const std::string_view rhs) {
+    if (lhs.size() != rhs.size()) {
+        return lhs.size() < rhs.size() ? -1 : 1;
+    }
+    return std::memcmp(lhs.data(), rhs.data(), lhs.size());
+}
+
+llvm::Value *Generator::Logical::generate_string_cmp_literal( //
+    llvm::IRBuilder<> &builder,                               //
+    const llvm::CmpInst::Predicate predicate,                 //
+    llvm::Value *str_value,                                   //
+    const std::string_view literal,                           //
+    const bool literal_is_lhs                                 //
+) {
+    // THE C IMPLEMENTATION (for 'str_value == "lit"', the ordering comparisons follow the 'compare_str' semantics):
+    // if (str_value->len != 3) {
+    //     return false;
+    // }
+    // return memcmp(str_value->value, "lit", 3) == 0;
+    llvm::Module *const module = builder.GetInsertBlock()->getModule();
+    llvm::Function *const parent = builder.GetInsertBlock()->getParent();
+    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
+    const uint64_t literal_len = literal.size();
+    // 'compare_str(lit, str)' always has the opposite sign of 'compare_str(str, lit)', so comparing with the literal on the lhs is the
+    // same as comparing with the swapped predicate
+    const llvm::CmpInst::Predicate pred = literal_is_lhs ? llvm::CmpInst::getSwappedPredicate(predicate) : predicate;
+
+    llvm::Value *const len_ptr = builder.CreateStructGEP(str_type, str_value, 0, "str_len_ptr");
+    llvm::Value *const len = IR::aligned_load(builder, builder.getInt64Ty(), len_ptr, "str_len");
+    llvm::Value *const len_eq = builder.CreateICmpEQ(len, builder.getInt64(literal_len), "str_len_eq");
+    if (literal_len == 0) {
+        // The empty literal is only equal to empty strings and every non-empty string is greater than it
+        llvm::Value *const len_order = builder.CreateZExt(builder.CreateNot(len_eq), builder.getInt32Ty(), "str_len_order");
+        return builder.CreateICmp(pred, len_order, builder.getInt32(0), "str_cmp");
+    }
+
+    // The contents are only looked at when the lengths match, the length comparison alone decides the result otherwise
+    llvm::BasicBlock *const len_block = builder.GetInsertBlock();
+    llvm::BasicBlock *const content_block = llvm::BasicBlock::Create(context, "str_lit_cmp_content", parent);
+    llvm::BasicBlock *const merge_block = llvm::BasicBlock::Create(context, "str_lit_cmp_merge", parent);
+    llvm::Value *len_result = nullptr;
+    if (llvm::CmpInst::isEquality(pred)) {
+        len_result = builder.getInt1(pred == llvm::CmpInst::ICMP_NE);
+    } else {
+        llvm::Value *const len_lt = builder.CreateICmpULT(len, builder.getInt64(literal_len), "str_len_lt");
+        llvm::Value *const len_order = builder.CreateSelect(len_lt, builder.getInt32(-1), builder.getInt32(1), "str_len_order");
+        len_result = builder.CreateICmp(pred, len_order, builder.getInt32(0), "str_len_cmp");
+    }
+    builder.CreateCondBr(len_eq, content_block, merge_block);
+
+    builder.SetInsertPoint(content_block);
+    llvm::Value *const value_ptr = builder.CreateStructGEP(str_type, str_value, 1, "str_value_ptr");
+    llvm::Value *const content_result = generate_string_content_cmp(builder, pred, value_ptr, literal);
+    llvm::BasicBlock *const content_end_block = builder.GetInsertBlock();
+    builder.CreateBr(merge_block);
+
+    builder.SetInsertPoint(merge_block);
+    llvm::PHINode *const result = builder.CreatePHI(builder.getInt1Ty(), 2, "str_cmp");
+    result->addIncoming(len_result, len_block);
+    result->addIncoming(content_result, content_end_block);
+    return result;
+}
+
+llvm::Value *Generator::Logical::generate_string_content_cmp( //
+    llvm::IRBuilder<> &builder,                               //
+    const llvm::CmpInst::Predicate predicate,                 //
+    llvm::Value *value_ptr,                                   //
+    const std::string_view literal                            //
+) {
+    llvm::Module *const module = builder.GetInsertBlock()->getModule();
+    const uint64_t literal_len = literal.size();
+    if (llvm::CmpInst::isEquality(predicate) && (literal_len == 1 || literal_len == 2 || literal_len == 4 || literal_len == 8)) {
+        // Short literals are compared with a single unaligned word load against the literal bytes as an integer constant
+        const bool is_little_endian = module->getDataLayout().isLittleEndian();
+        uint64_t literal_word = 0;
+        for (uint64_t i = 0; i < literal_len; i++) {
+            const uint64_t byte = static_cast<unsigned char>(literal[is_little_endian ? literal_len - 1 - i : i]);
+            literal_word = (literal_word << 8) | byte;
+        }
+        llvm::Type *const word_type = builder.getIntNTy(static_cast<unsigned int>(literal_len * 8));
+        llvm::Value *const word = builder.CreateAlignedLoad(word_type, value_ptr, llvm::Align(1), "str_word");
+        return builder.CreateICmp(predicate, word, llvm::ConstantInt::get(word_type, literal_word), "str_word_cmp");
+    }
+    llvm::Value *const literal_ptr = IR::generate_const_string(module, std::string(literal));
+    llvm::Value *const literal_len_value = builder.getInt64(literal_len);
+    llvm::Function *const memcmp_fn = c_functions.at(MEMCMP);
+    llvm::Value *const memcmp_result = builder.CreateCall(memcmp_fn, {value_ptr, literal_ptr, literal_len_value}, "str_memcmp");
+    return builder.CreateICmp(predicate, memcmp_result, builder.getInt32(0), "str_content_cmp");
+}
+
+llvm::Value *Generator::Logical::generate_string_switch_index( //
+    llvm::IRBuilder<> &builder,                                //
+    llvm::Value *str_value,                                    //
+    const std::vector<std::string_view> &literals              //
+) {
+    // THE C IMPLEMENTATION (for the literals "if", "in" and "else"):
+    // int32_t index = -1;
+    // switch (str_value->len) {
+    //     case 2:
+    //         switch (str_value->value[1]) {
+    //             case 'f':
+    //                 index = memcmp(str_value->value, "if", 2) == 0 ? 0 : -1;
+    //                 break;
+    //             case 'n':
+    //                 index = memcmp(str_value->value, "in", 2) == 0 ? 1 : -1;
+    //                 break;
+    //         }
+    //         break;
+    //     case 4:
+    //         index = memcmp(str_value->value, "else", 4) == 0 ? 2 : -1;
+    //         break;
+    // }
+    // return index;
+    llvm::Module *const module = builder.GetInsertBlock()->getModule();
+    llvm::Function *const parent = builder.GetInsertBlock()->getParent();
+    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
+
+    // Bucket all literals by their length, the first occurrence of a literal wins if a literal is listed multiple times
+    std::map<uint64_t, std::vector<uint32_t>> length_buckets;
+    for (uint32_t i = 0; i < literals.size(); i++) {
+        std::vector<uint32_t> &bucket = length_buckets[literals[i].size()];
+        const auto is_same_literal = [&literals, i](const uint32_t idx) { return literals[idx] == literals[i]; };
+        const bool is_duplicate = std::any_of(bucket.begin(), bucket.end(), is_same_literal);
+        if (!is_duplicate) {
+            bucket.emplace_back(i);
+        }
+    }
+
+    llvm::BasicBlock *const entry_block = builder.GetInsertBlock();
+    llvm::BasicBlock *const done_block = llvm::BasicBlock::Create(context, "str_switch_done", parent);
+    llvm::Value *const len_ptr = builder.CreateStructGEP(str_type, str_value, 0, "str_len_ptr");
+    llvm::Value *const len = IR::aligned_load(builder, builder.getInt64Ty(), len_ptr, "str_len");
+    llvm::Value *const value_ptr = builder.CreateStructGEP(str_type, str_value, 1, "str_value_ptr");
+    llvm::SwitchInst *const len_switch = builder.CreateSwitch(len, done_block, length_buckets.size());
+    builder.SetInsertPoint(done_block);
+    llvm::PHINode *const result = builder.CreatePHI(builder.getInt32Ty(), literals.size() + 1, "str_switch_index");
+    result->addIncoming(builder.getInt32(-1), entry_block);
+
+    // Emits the verification of a single candidate literal in the current block, which always is the last check for the given string
+    const auto verify_candidate = [&](const uint32_t idx) {
+        llvm::Value *index = builder.getInt32(idx);
+        if (!literals[idx].empty()) {
+            llvm::Value *const is_match = generate_string_content_cmp(builder, llvm::CmpInst::ICMP_EQ, value_ptr, literals[idx]);
+            index = builder.CreateSelect(is_match, index, builder.getInt32(-1), "str_switch_candidate");
+        }
+        result->addIncoming(index, builder.GetInsertBlock());
+        builder.CreateBr(done_block);
+    };
+
+    for (const auto &[length, bucket] : length_buckets) {
+        const std::string bucket_name = "str_switch_len_" + std::to_string(length);
+        llvm::BasicBlock *const bucket_block = llvm::BasicBlock::Create(context, bucket_name, parent, done_block);
+        len_switch->addCase(builder.getInt64(length), bucket_block);
+        builder.SetInsertPoint(bucket_block);
+        if (bucket.size() == 1) {
+            verify_candidate(bucket.front());
+            continue;
+        }
+
+        // Look for a byte position at which all literals of this length differ. If one exists, a single switch on that byte selects the
+        // only candidate which needs to be verified, which makes the whole dispatch a perfect hash over (length, byte)
+        std::optional<uint64_t> discriminator;
+        for (uint64_t pos = 0; pos < length && !discriminator.has_value(); pos++) {
+            std::array<bool, 256> is_byte_used{};
+            bool is_unique = true;
+            for (const uint32_t idx : bucket) {
+                const unsigned char byte = static_cast<unsigned char>(literals[idx][pos]);
+                if (is_byte_used[byte]) {
+                    is_unique = false;
+                    break;
+                }
+                is_byte_used[byte] = true;
+            }
+            if (is_unique) {
+                discriminator = pos;
+            }
+        }
+        if (discriminator.has_value()) {
+            llvm::Value *const byte_ptr = builder.CreateConstInBoundsGEP1_64(builder.getInt8Ty(), value_ptr, discriminator.value());
+            llvm::Value *const byte = builder.CreateLoad(builder.getInt8Ty(), byte_ptr, "str_switch_byte");
+            llvm::SwitchInst *const byte_switch = builder.CreateSwitch(byte, done_block, bucket.size());
+            result->addIncoming(builder.getInt32(-1), bucket_block);
+            for (const uint32_t idx : bucket) {
+                llvm::BasicBlock *const candidate_block = llvm::BasicBlock::Create(            //
+                    context, "str_switch_candidate_" + std::to_string(idx), parent, done_block //
+                );
+                byte_switch->addCase(builder.getInt8(static_cast<uint8_t>(literals[idx][discriminator.value()])), candidate_block);
+                builder.SetInsertPoint(candidate_block);
+                verify_candidate(idx);
+            }
+            continue;
+        }
+
+        // No single byte tells all literals of this length apart, so they are checked one after another. This chain only contains
+        // literals of the exact same length, so it stays short for any realistic set of literals
+        for (size_t i = 0; i + 1 < bucket.size(); i++) {
+            const uint32_t idx = bucket[i];
+            llvm::BasicBlock *const match_block = llvm::BasicBlock::Create(            //
+                context, "str_switch_match_" + std::to_string(idx), parent, done_block //
+            );
+            llvm::BasicBlock *const next_block = llvm::BasicBlock::Create(            //
+                context, "str_switch_next_" + std::to_string(idx), parent, done_block //
+            );
+            llvm::Value *const is_match = generate_string_content_cmp(builder, llvm::CmpInst::ICMP_EQ, value_ptr, literals[idx]);
+            builder.CreateCondBr(is_match, match_block, next_block);
+            builder.SetInsertPoint(match_block);
+            result->addIncoming(builder.getInt32(idx), match_block);
+            builder.CreateBr(done_block);
+            builder.SetInsertPoint(next_block);
+        }
+        verify_candidate(bucket.back());
+    }
+
+    builder.SetInsertPoint(done_block);
+    return result;
+}
+
+llvm::Value *Generator::Logical::generate_string_cmp( //
+    llvm::IRBuilder<> &builder,                       //
+    const llvm::CmpInst::Predicate predicate,         //
+    llvm::Value *lhs,                                 //
+    const ExpressionNode *lhs_expr,                   //
+    llvm::Value *rhs,                                 //
+    const ExpressionNode *rhs_expr                    //
+) {
+    const std::optional<std::string_view> lhs_literal = get_string_literal(lhs_expr);
+    const std::optional<std::string_view> rhs_literal = get_string_literal(rhs_expr);
+    if (lhs_literal.has_value() && rhs_literal.has_value()) {
+        const int32_t compare_result = compare_string_literals(lhs_literal.value(), rhs_literal.value());
+        // Comparisons of two constants are folded by the builder
+        return builder.CreateICmp(predicate, builder.getInt32(compare_result), builder.getInt32(0), "str_cmp");
+    }
+    if (rhs_literal.has_value()) {
+        return generate_string_cmp_literal(builder, predicate, lhs, rhs_literal.value(), false);
+    }
+    if (lhs_literal.has_value()) {
+        return generate_string_cmp_literal(builder, predicate, rhs, lhs_literal.value(), true);
+    }
+    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
+    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs, rhs}, "str_cmp_result");
+    return builder.CreateICmp(predicate, compare_result, builder.getInt32(0), "str_cmp");
+}
+
 llvm::Value *Generator::Logical::generate_string_cmp_lt( //
     llvm::IRBuilder<> &builder,                          //
     llvm::Value *lhs,                                    //
@@ -23,26 +289,7 @@ llvm::Value *Generator::Logical::generate_string_cmp_lt( //
     llvm::Value *rhs,                                    //
     const ExpressionNode *rhs_expr                       //
 ) {
-    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-
-    // First, make sure that both sides are actual 'str*' variables. If the lhs or rhs is a literal, we first call 'init_str'
-    llvm::Value *lhs_val = lhs;
-    llvm::Value *rhs_val = rhs;
-    if (lhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *lhs_lit = lhs_expr->as<LiteralNode>();
-        lhs_val = builder.CreateCall(init_str_fn, {lhs, builder.getInt64(std::get<LitStr>(lhs_lit->value).value.length())}, "lhs_str_lt");
-    }
-    if (rhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *rhs_lit = rhs_expr->as<LiteralNode>();
-        rhs_val = builder.CreateCall(init_str_fn, {rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())}, "rhs_str_lt");
-    }
-
-    // Call compare_str(lhs, rhs)
-    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs_val, rhs_val}, "str_cmp_result");
-
-    // Return compare_result < 0
-    return builder.CreateICmpSLT(compare_result, builder.getInt32(0), "str_lt_result");
+    return generate_string_cmp(builder, llvm::CmpInst::ICMP_SLT, lhs, lhs_expr, rhs, rhs_expr);
 }
 
 llvm::Value *Generator::Logical::generate_string_cmp_gt( //
@@ -52,26 +299,7 @@ llvm::Value *Generator::Logical::generate_string_cmp_gt( //
     llvm::Value *rhs,                                    //
     const ExpressionNode *rhs_expr                       //
 ) {
-    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-
-    // First, make sure that both sides are actual 'str*' variables. If the lhs or rhs is a literal, we first call 'init_str'
-    llvm::Value *lhs_val = lhs;
-    llvm::Value *rhs_val = rhs;
-    if (lhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *lhs_lit = lhs_expr->as<LiteralNode>();
-        lhs_val = builder.CreateCall(init_str_fn, {lhs, builder.getInt64(std::get<LitStr>(lhs_lit->value).value.length())}, "lhs_str_gt");
-    }
-    if (rhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *rhs_lit = rhs_expr->as<LiteralNode>();
-        rhs_val = builder.CreateCall(init_str_fn, {rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())}, "rhs_str_gt");
-    }
-
-    // Call compare_str(lhs, rhs)
-    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs_val, rhs_val}, "str_cmp_result");
-
-    // Return compare_result > 0
-    return builder.CreateICmpSGT(compare_result, builder.getInt32(0), "str_gt_result");
+    return generate_string_cmp(builder, llvm::CmpInst::ICMP_SGT, lhs, lhs_expr, rhs, rhs_expr);
 }
 
 llvm::Value *Generator::Logical::generate_string_cmp_le( //
@@ -81,26 +309,7 @@ llvm::Value *Generator::Logical::generate_string_cmp_le( //
     llvm::Value *rhs,                                    //
     const ExpressionNode *rhs_expr                       //
 ) {
-    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-
-    // First, make sure that both sides are actual 'str*' variables. If the lhs or rhs is a literal, we first call 'init_str'
-    llvm::Value *lhs_val = lhs;
-    llvm::Value *rhs_val = rhs;
-    if (lhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *lhs_lit = lhs_expr->as<LiteralNode>();
-        lhs_val = builder.CreateCall(init_str_fn, {lhs, builder.getInt64(std::get<LitStr>(lhs_lit->value).value.length())}, "lhs_str_le");
-    }
-    if (rhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *rhs_lit = rhs_expr->as<LiteralNode>();
-        rhs_val = builder.CreateCall(init_str_fn, {rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())}, "rhs_str_le");
-    }
-
-    // Call compare_str(lhs, rhs)
-    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs_val, rhs_val}, "str_cmp_result");
-
-    // Return compare_result <= 0
-    return builder.CreateICmpSLE(compare_result, builder.getInt32(0), "str_le_result");
+    return generate_string_cmp(builder, llvm::CmpInst::ICMP_SLE, lhs, lhs_expr, rhs, rhs_expr);
 }
 
 llvm::Value *Generator::Logical::generate_string_cmp_ge( //
@@ -110,26 +319,7 @@ llvm::Value *Generator::Logical::generate_string_cmp_ge( //
     llvm::Value *rhs,                                    //
     const ExpressionNode *rhs_expr                       //
 ) {
-    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-
-    // First, make sure that both sides are actual 'str*' variables. If the lhs or rhs is a literal, we first call 'init_str'
-    llvm::Value *lhs_val = lhs;
-    llvm::Value *rhs_val = rhs;
-    if (lhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *lhs_lit = lhs_expr->as<LiteralNode>();
-        lhs_val = builder.CreateCall(init_str_fn, {lhs, builder.getInt64(std::get<LitStr>(lhs_lit->value).value.length())}, "lhs_str_ge");
-    }
-    if (rhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *rhs_lit = rhs_expr->as<LiteralNode>();
-        rhs_val = builder.CreateCall(init_str_fn, {rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())}, "rhs_str_ge");
-    }
-
-    // Call compare_str(lhs, rhs)
-    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs_val, rhs_val}, "str_cmp_result");
-
-    // Return compare_result >= 0
-    return builder.CreateICmpSGE(compare_result, builder.getInt32(0), "str_ge_result");
+    return generate_string_cmp(builder, llvm::CmpInst::ICMP_SGE, lhs, lhs_expr, rhs, rhs_expr);
 }
 
 llvm::Value *Generator::Logical::generate_string_cmp_eq( //
@@ -139,26 +329,7 @@ llvm::Value *Generator::Logical::generate_string_cmp_eq( //
     llvm::Value *rhs,                                    //
     const ExpressionNode *rhs_expr                       //
 ) {
-    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-
-    // First, make sure that both sides are actual 'str*' variables. If the lhs or rhs is a literal, we first call 'init_str'
-    llvm::Value *lhs_val = lhs;
-    llvm::Value *rhs_val = rhs;
-    if (lhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *lhs_lit = lhs_expr->as<LiteralNode>();
-        lhs_val = builder.CreateCall(init_str_fn, {lhs, builder.getInt64(std::get<LitStr>(lhs_lit->value).value.length())}, "lhs_str_eq");
-    }
-    if (rhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *rhs_lit = rhs_expr->as<LiteralNode>();
-        rhs_val = builder.CreateCall(init_str_fn, {rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())}, "rhs_str_eq");
-    }
-
-    // Call compare_str(lhs, rhs)
-    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs_val, rhs_val}, "str_cmp_result");
-
-    // Return compare_result == 0
-    return builder.CreateICmpEQ(compare_result, builder.getInt32(0), "str_eq_result");
+    return generate_string_cmp(builder, llvm::CmpInst::ICMP_EQ, lhs, lhs_expr, rhs, rhs_expr);
 }
 
 llvm::Value *Generator::Logical::generate_string_cmp_neq( //
@@ -168,24 +339,5 @@ llvm::Value *Generator::Logical::generate_string_cmp_neq( //
     llvm::Value *rhs,                                     //
     const ExpressionNode *rhs_expr                        //
 ) {
-    llvm::Function *compare_str_fn = Module::String::string_manip_functions.at("compare_str");
-    llvm::Function *init_str_fn = Module::String::string_manip_functions.at("init_str");
-
-    // First, make sure that both sides are actual 'str*' variables. If the lhs or rhs is a literal, we first call 'init_str'
-    llvm::Value *lhs_val = lhs;
-    llvm::Value *rhs_val = rhs;
-    if (lhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *lhs_lit = lhs_expr->as<LiteralNode>();
-        lhs_val = builder.CreateCall(init_str_fn, {lhs, builder.getInt64(std::get<LitStr>(lhs_lit->value).value.length())}, "lhs_str_neq");
-    }
-    if (rhs_expr->get_variation() == ExpressionNode::Variation::LITERAL) {
-        const auto *rhs_lit = rhs_expr->as<LiteralNode>();
-        rhs_val = builder.CreateCall(init_str_fn, {rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())}, "rhs_str_neq");
-    }
-
-    // Call compare_str(lhs, rhs)
-    llvm::Value *compare_result = builder.CreateCall(compare_str_fn, {lhs_val, rhs_val}, "str_cmp_result");
-
-    // Return compare_result != 0
-    return builder.CreateICmpNE(compare_result, builder.getInt32(0), "str_neq_result");
+    return generate_string_cmp(builder, llvm::CmpInst::ICMP_NE, lhs, lhs_expr, rhs, rhs_expr);
 }
@@ -96,7 +96,7 @@ void Generator::Memory::generate_free_callable_function( //
             const IR::TypeStorageInfo &type_info = IR::get_type(module, pl.type);
             llvm::Value *field_value = field_ptr;
             const bool is_array = pl.type->get_variation() == Type::Variation::ARRAY;
-            const bool is_str = pl.type->to_string() == "str";
+            const bool is_str = pl.type->is(Type::Builtin::STR);
             const bool is_opaque = pl.type->get_variation() == Type::Variation::OPAQUE;
             if (type_info.is_complex || is_array || is_str || is_opaque) {
                 llvm::Type *const type_to_load = type_info.is_complex ? PTR_TY : type_info.type;
@@ -108,8 +108,7 @@ void Generator::Memory::generate_free_callable_function( //
                 llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
                 builder->CreateCall(dima_release_fn, {dima_head, field_value});
             } else {
-                llvm::Function *const free_fn = memory_functions.at("free");
-                builder->CreateCall(free_fn, {field_value, builder->getInt32(pl.type->get_id())});
+                generate_free_call(builder, module, field_value, pl.type);
             }
             builder->CreateBr(next_pers_block);
 
@@ -232,7 +231,7 @@ void Generator::Memory::generate_clone_callable_function( //
                 const IR::TypeStorageInfo &type_info = IR::get_type(module, pl.type);
                 llvm::Value *old_field_value = old_field_ptr;
                 const bool is_array = pl.type->get_variation() == Type::Variation::ARRAY;
-                const bool is_str = pl.type->to_string() == "str";
+                const bool is_str = pl.type->is(Type::Builtin::STR);
                 const bool is_opaque = pl.type->get_variation() == Type::Variation::OPAQUE;
                 if (type_info.is_complex || is_array || is_str || is_opaque) {
                     llvm::Type *const type_to_load = type_info.is_complex ? PTR_TY : type_info.type;
@@ -242,8 +241,7 @@ void Generator::Memory::generate_clone_callable_function( //
                 llvm::Value *const new_field_ptr = builder->CreateStructGEP(                 //
                     frame_type, new_fn_frame, pl.field_index + 1, "new_persistent_field_ptr" //
                 );
-                llvm::Function *const clone_fn = memory_functions.at("clone");
-                builder->CreateCall(clone_fn, {old_field_value, new_field_ptr, builder->getInt32(pl.type->get_id())});
+                generate_clone_call(builder, module, old_field_value, new_field_ptr, pl.type);
                 builder->CreateBr((i + 1 < num_plocals) ? check_blocks[i + 1] : done_block);
             }
 
@@ -334,7 +332,7 @@ void Generator::Memory::generate_free_value( //
             const bool base_is_array =                                      //
                 array_type->type->get_variation() == Type::Variation::ARRAY //
                 && !array_type->type->as<ArrayType>()->sizes.has_value();
-            const bool base_is_str = array_type->type->to_string() == "str";
+            const bool base_is_str = array_type->type->is(Type::Builtin::STR);
             const bool base_is_opaque = array_type->type->get_variation() == Type::Variation::OPAQUE;
             if (element_type_info.is_complex || base_is_array || base_is_str || base_is_opaque) {
                 arr_value = IR::aligned_load(*builder, element_type, arr_value_ptr, "arr_value");
@@ -345,8 +343,7 @@ void Generator::Memory::generate_free_value( //
                 llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
                 builder->CreateCall(dima_release_fn, {dima_head, arr_value});
             } else {
-                llvm::Function *const free_fn = memory_functions.at("free");
-                builder->CreateCall(free_fn, {arr_value, builder->getInt32(array_type->type->get_id())});
+                generate_free_call(builder, module, arr_value, array_type->type);
             }
             llvm::Value *const idx_value_p1 = builder->CreateAdd(idx_value, builder->getInt64(1), "idx_value_p1");
             IR::aligned_store(*builder, idx_value_p1, idx);
@@ -376,7 +373,7 @@ void Generator::Memory::generate_free_value( //
                 const bool field_is_array =                               //
                     field.type->get_variation() == Type::Variation::ARRAY //
                     && !field.type->as<ArrayType>()->sizes.has_value();
-                const bool field_is_str = field.type->to_string() == "str";
+                const bool field_is_str = field.type->is(Type::Builtin::STR);
                 const bool field_is_opaque = field.type->get_variation() == Type::Variation::OPAQUE;
                 if (field_type_info.is_complex || field_is_array || field_is_str || field_is_opaque) {
                     data_field = IR::aligned_load(*builder, PTR_TY, data_field_ptr, "data_field_" + field.name);
@@ -387,8 +384,7 @@ void Generator::Memory::generate_free_value( //
                     llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
                     builder->CreateCall(dima_release_fn, {dima_head, data_field});
                 } else {
-                    llvm::Function *const free_fn = memory_functions.at("free");
-                    builder->CreateCall(free_fn, {data_field, builder->getInt32(field.type->get_id())});
+                    generate_free_call(builder, module, data_field, field.type);
                 }
             }
             break;
@@ -452,7 +448,7 @@ void Generator::Memory::generate_free_value( //
             break;
         }
         case Type::Variation::PRIMITIVE: {
-            ASSERT(type->to_string() == "str");
+            ASSERT(type->is(Type::Builtin::STR));
             builder->CreateCall(c_functions.at(FREE), {value});
             break;
         }
@@ -517,7 +513,7 @@ void Generator::Memory::generate_free_value( //
             const bool base_is_array =                                              //
                 optional_type->base_type->get_variation() == Type::Variation::ARRAY //
                 && !optional_type->base_type->as<ArrayType>()->sizes.has_value();
-            const bool base_is_str = optional_type->base_type->to_string() == "str";
+            const bool base_is_str = optional_type->base_type->is(Type::Builtin::STR);
             const bool base_is_opaque = optional_type->base_type->get_variation() == Type::Variation::OPAQUE;
             if (base_type_info.is_complex || base_is_array || base_is_str || base_is_opaque) {
                 opt_value = IR::aligned_load(*builder, PTR_TY, opt_value_ptr, "opt_value");
@@ -528,7 +524,7 @@ void Generator::Memory::generate_free_value( //
                 llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
                 builder->CreateCall(dima_release_fn, {dima_head, opt_value});
             } else {
-                builder->CreateCall(memory_functions.at("free"), {opt_value, builder->getInt32(optional_type->base_type->get_id())});
+                generate_free_call(builder, module, opt_value, optional_type->base_type);
             }
             builder->CreateBr(merge_block);
 
@@ -548,7 +544,7 @@ void Generator::Memory::generate_free_value( //
                 const bool elem_is_array =                               //
                     elem_type->get_variation() == Type::Variation::ARRAY //
                     && !elem_type->as<ArrayType>()->sizes.has_value();
-                const bool elem_is_str = elem_type->to_string() == "str";
+                const bool elem_is_str = elem_type->is(Type::Builtin::STR);
                 const bool elem_is_opaque = elem_type->get_variation() == Type::Variation::OPAQUE;
                 if (elem_type_info.is_complex || elem_is_array || elem_is_str || elem_is_opaque) {
                     elem_ptr = IR::aligned_load(*builder, PTR_TY, elem_ptr, "elem");
@@ -559,7 +555,7 @@ void Generator::Memory::generate_free_value( //
                     llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
                     builder->CreateCall(dima_release_fn, {dima_head, elem_ptr});
                 } else {
-                    builder->CreateCall(memory_functions.at("free"), {elem_ptr, builder->getInt32(elem_type->get_id())});
+                    generate_free_call(builder, module, elem_ptr, elem_type);
                 }
             }
             break;
@@ -617,7 +613,7 @@ void Generator::Memory::generate_free_value( //
                     const bool value_is_array =                                     //
                         variant_type_ptr->get_variation() == Type::Variation::ARRAY //
                         && !variant_type_ptr->as<ArrayType>()->sizes.has_value();
-                    const bool value_is_str = variant_type_ptr->to_string() == "str";
+                    const bool value_is_str = variant_type_ptr->is(Type::Builtin::STR);
                     const bool value_is_opaque = variant_type_ptr->get_variation() == Type::Variation::OPAQUE;
                     if (value_type_info.is_complex || value_is_array || value_is_str || value_is_opaque) {
                         variant_value = IR::aligned_load(*builder, PTR_TY, variant_value_ptr, "variant_value");
@@ -628,7 +624,7 @@ void Generator::Memory::generate_free_value( //
                         llvm::Function *const dima_release_fn = Module::DIMA::dima_functions.at("release");
                         builder->CreateCall(dima_release_fn, {dima_head, value});
                     } else {
-                        builder->CreateCall(memory_functions.at("free"), {variant_value, builder->getInt32(variant_type_ptr->get_id())});
+                        generate_free_call(builder, module, variant_value, variant_type_ptr);
                     }
                     builder->CreateBr(variant_free_merge_block);
                 }
@@ -664,6 +660,30 @@ void Generator::Memory::generate_free_function( //
         return;
     }
 
+    // Get all freeable types
+    std::vector<std::shared_ptr<Type>> freeable_types = Parser::get_all_freeable_types();
+
+    // Every freeable type gets its own free function, which is called directly wherever the type of a value is known at compile time.
+    // All of them are declared first, since freeing a type calls the free functions of the types it contains
+    llvm::FunctionType *const free_typed_type = llvm::FunctionType::get( //
+        llvm::Type::getVoidTy(context),                                  // Returns void
+        {
+            PTR_TY // void* value_ptr
+        },
+        false // No vaargs
+    );
+    for (const auto &type : freeable_types) {
+        llvm::Function::Create(free_typed_type, llvm::Function::InternalLinkage, get_typed_function_name("free", type), module);
+    }
+    for (const auto &type : freeable_types) {
+        llvm::Function *const free_typed_fn = module->getFunction(get_typed_function_name("free", type));
+        llvm::Argument *const arg_value = free_typed_fn->arg_begin();
+        arg_value->setName("value_ptr");
+        builder->SetInsertPoint(llvm::BasicBlock::Create(context, "entry", free_typed_fn));
+        generate_free_value(builder, module, arg_value, type);
+        builder->CreateRetVoid();
+    }
+
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", free_value_fn);
     llvm::BasicBlock *const default_block = llvm::BasicBlock::Create(context, "default", free_value_fn);
 
@@ -676,20 +696,18 @@ void Generator::Memory::generate_free_function( //
     // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
 
-    // Get all freeable types
-    std::vector<std::shared_ptr<Type>> freeable_types = Parser::get_all_freeable_types();
-
     // Create the switch instruction (we'll add cases to it)
     // Number of cases = number of freeable types
     llvm::SwitchInst *const switch_inst = builder->CreateSwitch(arg_type_id, default_block, freeable_types.size());
 
-    // Add cases for each data type
+    // Add cases for each data type, the generic function only dispatches to the specialized functions for callers which only know the
+    // type ID at runtime
     for (const auto &type : freeable_types) {
         llvm::BasicBlock *const case_block = llvm::BasicBlock::Create(context, "case_" + type->to_string(), free_value_fn);
         switch_inst->addCase(builder->getInt32(type->get_id()), case_block);
 
         builder->SetInsertPoint(case_block);
-        generate_free_value(builder, module, arg_value_ptr, type);
+        builder->CreateCall(module->getFunction(get_typed_function_name("free", type)), {arg_value_ptr});
         builder->CreateRetVoid();
     }
 
@@ -708,7 +726,6 @@ void Generator::Memory::generate_clone_value( //
     llvm::Value *const dest,                  //
     const std::shared_ptr<Type> &type         //
 ) {
-    llvm::Function *const clone_fn = memory_functions.at("clone");
     switch (type->get_variation()) {
         default:
             break;
@@ -755,13 +772,13 @@ void Generator::Memory::generate_clone_value( //
                 const bool base_is_array =                                      //
                     array_type->type->get_variation() == Type::Variation::ARRAY //
                     && !array_type->type->as<ArrayType>()->sizes.has_value();
-                const bool base_is_str = array_type->type->to_string() == "str";
+                const bool base_is_str = array_type->type->is(Type::Builtin::STR);
                 const bool base_is_opaque = array_type->type->get_variation() == Type::Variation::OPAQUE;
                 if (elem_type_info.is_complex || base_is_array || base_is_str || base_is_opaque) {
                     arr_value = IR::aligned_load(*builder, elem_type, arr_value_ptr, "arr_value");
                 }
                 llvm::Value *const new_arr_value_ptr = builder->CreateGEP(elem_type, dest, idx_value, "new_arr_value_ptr");
-                builder->CreateCall(clone_fn, {arr_value, new_arr_value_ptr, builder->getInt32(array_type->type->get_id())});
+                generate_clone_call(builder, module, arr_value, new_arr_value_ptr, array_type->type);
                 llvm::Value *const idx_value_p1 = builder->CreateAdd(idx_value, builder->getInt64(1), "idx_value_p1");
                 IR::aligned_store(*builder, idx_value_p1, idx);
                 builder->CreateBr(loop_cond_block);
@@ -832,13 +849,13 @@ void Generator::Memory::generate_clone_value( //
             const bool base_is_array =                                      //
                 array_type->type->get_variation() == Type::Variation::ARRAY //
                 && !array_type->type->as<ArrayType>()->sizes.has_value();
-            const bool base_is_str = array_type->type->to_string() == "str";
+            const bool base_is_str = array_type->type->is(Type::Builtin::STR);
             const bool base_is_opaque = array_type->type->get_variation() == Type::Variation::OPAQUE;
             if (elem_type_info.is_complex || base_is_array || base_is_str || base_is_opaque) {
                 arr_value = IR::aligned_load(*builder, elem_type, arr_value, "arr_value");
             }
             llvm::Value *const new_arr_value_ptr = builder->CreateGEP(elem_type, new_value_ptr, idx_value, "new_arr_value_ptr");
-            builder->CreateCall(clone_fn, {arr_value, new_arr_value_ptr, builder->getInt32(array_type->type->get_id())});
+            generate_clone_call(builder, module, arr_value, new_arr_value_ptr, array_type->type);
             llvm::Value *const idx_value_p1 = builder->CreateAdd(idx_value, builder->getInt64(1), "idx_value_p1");
             IR::aligned_store(*builder, idx_value_p1, idx);
             builder->CreateBr(loop_cond_block);
@@ -864,7 +881,7 @@ void Generator::Memory::generate_clone_value( //
                 const bool field_is_array =                               //
                     field.type->get_variation() == Type::Variation::ARRAY //
                     && !field.type->as<ArrayType>()->sizes.has_value();
-                const bool field_is_str = field.type->to_string() == "str";
+                const bool field_is_str = field.type->is(Type::Builtin::STR);
                 const bool field_is_opaque = field.type->get_variation() == Type::Variation::OPAQUE;
                 if (field_type_info.is_complex || field_is_array || field_is_str || field_is_opaque) {
                     field_type_ptr = PTR_TY;
@@ -875,7 +892,7 @@ void Generator::Memory::generate_clone_value( //
                 );
                 if (field.type->is_freeable()) {
                     // The field is more complex so it needs to be cloned as well
-                    builder->CreateCall(clone_fn, {field_src, field_dest_ptr, builder->getInt32(field.type->get_id())});
+                    generate_clone_call(builder, module, field_src, field_dest_ptr, field.type);
                 } else {
                     // We simply copy the field from src to dest
                     const size_t field_size = Allocation::get_type_size(module, field_type_ptr);
@@ -901,8 +918,7 @@ void Generator::Memory::generate_clone_value( //
                 llvm::Value *const dest_field_ptr = builder->CreateStructGEP(         //
                     struct_type, new_object_ptr, i, "field_" + data_type_str + "_ptr" //
                 );
-                llvm::Value *const data_type_id = builder->getInt32(data_type->get_id());
-                builder->CreateCall(clone_fn, {src_field, dest_field_ptr, data_type_id});
+                generate_clone_call(builder, module, src_field, dest_field_ptr, data_type);
             }
             IR::aligned_store(*builder, new_object_ptr, dest);
             break;
@@ -911,7 +927,7 @@ void Generator::Memory::generate_clone_value( //
             llvm::StructType *const error_type = type_map.at("type.flint.err");
             llvm::Value *const loaded_err = IR::aligned_load(*builder, error_type, src, "loaded_err");
             IR::aligned_store(*builder, loaded_err, dest);
-            if (type->to_string() != "anyerror") {
+            if (!type->is(Type::Builtin::ANYERROR)) {
                 const auto *const error_set_type = type->as<ErrorSetType>();
                 const unsigned int type_id = error_set_type->error_node->error_id;
                 llvm::Value *const dest_type_id_ptr = builder->CreateStructGEP(error_type, dest, 0, "dest_type_id_ptr");
@@ -920,7 +936,7 @@ void Generator::Memory::generate_clone_value( //
             llvm::Value *const src_msg_ptr = builder->CreateStructGEP(error_type, src, 2, "src_msg_ptr");
             llvm::Value *const src_msg = IR::aligned_load(*builder, PTR_TY, src_msg_ptr, "src_msg");
             llvm::Value *const dest_msg_ptr = builder->CreateStructGEP(error_type, dest, 2, "dest_msg_ptr");
-            builder->CreateCall(clone_fn, {src_msg, dest_msg_ptr, builder->getInt32(Type::get_primitive_type("str")->get_id())});
+            generate_clone_call(builder, module, src_msg, dest_msg_ptr, Type::get_primitive_type("str"));
             break;
         }
         case Type::Variation::FUNC: {
@@ -958,7 +974,7 @@ void Generator::Memory::generate_clone_value( //
             break;
         }
         case Type::Variation::PRIMITIVE: {
-            ASSERT(type->to_string() == "str");
+            ASSERT(type->is(Type::Builtin::STR));
             llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
             llvm::Value *const str_len_ptr = builder->CreateStructGEP(str_type, src, 0, "str_len_ptr");
             llvm::Value *const str_len = IR::aligned_load(*builder, builder->getInt64Ty(), str_len_ptr, "str_len");
@@ -1011,13 +1027,13 @@ void Generator::Memory::generate_clone_value( //
             const bool base_is_array =                                              //
                 optional_type->base_type->get_variation() == Type::Variation::ARRAY //
                 && !optional_type->base_type->as<ArrayType>()->sizes.has_value();
-            const bool base_is_str = optional_type->base_type->to_string() == "str";
+            const bool base_is_str = optional_type->base_type->is(Type::Builtin::STR);
             const bool base_is_opaque = optional_type->base_type->get_variation() == Type::Variation::OPAQUE;
             if (base_type_info.is_complex || base_is_array || base_is_str || base_is_opaque) {
                 opt_value = IR::aligned_load(*builder, PTR_TY, opt_value_ptr, "opt_value");
             }
             llvm::Value *const dest_value_ptr = builder->CreateStructGEP(opt_struct_type, dest, 1, "dest_value_ptr");
-            builder->CreateCall(clone_fn, {opt_value, dest_value_ptr, builder->getInt32(optional_type->base_type->get_id())});
+            generate_clone_call(builder, module, opt_value, dest_value_ptr, optional_type->base_type);
             llvm::Value *const dest_has_value_ptr = builder->CreateStructGEP(opt_struct_type, dest, 0, "dest_has_value_ptr");
             IR::aligned_store(*builder, builder->getInt8(1), dest_has_value_ptr);
             builder->CreateBr(merge_block);
@@ -1048,12 +1064,12 @@ void Generator::Memory::generate_clone_value( //
                 const bool elem_is_array =                               //
                     elem_type->get_variation() == Type::Variation::ARRAY //
                     && !elem_type->as<ArrayType>()->sizes.has_value();
-                const bool elem_is_str = elem_type->to_string() == "str";
+                const bool elem_is_str = elem_type->is(Type::Builtin::STR);
                 const bool elem_is_opaque = elem_type->get_variation() == Type::Variation::OPAQUE;
                 if (elem_type_info.is_complex || elem_is_array || elem_is_str || elem_is_opaque) {
                     src_elem_ptr = IR::aligned_load(*builder, PTR_TY, src_elem_ptr, "src_elem");
                 }
-                builder->CreateCall(memory_functions.at("clone"), {src_elem_ptr, dest_elem_ptr, builder->getInt32(elem_type->get_id())});
+                generate_clone_call(builder, module, src_elem_ptr, dest_elem_ptr, elem_type);
             }
             break;
         }
@@ -1066,9 +1082,8 @@ void Generator::Memory::generate_clone_value( //
                 llvm::Value *const src_message_ptr = builder->CreateStructGEP(error_type, src, 2, "src_message_ptr");
                 llvm::Value *const dest_message_ptr = builder->CreateStructGEP(error_type, dest, 2, "dest_message_ptr");
                 const auto &string_type = Type::get_primitive_type("str");
-                llvm::Value *const string_type_id = builder->getInt32(string_type->get_id());
                 llvm::Value *const src_message = IR::aligned_load(*builder, PTR_TY, src_message_ptr, "src_message");
-                builder->CreateCall(clone_fn, {src_message, dest_message_ptr, string_type_id});
+                generate_clone_call(builder, module, src_message, dest_message_ptr, string_type);
             } else {
                 llvm::BasicBlock *const prev_block = builder->GetInsertBlock();
                 std::map<size_t, llvm::BasicBlock *> possible_value_blocks;
@@ -1112,14 +1127,14 @@ void Generator::Memory::generate_clone_value( //
                     const bool value_is_array =                                     //
                         variant_type_ptr->get_variation() == Type::Variation::ARRAY //
                         && !variant_type_ptr->as<ArrayType>()->sizes.has_value();
-                    const bool value_is_str = variant_type_ptr->to_string() == "str";
+                    const bool value_is_str = variant_type_ptr->is(Type::Builtin::STR);
                     const bool value_is_opaque = variant_type_ptr->get_variation() == Type::Variation::OPAQUE;
                     if (value_type_info.is_complex || value_is_array || value_is_str || value_is_opaque) {
                         variant_value = IR::aligned_load(                    //
                             *builder, PTR_TY, src_value_ptr, "variant_value" //
                         );
                     }
-                    builder->CreateCall(clone_fn, {variant_value, dest_value_ptr, builder->getInt32(variant_type_ptr->get_id())});
+                    generate_clone_call(builder, module, variant_value, dest_value_ptr, variant_type_ptr);
                     builder->CreateBr(variant_clone_merge_block);
                 }
                 variant_clone_merge_block->insertInto(prev_block->getParent());
@@ -1154,6 +1169,33 @@ void Generator::Memory::generate_clone_function( //
         return;
     }
 
+    // Get all freeable types. Only types which can be freed must be cloned, which means that only types containing data or pointers etc
+    // need to be cloned, all other types can be "cloned" by simply making a shallow copy. Cloning is always a deep-copy
+    std::vector<std::shared_ptr<Type>> freeable_types = Parser::get_all_freeable_types();
+
+    // Just like freeing, every freeable type gets its own clone function which is called directly wherever the type is known
+    llvm::FunctionType *const clone_typed_type = llvm::FunctionType::get( //
+        llvm::Type::getVoidTy(context),                                   // Returns void
+        {
+            PTR_TY, // void* src
+            PTR_TY  // void* dest
+        },
+        false // No vaargs
+    );
+    for (const auto &type : freeable_types) {
+        llvm::Function::Create(clone_typed_type, llvm::Function::InternalLinkage, get_typed_function_name("clone", type), module);
+    }
+    for (const auto &type : freeable_types) {
+        llvm::Function *const clone_typed_fn = module->getFunction(get_typed_function_name("clone", type));
+        llvm::Argument *const arg_src = clone_typed_fn->arg_begin();
+        arg_src->setName("src");
+        llvm::Argument *const arg_dest = clone_typed_fn->arg_begin() + 1;
+        arg_dest->setName("dest");
+        builder->SetInsertPoint(llvm::BasicBlock::Create(context, "entry", clone_typed_fn));
+        generate_clone_value(builder, module, arg_src, arg_dest, type);
+        builder->CreateRetVoid();
+    }
+
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", clone_value_fn);
     llvm::BasicBlock *const default_block = llvm::BasicBlock::Create(context, "default", clone_value_fn);
 
@@ -1168,10 +1210,6 @@ void Generator::Memory::generate_clone_function( //
     // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
 
-    // Get all freeable types. Only types which can be freed must be cloned, which means that only types containing data or pointers etc
-    // need to be cloned, all other types can be "cloned" by simply making a shallow copy. Cloning is always a deep-copy
-    std::vector<std::shared_ptr<Type>> freeable_types = Parser::get_all_freeable_types();
-
     // Create the switch instruction (we'll add cases to it)
     // Number of cases = number of freeable types
     llvm::SwitchInst *const switch_inst = builder->CreateSwitch(arg_type_id, default_block, freeable_types.size());
@@ -1182,7 +1220,7 @@ void Generator::Memory::generate_clone_function( //
         switch_inst->addCase(builder->getInt32(type->get_id()), case_block);
 
         builder->SetInsertPoint(case_block);
-        generate_clone_value(builder, module, arg_src, arg_dest, type);
+        builder->CreateCall(module->getFunction(get_typed_function_name("clone", type)), {arg_src, arg_dest});
         builder->CreateRetVoid();
     }
 
@@ -1193,3 +1231,35 @@ void Generator::Memory::generate_clone_function( //
     builder->CreateCall(c_functions.at(ABORT), {});
     builder->CreateUnreachable();
 }
+
+std::string Generator::Memory::get_typed_function_name(const std::string &base_name, const std::shared_ptr<Type> &type) {
+    return prefix + base_name + "." + std::to_string(type->get_id());
+}
+
+llvm::CallInst *Generator::Memory::generate_free_call( //
+    llvm::IRBuilder<> *const builder,                  //
+    llvm::Module *const module,                        //
+    llvm::Value *const value,                          //
+    const std::shared_ptr<Type> &type                  //
+) {
+    // The specialized functions only exist in the program module, the builtin modules only know the generic function
+    llvm::Function *const free_typed_fn = module->getFunction(get_typed_function_name("free", type));
+    if (free_typed_fn != nullptr) {
+        return builder->CreateCall(free_typed_fn, {value});
+    }
+    return builder->CreateCall(memory_functions.at("free"), {value, builder->getInt32(type->get_id())});
+}
+
+llvm::CallInst *Generator::Memory::generate_clone_call( //
+    llvm::IRBuilder<> *const builder,                   //
+    llvm::Module *const module,                         //
+    llvm::Value *const src,                             //
+    llvm::Value *const dest,                            //
+    const std::shared_ptr<Type> &type                   //
+) {
+    llvm::Function *const clone_typed_fn = module->getFunction(get_typed_function_name("clone", type));
+    if (clone_typed_fn != nullptr) {
+        return builder->CreateCall(clone_typed_fn, {src, dest});
+    }
+    return builder->CreateCall(memory_functions.at("clone"), {src, dest, builder->getInt32(type->get_id())});
+}
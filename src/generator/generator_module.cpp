@@ -4,9 +4,12 @@
 #include "globals.hpp"
 #include "io.hpp"
 #include "linker/linker.hpp"
+#include "persistent_thread_pool.hpp"
 #include "profiler.hpp"
 
 #include <json/parser.hpp>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 
 void Generator::Module::generate_dima_heads(llvm::Module *module, const std::string &module_name) {
     llvm::ConstantPointerNull *const nullpointer = llvm::ConstantPointerNull::get(PTR_TY);
@@ -25,10 +28,27 @@ void Generator::Module::generate_dima_heads(llvm::Module *module, const std::str
     }
 }
 
-bool Generator::Module::generate_module(     //
-    const BuiltinLibrary lib_to_build,       //
-    const std::filesystem::path &cache_path, //
-    const std::string &module_name           //
+bool Generator::Module::compile_module_bitcode( //
+    const llvm::SmallVector<char, 0> &bitcode,  //
+    const std::filesystem::path &module_path,   //
+    const std::string &module_name              //
+) {
+    PROFILE_SCOPE("Compiling module '" + module_name + "'");
+    // The module is loaded into a context of its own, so that no LLVM state is shared with any other thread
+    llvm::LLVMContext module_context;
+    const llvm::MemoryBufferRef buffer(llvm::StringRef(bitcode.data(), bitcode.size()), module_name);
+    llvm::Expected<std::unique_ptr<llvm::Module>> module = llvm::parseBitcodeFile(buffer, module_context);
+    if (!module) {
+        llvm::consumeError(module.takeError());
+        return false;
+    }
+    return compile_module(module.get().get(), module_path);
+}
+
+std::optional<std::future<bool>> Generator::Module::generate_module( //
+    const BuiltinLibrary lib_to_build,                               //
+    const std::filesystem::path &cache_path,                         //
+    const std::string &module_name                                   //
 ) {
     PROFILE_SCOPE("Generating module '" + module_name + "'");
     generating_builtin_module = true;
@@ -115,23 +135,25 @@ bool Generator::Module::generate_module(     //
     // Verify the module after generation
     if (!verify_module(module.get())) {
         THROW_BASIC_ERR(ERR_GENERATING);
-        return false;
+        return std::nullopt;
     }
     // Print the module, if requested
     if (DEBUG_MODE && (BUILTIN_LIBS_TO_PRINT & static_cast<unsigned int>(lib_to_build))) {
         std::cout << YELLOW << "[Debug Info] Generated module '" << module_name << "':\n"
                   << DEFAULT << resolve_ir_comments(get_module_ir_string(module.get())) << std::endl;
     }
-    // Save the generated module at the module_path
-    bool compilation_successful = compile_module(module.get(), cache_path / module_name);
+    // The generator state lives in the shared context, so only the generation happens on this thread. The optimization and code
+    // generation of the module run on the thread pool, on a bitcode copy of the module
+    llvm::SmallVector<char, 0> bitcode;
+    llvm::raw_svector_ostream bitcode_stream(bitcode);
+    llvm::WriteBitcodeToFile(*module, bitcode_stream);
     module.reset();
     builder.reset();
     global_strings.clear();
     generating_builtin_module = false;
-    if (!compilation_successful) {
-        std::cerr << "Error: Failed to generate builtin module '" << module_name << "'" << std::endl;
-    }
-    return compilation_successful;
+    return thread_pool.enqueue([bitcode = std::move(bitcode), module_path = cache_path / module_name, module_name]() {
+        return compile_module_bitcode(bitcode, module_path, module_name);
+    });
 }
 
 bool Generator::Module::generate_modules() {
@@ -144,48 +166,29 @@ bool Generator::Module::generate_modules() {
         return true;
     }
 
+    // All modules are generated one after another but compiled in parallel. The modules are collected in a fixed order, which keeps
+    // the order of the object files in the static library the same no matter which module finished compiling first
+    PROFILE_THREADED_SCOPE("Generate modules", true);
+    std::vector<std::pair<std::string, std::future<bool>>> compilations;
     bool success = true;
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::PRINT)) {
-        success = success && generate_module(BuiltinLibrary::PRINT, cache_path, "print");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::STR)) {
-        success = success && generate_module(BuiltinLibrary::STR, cache_path, "str");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::CAST)) {
-        success = success && generate_module(BuiltinLibrary::CAST, cache_path, "cast");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::ARITHMETIC)) {
-        success = success && generate_module(BuiltinLibrary::ARITHMETIC, cache_path, "arithmetic");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::ARRAY)) {
-        success = success && generate_module(BuiltinLibrary::ARRAY, cache_path, "array");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::READ)) {
-        success = success && generate_module(BuiltinLibrary::READ, cache_path, "read");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::ASSERT)) {
-        success = success && generate_module(BuiltinLibrary::ASSERT, cache_path, "assert");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::FILESYSTEM)) {
-        success = success && generate_module(BuiltinLibrary::FILESYSTEM, cache_path, "filesystem");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::ENV)) {
-        success = success && generate_module(BuiltinLibrary::ENV, cache_path, "env");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::SYSTEM)) {
-        success = success && generate_module(BuiltinLibrary::SYSTEM, cache_path, "system");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::MATH)) {
-        success = success && generate_module(BuiltinLibrary::MATH, cache_path, "math");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::PARSE)) {
-        success = success && generate_module(BuiltinLibrary::PARSE, cache_path, "parse");
-    }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::TIME)) {
-        success = success && generate_module(BuiltinLibrary::TIME, cache_path, "time");
+    for (const auto &[lib, module_name] : builtin_modules) {
+        if ((which_need_rebuilding & static_cast<unsigned int>(lib)) == 0) {
+            continue;
+        }
+        std::optional<std::future<bool>> compilation = generate_module(lib, cache_path, std::string(module_name));
+        if (!compilation.has_value()) {
+            std::cerr << "Error: Failed to generate builtin module '" << module_name << "'" << std::endl;
+            success = false;
+            break;
+        }
+        compilations.emplace_back(module_name, std::move(compilation.value()));
     }
-    if (which_need_rebuilding & static_cast<unsigned int>(BuiltinLibrary::DIMA)) {
-        success = success && generate_module(BuiltinLibrary::DIMA, cache_path, "dima");
+    // Every compilation needs to finish before returning, even if an earlier one failed, since they all write into the cache directory
+    for (auto &[module_name, compilation] : compilations) {
+        if (!compilation.get()) {
+            std::cerr << "Error: Failed to generate builtin module '" << module_name << "'" << std::endl;
+            success = false;
+        }
     }
     if (!success) {
         return false;
@@ -212,20 +215,9 @@ bool Generator::Module::generate_modules() {
             break;
     }
     std::vector<std::filesystem::path> libs;
-    libs.emplace_back(cache_path / ("print" + file_ending));
-    libs.emplace_back(cache_path / ("str" + file_ending));
-    libs.emplace_back(cache_path / ("cast" + file_ending));
-    libs.emplace_back(cache_path / ("arithmetic" + file_ending));
-    libs.emplace_back(cache_path / ("array" + file_ending));
-    libs.emplace_back(cache_path / ("read" + file_ending));
-    libs.emplace_back(cache_path / ("assert" + file_ending));
-    libs.emplace_back(cache_path / ("filesystem" + file_ending));
-    libs.emplace_back(cache_path / ("env" + file_ending));
-    libs.emplace_back(cache_path / ("system" + file_ending));
-    libs.emplace_back(cache_path / ("math" + file_ending));
-    libs.emplace_back(cache_path / ("parse" + file_ending));
-    libs.emplace_back(cache_path / ("time" + file_ending));
-    libs.emplace_back(cache_path / ("dima" + file_ending));
+    for (const auto &[lib, module_name] : builtin_modules) {
+        libs.emplace_back(cache_path / (std::string(module_name) + file_ending));
+    }
 
     // Delete the old `builtins.` o / obj file before creating a new one
     std::filesystem::path builtins_path = cache_path / ("builtins" + file_ending);
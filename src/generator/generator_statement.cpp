@@ -212,8 +212,7 @@ bool Generator::Statement::clear_garbage(
                 std::cout << "  -- Type '" << type->to_string() << "' val addr: " << llvm_val << "\n";
             }
             ASSERT(type->is_freeable());
-            llvm::Function *free_fn = Memory::memory_functions.at("free");
-            llvm::CallInst *free_call = builder.CreateCall(free_fn, {llvm_val, builder.getInt32(type->get_id())});
+            llvm::CallInst *free_call = Memory::generate_free_call(&builder, builder.GetInsertBlock()->getModule(), llvm_val, type);
             free_call->setMetadata("comment",
                 llvm::MDNode::get(context,
                     llvm::MDString ::get(context, "Clear garbage of type '" + type->to_string() + "', depth " + std::to_string(key))));
@@ -322,12 +321,11 @@ bool Generator::Statement::generate_end_of_scope(llvm::IRBuilder<> &builder, Gen
             var_type = alias_type->type;
         }
         // Free the variable by simply calling the `memory.free` function
-        const std::string alloca_name = "s" + std::to_string(variable.scope_id) + "::" + var_name;
-        llvm::Value *const alloca = ctx.allocations.at(alloca_name);
+        llvm::Value *const alloca = ctx.allocations.get_variable(variable.slot);
         llvm::Value *variable_value = alloca;
         const IR::TypeStorageInfo &variable_type_info = IR::get_type(ctx.parent->getParent(), var_type);
         const bool var_is_array = var_type->get_variation() == Type::Variation::ARRAY && !var_type->as<ArrayType>()->sizes.has_value();
-        const bool var_is_str = var_type->to_string() == "str";
+        const bool var_is_str = var_type->is(Type::Builtin::STR);
         const bool var_is_opaque = var_type->get_variation() == Type::Variation::OPAQUE;
         if ((variable_type_info.is_complex || var_is_array || var_is_str || var_is_opaque) && !variable.is_fn_param) {
             llvm::Type *type_to_load = variable_type_info.is_complex ? PTR_TY : variable_type_info.type;
@@ -382,7 +380,7 @@ bool Generator::Statement::generate_return_statement(llvm::IRBuilder<> &builder,
         }
 
         // If the rhs is of type `str`, delete the last "garbage", as thats the _actual_ return value
-        if (return_node->return_value.value()->type->to_string() == "str" && garbage.count(0) > 0) {
+        if (return_node->return_value.value()->type->is(Type::Builtin::STR) && garbage.count(0) > 0) {
             garbage.at(0).clear();
         }
         if (!clear_garbage(builder, garbage)) {
@@ -478,10 +476,27 @@ bool Generator::Statement::generate_throw_statement(llvm::IRBuilder<> &builder,
         type_map.at("type.ts.function"), ctx.allocations.at("flint.stack"), Module::ThreadStack::FUNCTION::ERR //
     );
 
-    // Generate the expression right of the throw statement, it has to be an error set
+    // Generate the expression right of the throw statement, it has to be an error set. Thrown error literals with their default message
+    // are built by the outlined `flint.cold.create_err` function, as a throw is never on the hot path
     Expression::garbage_type garbage;
-    auto expr_result = Expression::generate_expression(builder, ctx, garbage, 0, throw_node->throw_value.get());
-    llvm::Value *err_value = expr_result.value().front();
+    llvm::Value *err_value = nullptr;
+    const ExpressionNode *throw_value = throw_node->throw_value.get();
+    const auto *lit_error = throw_value->get_variation() == ExpressionNode::Variation::LITERAL
+        ? std::get_if<LitError>(&throw_value->as<LiteralNode>()->value)
+        : nullptr;
+    if (lit_error != nullptr && !lit_error->message.has_value()) {
+        const ErrorNode *error_node = lit_error->error_type->as<ErrorSetType>()->error_node;
+        const auto err_value_msg_pair = error_node->get_id_msg_pair_of_value(lit_error->value);
+        if (!err_value_msg_pair.has_value()) {
+            THROW_BASIC_ERR(ERR_GENERATING);
+            return false;
+        }
+        const auto &[value_id, message] = err_value_msg_pair.value();
+        err_value = IR::generate_err_value(builder, ctx.parent->getParent(), error_node->error_id, value_id, message);
+    } else {
+        auto expr_result = Expression::generate_expression(builder, ctx, garbage, 0, throw_value);
+        err_value = expr_result.value().front();
+    }
     // Store the error value in the error field of the current function
     IR::aligned_store(builder, err_value, error_ptr);
 
@@ -990,9 +1005,11 @@ bool Generator::Statement::generate_enh_for_loop(llvm::IRBuilder<> &builder, Gen
         llvm::Value *calculated_length = builder.CreateSub(upper_bound, lower_bound, "range_length");
         // Ensure length is positive
         llvm::Value *is_positive = builder.CreateICmpSGE(calculated_length, builder.getInt64(0), "is_positive");
+        // The bounds expressions may have split the block the loop started in, so the check happens in the block they ended in
+        llvm::BasicBlock *range_check_block = builder.GetInsertBlock();
         llvm::BasicBlock *range_error_block = llvm::BasicBlock::Create(context, "range_error", ctx.parent);
         llvm::BasicBlock *range_continue_block = llvm::BasicBlock::Create(context, "range_continue", ctx.parent);
-        builder.CreateCondBr(is_positive, range_continue_block, range_error_block);
+        builder.CreateCondBr(is_positive, range_continue_block, range_error_block, IR::generate_weights(100, 1));
 
         builder.SetInsertPoint(range_error_block);
         // For simplicity, set length to 0 and continue
@@ -1005,7 +1022,7 @@ bool Generator::Statement::generate_enh_for_loop(llvm::IRBuilder<> &builder, Gen
 
         builder.SetInsertPoint(range_continue_block);
         llvm::PHINode *length_phi = builder.CreatePHI(builder.getInt64Ty(), 2, "length_phi");
-        length_phi->addIncoming(calculated_length, pred_block);
+        length_phi->addIncoming(calculated_length, range_check_block);
         length_phi->addIncoming(error_length, range_error_block);
         length = length_phi;
         element_type = builder.getInt64Ty();
@@ -1021,25 +1038,15 @@ bool Generator::Statement::generate_enh_for_loop(llvm::IRBuilder<> &builder, Gen
     llvm::Type *tuple_type = nullptr;
     llvm::Value *index_alloca = nullptr;
     if (std::holds_alternative<std::string>(for_node->iterators)) {
-        const unsigned int scope_id = for_node->definition_scope->scope_id;
-        const std::string tuple_alloca_name = "s" + std::to_string(scope_id) + "::" + std::get<std::string>(for_node->iterators);
-        tuple_alloca = ctx.allocations.at(tuple_alloca_name);
         const auto tuple_var = for_node->definition_scope->variables.at(std::get<std::string>(for_node->iterators));
+        tuple_alloca = ctx.allocations.get_variable(for_node->index_slot);
         tuple_type = IR::get_type(ctx.parent->getParent(), tuple_var.type).type;
         llvm::Value *idx_ptr = builder.CreateStructGEP(tuple_type, tuple_alloca, 0, "idx_ptr");
         IR::aligned_store(builder, builder.getInt64(0), idx_ptr);
     } else {
-        const auto iterators = std::get<std::pair<std::optional<std::string>, std::optional<std::string>>>(for_node->iterators);
-        const unsigned int scope_id = for_node->definition_scope->scope_id;
-        if (iterators.first.has_value()) {
-            const std::string index_alloca_name = "s" + std::to_string(scope_id) + "::" + iterators.first.value();
-            index_alloca = ctx.allocations.at(index_alloca_name);
-            IR::aligned_store(builder, builder.getInt64(0), index_alloca);
-        } else {
-            const std::string index_alloca_name = "s" + std::to_string(scope_id) + "::IDX";
-            index_alloca = ctx.allocations.at(index_alloca_name);
-            IR::aligned_store(builder, builder.getInt64(0), index_alloca);
-        }
+        // The index slot is the slot of the hidden index counter if the index is discarded
+        index_alloca = ctx.allocations.get_variable(for_node->index_slot);
+        IR::aligned_store(builder, builder.getInt64(0), index_alloca);
         // The second element will be handled later
     }
     builder.CreateBr(for_blocks[0]);
@@ -1084,18 +1091,14 @@ bool Generator::Statement::generate_enh_for_loop(llvm::IRBuilder<> &builder, Gen
         IR::aligned_store(builder, current_element, elem_ptr);
     } else {
         // If we have a elem variable the elem variable is actually just the iterable element itself
-        const auto iterators = std::get<std::pair<std::optional<std::string>, std::optional<std::string>>>(for_node->iterators);
-        if (iterators.second.has_value()) {
-            const unsigned int scope_id = for_node->definition_scope->scope_id;
-            const std::string element_alloca_name = "s" + std::to_string(scope_id) + "::" + iterators.second.value();
+        if (for_node->element_slot.has_value()) {
+            const unsigned int element_slot = for_node->element_slot.value();
             if (is_range) {
-                llvm::Value *const element_alloca = ctx.allocations.at(element_alloca_name);
+                llvm::Value *const element_alloca = ctx.allocations.get_variable(element_slot);
                 IR::aligned_store(builder, current_element, element_alloca);
             } else {
                 // For non-range, replace the old nullptr alloca with the new alloca
-                ASSERT(ctx.allocations.find(element_alloca_name) == ctx.allocations.end());
-                ctx.allocations.erase(element_alloca_name);
-                ctx.allocations.emplace(element_alloca_name, current_element_ptr);
+                ctx.allocations.set_variable(element_slot, current_element_ptr);
             }
         }
     }
@@ -1175,17 +1178,16 @@ bool Generator::Statement::generate_optional_switch_statement( //
                 return false;
             }
             const auto *switcher_var_node = switch_statement->switcher->as<VariableNode>();
-            const unsigned int switcher_scope_id = ctx.scope->variables.at(switcher_var_node->name).scope_id;
-            const std::string switcher_var_str = "s" + std::to_string(switcher_scope_id) + "::" + switcher_var_node->name;
+            const unsigned int switcher_slot = switcher_var_node->slot;
             llvm::StructType *opt_struct_type = IR::add_and_or_get_type(ctx.parent->getParent(), switch_statement->switcher->type, false);
             // if (switch_value->getType()->isPointerTy()) {
             //     switch_value = IR::aligned_load(builder, opt_struct_type, switch_value, "loaded_rhs");
             // }
-            llvm::Value *var_alloca = ctx.allocations.at(switcher_var_str);
+            llvm::Value *var_alloca = ctx.allocations.get_variable(switcher_slot);
             if (match_node->name.has_value()) {
-                const std::string var_str = "s" + std::to_string(branch.body->parent_scope->scope_id) + "::" + match_node->name.value();
+                const unsigned int match_slot = match_node->slot;
                 llvm::Value *real_value_reference = builder.CreateStructGEP(opt_struct_type, var_alloca, 1, "value_reference");
-                ctx.allocations.emplace(var_str, real_value_reference);
+                ctx.allocations.set_variable(match_slot, real_value_reference);
             }
             value_block_idx = i;
         }
@@ -1209,10 +1211,9 @@ bool Generator::Statement::generate_optional_switch_statement( //
         return false;
     }
     const auto *switcher_var_node = switch_statement->switcher->as<VariableNode>();
-    const unsigned int switcher_scope_id = ctx.scope->variables.at(switcher_var_node->name).scope_id;
-    const std::string switcher_var_str = "s" + std::to_string(switcher_scope_id) + "::" + switcher_var_node->name;
+    const unsigned int switcher_slot = switcher_var_node->slot;
     llvm::StructType *opt_struct_type = IR::add_and_or_get_type(ctx.parent->getParent(), switch_statement->switcher->type, false);
-    llvm::Value *var_alloca = ctx.allocations.at(switcher_var_str);
+    llvm::Value *var_alloca = ctx.allocations.get_variable(switcher_slot);
     // We just check for the "has_value" field and branch to our blocks depending on that field's value
     llvm::Value *const has_value_ptr = builder.CreateStructGEP(opt_struct_type, var_alloca, 0, "has_value_ptr");
     llvm::Value *const has_value_i8 = IR::aligned_load(builder, builder.getInt8Ty(), has_value_ptr, "has_value_i8");
@@ -1253,8 +1254,7 @@ bool Generator::Statement::generate_variant_switch_statement( //
         return false;
     }
     const auto *switcher_var_node = switch_statement->switcher->as<VariableNode>();
-    const unsigned int switcher_scope_id = ctx.scope->variables.at(switcher_var_node->name).scope_id;
-    const std::string switcher_var_str = "s" + std::to_string(switcher_scope_id) + "::" + switcher_var_node->name;
+    const unsigned int switcher_slot = switcher_var_node->slot;
     // The switcher variable must be a variant type
     const auto *variant_type = switch_statement->switcher->type->as<VariantType>();
     llvm::StructType *variant_struct_type;
@@ -1266,7 +1266,7 @@ bool Generator::Statement::generate_variant_switch_statement( //
     if (switch_value->getType()->isPointerTy()) {
         switch_value = IR::aligned_load(builder, variant_struct_type, switch_value, "loaded_rhs");
     }
-    llvm::Value *var_alloca = ctx.allocations.at(switcher_var_str);
+    llvm::Value *var_alloca = ctx.allocations.get_variable(switcher_slot);
 
     for (size_t i = 0; i < switch_statement->branches.size(); i++) {
         const auto &branch = switch_statement->branches[i];
@@ -1287,17 +1287,17 @@ bool Generator::Statement::generate_variant_switch_statement( //
 
         const auto *match_node = branch.matches.front()->as<SwitchMatchNode>();
         if (match_node->name.has_value()) {
-            const std::string var_str = "s" + std::to_string(branch.body->parent_scope->scope_id) + "::" + match_node->name.value();
+            const unsigned int match_slot = match_node->slot;
             llvm::Value *real_value_reference = nullptr;
             if (variant_type->is_err_variant) {
                 real_value_reference = var_alloca;
-                if (match_node->type->to_string() == "anyerror") {
+                if (match_node->type->is(Type::Builtin::ANYERROR)) {
                     default_block = branch_blocks[i];
                 }
             } else {
                 real_value_reference = builder.CreateStructGEP(variant_struct_type, var_alloca, 1, "value_reference");
             }
-            ctx.allocations.emplace(var_str, real_value_reference);
+            ctx.allocations.set_variable(match_slot, real_value_reference);
         }
 
         ctx.scope = branch.body;
@@ -1364,6 +1364,27 @@ bool Generator::Statement::generate_switch_statement( //
     Expression::garbage_type garbage;
     group_mapping expr_result = Expression::generate_expression(builder, ctx, garbage, 0, switch_statement->switcher.get());
     llvm::Value *switch_value = expr_result.value().front();
+
+    // Strings are first dispatched to the index of the matching literal, the switch itself then switches over these indices. This needs
+    // to happen before the garbage is cleared, as the switcher could be a temporary string
+    const bool is_string_switch = switch_statement->switcher->type->is(Type::Builtin::STR);
+    std::vector<std::string_view> string_literals;
+    if (is_string_switch) {
+        for (const auto &branch : switch_statement->branches) {
+            if (branch.matches.front()->get_variation() == ExpressionNode::Variation::DEFAULT) {
+                continue;
+            }
+            for (const auto &match : branch.matches) {
+                const std::optional<std::string_view> literal = Logical::get_string_literal(match.get());
+                if (!literal.has_value()) {
+                    THROW_BASIC_ERR(ERR_GENERATING);
+                    return false;
+                }
+                string_literals.emplace_back(literal.value());
+            }
+        }
+        switch_value = Logical::generate_string_switch_index(builder, switch_value, string_literals);
+    }
     if (!clear_garbage(builder, garbage)) {
         THROW_BASIC_ERR(ERR_GENERATING);
         return false;
@@ -1428,6 +1449,7 @@ bool Generator::Statement::generate_switch_statement( //
     }
 
     // Add the cases to the switch instruction
+    size_t string_literal_idx = 0;
     for (size_t i = 0; i < switch_statement->branches.size(); i++) {
         const auto &branch = switch_statement->branches[i];
         // Skip the default node, this block is not targetted directly by any switch expression
@@ -1437,6 +1459,15 @@ bool Generator::Statement::generate_switch_statement( //
 
         // Generate the case values
         for (auto &match : branch.matches) {
+            if (is_string_switch) {
+                // A literal listed multiple times only matches at its first occurrence
+                const size_t literal_idx = string_literal_idx++;
+                const auto first_it = std::find(string_literals.begin(), string_literals.end(), string_literals[literal_idx]);
+                if (static_cast<size_t>(std::distance(string_literals.begin(), first_it)) == literal_idx) {
+                    switch_inst->addCase(builder.getInt32(static_cast<uint32_t>(literal_idx)), branch_blocks[i]);
+                }
+                continue;
+            }
             if (match->get_variation() == ExpressionNode::Variation::LITERAL) {
                 const auto *literal_node = match->as<LiteralNode>();
                 if (std::holds_alternative<LitError>(literal_node->value)) {
@@ -1513,7 +1544,7 @@ bool Generator::Statement::generate_catch_statement(llvm::IRBuilder<> &builder,
     builder.SetInsertPoint(current_block);
 
     // Create the branching operation
-    builder.CreateCondBr(last_err_values.first, catch_block, merge_block)
+    builder.CreateCondBr(last_err_values.first, catch_block, merge_block, IR::generate_weights(1, 100))
         ->setMetadata("comment",
             llvm::MDNode::get(context,
                 llvm::MDString::get(context, "Branch to '" + catch_block->getName().str() + "' if '" + fn_name + "' returned error")));
@@ -1535,11 +1566,9 @@ bool Generator::Statement::generate_catch_statement(llvm::IRBuilder<> &builder,
     err_val->setMetadata("comment",
         llvm::MDNode::get(context,
             llvm::MDString::get(context, "Load err val of call '" + fn_name + "::" + std::to_string(call_node->call_id) + "'")));
-    std::string err_alloca_name;
+    // Add the error variable to the list of allocations (temporarily)
+    ctx.allocations.set_variable(catch_node->err_slot, err_ptr);
     if (catch_node->var_name.has_value()) {
-        // Add the error variable to the list of allocations (temporarily)
-        err_alloca_name = "s" + std::to_string(catch_node->scope->scope_id) + "::" + catch_node->var_name.value();
-        ctx.allocations.insert({err_alloca_name, err_ptr});
 
         // Emit debug info for the catch variable if in debug mode
         if (OPTIMIZE_MODE == OptimizeMode::DEBUG) {
@@ -1574,16 +1603,13 @@ bool Generator::Statement::generate_catch_statement(llvm::IRBuilder<> &builder,
         // Generate the implicit switch on the error value
         ASSERT(catch_node->scope->body.size() == 1);
         const auto *switch_statement = catch_node->scope->body.front()->as<SwitchStatement>();
-        // Add the error variable to the list of allocations (temporarily)
-        err_alloca_name = "s" + std::to_string(catch_node->scope->scope_id) + "::flint.value_err";
-        ctx.allocations.insert({err_alloca_name, err_ptr});
         if (!generate_variant_switch_statement(builder, ctx, switch_statement, err_ptr)) {
             THROW_BASIC_ERR(ERR_GENERATING);
             return false;
         }
     }
     // Remove the error variable from the list of allocations
-    ctx.allocations.erase(ctx.allocations.find(err_alloca_name));
+    ctx.allocations.erase_variable(catch_node->err_slot);
 
     // Add branch to the merge block from the catch block if it does not contain a terminator (return or throw)
     // If the catch block has its own blocks, we actually dont need to check the catch block but the second last block in the function
@@ -1641,8 +1667,7 @@ bool Generator::Statement::generate_group_declaration( //
             continue;
         }
         // Store the expression result in an variable
-        const std::string variable_name = "s" + std::to_string(ctx.scope->scope_id) + "::" + variable.second;
-        llvm::Value *const variable_alloca = ctx.allocations.at(variable_name);
+        llvm::Value *const variable_alloca = ctx.allocations.get_variable(declaration_node->slots.at(elem_idx));
         IR::aligned_store(builder, elem_value, variable_alloca);
         elem_idx++;
     }
@@ -1690,9 +1715,7 @@ bool Generator::Statement::generate_declaration( //
 
         builder.SetInsertPoint(declaration_block);
     }
-    const unsigned int scope_id = ctx.scope->variables.at(declaration_node->name).scope_id;
-    const std::string var_name = "s" + std::to_string(scope_id) + "::" + declaration_node->name;
-    llvm::Value *const alloca = ctx.allocations.at(var_name);
+    llvm::Value *const alloca = ctx.allocations.get_variable(declaration_node->slot);
 
     llvm::Value *expression;
     if (declaration_node->initializer.has_value()) {
@@ -1755,7 +1778,7 @@ bool Generator::Statement::generate_declaration( //
             case Type::Variation::OPTIONAL: {
                 if (declaration_node->initializer.value()->get_variation() == ExpressionNode::Variation::TYPE_CAST) {
                     const auto *typecast_node = declaration_node->initializer.value()->as<TypeCastNode>();
-                    if (typecast_node->expr->type->to_string() == "void?") {
+                    if (typecast_node->expr->type->is(Type::Builtin::VOID_OPT)) {
                         break;
                     }
                 }
@@ -1831,7 +1854,7 @@ bool Generator::Statement::generate_declaration( //
         expression = IR::get_default_value_of_type(builder, ctx.parent->getParent(), declaration_node->type);
     }
 
-    if (declaration_node->type->to_string() == "str") {
+    if (declaration_node->type->is(Type::Builtin::STR)) {
         std::optional<const ExpressionNode *> initializer;
         if (declaration_node->initializer.has_value()) {
             initializer = declaration_node->initializer.value().get();
@@ -1942,7 +1965,7 @@ bool Generator::Statement::generate_assign_to_lvalue( //
         llvm::Value *lhs_value = lhs;
         const IR::TypeStorageInfo &var_type_info = IR::get_type(ctx.parent->getParent(), lhs_type);
         const bool var_is_array = lhs_type->get_variation() == Type::Variation::ARRAY && !lhs_type->as<ArrayType>()->sizes.has_value();
-        const bool var_is_str = lhs_type->to_string() == "str";
+        const bool var_is_str = lhs_type->is(Type::Builtin::STR);
         if (var_type_info.is_complex || var_is_array || var_is_str) {
             llvm::Type *type_to_load = var_type_info.is_complex ? PTR_TY : var_type_info.type;
             lhs_value = IR::aligned_load(builder, type_to_load, lhs_value, "variable_value");
@@ -1978,7 +2001,8 @@ bool Generator::Statement::generate_assign_to_lvalue( //
 
 bool Generator::Statement::generate_assignment(llvm::IRBuilder<> &builder, GenerationContext &ctx, const AssignmentNode *assignment_node) {
     Expression::garbage_type garbage;
-    const bool is_discarded = assignment_node->name == "_";
+    // Discard assignments `_ = expr` are the only assignments without a variable slot
+    const bool is_discarded = !assignment_node->slot.has_value();
     const bool is_reference = is_discarded || assignment_node->type->get_variation() == Type::Variation::ERROR_SET;
     auto expr = Expression::generate_expression(builder, ctx, garbage, 0, assignment_node->expression.get(), is_reference);
     if (!expr.has_value()) {
@@ -1986,7 +2010,7 @@ bool Generator::Statement::generate_assignment(llvm::IRBuilder<> &builder, Gener
         return false;
     }
     // If the rhs is of type `str`, delete the last "garbage", as thats the _actual_ value
-    if (assignment_node->expression->type->to_string() == "str" && garbage.count(0) > 0) {
+    if (assignment_node->expression->type->is(Type::Builtin::STR) && garbage.count(0) > 0) {
         garbage.at(0).clear();
     }
     if (!clear_garbage(builder, garbage)) {
@@ -2015,16 +2039,9 @@ bool Generator::Statement::generate_assignment(llvm::IRBuilder<> &builder, Gener
         return true;
     }
 
-    // Check if the variable is declared
-    if (ctx.scope->variables.find(assignment_node->name) == ctx.scope->variables.end()) {
-        // Error: Undeclared Variable
-        THROW_BASIC_ERR(ERR_GENERATING);
-        return false;
-    }
-    // Get the allocation of the lhs
-    const std::shared_ptr<Type> &variable_type = ctx.scope->variables.at(assignment_node->name).type;
-    const unsigned int variable_decl_scope = ctx.scope->variables.at(assignment_node->name).scope_id;
-    llvm::Value *const lhs = ctx.allocations.at("s" + std::to_string(variable_decl_scope) + "::" + assignment_node->name);
+    // Get the allocation of the lhs, the type of the assignment is the type of the assigned variable
+    const std::shared_ptr<Type> &variable_type = assignment_node->type;
+    llvm::Value *const lhs = ctx.allocations.get_variable(assignment_node->slot.value());
 
     // If its a group type we have to handle it differently than when its a single value
     if (assignment_node->expression->type->get_variation() == Type::Variation::GROUP) {
@@ -2055,7 +2072,7 @@ bool Generator::Statement::generate_assignment(llvm::IRBuilder<> &builder, Gener
             // whether the LLVM type of the expression's type matches our expected optional type
             const bool types_match = expr.value().front()->getType() == var_type;
             const TypeCastNode *rhs_cast = dynamic_cast<const TypeCastNode *>(assignment_node->expression.get());
-            if (!types_match && (rhs_cast == nullptr || rhs_cast->expr->type->to_string() != "void?")) {
+            if (!types_match && (rhs_cast == nullptr || !rhs_cast->expr->type->is(Type::Builtin::VOID_OPT))) {
                 // Get the pointer to the i1 element of the optional variable and set it to 1
                 llvm::Value *var_has_value_ptr = builder.CreateStructGEP(var_type, lhs, 0, assignment_node->name + "_has_value_ptr");
                 llvm::StoreInst *store = IR::aligned_store(builder, builder.getInt8(1), var_has_value_ptr);
@@ -2119,7 +2136,7 @@ bool Generator::Statement::generate_assignment(llvm::IRBuilder<> &builder, Gener
     }
     // Its definitely a single value
     llvm::Value *expression = expr.value().front();
-    if (assignment_node->type->to_string() == "str") {
+    if (assignment_node->type->is(Type::Builtin::STR)) {
         // Only generate the string assignment if its not a shorthand
         if (!assignment_node->is_shorthand) {
             Module::String::generate_string_assignment(builder, lhs, assignment_node->expression.get(), expression);
@@ -2209,7 +2226,7 @@ bool Generator::Statement::generate_data_field_assignment( //
     }
     llvm::Value *expr_val = expression.value().front();
     const auto &base_expr_type = data_field_assignment->base_expr->type;
-    const bool is_bool8 = base_expr_type->to_string() == "bool8";
+    const bool is_bool8 = base_expr_type->is(Type::Builtin::BOOL8);
     const bool is_tuple = base_expr_type->get_variation() == Type::Variation::TUPLE;
     const bool is_vector = base_expr_type->get_variation() == Type::Variation::VECTOR;
     auto base_expr = Expression::generate_expression(                                                       //
@@ -2255,7 +2272,7 @@ bool Generator::Statement::generate_data_field_assignment( //
         llvm::StructType *field_optional_type = IR::add_and_or_get_type(ctx.parent->getParent(), field_type, false);
 
         // Handle special cases (like str cleanup)
-        if (optional_type->base_type->to_string() == "str") {
+        if (optional_type->base_type->is(Type::Builtin::STR)) {
             llvm::Value *field_value_ptr = builder.CreateStructGEP(field_optional_type, field_ptr, 1, "field_value_ptr");
             llvm::Value *actual_str_ptr = IR::aligned_load(builder, PTR_TY, field_value_ptr, "actual_str_ptr");
             builder.CreateCall(c_functions.at(FREE), {actual_str_ptr});
@@ -2263,7 +2280,7 @@ bool Generator::Statement::generate_data_field_assignment( //
 
         // Check if we need to handle optional conversion
         const bool types_match = expr_val->getType() == field_optional_type;
-        if (!types_match && (rhs_cast == nullptr || rhs_cast->expr->type->to_string() != "void?")) {
+        if (!types_match && (rhs_cast == nullptr || !rhs_cast->expr->type->is(Type::Builtin::VOID_OPT))) {
             // Set has_value to true
             llvm::Value *field_has_value_ptr = builder.CreateStructGEP(field_optional_type, field_ptr, 0, "field_has_value_ptr");
             llvm::StoreInst *store = IR::aligned_store(builder, builder.getInt8(1), field_has_value_ptr);
@@ -2359,7 +2376,7 @@ bool Generator::Statement::generate_grouped_data_field_assignment( //
         return false;
     }
     const auto &base_expr_type = grouped_field_assignment->base_expr->type;
-    const bool is_bool8 = base_expr_type->to_string() == "bool8";
+    const bool is_bool8 = base_expr_type->is(Type::Builtin::BOOL8);
     const bool is_tuple = base_expr_type->get_variation() == Type::Variation::TUPLE;
     const bool is_vector = base_expr_type->get_variation() == Type::Variation::VECTOR;
     auto base_expr = Expression::generate_expression(                                                          //
@@ -2461,7 +2478,7 @@ bool Generator::Statement::generate_array_assignment( //
         return false;
     }
     llvm::Value *array_ptr = base_expr.value().front();
-    if (array_assignment->base_expr->type->to_string() == "str" && array_assignment->expression->type->to_string() == "u8") {
+    if (array_assignment->base_expr->type->is(Type::Builtin::STR) && array_assignment->expression->type->is(Type::Builtin::U8)) {
         // We assign a single u8 value in a string
         ASSERT(idx_expressions.size() == 1);
         llvm::Function *const assign_str_at_fn = Module::String::string_manip_functions.at("assign_str_at");
@@ -2470,7 +2487,7 @@ bool Generator::Statement::generate_array_assignment( //
     }
 
     // Store all the results of the index expressions in the indices array
-    llvm::Value *const indices = ctx.allocations.at("arr::idx::" + std::to_string(array_assignment->indexing_expressions.size()));
+    llvm::Value *const indices = ctx.allocations.get_index_array(array_assignment->indexing_expressions.size());
     for (size_t i = 0; i < idx_expressions.size(); i++) {
         llvm::Value *idx_ptr = builder.CreateGEP(builder.getInt64Ty(), indices, builder.getInt64(i), "idx_ptr_" + std::to_string(i));
         IR::aligned_store(builder, idx_expressions[i], idx_ptr);
@@ -2515,7 +2532,7 @@ bool Generator::Statement::generate_array_assignment( //
     // Free the value stored in the array before assigning the new value
     const IR::TypeStorageInfo &base_type_info = IR::get_type(ctx.parent->getParent(), base_type);
     const bool var_is_array = base_type->get_variation() == Type::Variation::ARRAY && !base_type->as<ArrayType>()->sizes.has_value();
-    const bool var_is_str = base_type->to_string() == "str";
+    const bool var_is_str = base_type->is(Type::Builtin::STR);
     const bool var_is_opaque = base_type->get_variation() == Type::Variation::OPAQUE;
     llvm::Value *arr_value = arr_value_ptr;
     if (base_type_info.is_complex || var_is_array || var_is_str || var_is_opaque) {
@@ -2560,7 +2577,7 @@ bool Generator::Statement::generate_grouped_array_assignment( //
 
     // Generate the base expression for the grouped array assignment
     std::optional<ArrayType *> array_type;
-    if (array_assignment->base_expr->type->to_string() != "str") {
+    if (!array_assignment->base_expr->type->is(Type::Builtin::STR)) {
         array_type = array_assignment->base_expr->type->as<ArrayType>();
     }
     const bool is_const_array = array_type.has_value() && array_type.value()->sizes.has_value();
@@ -2594,7 +2611,7 @@ bool Generator::Statement::generate_grouped_array_assignment( //
             return false;
         }
 
-        if (!array_type.has_value() && expr_type->types.at(i)->to_string() == "u8") {
+        if (!array_type.has_value() && expr_type->types.at(i)->is(Type::Builtin::U8)) {
             // We assign a single u8 value in a string
             ASSERT(idx_expressions.value().size() == 1);
             llvm::Function *const assign_str_at_fn = Module::String::string_manip_functions.at("assign_str_at");
@@ -2608,7 +2625,7 @@ bool Generator::Statement::generate_grouped_array_assignment( //
         }
 
         // Store all the results of the index expressions in the indices array
-        llvm::Value *const indices = ctx.allocations.at("arr::idx::" + std::to_string(idx_expressions.value().size()));
+        llvm::Value *const indices = ctx.allocations.get_index_array(idx_expressions.value().size());
         for (size_t j = 0; j < idx_expressions.value().size(); j++) {
             llvm::Value *idx_ptr = builder.CreateGEP(builder.getInt64Ty(), indices, builder.getInt64(j), "idx_ptr_" + std::to_string(j));
             IR::aligned_store(builder, idx_expressions.value().at(j), idx_ptr);
@@ -2668,9 +2685,7 @@ bool Generator::Statement::generate_unary_op_statement( //
         return false;
     }
     const auto *var_node = unary_op->operand->as<VariableNode>();
-    const unsigned int scope_id = ctx.scope->variables.at(var_node->name).scope_id;
-    const std::string var_name = "s" + std::to_string(scope_id) + "::" + var_node->name;
-    llvm::Value *const alloca = ctx.allocations.at(var_name);
+    llvm::Value *const alloca = ctx.allocations.get_variable(var_node->slot);
 
     llvm::LoadInst *var_value = IR::aligned_load(builder,           //
         IR::get_type(ctx.parent->getParent(), var_node->type).type, //
@@ -2695,11 +2710,7 @@ bool Generator::Statement::generate_unary_op_statement( //
                 || var_type == "i8" || var_type == "i16" || var_type == "i32" || var_type == "i64" //
             ) {
                 llvm::Value *one = llvm::ConstantInt::get(var_value->getType(), 1);
-                operation_result = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                    ? builder.CreateAdd(var_value, one)
-                    : builder.CreateCall(                                                                                       //
-                          Module::Arithmetic::arithmetic_functions.at(var_type + "_safe_add"), {var_value, one}, "safe_add_res" //
-                      );
+                operation_result = Module::Arithmetic::generate_inline_safe_op(builder, TOK_PLUS, var_type, var_value, one);
             } else if (var_type == "f32" || var_type == "f64") {
                 llvm::Value *one = llvm::ConstantFP::get(var_value->getType(), 1.0);
                 operation_result = builder.CreateFAdd(var_value, one);
@@ -2714,11 +2725,7 @@ bool Generator::Statement::generate_unary_op_statement( //
                 || var_type == "i8" || var_type == "i16" || var_type == "i32" || var_type == "i64" //
             ) {
                 llvm::Value *one = llvm::ConstantInt::get(var_value->getType(), 1);
-                operation_result = overflow_mode == ArithmeticOverflowMode::UNSAFE
-                    ? builder.CreateSub(var_value, one)
-                    : builder.CreateCall(                                                                                       //
-                          Module::Arithmetic::arithmetic_functions.at(var_type + "_safe_sub"), {var_value, one}, "safe_sub_res" //
-                      );
+                operation_result = Module::Arithmetic::generate_inline_safe_op(builder, TOK_MINUS, var_type, var_value, one);
             } else if (var_type == "f32" || var_type == "f64") {
                 llvm::Value *one = llvm::ConstantFP::get(var_value->getType(), 1.0);
                 operation_result = builder.CreateFSub(var_value, one);
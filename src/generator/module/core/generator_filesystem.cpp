@@ -252,96 +252,119 @@ void Generator::Module::FileSystem::generate_read_lines_function( //
     // THE C IMPLEMENTATION:
     // str *read_lines(const str *path) {
     //     char *c_path = (char *)path->value;
-    //     // Open the file for reading
     //     FILE *file = fopen(c_path, "r");
     //     if (!file) {
-    //         return NULL; // File open error
+    //         THROW ErrFS.NotFound;
     //     }
-    //     // First pass: Count the number of lines
+    //     // Get the file size, pipes, FIFOs and procfs files cannot report one and are streamed instead
+    //     const int seek_result = fseek(file, 0, SEEK_END);
+    //     const long size = ftell(file);
+    //     char *data = NULL;
+    //     size_t data_size = 0;
+    //     bool is_mapped = false;
+    //     if (seek_result == 0 && size > 0) {
+    // #ifdef __WIN32__
+    //         // Text mode may translate line endings, so the content can be shorter than the file size
+    //         rewind(file);
+    //         data = malloc(size);
+    //         data_size = fread(data, 1, size, file);
+    // #else
+    //         // Regular files are mapped instead of copied, their pages are only read once so the kernel can read ahead and drop them
+    //         data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    //         if (data != MAP_FAILED) {
+    //             madvise(data, size, MADV_SEQUENTIAL);
+    //             data_size = size;
+    //             is_mapped = true;
+    //         } else {
+    //             data = NULL;
+    //         }
+    // #endif
+    //     }
+    //     if (data == NULL) {
+    //         rewind(file);
+    //         size_t capacity = 0;
+    //         for (;;) {
+    //             if (data_size == capacity) {
+    //                 capacity = capacity == 0 ? 65536 : capacity * 2;
+    //                 char *grown = realloc(data, capacity);
+    //                 if (grown == NULL) {
+    //                     free(data);
+    //                     fclose(file);
+    //                     THROW ErrFS.TooLarge;
+    //                 }
+    //                 data = grown;
+    //             }
+    //             const size_t read_count = fread(data + data_size, 1, capacity - data_size, file);
+    //             data_size += read_count;
+    //             if (read_count == 0) {
+    //                 break;
+    //             }
+    //         }
+    //         if (ferror(file)) {
+    //             free(data);
+    //             fclose(file);
+    //             THROW ErrFS.NotReadable;
+    //         }
+    //     }
+    //     fclose(file);
+    //     // First pass: Count the lines, a last line without a trailing newline still counts
     //     size_t line_count = 0;
-    //     int ch;
-    //     bool_t in_line = FALSE;
-    //     while ((ch = fgetc(file)) != EOF) {
-    //         if (ch == '\n') {
+    //     for (size_t pos = 0; pos < data_size; line_count++) {
+    //         const char *newline = memchr(data + pos, '\n', data_size - pos);
+    //         if (newline == NULL) {
     //             line_count++;
-    //             in_line = FALSE;
-    //         } else if (!in_line) {
-    //             in_line = TRUE;
+    //             break;
     //         }
+    //         pos = newline - data + 1;
     //     }
-    //     // Handle the case where the last line doesn't end with a newline
-    //     if (in_line) {
-    //         line_count++;
-    //     }
-    //     // Reset file pointer to beginning
-    //     rewind(file);
-    //     // Create the array of strings
     //     size_t lengths[1] = {line_count};
     //     str *lines_array = create_arr(1, sizeof(str *), lengths);
     //     if (!lines_array) {
-    //         fclose(file);
-    //         return NULL;
-    //     }
-    //     // Initialize array with NULL pointers
-    //     str *null_ptr = NULL;
-    //     fill_arr_inline(lines_array, sizeof(str *), &null_ptr);
-    //     // Read lines and populate the array
-    //     size_t line_idx = 0;
-    //     char buffer[4096]; // Buffer for reading lines
-    //     size_t idx[1];     // For accessing array elements
-    //     while (fgets(buffer, sizeof(buffer), file)) {
-    //         size_t len = strlen(buffer);
-    //         // Remove trailing newline if present
-    //         if (len > 0 && buffer[len - 1] == '\n') {
-    //             buffer[--len] = '\0';
-    //         }
-    //         // Create str for this line
-    //         str *line = init_str(buffer, len);
-    //         if (!line) {
-    //             // Clean up on error
-    //             for (size_t i = 0; i < line_idx; i++) {
-    //                 idx[0] = i;
-    //                 str *line_str = *(str **)access_arr(lines_array, sizeof(str *), idx);
-    //                 free(line_str);
-    //             }
-    //             free(lines_array);
-    //             fclose(file);
-    //             return NULL;
-    //         }
-    //         // Store in array
-    //         idx[0] = line_idx;
-    //         str **elem_ptr = (str **)access_arr(lines_array, sizeof(str *), idx);
-    //         *elem_ptr = line;
-    //         line_idx++;
+    //         release(data, data_size, is_mapped); // munmap or free
+    //         THROW ErrFS.TooLarge;
     //     }
-    //     // Check if we read fewer lines than expected (e.g., due to errors)
-    //     if (line_idx < line_count) {
-    //         // Adjust the array size (this is a simplification - in real code you might want to reallocate)
-    //         size_t *dim_lengths = (size_t *)lines_array->value;
-    //         dim_lengths[0] = line_idx;
+    //     // Second pass: Copy every line out of the file content
+    //     str **lines = (str **)(lines_array->value + sizeof(size_t));
+    //     size_t pos = 0;
+    //     for (size_t i = 0; i < line_count; i++) {
+    //         const char *newline = memchr(data + pos, '\n', data_size - pos);
+    //         const size_t line_len = newline == NULL ? data_size - pos : newline - data - pos;
+    //         lines[i] = init_str(data + pos, line_len);
+    //         pos += line_len + 1;
     //     }
-    //     fclose(file);
+    //     release(data, data_size, is_mapped); // munmap or free
     //     return lines_array;
     // }
     llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
-    llvm::Function *const free_fn = c_functions.at(FREE);
     llvm::Function *const fopen_fn = c_functions.at(FOPEN);
     llvm::Function *const fclose_fn = c_functions.at(FCLOSE);
-    llvm::Function *const fgetc_fn = c_functions.at(FGETC);
-    llvm::Function *const fgets_fn = c_functions.at(FGETS);
+    llvm::Function *const fseek_fn = c_functions.at(FSEEK);
+    llvm::Function *const ftell_fn = c_functions.at(FTELL);
+    llvm::Function *const memchr_fn = c_functions.at(MEMCHR);
+    llvm::Function *const ferror_fn = c_functions.at(FERROR);
+    llvm::Function *const realloc_fn = c_functions.at(REALLOC);
+    llvm::Function *const free_fn = c_functions.at(FREE);
+    llvm::Function *const fread_fn = c_functions.at(FREAD);
     llvm::Function *const rewind_fn = c_functions.at(REWIND);
-    llvm::Function *const strlen_fn = c_functions.at(STRLEN);
+#ifdef __WIN32__
+    llvm::Function *const malloc_fn = c_functions.at(MALLOC);
+#else
+    llvm::Function *const fileno_fn = c_functions.at(FILENO);
+    llvm::Function *const mmap_fn = c_functions.at(MMAP);
+    llvm::Function *const munmap_fn = c_functions.at(MUNMAP);
+    llvm::Function *const madvise_fn = c_functions.at(MADVISE);
+#endif
 
     // Get string and array utility functions
     llvm::Function *const create_str_fn = String::string_manip_functions.at("create_str");
     llvm::Function *const init_str_fn = String::string_manip_functions.at("init_str");
     llvm::Function *const create_arr_fn = Array::array_manip_functions.at("create_arr");
-    llvm::Function *const fill_arr_fn = Array::array_manip_functions.at("fill_arr");
-    llvm::Function *const access_arr_fn = Array::array_manip_functions.at("access_arr");
 
     const std::vector<error_value> &ErrIOValues = std::get<2>(core_module_error_sets.at("filesystem").at(0));
     const unsigned int NotFound = 1;
+    const unsigned int NotReadable = 2;
     const std::string NotFoundMessage(ErrIOValues.at(NotFound).second);
+    const std::string NotReadableMessage(ErrIOValues.at(NotReadable).second);
 
     const unsigned int ErrIOCount = 5;
     const unsigned int ErrFS = hash.get_type_id_from_str("ErrFS");
@@ -366,143 +389,237 @@ void Generator::Module::FileSystem::generate_read_lines_function( //
 
     // Create basic blocks
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", read_lines_fn);
-    llvm::BasicBlock *const file_ok_block = llvm::BasicBlock::Create(context, "file_ok", read_lines_fn);
     llvm::BasicBlock *const file_fail_block = llvm::BasicBlock::Create(context, "file_fail", read_lines_fn);
-    llvm::BasicBlock *const count_lines_loop = llvm::BasicBlock::Create(context, "count_lines_loop", read_lines_fn);
-    llvm::BasicBlock *const count_lines_end = llvm::BasicBlock::Create(context, "count_lines_end", read_lines_fn);
-    llvm::BasicBlock *const check_last_line = llvm::BasicBlock::Create(context, "check_last_line", read_lines_fn);
-    llvm::BasicBlock *const inc_line_count = llvm::BasicBlock::Create(context, "inc_line_count", read_lines_fn);
-    llvm::BasicBlock *const array_create_ok = llvm::BasicBlock::Create(context, "array_create_ok", read_lines_fn);
-    llvm::BasicBlock *const array_create_fail = llvm::BasicBlock::Create(context, "array_create_fail", read_lines_fn);
-    llvm::BasicBlock *const read_lines_loop = llvm::BasicBlock::Create(context, "read_lines_loop", read_lines_fn);
-    llvm::BasicBlock *const read_line_body = llvm::BasicBlock::Create(context, "read_line_body", read_lines_fn);
-    llvm::BasicBlock *const check_newline = llvm::BasicBlock::Create(context, "check_newline", read_lines_fn);
-    llvm::BasicBlock *const remove_newline = llvm::BasicBlock::Create(context, "remove_newline", read_lines_fn);
-    llvm::BasicBlock *const after_newline_check = llvm::BasicBlock::Create(context, "after_newline_check", read_lines_fn);
-    llvm::BasicBlock *const init_str_fail = llvm::BasicBlock::Create(context, "init_str_fail", read_lines_fn);
-    llvm::BasicBlock *const cleanup_loop = llvm::BasicBlock::Create(context, "cleanup_loop", read_lines_fn);
-    llvm::BasicBlock *const cleanup_body = llvm::BasicBlock::Create(context, "cleanup_body", read_lines_fn);
-    llvm::BasicBlock *const cleanup_end = llvm::BasicBlock::Create(context, "cleanup_end", read_lines_fn);
-    llvm::BasicBlock *const store_line = llvm::BasicBlock::Create(context, "store_line", read_lines_fn);
-    llvm::BasicBlock *const size_check = llvm::BasicBlock::Create(context, "size_check", read_lines_fn);
-    llvm::BasicBlock *const adjust_size = llvm::BasicBlock::Create(context, "adjust_size", read_lines_fn);
-    llvm::BasicBlock *const return_result = llvm::BasicBlock::Create(context, "return_result", read_lines_fn);
-
-    // Set insertion point to entry block
+    llvm::BasicBlock *const file_ok_block = llvm::BasicBlock::Create(context, "file_ok", read_lines_fn);
+    llvm::BasicBlock *const sized_block = llvm::BasicBlock::Create(context, "sized", read_lines_fn);
+#ifndef __WIN32__
+    llvm::BasicBlock *const map_ok_block = llvm::BasicBlock::Create(context, "map_ok", read_lines_fn);
+#endif
+    llvm::BasicBlock *const stream_block = llvm::BasicBlock::Create(context, "stream", read_lines_fn);
+    llvm::BasicBlock *const stream_loop_block = llvm::BasicBlock::Create(context, "stream_loop", read_lines_fn);
+    llvm::BasicBlock *const stream_grow_block = llvm::BasicBlock::Create(context, "stream_grow", read_lines_fn);
+    llvm::BasicBlock *const stream_grow_fail_block = llvm::BasicBlock::Create(context, "stream_grow_fail", read_lines_fn);
+    llvm::BasicBlock *const stream_read_block = llvm::BasicBlock::Create(context, "stream_read", read_lines_fn);
+    llvm::BasicBlock *const stream_end_block = llvm::BasicBlock::Create(context, "stream_end", read_lines_fn);
+    llvm::BasicBlock *const stream_fail_block = llvm::BasicBlock::Create(context, "stream_fail", read_lines_fn);
+    llvm::BasicBlock *const content_ready_block = llvm::BasicBlock::Create(context, "content_ready", read_lines_fn);
+    llvm::BasicBlock *const count_loop_block = llvm::BasicBlock::Create(context, "count_loop", read_lines_fn);
+    llvm::BasicBlock *const count_body_block = llvm::BasicBlock::Create(context, "count_body", read_lines_fn);
+    llvm::BasicBlock *const count_next_block = llvm::BasicBlock::Create(context, "count_next", read_lines_fn);
+    llvm::BasicBlock *const count_end_block = llvm::BasicBlock::Create(context, "count_end", read_lines_fn);
+    llvm::BasicBlock *const array_fail_block = llvm::BasicBlock::Create(context, "array_fail", read_lines_fn);
+    llvm::BasicBlock *const array_ok_block = llvm::BasicBlock::Create(context, "array_ok", read_lines_fn);
+    llvm::BasicBlock *const split_loop_block = llvm::BasicBlock::Create(context, "split_loop", read_lines_fn);
+    llvm::BasicBlock *const split_body_block = llvm::BasicBlock::Create(context, "split_body", read_lines_fn);
+    llvm::BasicBlock *const split_end_block = llvm::BasicBlock::Create(context, "split_end", read_lines_fn);
+
+    // Returns an empty string alongside the given error value, all failures of this function return this way
+    const auto return_error = [&](const unsigned int value_id, const std::string &message) {
+        llvm::AllocaInst *const ret_fail_alloc = builder->CreateAlloca(function_result_type, 0, nullptr, "ret_fail_alloc");
+        llvm::Value *const ret_fail_err_ptr = builder->CreateStructGEP(function_result_type, ret_fail_alloc, 0, "ret_fail_err_ptr");
+        llvm::Value *const err_value = IR::generate_err_value(*builder, module, ErrFS, value_id, message);
+        IR::aligned_store(*builder, err_value, ret_fail_err_ptr);
+        llvm::Value *const ret_fail_empty_str = builder->CreateCall(create_str_fn, {builder->getInt64(0)}, "ret_fail_empty_str");
+        llvm::Value *const ret_fail_val_ptr = builder->CreateStructGEP(function_result_type, ret_fail_alloc, 1, "ret_fail_val_ptr");
+        IR::aligned_store(*builder, ret_fail_empty_str, ret_fail_val_ptr);
+        llvm::Value *const ret_fail_val = IR::aligned_load(*builder, function_result_type, ret_fail_alloc, "ret_fail_val");
+        builder->CreateRet(ret_fail_val);
+    };
+
+    // Open the file: file = fopen(c_path, "r")
     builder->SetInsertPoint(entry_block);
-
-    // Get the C string from the value
     llvm::Value *const c_path = builder->CreateStructGEP(str_type, path_arg, 1, "c_path");
-
-    // Create "r" string constant for fopen mode
     llvm::Value *const mode_str = IR::generate_const_string(module, "r");
-
-    // Open file: file = fopen(c_path, "r")
     llvm::Value *const file = builder->CreateCall(fopen_fn, {c_path, mode_str}, "file");
-
-    // Check if file is NULL
     llvm::Value *const file_null = builder->CreateIsNull(file, "file_null");
-    builder->CreateCondBr(file_null, file_fail_block, file_ok_block);
+    builder->CreateCondBr(file_null, file_fail_block, file_ok_block, IR::generate_weights(1, 100));
 
-    // Handle file open failure, throw ErrIO.NotFound
+    // Handle file open failure, throw ErrFS.NotFound
     builder->SetInsertPoint(file_fail_block);
-    llvm::AllocaInst *const ret_file_fail_alloc = builder->CreateAlloca(function_result_type, 0, nullptr, "ret_file_fail_alloc");
-    llvm::Value *const ret_file_fail_err_ptr = builder->CreateStructGEP(      //
-        function_result_type, ret_file_fail_alloc, 0, "ret_file_fail_err_ptr" //
-    );
-    llvm::Value *err_value = IR::generate_err_value(*builder, module, ErrFS, NotFound, NotFoundMessage);
-    IR::aligned_store(*builder, err_value, ret_file_fail_err_ptr);
-    llvm::Value *const ret_file_fail_empty_str = builder->CreateCall(create_str_fn, {builder->getInt64(0)}, "ret_file_fail_empty_str");
-    llvm::Value *const ret_file_fail_val_ptr = builder->CreateStructGEP(      //
-        function_result_type, ret_file_fail_alloc, 1, "ret_file_fail_val_ptr" //
-    );
-    IR::aligned_store(*builder, ret_file_fail_empty_str, ret_file_fail_val_ptr);
-    llvm::Value *const ret_file_fail_val = IR::aligned_load(*builder, function_result_type, ret_file_fail_alloc, "ret_file_fail_val");
-    builder->CreateRet(ret_file_fail_val);
+    return_error(NotFound, NotFoundMessage);
 
-    // Continue with successful file open - count lines
+    // Get the file size, SEEK_END is 2
     builder->SetInsertPoint(file_ok_block);
+    llvm::Value *const seek_end_result = builder->CreateCall(                           //
+        fseek_fn, {file, builder->getInt64(0), builder->getInt32(2)}, "seek_end_result" //
+    );
+    llvm::Value *const file_size = builder->CreateCall(ftell_fn, {file}, "file_size");
+    // Only a seekable file with a size can be read in one go, everything else is streamed
+    llvm::Value *const is_sized = builder->CreateAnd(                                   //
+        builder->CreateICmpEQ(seek_end_result, builder->getInt32(0), "seek_end_ok"),    //
+        builder->CreateICmpSGT(file_size, builder->getInt64(0), "has_size"), "is_sized" //
+    );
+    builder->CreateCondBr(is_sized, sized_block, stream_block, IR::generate_weights(100, 1));
 
-    // Initialize line counting variables
-    llvm::AllocaInst *const line_count_var = builder->CreateAlloca(builder->getInt64Ty(), 0, "line_count_var");
-    IR::aligned_store(*builder, builder->getInt64(0), line_count_var);
-
-    llvm::AllocaInst *const in_line_var = builder->CreateAlloca(builder->getInt1Ty(), 0, "in_line_var");
-    IR::aligned_store(*builder, builder->getFalse(), in_line_var);
-
-    llvm::AllocaInst *const ch_var = builder->CreateAlloca(builder->getInt32Ty(), 0, "ch_var");
-
-    // Start line counting loop
-    builder->CreateBr(count_lines_loop);
-
-    // Line counting loop header
-    builder->SetInsertPoint(count_lines_loop);
-    llvm::Value *const ch = builder->CreateCall(fgetc_fn, {file}, "ch");
-    IR::aligned_store(*builder, ch, ch_var);
-
-    // Check if we hit EOF
-    llvm::Value *const is_eof = builder->CreateICmpEQ(ch, builder->getInt32(-1), "is_eof");
-    builder->CreateCondBr(is_eof, check_last_line, count_lines_end);
-
-    // Line counting loop body
-    builder->SetInsertPoint(count_lines_end);
-
-    // Check if character is newline
-    llvm::Value *const is_newline = builder->CreateICmpEQ(ch, builder->getInt32('\n'), "is_newline");
-
-    // If newline, increment line count and reset in_line
-    llvm::Value *const current_line_count = IR::aligned_load(*builder, builder->getInt64Ty(), line_count_var, "current_line_count");
-    llvm::Value *const incremented_count = builder->CreateAdd(current_line_count, builder->getInt64(1), "incremented_count");
-
-    // Use select for conditional stores
-    llvm::Value *const current_in_line = IR::aligned_load(*builder, builder->getInt1Ty(), in_line_var, "current_in_line");
-    llvm::Value *const new_line_count = builder->CreateSelect(is_newline, incremented_count, current_line_count, "new_line_count");
-    IR::aligned_store(*builder, new_line_count, line_count_var);
-
-    llvm::Value *new_in_line;
-    if (is_newline->getType()->isIntegerTy(1)) {
-        // If is_newline is already i1, use it directly with not operation
-        new_in_line = builder->CreateSelect(                                                                       //
-            is_newline, builder->getFalse(), builder->CreateOr(current_in_line, builder->getTrue()), "new_in_line" //
-        );
-    } else {
-        // Convert is_newline to i1 type
-        llvm::Value *is_newline_i1 = builder->CreateICmpNE(is_newline, builder->getInt32(0), "is_newline_i1");
-        new_in_line = builder->CreateSelect(                                                                          //
-            is_newline_i1, builder->getFalse(), builder->CreateOr(current_in_line, builder->getTrue()), "new_in_line" //
-        );
-    }
-    IR::aligned_store(*builder, new_in_line, in_line_var);
-
-    // Continue the loop
-    builder->CreateBr(count_lines_loop);
-
-    // Check if last line needs to be counted
-    builder->SetInsertPoint(check_last_line);
-    llvm::Value *const final_in_line = IR::aligned_load(*builder, builder->getInt1Ty(), in_line_var, "final_in_line");
-    builder->CreateCondBr(final_in_line, inc_line_count, array_create_ok);
-
-    // Increment line count for the last line
-    builder->SetInsertPoint(inc_line_count);
-    llvm::Value *const final_line_count = IR::aligned_load(*builder, builder->getInt64Ty(), line_count_var, "final_line_count");
-    llvm::Value *const final_incremented_count = builder->CreateAdd(final_line_count, builder->getInt64(1), "final_incremented_count");
-    IR::aligned_store(*builder, final_incremented_count, line_count_var);
-    builder->CreateBr(array_create_ok);
+    builder->SetInsertPoint(sized_block);
+#ifdef __WIN32__
+    // Read the whole content into one buffer: data_size = fread(data, 1, file_size, file)
+    builder->CreateCall(rewind_fn, {file});
+    llvm::Value *const sized_data = builder->CreateCall(malloc_fn, {file_size}, "sized_data");
+    llvm::Value *const sized_data_size = builder->CreateCall(                            //
+        fread_fn, {sized_data, builder->getInt64(1), file_size, file}, "sized_data_size" //
+    );
+    builder->CreateBr(content_ready_block);
+#else
+    // Map the file: mapped = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fileno(file), 0)
+    llvm::Value *const fd = builder->CreateCall(fileno_fn, {file}, "fd");
+    llvm::Value *const mapped = builder->CreateCall(mmap_fn,
+        {
+            llvm::ConstantPointerNull::get(PTR_TY), // void* address
+            file_size,                              // u64 length
+            builder->getInt32(1),                   // PROT_READ
+            builder->getInt32(2),                   // MAP_PRIVATE
+            fd,                                     // i32 fd
+            builder->getInt64(0)                    // i64 offset
+        },                                          //
+        "mapped"                                    //
+    );
+    llvm::Value *const map_failed = builder->CreateICmpEQ(                                                                 //
+        builder->CreatePtrToInt(mapped, builder->getInt64Ty()), builder->getInt64(static_cast<uint64_t>(-1)), "map_failed" //
+    );
+    // Files which cannot be mapped, like character devices, are streamed instead
+    builder->CreateCondBr(map_failed, stream_block, map_ok_block, IR::generate_weights(1, 100));
 
-    // Create array of strings
-    builder->SetInsertPoint(array_create_ok);
+    // Both passes walk the mapping front to back, so let the kernel read ahead aggressively. MADV_SEQUENTIAL is 2
+    builder->SetInsertPoint(map_ok_block);
+    builder->CreateCall(madvise_fn, {mapped, file_size, builder->getInt32(2)});
+    builder->CreateBr(content_ready_block);
+#endif
 
-    // Rewind file to beginning
+    // Stream the content into a buffer which doubles whenever it is full, until fread reports the end of the stream
+    builder->SetInsertPoint(stream_block);
     builder->CreateCall(rewind_fn, {file});
+    builder->CreateBr(stream_loop_block);
+
+    builder->SetInsertPoint(stream_loop_block);
+    llvm::PHINode *const stream_data = builder->CreatePHI(PTR_TY, 2, "stream_data");
+    stream_data->addIncoming(llvm::ConstantPointerNull::get(PTR_TY), stream_block);
+    llvm::PHINode *const stream_capacity = builder->CreatePHI(builder->getInt64Ty(), 2, "stream_capacity");
+    stream_capacity->addIncoming(builder->getInt64(0), stream_block);
+    llvm::PHINode *const stream_size = builder->CreatePHI(builder->getInt64Ty(), 2, "stream_size");
+    stream_size->addIncoming(builder->getInt64(0), stream_block);
+    llvm::Value *const stream_full = builder->CreateICmpEQ(stream_size, stream_capacity, "stream_full");
+    builder->CreateCondBr(stream_full, stream_grow_block, stream_read_block);
+
+    builder->SetInsertPoint(stream_grow_block);
+    llvm::Value *const grown_capacity = builder->CreateSelect(                                  //
+        builder->CreateICmpEQ(stream_capacity, builder->getInt64(0)), builder->getInt64(65536), //
+        builder->CreateShl(stream_capacity, builder->getInt64(1)), "grown_capacity"             //
+    );
+    llvm::Value *const grown_data = builder->CreateCall(realloc_fn, {stream_data, grown_capacity}, "grown_data");
+    llvm::Value *const grow_failed = builder->CreateIsNull(grown_data, "grow_failed");
+    builder->CreateCondBr(grow_failed, stream_grow_fail_block, stream_read_block, IR::generate_weights(1, 100));
 
-    // Create array with 1 dimension of size line_count
-    llvm::Value *const final_count = IR::aligned_load(*builder, builder->getInt64Ty(), line_count_var, "final_count");
+    // Handle a failed buffer growth, throw ErrFS.TooLarge
+    builder->SetInsertPoint(stream_grow_fail_block);
+    builder->CreateCall(free_fn, {stream_data});
+    builder->CreateCall(fclose_fn, {file});
+    return_error(TooLarge, TooLargeMessage);
+
+    // Fill the free part of the buffer: read_count = fread(data + size, 1, capacity - size, file)
+    builder->SetInsertPoint(stream_read_block);
+    llvm::PHINode *const read_data = builder->CreatePHI(PTR_TY, 2, "read_data");
+    read_data->addIncoming(stream_data, stream_loop_block);
+    read_data->addIncoming(grown_data, stream_grow_block);
+    llvm::PHINode *const read_capacity = builder->CreatePHI(builder->getInt64Ty(), 2, "read_capacity");
+    read_capacity->addIncoming(stream_capacity, stream_loop_block);
+    read_capacity->addIncoming(grown_capacity, stream_grow_block);
+    llvm::Value *const read_dest = builder->CreateGEP(builder->getInt8Ty(), read_data, stream_size, "read_dest");
+    llvm::Value *const read_space = builder->CreateSub(read_capacity, stream_size, "read_space");
+    llvm::Value *const read_count = builder->CreateCall(fread_fn, {read_dest, builder->getInt64(1), read_space, file}, "read_count");
+    llvm::Value *const read_size = builder->CreateAdd(stream_size, read_count, "read_size");
+    stream_data->addIncoming(read_data, stream_read_block);
+    stream_capacity->addIncoming(read_capacity, stream_read_block);
+    stream_size->addIncoming(read_size, stream_read_block);
+    llvm::Value *const stream_done = builder->CreateICmpEQ(read_count, builder->getInt64(0), "stream_done");
+    builder->CreateCondBr(stream_done, stream_end_block, stream_loop_block);
+
+    // fread returns 0 both at the end of the stream and on a failed read, like reading a directory
+    builder->SetInsertPoint(stream_end_block);
+    llvm::Value *const stream_error = builder->CreateCall(ferror_fn, {file}, "stream_error");
+    llvm::Value *const stream_failed = builder->CreateICmpNE(stream_error, builder->getInt32(0), "stream_failed");
+    builder->CreateCondBr(stream_failed, stream_fail_block, content_ready_block, IR::generate_weights(1, 100));
+
+    // Handle a failed read, throw ErrFS.NotReadable
+    builder->SetInsertPoint(stream_fail_block);
+    builder->CreateCall(free_fn, {read_data});
+    builder->CreateCall(fclose_fn, {file});
+    return_error(NotReadable, NotReadableMessage);
+
+    // The file itself is not needed any more, the mapping stays valid after closing it
+    builder->SetInsertPoint(content_ready_block);
+    llvm::PHINode *const data = builder->CreatePHI(PTR_TY, 2, "data");
+    data->addIncoming(read_data, stream_end_block);
+    llvm::PHINode *const data_size = builder->CreatePHI(builder->getInt64Ty(), 2, "data_size");
+    data_size->addIncoming(stream_size, stream_end_block);
+#ifdef __WIN32__
+    data->addIncoming(sized_data, sized_block);
+    data_size->addIncoming(sized_data_size, sized_block);
+#else
+    data->addIncoming(mapped, map_ok_block);
+    data_size->addIncoming(file_size, map_ok_block);
+    llvm::PHINode *const is_mapped = builder->CreatePHI(builder->getInt1Ty(), 2, "is_mapped");
+    is_mapped->addIncoming(builder->getFalse(), stream_end_block);
+    is_mapped->addIncoming(builder->getTrue(), map_ok_block);
+#endif
+    builder->CreateCall(fclose_fn, {file});
+    llvm::Value *const data_address = builder->CreatePtrToInt(data, builder->getInt64Ty(), "data_address");
+    builder->CreateBr(count_loop_block);
+
+    // Releases the file content once it is no longer needed
+    const auto release_data = [&]() {
+#ifdef __WIN32__
+        builder->CreateCall(free_fn, {data});
+#else
+        llvm::BasicBlock *const unmap_block = llvm::BasicBlock::Create(context, "unmap", read_lines_fn);
+        llvm::BasicBlock *const free_block = llvm::BasicBlock::Create(context, "free", read_lines_fn);
+        llvm::BasicBlock *const released_block = llvm::BasicBlock::Create(context, "released", read_lines_fn);
+        builder->CreateCondBr(is_mapped, unmap_block, free_block);
+        builder->SetInsertPoint(unmap_block);
+        builder->CreateCall(munmap_fn, {data, data_size});
+        builder->CreateBr(released_block);
+        builder->SetInsertPoint(free_block);
+        builder->CreateCall(free_fn, {data});
+        builder->CreateBr(released_block);
+        builder->SetInsertPoint(released_block);
+#endif
+    };
+
+    // First pass: Count the lines by jumping from newline to newline. memchr scans many bytes at once instead of one at a time
+    builder->SetInsertPoint(count_loop_block);
+    llvm::PHINode *const count_pos = builder->CreatePHI(builder->getInt64Ty(), 2, "count_pos");
+    count_pos->addIncoming(builder->getInt64(0), content_ready_block);
+    llvm::PHINode *const line_count = builder->CreatePHI(builder->getInt64Ty(), 2, "line_count");
+    line_count->addIncoming(builder->getInt64(0), content_ready_block);
+    llvm::Value *const count_has_more = builder->CreateICmpULT(count_pos, data_size, "count_has_more");
+    builder->CreateCondBr(count_has_more, count_body_block, count_end_block);
+
+    builder->SetInsertPoint(count_body_block);
+    llvm::Value *const next_line_count = builder->CreateAdd(line_count, builder->getInt64(1), "next_line_count");
+    llvm::Value *const count_start = builder->CreateGEP(builder->getInt8Ty(), data, count_pos, "count_start");
+    llvm::Value *const count_remaining = builder->CreateSub(data_size, count_pos, "count_remaining");
+    llvm::Value *const count_newline = builder->CreateCall(                                 //
+        memchr_fn, {count_start, builder->getInt32('\n'), count_remaining}, "count_newline" //
+    );
+    // A last line without a trailing newline still counts as a line
+    builder->CreateCondBr(builder->CreateIsNull(count_newline, "count_last_line"), count_end_block, count_next_block);
 
-    // Create an array for the dimension lengths
+    builder->SetInsertPoint(count_next_block);
+    llvm::Value *const count_newline_pos = builder->CreateSub(                                           //
+        builder->CreatePtrToInt(count_newline, builder->getInt64Ty()), data_address, "count_newline_pos" //
+    );
+    llvm::Value *const next_count_pos = builder->CreateAdd(count_newline_pos, builder->getInt64(1), "next_count_pos");
+    count_pos->addIncoming(next_count_pos, count_next_block);
+    line_count->addIncoming(next_line_count, count_next_block);
+    builder->CreateBr(count_loop_block);
+
+    // Create the array of strings with exactly one slot per line
+    builder->SetInsertPoint(count_end_block);
+    llvm::PHINode *const final_count = builder->CreatePHI(builder->getInt64Ty(), 2, "final_count");
+    final_count->addIncoming(line_count, count_loop_block);
+    final_count->addIncoming(next_line_count, count_body_block);
     llvm::AllocaInst *const lengths_alloca = builder->CreateAlloca(builder->getInt64Ty(), builder->getInt32(1), "lengths_alloca");
     IR::aligned_store(*builder, final_count, lengths_alloca);
-
-    // Create the array of strings
     llvm::Value *const lines_array = builder->CreateCall(create_arr_fn,
         {
             builder->getInt64(1),              // 1 dimension
@@ -511,252 +628,56 @@ void Generator::Module::FileSystem::generate_read_lines_function( //
         },                                     //
         "lines_array"                          //
     );
-
-    // Check if array creation was successful
     llvm::Value *const array_null = builder->CreateIsNull(lines_array, "array_null");
-    builder->CreateCondBr(array_null, array_create_fail, read_lines_loop);
+    builder->CreateCondBr(array_null, array_fail_block, array_ok_block, IR::generate_weights(1, 100));
 
     // Handle array creation failure, throw ErrFS.TooLarge
-    builder->SetInsertPoint(array_create_fail);
-    builder->CreateCall(fclose_fn, {file});
-    llvm::AllocaInst *const ret_array_fail_alloc = builder->CreateAlloca(function_result_type, 0, nullptr, "ret_array_fail_alloc");
-    llvm::Value *const ret_array_fail_err_ptr =
-        builder->CreateStructGEP(function_result_type, ret_array_fail_alloc, 0, "ret_array_fail_err_ptr");
-    err_value = IR::generate_err_value(*builder, module, ErrFS, TooLarge, TooLargeMessage);
-    IR::aligned_store(*builder, err_value, ret_array_fail_err_ptr);
-    llvm::Value *const ret_array_fail_empty_str = builder->CreateCall(create_str_fn, {builder->getInt64(0)}, "ret_array_fail_empty_str");
-    llvm::Value *const ret_array_fail_val_ptr =
-        builder->CreateStructGEP(function_result_type, ret_array_fail_alloc, 1, "ret_array_fail_val_ptr");
-    IR::aligned_store(*builder, ret_array_fail_empty_str, ret_array_fail_val_ptr);
-    llvm::Value *const ret_array_fail_val = IR::aligned_load(*builder, function_result_type, ret_array_fail_alloc, "ret_array_fail_val");
-    builder->CreateRet(ret_array_fail_val);
-
-    // Initialize array with NULL pointers
-    builder->SetInsertPoint(read_lines_loop);
-
-    // Create a NULL str pointer to fill array
-    llvm::AllocaInst *const null_str_ptr = builder->CreateAlloca(PTR_TY, 0, "null_str_ptr");
-    IR::aligned_store(*builder, llvm::ConstantPointerNull::get(PTR_TY), null_str_ptr);
-
-    // Extract the data pointer from the str*: data = (char*)(str->value + str->len * sizeof(size_t))
-    llvm::Value *const fill_arr_len_ptr = builder->CreateStructGEP(str_type, lines_array, 0, "fill_arr_len_ptr");
-    llvm::Value *const fill_arr_dim = IR::aligned_load(*builder, builder->getInt64Ty(), fill_arr_len_ptr, "fill_arr_dim");
-    llvm::Value *const fill_arr_dim_lengths = builder->CreateStructGEP(str_type, lines_array, 1, "fill_arr_dim_lengths");
-    llvm::Value *const fill_arr_data = builder->CreateBitCast(                                                 //
-        builder->CreateGEP(builder->getInt64Ty(), fill_arr_dim_lengths, fill_arr_dim, "fill_arr_data"), PTR_TY //
-    );
-
-    // Fill array with NULL pointers using new fill_arr signature
-    builder->CreateCall(fill_arr_fn,
-        {
-            fill_arr_data,                     // char* data
-            fill_arr_dim,                      // size_t dim
-            fill_arr_dim_lengths,              // size_t* dim_lengths
-            builder->getInt64(sizeof(void *)), // size_t value_size
-            null_str_ptr,                      // void* value
-            builder->getInt32(0)               // i32 type_id
-        });
-
-    // Allocate buffer for reading lines (4096 bytes)
-    llvm::AllocaInst *const buffer = builder->CreateAlloca(builder->getInt8Ty(), builder->getInt32(4096), "buffer");
-
-    // Create an array for accessing array elements (1 index)
-    llvm::AllocaInst *const idx_alloca = builder->CreateAlloca(builder->getInt64Ty(), builder->getInt32(1), "idx_alloca");
-
-    // Initialize line index
-    llvm::AllocaInst *const line_idx_var = builder->CreateAlloca(builder->getInt64Ty(), 0, "line_idx_var");
-    IR::aligned_store(*builder, builder->getInt64(0), line_idx_var);
-
-    // Start reading lines
-    builder->CreateBr(read_line_body);
-
-    // Read lines loop
-    builder->SetInsertPoint(read_line_body);
-
-    // Call fgets(buffer, 4096, file)
-    llvm::Value *const fgets_result = builder->CreateCall(fgets_fn, {buffer, builder->getInt32(4096), file}, "fgets_result");
-
-    // Check if fgets returned NULL (EOF or error)
-    llvm::Value *const fgets_null = builder->CreateIsNull(fgets_result, "fgets_null");
-    builder->CreateCondBr(fgets_null, size_check, check_newline);
-
-    // Check for newline and remove it
-    builder->SetInsertPoint(check_newline);
-
-    // Get line length: strlen(buffer)
-    llvm::Value *const line_len = builder->CreateCall(strlen_fn, {buffer}, "line_len");
-
-    // Check if line ends with newline
-    llvm::Value *const has_newline = builder->CreateICmpNE(line_len, builder->getInt64(0), "has_len");
-    builder->CreateCondBr(has_newline, remove_newline, after_newline_check);
-
-    // Remove trailing newline
-    builder->SetInsertPoint(remove_newline);
-
-    // Get last character index: len - 1
-    llvm::Value *const last_idx = builder->CreateSub(line_len, builder->getInt64(1), "last_idx");
-
-    // Get pointer to last character
-    llvm::Value *const last_char_ptr = builder->CreateGEP(builder->getInt8Ty(), buffer, last_idx, "last_char_ptr");
-
-    // Load the last character
-    llvm::Value *const last_char = IR::aligned_load(*builder, builder->getInt8Ty(), last_char_ptr, "last_char");
-
-    // Check if last character is newline
-    llvm::Value *const is_last_newline = builder->CreateICmpEQ(last_char, builder->getInt8('\n'), "is_last_newline");
-
-    // If newline, create new length by decrementing
-    llvm::Value *const new_len =
-        builder->CreateSelect(is_last_newline, builder->CreateSub(line_len, builder->getInt64(1)), line_len, "new_len");
-
-    // If newline, replace it with null terminator
-    IR::aligned_store(*builder, builder->CreateSelect(is_last_newline, builder->getInt8(0), last_char), last_char_ptr);
-
-    // Continue with or without newline
-    builder->CreateBr(after_newline_check);
-
-    // Create string for the line
-    builder->SetInsertPoint(after_newline_check);
-
-    // Use final line length (after potential newline removal)
-    llvm::PHINode *const final_len = builder->CreatePHI(builder->getInt64Ty(), 2, "final_len");
-    final_len->addIncoming(line_len, check_newline);
-    final_len->addIncoming(new_len, remove_newline);
-
-    // Create string from buffer: init_str(buffer, len)
-    llvm::Value *const line_str = builder->CreateCall(init_str_fn, {buffer, final_len}, "line_str");
+    builder->SetInsertPoint(array_fail_block);
+    release_data();
+    return_error(TooLarge, TooLargeMessage);
 
-    // Check if string creation was successful
-    llvm::Value *const line_null = builder->CreateIsNull(line_str, "line_null");
-    builder->CreateCondBr(line_null, init_str_fail, store_line);
-
-    // Handle string creation failure - clean up previous lines
-    builder->SetInsertPoint(init_str_fail);
-
-    // Load current line index
-    llvm::Value *const cleanup_line_idx = IR::aligned_load(*builder, builder->getInt64Ty(), line_idx_var, "cleanup_line_idx");
-
-    // Initialize loop counter for cleanup
-    llvm::AllocaInst *const cleanup_i = builder->CreateAlloca(builder->getInt64Ty(), 0, "cleanup_i");
-    IR::aligned_store(*builder, builder->getInt64(0), cleanup_i);
-
-    // Start cleanup loop
-    builder->CreateBr(cleanup_loop);
-
-    // Cleanup loop header
-    builder->SetInsertPoint(cleanup_loop);
-    llvm::Value *const i = IR::aligned_load(*builder, builder->getInt64Ty(), cleanup_i, "i");
-    llvm::Value *const cleanup_done = builder->CreateICmpUGE(i, cleanup_line_idx, "cleanup_done");
-    builder->CreateCondBr(cleanup_done, cleanup_end, cleanup_body);
-
-    // Cleanup loop body
-    builder->SetInsertPoint(cleanup_body);
-
-    // Store index for array access
-    IR::aligned_store(*builder, i, idx_alloca);
-
-    // Access array element: access_arr(lines_array, sizeof(str*), idx)
-    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, lines_array, 0, "len_ptr");
-    llvm::Value *const arr_dim = IR::aligned_load(*builder, builder->getInt64Ty(), len_ptr, "arr_dim");
+    // The line pointers start right after the single dimension length
+    builder->SetInsertPoint(array_ok_block);
     llvm::Value *const arr_dim_lengths = builder->CreateStructGEP(str_type, lines_array, 1, "arr_dim_lengths");
-    llvm::Value *const arr_access_data = builder->CreateBitCast(                                       //
-        builder->CreateGEP(builder->getInt64Ty(), arr_dim_lengths, arr_dim, "arr_access_data"), PTR_TY //
+    llvm::Value *const lines_data = builder->CreateGEP(builder->getInt64Ty(), arr_dim_lengths, builder->getInt64(1), "lines_data");
+    builder->CreateBr(split_loop_block);
+
+    // Second pass: Copy every line out of the file content, the line count bounds the loop so no end check is needed
+    builder->SetInsertPoint(split_loop_block);
+    llvm::PHINode *const split_pos = builder->CreatePHI(builder->getInt64Ty(), 2, "split_pos");
+    split_pos->addIncoming(builder->getInt64(0), array_ok_block);
+    llvm::PHINode *const line_idx = builder->CreatePHI(builder->getInt64Ty(), 2, "line_idx");
+    line_idx->addIncoming(builder->getInt64(0), array_ok_block);
+    llvm::Value *const split_has_more = builder->CreateICmpULT(line_idx, final_count, "split_has_more");
+    builder->CreateCondBr(split_has_more, split_body_block, split_end_block);
+
+    builder->SetInsertPoint(split_body_block);
+    llvm::Value *const line_start = builder->CreateGEP(builder->getInt8Ty(), data, split_pos, "line_start");
+    llvm::Value *const split_remaining = builder->CreateSub(data_size, split_pos, "split_remaining");
+    llvm::Value *const split_newline = builder->CreateCall(                                //
+        memchr_fn, {line_start, builder->getInt32('\n'), split_remaining}, "split_newline" //
     );
-    llvm::Value *const elem_ptr = builder->CreateCall(                                                                        //
-        access_arr_fn, {builder->getInt64(sizeof(void *)), arr_access_data, arr_dim, arr_dim_lengths, idx_alloca}, "elem_ptr" //
+    llvm::Value *const newline_len = builder->CreateSub(                          //
+        builder->CreatePtrToInt(split_newline, builder->getInt64Ty()),            //
+        builder->CreatePtrToInt(line_start, builder->getInt64Ty()), "newline_len" //
     );
-
-    // Load the string pointer
-    llvm::Value *const elem_str_ptr = IR::aligned_load(*builder, PTR_TY, elem_ptr, "elem_str_ptr");
-
-    // Free the string
-    builder->CreateCall(free_fn, {elem_str_ptr});
-
-    // Increment cleanup counter
-    llvm::Value *const next_i = builder->CreateAdd(i, builder->getInt64(1), "next_i");
-    IR::aligned_store(*builder, next_i, cleanup_i);
-
-    // Continue cleanup loop
-    builder->CreateBr(cleanup_loop);
-
-    // Cleanup finished, free array and return NULL
-    builder->SetInsertPoint(cleanup_end);
-    builder->CreateCall(free_fn, {lines_array});
-    builder->CreateCall(fclose_fn, {file});
-
-    // Throw error ErrFS.TooLarge
-    llvm::AllocaInst *const ret_init_fail_alloc = builder->CreateAlloca(function_result_type, 0, nullptr, "ret_init_fail_alloc");
-    llvm::Value *const ret_init_fail_err_ptr = builder->CreateStructGEP(      //
-        function_result_type, ret_init_fail_alloc, 0, "ret_init_fail_err_ptr" //
+    llvm::Value *const line_len = builder->CreateSelect(                               //
+        builder->CreateIsNull(split_newline), split_remaining, newline_len, "line_len" //
     );
-    err_value = IR::generate_err_value(*builder, module, ErrFS, TooLarge, TooLargeMessage);
-    IR::aligned_store(*builder, err_value, ret_init_fail_err_ptr);
-    llvm::Value *const ret_init_fail_empty_str = builder->CreateCall(create_str_fn, {builder->getInt64(0)}, "ret_init_fail_empty_str");
-    llvm::Value *const ret_init_fail_val_ptr = builder->CreateStructGEP(      //
-        function_result_type, ret_init_fail_alloc, 1, "ret_init_fail_val_ptr" //
+    llvm::Value *const line_str = builder->CreateCall(init_str_fn, {line_start, line_len}, "line_str");
+    llvm::Value *const line_slot = builder->CreateGEP(PTR_TY, lines_data, line_idx, "line_slot");
+    IR::aligned_store(*builder, line_str, line_slot);
+    llvm::Value *const next_split_pos = builder->CreateAdd(                             //
+        split_pos, builder->CreateAdd(line_len, builder->getInt64(1)), "next_split_pos" //
     );
-    IR::aligned_store(*builder, ret_init_fail_empty_str, ret_init_fail_val_ptr);
-    llvm::Value *const ret_init_fail_val = IR::aligned_load(*builder, function_result_type, ret_init_fail_alloc, "ret_init_fail_val");
-    builder->CreateRet(ret_init_fail_val);
-
-    // Store line in array
-    builder->SetInsertPoint(store_line);
-
-    // Get current line index
-    llvm::Value *const current_idx = IR::aligned_load(*builder, builder->getInt64Ty(), line_idx_var, "current_idx");
-
-    // Store index for array access
-    IR::aligned_store(*builder, current_idx, idx_alloca);
-
-    // Access array element: access_arr(lines_array, sizeof(str*), idx)
-    llvm::Value *const len_ptr_2 = builder->CreateStructGEP(str_type, lines_array, 0, "len_ptr_2");
-    llvm::Value *const arr_dim_2 = IR::aligned_load(*builder, builder->getInt64Ty(), len_ptr_2, "arr_dim_2");
-    llvm::Value *const arr_dim_lengths_2 = builder->CreateStructGEP(str_type, lines_array, 1, "arr_dim_lengths_2");
-    llvm::Value *const arr_data_2 = builder->CreateGEP(builder->getInt64Ty(), arr_dim_lengths_2, arr_dim_2, "arr_data_2");
-    llvm::Value *const line_elem_ptr = builder->CreateCall(                                                                       //
-        access_arr_fn, {builder->getInt64(sizeof(void *)), arr_data_2, arr_dim_2, arr_dim_lengths_2, idx_alloca}, "line_elem_ptr" //
-    );
-
-    // Store the string pointer in the array
-    IR::aligned_store(*builder, line_str, line_elem_ptr);
-
-    // Increment line index
-    llvm::Value *const next_line_idx = builder->CreateAdd(current_idx, builder->getInt64(1), "next_line_idx");
-    IR::aligned_store(*builder, next_line_idx, line_idx_var);
-
-    // Continue reading next line
-    builder->CreateBr(read_line_body);
-
-    // Check if we read the expected number of lines
-    builder->SetInsertPoint(size_check);
-
-    // Get final line count
-    llvm::Value *const expected_count = IR::aligned_load(*builder, builder->getInt64Ty(), line_count_var, "expected_count");
-    llvm::Value *const actual_count = IR::aligned_load(*builder, builder->getInt64Ty(), line_idx_var, "actual_count");
-
-    // Check if actual count is less than expected
-    llvm::Value *const count_mismatch = builder->CreateICmpULT(actual_count, expected_count, "count_mismatch");
-    builder->CreateCondBr(count_mismatch, adjust_size, return_result);
-
-    // Adjust array size if needed
-    builder->SetInsertPoint(adjust_size);
-
-    // Get pointer to dimension lengths in array (first element of array->value)
-    llvm::Value *const array_value_ptr = builder->CreateStructGEP(str_type, lines_array, 1, "array_value_ptr");
-    llvm::Value *const dim_lengths = IR::aligned_load(*builder, PTR_TY, array_value_ptr, "dim_lengths");
-    llvm::Value *const dim_lengths_cast = builder->CreateBitCast(dim_lengths, PTR_TY, "dim_lengths_cast");
-
-    // Update first dimension length
-    llvm::Value *const dim_first = builder->CreateGEP(builder->getInt64Ty(), dim_lengths_cast, builder->getInt32(0), "dim_first");
-    IR::aligned_store(*builder, actual_count, dim_first);
-
-    // Return array
-    builder->CreateBr(return_result);
-
-    // Return the array of lines
-    builder->SetInsertPoint(return_result);
-    builder->CreateCall(fclose_fn, {file});
-
+    llvm::Value *const next_line_idx = builder->CreateAdd(line_idx, builder->getInt64(1), "next_line_idx");
+    split_pos->addIncoming(next_split_pos, split_body_block);
+    line_idx->addIncoming(next_line_idx, split_body_block);
+    builder->CreateBr(split_loop_block);
+
+    // Release the file content and return the array of lines
+    builder->SetInsertPoint(split_end_block);
+    release_data();
     llvm::AllocaInst *const ret_alloc = builder->CreateAlloca(function_result_type, 0, nullptr, "ret_alloc");
     llvm::Value *const ret_err_ptr = builder->CreateStructGEP(function_result_type, ret_alloc, 0, "ret_err_ptr");
     llvm::StructType *const err_type = type_map.at("type.flint.err");
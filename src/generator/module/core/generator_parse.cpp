@@ -19,14 +19,166 @@ static llvm::Value *get_errno_ptr(llvm::IRBuilder<> *builder, llvm::Module *modu
     return builder->CreateCall(errno_fn, {}, "errno_ptr");
 }
 
+/// @function `generate_is_space`
+/// @brief Generates the check whether the given character is whitespace in the "C" locale, e.g. one of ' ', '\t', '\n', '\v', '\f' or
+/// '\r', just like `isspace` does for the leading whitespace which `strtoll` and friends skip
+///
+/// @param `builder` The LLVM IRBuilder
+/// @param `c` The character to check
+/// @return `llvm::Value *` The i1 value whether the character is whitespace
+static llvm::Value *generate_is_space(llvm::IRBuilder<> *builder, llvm::Value *c) {
+    llvm::Value *const is_blank = builder->CreateICmpEQ(c, builder->getInt8(' '), "is_blank");
+    llvm::Value *const control_idx = builder->CreateSub(c, builder->getInt8('\t'), "control_idx");
+    llvm::Value *const is_control_space = builder->CreateICmpULT(control_idx, builder->getInt8(5), "is_control_space");
+    return builder->CreateOr(is_blank, is_control_space, "is_space");
+}
+
 void Generator::Module::Parse::generate_parse_functions(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations) {
     generate_parse_uint_function(builder, module, only_declarations, 8);
     generate_parse_int_function(builder, module, only_declarations, 32);
     generate_parse_uint_function(builder, module, only_declarations, 32);
     generate_parse_int_function(builder, module, only_declarations, 64);
     generate_parse_uint_function(builder, module, only_declarations, 64);
-    generate_parse_f32_function(builder, module, only_declarations);
-    generate_parse_f64_function(builder, module, only_declarations);
+    generate_parse_float_function(builder, module, only_declarations, 32);
+    generate_parse_float_function(builder, module, only_declarations, 64);
+}
+
+llvm::BasicBlock *Generator::Module::Parse::generate_parse_error_block( //
+    llvm::IRBuilder<> *builder,                                         //
+    llvm::Module *module,                                               //
+    llvm::Function *parent,                                             //
+    llvm::StructType *function_result_type,                             //
+    const unsigned int value_id,                                        //
+    const std::string &name                                             //
+) {
+    const unsigned int ErrParse = hash.get_type_id_from_str("ErrParse");
+    const std::vector<error_value> &ErrParseValues = std::get<2>(core_module_error_sets.at("parse").front());
+    const std::string message(ErrParseValues.at(value_id).second);
+
+    llvm::BasicBlock *const insert_block = builder->GetInsertBlock();
+    llvm::BasicBlock *const error_block = llvm::BasicBlock::Create(context, name, parent);
+    builder->SetInsertPoint(error_block);
+    llvm::AllocaInst *const ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
+    llvm::Value *const err_ptr = builder->CreateStructGEP(function_result_type, ret_alloca, 0, "parse_err_ptr");
+    llvm::Value *const err_value = IR::generate_err_value(*builder, module, ErrParse, value_id, message);
+    IR::aligned_store(*builder, err_value, err_ptr);
+    llvm::Value *const ret_val = IR::aligned_load(*builder, function_result_type, ret_alloca, "parse_ret_val");
+    builder->CreateRet(ret_val);
+    builder->SetInsertPoint(insert_block);
+    return error_block;
+}
+
+llvm::Value *Generator::Module::Parse::generate_parse_integer( //
+    llvm::IRBuilder<> *builder,                                //
+    llvm::Module *module,                                      //
+    llvm::Function *parent,                                    //
+    llvm::Value *input,                                        //
+    const bool is_signed,                                      //
+    const size_t bit_width,                                    //
+    llvm::BasicBlock *invalid_block,                           //
+    llvm::BasicBlock *out_of_bounds_block                      //
+) {
+    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
+    llvm::Type *const i8_type = builder->getInt8Ty();
+    llvm::Type *const i64_type = builder->getInt64Ty();
+
+    llvm::BasicBlock *const entry_block = builder->GetInsertBlock();
+    llvm::BasicBlock *const space_cond_block = llvm::BasicBlock::Create(context, "space_cond", parent);
+    llvm::BasicBlock *const space_check_block = llvm::BasicBlock::Create(context, "space_check", parent);
+    llvm::BasicBlock *const sign_block = llvm::BasicBlock::Create(context, "sign", parent);
+    llvm::BasicBlock *const digit_cond_block = llvm::BasicBlock::Create(context, "digit_cond", parent);
+    llvm::BasicBlock *const digit_check_block = llvm::BasicBlock::Create(context, "digit_check", parent);
+    llvm::BasicBlock *const digit_block = llvm::BasicBlock::Create(context, "digit", parent);
+    llvm::BasicBlock *const bounds_check_block = llvm::BasicBlock::Create(context, "bounds_check", parent);
+    llvm::BasicBlock *const parsed_block = llvm::BasicBlock::Create(context, "parsed", parent);
+
+    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, input, 0, "len_ptr");
+    llvm::Value *const len = IR::aligned_load(*builder, i64_type, len_ptr, "len");
+    llvm::Value *const value_ptr = builder->CreateStructGEP(str_type, input, 1, "value_ptr");
+    // An empty input parses as 0
+    builder->CreateCondBr(builder->CreateICmpEQ(len, builder->getInt64(0), "is_empty"), parsed_block, space_cond_block);
+
+    // Skip all leading whitespace, an input consisting only of whitespace contains no number at all
+    builder->SetInsertPoint(space_cond_block);
+    llvm::PHINode *const space_idx = builder->CreatePHI(i64_type, 2, "space_idx");
+    space_idx->addIncoming(builder->getInt64(0), entry_block);
+    llvm::Value *const space_in_range = builder->CreateICmpULT(space_idx, len, "space_in_range");
+    builder->CreateCondBr(space_in_range, space_check_block, invalid_block);
+
+    builder->SetInsertPoint(space_check_block);
+    llvm::Value *const first_char_ptr = builder->CreateGEP(i8_type, value_ptr, space_idx, "first_char_ptr");
+    llvm::Value *const first_char = IR::aligned_load(*builder, i8_type, first_char_ptr, "first_char");
+    llvm::Value *const next_space_idx = builder->CreateAdd(space_idx, builder->getInt64(1), "next_space_idx");
+    space_idx->addIncoming(next_space_idx, space_check_block);
+    builder->CreateCondBr(generate_is_space(builder, first_char), space_cond_block, sign_block);
+
+    // An optional sign is followed by at least one digit
+    builder->SetInsertPoint(sign_block);
+    llvm::Value *const is_neg = builder->CreateICmpEQ(first_char, builder->getInt8('-'), "is_neg");
+    llvm::Value *const is_pos = builder->CreateICmpEQ(first_char, builder->getInt8('+'), "is_pos");
+    llvm::Value *const has_sign = builder->CreateOr(is_neg, is_pos, "has_sign");
+    llvm::Value *const digits_start = builder->CreateAdd(space_idx, builder->CreateZExt(has_sign, i64_type), "digits_start");
+    llvm::Value *const no_digits = builder->CreateICmpEQ(digits_start, len, "no_digits");
+    builder->CreateCondBr(no_digits, invalid_block, digit_cond_block);
+
+    // Accumulate the magnitude in an u64. Overflows are remembered instead of reported right away, because an invalid character after
+    // the overflow is reported as an invalid character
+    builder->SetInsertPoint(digit_cond_block);
+    llvm::PHINode *const idx = builder->CreatePHI(i64_type, 2, "idx");
+    llvm::PHINode *const magnitude = builder->CreatePHI(i64_type, 2, "magnitude");
+    llvm::PHINode *const overflowed = builder->CreatePHI(builder->getInt1Ty(), 2, "overflowed");
+    idx->addIncoming(digits_start, sign_block);
+    magnitude->addIncoming(builder->getInt64(0), sign_block);
+    overflowed->addIncoming(builder->getFalse(), sign_block);
+    llvm::Value *const idx_in_range = builder->CreateICmpULT(idx, len, "idx_in_range");
+    builder->CreateCondBr(idx_in_range, digit_check_block, bounds_check_block);
+
+    builder->SetInsertPoint(digit_check_block);
+    llvm::Value *const char_ptr = builder->CreateGEP(i8_type, value_ptr, idx, "char_ptr");
+    llvm::Value *const current_char = IR::aligned_load(*builder, i8_type, char_ptr, "current_char");
+    llvm::Value *const digit = builder->CreateSub(current_char, builder->getInt8('0'), "digit");
+    llvm::Value *const is_digit = builder->CreateICmpULE(digit, builder->getInt8(9), "is_digit");
+    builder->CreateCondBr(is_digit, digit_block, invalid_block);
+
+    builder->SetInsertPoint(digit_block);
+    llvm::Function *const umul_fn = llvm::Intrinsic::getDeclaration(module, llvm::Intrinsic::umul_with_overflow, {i64_type});
+    llvm::Function *const uadd_fn = llvm::Intrinsic::getDeclaration(module, llvm::Intrinsic::uadd_with_overflow, {i64_type});
+    llvm::Value *const mul_res = builder->CreateCall(umul_fn, {magnitude, builder->getInt64(10)}, "mul_res");
+    llvm::Value *const mul_value = builder->CreateExtractValue(mul_res, {0}, "mul_value");
+    llvm::Value *const mul_overflow = builder->CreateExtractValue(mul_res, {1}, "mul_overflow");
+    llvm::Value *const add_res = builder->CreateCall(uadd_fn, {mul_value, builder->CreateZExt(digit, i64_type)}, "add_res");
+    llvm::Value *const add_value = builder->CreateExtractValue(add_res, {0}, "add_value");
+    llvm::Value *const add_overflow = builder->CreateExtractValue(add_res, {1}, "add_overflow");
+    llvm::Value *const digit_overflow = builder->CreateOr(mul_overflow, add_overflow, "digit_overflow");
+    idx->addIncoming(builder->CreateAdd(idx, builder->getInt64(1), "next_idx"), digit_block);
+    magnitude->addIncoming(add_value, digit_block);
+    overflowed->addIncoming(builder->CreateOr(overflowed, digit_overflow, "next_overflowed"), digit_block);
+    builder->CreateBr(digit_cond_block);
+
+    // Negative numbers reach one further than positive ones for signed types. For unsigned types negative numbers wrap around like
+    // they do in strtoull, so only "-0" is in bounds of the narrower types
+    builder->SetInsertPoint(bounds_check_block);
+    llvm::Value *const negated = builder->CreateSub(builder->getInt64(0), magnitude, "negated");
+    llvm::Value *const value = builder->CreateSelect(is_neg, negated, magnitude, "value");
+    llvm::Value *above_limit = nullptr;
+    if (is_signed) {
+        const llvm::APInt max = llvm::APInt::getSignedMaxValue(bit_width).zext(64);
+        llvm::Value *const limit = builder->CreateSelect(                                                     //
+            is_neg, builder->getInt64(max.getZExtValue() + 1), builder->getInt64(max.getZExtValue()), "limit" //
+        );
+        above_limit = builder->CreateICmpUGT(magnitude, limit, "above_limit");
+    } else {
+        const llvm::APInt max = llvm::APInt::getMaxValue(bit_width).zext(64);
+        above_limit = builder->CreateICmpUGT(value, builder->getInt64(max.getZExtValue()), "above_limit");
+    }
+    llvm::Value *const out_of_bounds = builder->CreateOr(overflowed, above_limit, "out_of_bounds");
+    builder->CreateCondBr(out_of_bounds, out_of_bounds_block, parsed_block);
+
+    builder->SetInsertPoint(parsed_block);
+    llvm::PHINode *const parsed_value = builder->CreatePHI(i64_type, 2, "parsed_value");
+    parsed_value->addIncoming(builder->getInt64(0), entry_block);
+    parsed_value->addIncoming(value, bounds_check_block);
+    return parsed_value;
 }
 
 void Generator::Module::Parse::generate_parse_int_function( //
@@ -37,163 +189,75 @@ void Generator::Module::Parse::generate_parse_int_function( //
 ) {
     // THE C IMPLEMENTATION:
     // intN_t parse_iN(const str* input) {
-    //     long long len = input->len;
-    //     char *endptr = NULL;
-    //     errno = 0;
-    //     long long value = strtoll(&input->value, &endptr, 10);
-    //     if (endptr < &input->value + len) {
-    //         printf("Not whole buffer read!\n");
-    //         abort();
+    //     const size_t len = input->len;
+    //     const char *s = input->value;
+    //     if (len == 0) {
+    //         return 0;
+    //     }
+    //     size_t i = 0;
+    //     while (i < len && isspace(s[i])) {
+    //         i++;
+    //     }
+    //     if (i == len) {
+    //         THROW ErrParse.InvalidCharacter;
     //     }
-    //     if (errno == ERANGE) {
-    //         printf("Int value out of bounds!\n");
-    //         abort();
+    //     const bool is_neg = s[i] == '-';
+    //     if (is_neg || s[i] == '+') {
+    //         i++;
     //     }
-    //     if (value <= MIN(iN)) {
-    //         printf("Int out of bounds of target type!\n");
-    //         abort();
+    //     if (i == len) {
+    //         THROW ErrParse.InvalidCharacter;
     //     }
-    //     if (value >= MAX(iN)) {
-    //         printf("Int out of bounds of target type!\n");
-    //         abort();
+    //     uint64_t magnitude = 0;
+    //     bool overflowed = false;
+    //     for (; i < len; i++) {
+    //         const uint8_t digit = s[i] - '0';
+    //         if (digit > 9) {
+    //             THROW ErrParse.InvalidCharacter;
+    //         }
+    //         overflowed |= __builtin_mul_overflow(magnitude, 10, &magnitude);
+    //         overflowed |= __builtin_add_overflow(magnitude, digit, &magnitude);
     //     }
-    //     return (intN_t)value;
+    //     const uint64_t limit = is_neg ? (uint64_t)MAX(iN) + 1 : (uint64_t)MAX(iN);
+    //     if (overflowed || magnitude > limit) {
+    //         THROW ErrParse.OutOfBounds;
+    //     }
+    //     return (intN_t)(is_neg ? 0 - magnitude : magnitude);
     // }
-    llvm::Function *const strtoll_fn = c_functions.at(STRTOLL);
-    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
-
     const std::shared_ptr<Type> result_type_ptr = Type::get_primitive_type("i" + std::to_string(bit_width));
     llvm::StructType *const function_result_type = IR::add_and_or_get_type(module, result_type_ptr, true);
-    const unsigned int ErrParse = hash.get_type_id_from_str("ErrParse");
-    const std::vector<error_value> &ErrParseValues = std::get<2>(core_module_error_sets.at("parse").front());
     const unsigned int OutOfBounds = 0;
     const unsigned int InvalidCharacter = 1;
-    const std::string OutOfBoundsMessage(ErrParseValues.at(OutOfBounds).second);
-    const std::string InvalidCharacterMessage(ErrParseValues.at(InvalidCharacter).second);
-    llvm::FunctionType *const parse_uN_type = llvm::FunctionType::get(function_result_type, {PTR_TY}, false);
-    llvm::Function *const parse_uN_fn = llvm::Function::Create( //
-        parse_uN_type,                                          //
+    llvm::FunctionType *const parse_iN_type = llvm::FunctionType::get(function_result_type, {PTR_TY}, false);
+    llvm::Function *const parse_iN_fn = llvm::Function::Create( //
+        parse_iN_type,                                          //
         llvm::Function::ExternalLinkage,                        //
         prefix + "parse_i" + std::to_string(bit_width),         //
         module                                                  //
     );
     const std::string fn_name = std::string("parse_i" + std::to_string(bit_width));
-    parse_functions[fn_name] = parse_uN_fn;
+    parse_functions[fn_name] = parse_iN_fn;
     if (only_declarations) {
         return;
     }
 
     // Get the input argument
-    llvm::Argument *const arg_input = parse_uN_fn->arg_begin();
+    llvm::Argument *const arg_input = parse_iN_fn->arg_begin();
     arg_input->setName("input");
 
-    // Create basic blocks
-    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_uN_fn);
-    llvm::BasicBlock *const parse_error_block = llvm::BasicBlock::Create(context, "parse_error", parse_uN_fn);
-    llvm::BasicBlock *const errno_check_block = llvm::BasicBlock::Create(context, "errno_check", parse_uN_fn);
-    llvm::BasicBlock *const errno_fail_block = llvm::BasicBlock::Create(context, "errno_fail", parse_uN_fn);
-    llvm::BasicBlock *const parse_ok_block = llvm::BasicBlock::Create(context, "parse_ok");
-    llvm::BasicBlock *const below_min_block = llvm::BasicBlock::Create(context, "below_min");
-    llvm::BasicBlock *const above_min_block = llvm::BasicBlock::Create(context, "above_min");
-    llvm::BasicBlock *const above_max_block = llvm::BasicBlock::Create(context, "above_max");
-    if (bit_width < 64) {
-        parse_ok_block->insertInto(parse_uN_fn);
-        below_min_block->insertInto(parse_uN_fn);
-        above_min_block->insertInto(parse_uN_fn);
-        above_max_block->insertInto(parse_uN_fn);
-    }
-    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", parse_uN_fn);
-
-    // Set insertion point to entry block
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_iN_fn);
     builder->SetInsertPoint(entry_block);
+    llvm::BasicBlock *const invalid_block = generate_parse_error_block(                           //
+        builder, module, parse_iN_fn, function_result_type, InvalidCharacter, "invalid_character" //
+    );
+    llvm::BasicBlock *const out_of_bounds_block = generate_parse_error_block(            //
+        builder, module, parse_iN_fn, function_result_type, OutOfBounds, "out_of_bounds" //
+    );
+    llvm::Value *const value = generate_parse_integer(                                               //
+        builder, module, parse_iN_fn, arg_input, true, bit_width, invalid_block, out_of_bounds_block //
+    );
 
-    // Get the length of the input string
-    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, arg_input, 0);
-    llvm::Value *const len = IR::aligned_load(*builder, builder->getInt64Ty(), len_ptr, "len");
-
-    // Create endptr variable: char *endptr = NULL
-    llvm::Value *const endptr_ptr = builder->CreateAlloca(PTR_TY, nullptr, "endptr_ptr");
-    IR::aligned_store(*builder, llvm::ConstantPointerNull::get(PTR_TY), endptr_ptr);
-
-    // Call strtoll: long long value = strtoll(input.c_str, &endptr, 10)
-    llvm::Value *const input_cstr = builder->CreateStructGEP(str_type, arg_input, 1);
-    llvm::Value *const errno_ptr = get_errno_ptr(builder, module);
-    IR::aligned_store(*builder, builder->getInt32(0), errno_ptr);
-    llvm::Value *const value = builder->CreateCall(strtoll_fn, {input_cstr, endptr_ptr, builder->getInt32(10)}, "value");
-
-    // Load the endptr value after strtoll call
-    llvm::Value *const endptr = IR::aligned_load(*builder, PTR_TY, endptr_ptr, "endptr");
-
-    // Calculate input.c_str + len (end of the input c string)
-    llvm::Value *const input_end = builder->CreateGEP(builder->getInt8Ty(), input_cstr, len, "cstr_end");
-
-    // Check if endptr < input.c_str + len (not all input was parsed)
-    llvm::Value *const endptr_lt_end = builder->CreateICmpULT(endptr, input_end, "endptr_lt_end");
-
-    // Branch if an parse error occured
-    builder->CreateCondBr(endptr_lt_end, parse_error_block, errno_check_block);
-
-    // Parse error: throw ErrParse.InvalidCharacter
-    builder->SetInsertPoint(parse_error_block);
-    llvm::AllocaInst *parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    llvm::Value *parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    llvm::Value *err_value = IR::generate_err_value(*builder, module, ErrParse, InvalidCharacter, InvalidCharacterMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    llvm::Value *parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    // Check if errno had an error, e.g. if the input was outside the range of an `i64`
-    builder->SetInsertPoint(errno_check_block);
-    llvm::Value *const errno_val = builder->CreateLoad(builder->getInt32Ty(), errno_ptr);
-    llvm::Value *const is_range_error = builder->CreateICmpEQ(errno_val, builder->getInt32(ERANGE));
-    if (bit_width < 64) {
-        builder->CreateCondBr(is_range_error, errno_fail_block, parse_ok_block);
-    } else {
-        builder->CreateCondBr(is_range_error, errno_fail_block, exit_block);
-    }
-
-    // Errno error: throw ErrParse.OutOfBounds
-    builder->SetInsertPoint(errno_fail_block);
-    parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    if (bit_width < 64) {
-        // Parsing was okay, check if the value is below MIN(iN)
-        builder->SetInsertPoint(parse_ok_block);
-        llvm::Value *const min = llvm::ConstantInt::get(builder->getInt64Ty(), llvm::APInt::getSignedMinValue(bit_width).sext(64));
-        llvm::Value *const lt_min = builder->CreateICmpSLT(value, min, "lt_min");
-        builder->CreateCondBr(lt_min, below_min_block, above_min_block);
-
-        // Parse error: throw ErrParse.OutOfBounds
-        builder->SetInsertPoint(below_min_block);
-        parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-        parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-        err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-        IR::aligned_store(*builder, err_value, parse_err_ptr);
-        parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-        builder->CreateRet(parse_ret_val);
-
-        builder->SetInsertPoint(above_min_block);
-        llvm::Value *const max = llvm::ConstantInt::get(builder->getInt64Ty(), llvm::APInt::getSignedMaxValue(bit_width).sext(64));
-        llvm::Value *const gt_max = builder->CreateICmpSGT(value, max, "gt_max");
-        builder->CreateCondBr(gt_max, above_max_block, exit_block);
-
-        // Parse error: throw ErrParse.OutOfBounds
-        builder->SetInsertPoint(above_max_block);
-        parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-        parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-        err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-        IR::aligned_store(*builder, err_value, parse_err_ptr);
-        parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-        builder->CreateRet(parse_ret_val);
-    }
-
-    // Exit block: return the uN value
-    builder->SetInsertPoint(exit_block);
+    // Return the iN value
     llvm::AllocaInst *const ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "ret_alloca", false);
     llvm::Value *const val_ptr = builder->CreateStructGEP(function_result_type, ret_alloca, 1, "ret_value_ptr");
     llvm::Type *const int_type = builder->getIntNTy(bit_width);
@@ -211,35 +275,46 @@ void Generator::Module::Parse::generate_parse_uint_function( //
 ) {
     // THE C IMPLEMENTATION:
     // uintN_t parse_uN(const str* input) {
-    //     long long len = input->len;
-    //     char *endptr = NULL;
-    //     errno = 0;
-    //     unsigned long long value = strtoull(&input->value, &endptr, 10);
-    //     if (endptr < &input->value + len) {
-    //         printf("Not whole buffer read!\n");
-    //         abort();
+    //     const size_t len = input->len;
+    //     const char *s = input->value;
+    //     if (len == 0) {
+    //         return 0;
+    //     }
+    //     size_t i = 0;
+    //     while (i < len && isspace(s[i])) {
+    //         i++;
     //     }
-    //     if (errno == ERANGE) {
-    //         printf("Uint value out of bounds!\n");
-    //         abort();
+    //     if (i == len) {
+    //         THROW ErrParse.InvalidCharacter;
     //     }
-    //     if (value > MAX(uN)) {
-    //         printf("Uint out of bounds of target type!\n");
-    //         abort();
+    //     const bool is_neg = s[i] == '-';
+    //     if (is_neg || s[i] == '+') {
+    //         i++;
+    //     }
+    //     if (i == len) {
+    //         THROW ErrParse.InvalidCharacter;
+    //     }
+    //     uint64_t magnitude = 0;
+    //     bool overflowed = false;
+    //     for (; i < len; i++) {
+    //         const uint8_t digit = s[i] - '0';
+    //         if (digit > 9) {
+    //             THROW ErrParse.InvalidCharacter;
+    //         }
+    //         overflowed |= __builtin_mul_overflow(magnitude, 10, &magnitude);
+    //         overflowed |= __builtin_add_overflow(magnitude, digit, &magnitude);
+    //     }
+    //     // Negative numbers wrap around like they do in strtoull
+    //     const uint64_t value = is_neg ? 0 - magnitude : magnitude;
+    //     if (overflowed || value > (uint64_t)MAX(uN)) {
+    //         THROW ErrParse.OutOfBounds;
     //     }
     //     return (uintN_t)value;
     // }
-    llvm::Function *const strtoull_fn = c_functions.at(STRTOULL);
-    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
-
     const std::shared_ptr<Type> result_type_ptr = Type::get_primitive_type("u" + std::to_string(bit_width));
     llvm::StructType *const function_result_type = IR::add_and_or_get_type(module, result_type_ptr, true);
-    const unsigned int ErrParse = hash.get_type_id_from_str("ErrParse");
-    const std::vector<error_value> &ErrParseValues = std::get<2>(core_module_error_sets.at("parse").front());
     const unsigned int OutOfBounds = 0;
     const unsigned int InvalidCharacter = 1;
-    const std::string OutOfBoundsMessage(ErrParseValues.at(OutOfBounds).second);
-    const std::string InvalidCharacterMessage(ErrParseValues.at(InvalidCharacter).second);
     llvm::FunctionType *const parse_uN_type = llvm::FunctionType::get(function_result_type, {PTR_TY}, false);
     llvm::Function *const parse_uN_fn = llvm::Function::Create( //
         parse_uN_type,                                          //
@@ -257,112 +332,19 @@ void Generator::Module::Parse::generate_parse_uint_function( //
     llvm::Argument *const arg_input = parse_uN_fn->arg_begin();
     arg_input->setName("input");
 
-    // Create basic blocks
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_uN_fn);
-    llvm::BasicBlock *const parse_error_block = llvm::BasicBlock::Create(context, "parse_error", parse_uN_fn);
-    llvm::BasicBlock *const errno_check_block = llvm::BasicBlock::Create(context, "errno_check", parse_uN_fn);
-    llvm::BasicBlock *const errno_fail_block = llvm::BasicBlock::Create(context, "errno_fail", parse_uN_fn);
-    llvm::BasicBlock *const parse_ok_block = llvm::BasicBlock::Create(context, "parse_ok");
-    llvm::BasicBlock *const below_0_block = llvm::BasicBlock::Create(context, "below_0");
-    llvm::BasicBlock *const above_0_block = llvm::BasicBlock::Create(context, "above_0");
-    llvm::BasicBlock *const above_max_block = llvm::BasicBlock::Create(context, "above_max");
-    if (bit_width < 64) {
-        parse_ok_block->insertInto(parse_uN_fn);
-        below_0_block->insertInto(parse_uN_fn);
-        above_0_block->insertInto(parse_uN_fn);
-        above_max_block->insertInto(parse_uN_fn);
-    }
-    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", parse_uN_fn);
-
-    // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
+    llvm::BasicBlock *const invalid_block = generate_parse_error_block(                           //
+        builder, module, parse_uN_fn, function_result_type, InvalidCharacter, "invalid_character" //
+    );
+    llvm::BasicBlock *const out_of_bounds_block = generate_parse_error_block(            //
+        builder, module, parse_uN_fn, function_result_type, OutOfBounds, "out_of_bounds" //
+    );
+    llvm::Value *const value = generate_parse_integer(                                                //
+        builder, module, parse_uN_fn, arg_input, false, bit_width, invalid_block, out_of_bounds_block //
+    );
 
-    // Get the length of the input string
-    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, arg_input, 0);
-    llvm::Value *const len = IR::aligned_load(*builder, builder->getInt64Ty(), len_ptr, "len");
-
-    // Create endptr variable: char *endptr = NULL
-    llvm::Value *const endptr_ptr = builder->CreateAlloca(PTR_TY, nullptr, "endptr_ptr");
-    IR::aligned_store(*builder, llvm::ConstantPointerNull::get(PTR_TY), endptr_ptr);
-
-    // Call strtoull: unsigned long long value = strtoull(input.c_str, &endptr, 10)
-    llvm::Value *const input_cstr = builder->CreateStructGEP(str_type, arg_input, 1);
-    llvm::Value *const errno_ptr = get_errno_ptr(builder, module);
-    IR::aligned_store(*builder, builder->getInt32(0), errno_ptr);
-    llvm::Value *const value = builder->CreateCall(strtoull_fn, {input_cstr, endptr_ptr, builder->getInt32(10)}, "value");
-
-    // Load the endptr value after strtoull call
-    llvm::Value *const endptr = IR::aligned_load(*builder, PTR_TY, endptr_ptr, "endptr");
-
-    // Calculate input.c_str + len (end of the input c string)
-    llvm::Value *const input_end = builder->CreateGEP(builder->getInt8Ty(), input_cstr, len, "cstr_end");
-
-    // Check if endptr < input.c_str + len (not all input was parsed)
-    llvm::Value *const endptr_lt_end = builder->CreateICmpULT(endptr, input_end, "endptr_lt_end");
-
-    // Branch if an parse error occured
-    builder->CreateCondBr(endptr_lt_end, parse_error_block, errno_check_block);
-
-    // Parse error: throw ErrParse.InvalidCharacter
-    builder->SetInsertPoint(parse_error_block);
-    llvm::AllocaInst *parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    llvm::Value *parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    llvm::Value *err_value = IR::generate_err_value(*builder, module, ErrParse, InvalidCharacter, InvalidCharacterMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    llvm::Value *parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    // Check if errno had an error, e.g. if the input was outside the range of an `u64`
-    builder->SetInsertPoint(errno_check_block);
-    llvm::Value *const errno_val = builder->CreateLoad(builder->getInt32Ty(), errno_ptr);
-    llvm::Value *const is_range_error = builder->CreateICmpEQ(errno_val, builder->getInt32(ERANGE));
-    if (bit_width < 64) {
-        builder->CreateCondBr(is_range_error, errno_fail_block, parse_ok_block);
-    } else {
-        builder->CreateCondBr(is_range_error, errno_fail_block, exit_block);
-    }
-
-    // Errno error: throw ErrParse.OutOfBounds
-    builder->SetInsertPoint(errno_fail_block);
-    parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    if (bit_width < 64) {
-        // Parsing was okay, check if the value is below 0
-        builder->SetInsertPoint(parse_ok_block);
-        llvm::Value *const lt_0 = builder->CreateICmpSLT(value, builder->getInt64(0), "lt_0");
-        builder->CreateCondBr(lt_0, below_0_block, above_0_block);
-
-        // Parse error: throw ErrParse.OutOfBounds
-        builder->SetInsertPoint(below_0_block);
-        parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-        parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-        err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-        IR::aligned_store(*builder, err_value, parse_err_ptr);
-        parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-        builder->CreateRet(parse_ret_val);
-
-        builder->SetInsertPoint(above_0_block);
-        llvm::Value *const max = llvm::ConstantInt::get(builder->getInt64Ty(), llvm::APInt::getMaxValue(bit_width).zext(64));
-        llvm::Value *const gt_max = builder->CreateICmpSGT(value, max, "gt_max");
-        builder->CreateCondBr(gt_max, above_max_block, exit_block);
-
-        // Parse error: throw ErrParse.OutOfBounds
-        builder->SetInsertPoint(above_max_block);
-        parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-        parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-        err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-        IR::aligned_store(*builder, err_value, parse_err_ptr);
-        parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-        builder->CreateRet(parse_ret_val);
-    }
-
-    // Exit block: return the uN value
-    builder->SetInsertPoint(exit_block);
+    // Return the uN value
     llvm::AllocaInst *const ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "ret_alloca", false);
     llvm::Value *const val_ptr = builder->CreateStructGEP(function_result_type, ret_alloca, 1, "ret_value_ptr");
     llvm::Type *const int_type = builder->getIntNTy(bit_width);
@@ -372,234 +354,633 @@ void Generator::Module::Parse::generate_parse_uint_function( //
     builder->CreateRet(ret_val);
 }
 
-void Generator::Module::Parse::generate_parse_f32_function( //
-    llvm::IRBuilder<> *builder,                             //
-    llvm::Module *module,                                   //
-    const bool only_declarations                            //
+llvm::GlobalVariable *Generator::Module::Parse::get_power_of_five_table(llvm::Module *module) {
+    const std::string table_name = prefix + "power_of_five_128";
+    if (llvm::GlobalVariable *const table = module->getGlobalVariable(table_name, true)) {
+        return table;
+    }
+    // The table contains the 128 most significant bits of 5^q for every q in [SMALLEST_POWER_OF_FIVE, LARGEST_POWER_OF_FIVE], normalized
+    // so that the highest bit is set, stored as the high and then the low u64. Negative powers are the rounded up reciprocals. All
+    // intermediate values fit into 2048 bits, as 5^342 has less than 800 bits
+    const unsigned int width = 2048;
+    std::vector<uint64_t> entries;
+    entries.reserve(2 * (LARGEST_POWER_OF_FIVE - SMALLEST_POWER_OF_FIVE + 1));
+    for (int q = SMALLEST_POWER_OF_FIVE; q <= LARGEST_POWER_OF_FIVE; q++) {
+        llvm::APInt power_of_five(width, 1);
+        for (int i = 0; i < std::abs(q); i++) {
+            power_of_five *= 5;
+        }
+        llvm::APInt entry(width, 0);
+        if (q < 0) {
+            // z is the smallest exponent with 2^z >= 5^-q
+            const unsigned int z = power_of_five.getActiveBits();
+            const unsigned int b = q >= -27 ? z + 127 : 2 * z + 128;
+            entry = llvm::APInt::getOneBitSet(width, b).udiv(power_of_five) + 1;
+            if (entry.getActiveBits() > 128) {
+                entry = entry.lshr(entry.getActiveBits() - 128);
+            }
+        } else {
+            const unsigned int active_bits = power_of_five.getActiveBits();
+            entry = active_bits < 128 ? power_of_five.shl(128 - active_bits) : power_of_five.lshr(active_bits - 128);
+        }
+        entries.push_back(entry.lshr(64).trunc(64).getZExtValue());
+        entries.push_back(entry.trunc(64).getZExtValue());
+    }
+    llvm::Constant *const table_data = llvm::ConstantDataArray::get(context, entries);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    llvm::GlobalVariable *const table = new llvm::GlobalVariable(                                       //
+        *module, table_data->getType(), true, llvm::GlobalValue::PrivateLinkage, table_data, table_name //
+    );
+#pragma GCC diagnostic pop
+    return table;
+}
+
+llvm::Function *Generator::Module::Parse::generate_eisel_lemire_function( //
+    llvm::IRBuilder<> *builder,                                           //
+    llvm::Module *module,                                                 //
+    const size_t bit_width                                                //
 ) {
     // THE C IMPLEMENTATION:
-    // float parse_f32(const str* input) {
-    //     size_t len = input->len;
-    //     char *endptr = NULL;
-    //     errno = 0;
-    //     float value = strtof(&input->value, &endptr);
-    //     if (endptr < &input->value + len) {
-    //         printf("Not whole buffer parsed!\n");
-    //         abort();
+    // int64_t eisel_lemire_fN(uint64_t w, int64_t q) {
+    //     if (q < SMALLEST_POWER_OF_TEN || q > LARGEST_POWER_OF_TEN) {
+    //         return -1;
     //     }
-    //     if (errno == ERANGE) {
-    //         printf("Floating point value out of bounds!\n");
-    //         abort();
+    //     const int lz = __builtin_clzll(w);
+    //     w <<= lz;
+    //     const size_t index = 2 * (q - SMALLEST_POWER_OF_FIVE);
+    //     __uint128_t first = (__uint128_t)w * power_of_five_128[index];
+    //     uint64_t high = first >> 64;
+    //     uint64_t low = (uint64_t)first;
+    //     // Only if the lower bits of the high product are all set, the truncated power of five could change the result
+    //     if ((high & PRECISION_MASK) == PRECISION_MASK) {
+    //         const uint64_t second_high = ((__uint128_t)w * power_of_five_128[index + 1]) >> 64;
+    //         low += second_high;
+    //         high += second_high > low;
     //     }
-    //     return value;
+    //     const uint64_t upper_bit = high >> 63;
+    //     const uint64_t shift = upper_bit + 64 - MANTISSA_BITS - 3;
+    //     uint64_t mantissa = high >> shift;
+    //     int64_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upper_bit - lz - MINIMUM_EXPONENT;
+    //     if (power2 <= 0) {
+    //         return -1; // Subnormal results are left to the fallback
+    //     }
+    //     // Round halfway cases to even, which are only possible for a small range of exponents
+    //     if (low <= 1 && q >= MIN_ROUND_TO_EVEN && q <= MAX_ROUND_TO_EVEN && (mantissa & 3) == 1 && (mantissa << shift) == high) {
+    //         mantissa &= ~1;
+    //     }
+    //     mantissa += mantissa & 1;
+    //     mantissa >>= 1;
+    //     if (mantissa >= (2 << MANTISSA_BITS)) {
+    //         mantissa = 1 << MANTISSA_BITS;
+    //         power2++;
+    //     }
+    //     mantissa &= ~(1 << MANTISSA_BITS);
+    //     if (power2 >= INFINITE_POWER) {
+    //         return -1; // Overflows are left to the fallback
+    //     }
+    //     return mantissa | (power2 << MANTISSA_BITS);
     // }
-    llvm::Function *const strtof_fn = c_functions.at(STRTOF);
-    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
+    const bool is_f64 = bit_width == 64;
+    const int64_t mantissa_bits = is_f64 ? 52 : 23;
+    const int64_t minimum_exponent = is_f64 ? -1023 : -127;
+    const int64_t infinite_power = is_f64 ? 0x7FF : 0xFF;
+    const int64_t smallest_power_of_ten = is_f64 ? SMALLEST_POWER_OF_FIVE : -65;
+    const int64_t largest_power_of_ten = is_f64 ? LARGEST_POWER_OF_FIVE : 38;
+    const int64_t min_round_to_even = is_f64 ? -4 : -17;
+    const int64_t max_round_to_even = is_f64 ? 23 : 10;
+    const uint64_t precision_mask = 0xFFFFFFFFFFFFFFFFULL >> (mantissa_bits + 3);
+
+    llvm::Type *const i64_type = builder->getInt64Ty();
+    llvm::Type *const i128_type = builder->getInt128Ty();
+    llvm::FunctionType *const el_type = llvm::FunctionType::get(i64_type, {i64_type, i64_type}, false);
+    const std::string el_name = prefix + "eisel_lemire_f" + std::to_string(bit_width);
+    llvm::Function *const el_fn = llvm::Function::Create(el_type, llvm::Function::InternalLinkage, el_name, module);
+    llvm::Argument *const arg_w = el_fn->arg_begin();
+    arg_w->setName("w");
+    llvm::Argument *const arg_q = el_fn->arg_begin() + 1;
+    arg_q->setName("q");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", el_fn);
+    llvm::BasicBlock *const compute_block = llvm::BasicBlock::Create(context, "compute", el_fn);
+    llvm::BasicBlock *const fail_block = llvm::BasicBlock::Create(context, "fail", el_fn);
 
-    const std::shared_ptr<Type> result_type_ptr = Type::get_primitive_type("f32");
-    llvm::StructType *const function_result_type = IR::add_and_or_get_type(module, result_type_ptr, true);
-    const unsigned int ErrParse = hash.get_type_id_from_str("ErrParse");
-    const std::vector<error_value> &ErrParseValues = std::get<2>(core_module_error_sets.at("parse").front());
-    const unsigned int OutOfBounds = 0;
-    const unsigned int InvalidCharacter = 1;
-    const std::string OutOfBoundsMessage(ErrParseValues.at(OutOfBounds).second);
-    const std::string InvalidCharacterMessage(ErrParseValues.at(InvalidCharacter).second);
-    llvm::FunctionType *const parse_f32_type = llvm::FunctionType::get(function_result_type, {PTR_TY}, false);
-    llvm::Function *const parse_f32_fn = llvm::Function::Create( //
-        parse_f32_type,                                          //
-        llvm::Function::ExternalLinkage,                         //
-        prefix + "parse_f32",                                    //
-        module                                                   //
-    );
-    parse_functions["parse_f32"] = parse_f32_fn;
-    if (only_declarations) {
-        return;
-    }
-
-    // Get the input argument
-    llvm::Argument *const arg_input = parse_f32_fn->arg_begin();
-    arg_input->setName("input");
-
-    // Create basic blocks
-    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_f32_fn);
-    llvm::BasicBlock *const parse_error_block = llvm::BasicBlock::Create(context, "parse_error", parse_f32_fn);
-    llvm::BasicBlock *const errno_check_block = llvm::BasicBlock::Create(context, "errno_check", parse_f32_fn);
-    llvm::BasicBlock *const errno_fail_block = llvm::BasicBlock::Create(context, "errno_fail", parse_f32_fn);
-    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", parse_f32_fn);
-
-    // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
-
-    // Get the length of the input string
-    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, arg_input, 0);
-    llvm::Value *const len = IR::aligned_load(*builder, builder->getInt64Ty(), len_ptr, "len");
-
-    // Create endptr variable: char *endptr = NULL
-    llvm::Value *const endptr_ptr = builder->CreateAlloca(PTR_TY, nullptr, "endptr_ptr");
-    IR::aligned_store(*builder, llvm::ConstantPointerNull::get(PTR_TY), endptr_ptr);
-
-    // Call strtof: float value = strtof(input.c_str, &endptr)
-    llvm::Value *const input_cstr = builder->CreateStructGEP(str_type, arg_input, 1);
-    llvm::Value *const errno_ptr = get_errno_ptr(builder, module);
-    IR::aligned_store(*builder, builder->getInt32(0), errno_ptr);
-    llvm::Value *const value = builder->CreateCall(strtof_fn, {input_cstr, endptr_ptr}, "value");
-
-    // Load the endptr value after strtof call
-    llvm::Value *const endptr = IR::aligned_load(*builder, PTR_TY, endptr_ptr, "endptr");
-
-    // Calculate input.c_str + len (end of the input c string)
-    llvm::Value *const input_end = builder->CreateGEP(builder->getInt8Ty(), input_cstr, len, "cstr_end");
-
-    // Check if endptr < input.c_str + len (not all input was parsed)
-    llvm::Value *const endptr_lt_end = builder->CreateICmpULT(endptr, input_end, "endptr_lt_end");
-
-    // Branch if an parse error occured
-    builder->CreateCondBr(endptr_lt_end, parse_error_block, errno_check_block);
-
-    // Parse warning: throw ErrParse.InvalidCharacter
-    builder->SetInsertPoint(parse_error_block);
-    llvm::AllocaInst *parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    llvm::Value *parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    llvm::Value *err_value = IR::generate_err_value(*builder, module, ErrParse, InvalidCharacter, InvalidCharacterMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    llvm::Value *parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    // Check if errno had an error, e.g. if the input was outside the range of an `f32`
-    builder->SetInsertPoint(errno_check_block);
-    llvm::Value *const errno_val = builder->CreateLoad(builder->getInt32Ty(), errno_ptr);
-    llvm::Value *const is_range_error = builder->CreateICmpEQ(errno_val, builder->getInt32(ERANGE));
-    builder->CreateCondBr(is_range_error, errno_fail_block, exit_block);
-
-    // Errno error: throw ErrParse.OutOfBounds
-    builder->SetInsertPoint(errno_fail_block);
-    parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    // Exit block: return the float value
-    builder->SetInsertPoint(exit_block);
-    llvm::AllocaInst *const ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "ret_alloca", false);
-    llvm::Value *const val_ptr = builder->CreateStructGEP(function_result_type, ret_alloca, 1, "ret_value_ptr");
-    IR::aligned_store(*builder, value, val_ptr);
-    llvm::Value *const ret_val = IR::aligned_load(*builder, function_result_type, ret_alloca, "ret_val");
-    builder->CreateRet(ret_val);
+    llvm::Value *const above_min = builder->CreateICmpSGE(arg_q, builder->getInt64(smallest_power_of_ten), "above_min");
+    llvm::Value *const below_max = builder->CreateICmpSLE(arg_q, builder->getInt64(largest_power_of_ten), "below_max");
+    builder->CreateCondBr(builder->CreateAnd(above_min, below_max, "in_range"), compute_block, fail_block);
+
+    builder->SetInsertPoint(fail_block);
+    builder->CreateRet(builder->getInt64(-1));
+
+    // Normalize w and multiply it with the 128 bit approximation of 5^q
+    builder->SetInsertPoint(compute_block);
+    llvm::Function *const ctlz_fn = llvm::Intrinsic::getDeclaration(module, llvm::Intrinsic::ctlz, {i64_type});
+    llvm::Value *const lz = builder->CreateCall(ctlz_fn, {arg_w, builder->getTrue()}, "lz");
+    llvm::Value *const w = builder->CreateShl(arg_w, lz, "w_normalized");
+    llvm::Value *const w_wide = builder->CreateZExt(w, i128_type, "w_wide");
+    llvm::GlobalVariable *const table = get_power_of_five_table(module);
+    llvm::Value *const table_idx = builder->CreateShl(builder->CreateSub(arg_q, builder->getInt64(SMALLEST_POWER_OF_FIVE)), 1, "table_idx");
+    llvm::Value *const high_entry_ptr = builder->CreateGEP(i64_type, table, table_idx, "high_entry_ptr");
+    llvm::Value *const high_entry = IR::aligned_load(*builder, i64_type, high_entry_ptr, "high_entry");
+    llvm::Value *const low_entry_ptr = builder->CreateGEP(i64_type, high_entry_ptr, builder->getInt64(1), "low_entry_ptr");
+    llvm::Value *const low_entry = IR::aligned_load(*builder, i64_type, low_entry_ptr, "low_entry");
+    llvm::Value *const first = builder->CreateMul(w_wide, builder->CreateZExt(high_entry, i128_type), "first");
+    llvm::Value *const first_high = builder->CreateTrunc(builder->CreateLShr(first, 64), i64_type, "first_high");
+    llvm::Value *const first_low = builder->CreateTrunc(first, i64_type, "first_low");
+    llvm::Value *const second = builder->CreateMul(w_wide, builder->CreateZExt(low_entry, i128_type), "second");
+    llvm::Value *const second_high = builder->CreateTrunc(builder->CreateLShr(second, 64), i64_type, "second_high");
+    llvm::Value *const summed_low = builder->CreateAdd(first_low, second_high, "summed_low");
+    llvm::Value *const low_carry = builder->CreateZExt(builder->CreateICmpULT(summed_low, second_high), i64_type, "low_carry");
+    llvm::Value *const masked_high = builder->CreateAnd(first_high, builder->getInt64(precision_mask), "masked_high");
+    llvm::Value *const needs_second = builder->CreateICmpEQ(masked_high, builder->getInt64(precision_mask), "needs_second");
+    llvm::Value *const high = builder->CreateSelect(needs_second, builder->CreateAdd(first_high, low_carry), first_high, "high");
+    llvm::Value *const low = builder->CreateSelect(needs_second, summed_low, first_low, "low");
+
+    // Extract the mantissa and the binary exponent from the product
+    llvm::Value *const upper_bit = builder->CreateLShr(high, 63, "upper_bit");
+    llvm::Value *const shift = builder->CreateAdd(upper_bit, builder->getInt64(64 - mantissa_bits - 3), "shift");
+    llvm::Value *mantissa = builder->CreateLShr(high, shift, "mantissa");
+    llvm::Value *const power_of_q = builder->CreateAShr(builder->CreateMul(arg_q, builder->getInt64(152170 + 65536)), 16, "power_of_q");
+    llvm::Value *power2 = builder->CreateAdd(power_of_q, builder->getInt64(63 - minimum_exponent));
+    power2 = builder->CreateSub(builder->CreateAdd(power2, upper_bit), lz, "power2");
+    llvm::Value *const is_normal = builder->CreateICmpSGT(power2, builder->getInt64(0), "is_normal");
+
+    // Round halfway cases to even
+    llvm::Value *const low_is_exact = builder->CreateICmpULE(low, builder->getInt64(1), "low_is_exact");
+    llvm::Value *const above_min_rte = builder->CreateICmpSGE(arg_q, builder->getInt64(min_round_to_even), "above_min_rte");
+    llvm::Value *const below_max_rte = builder->CreateICmpSLE(arg_q, builder->getInt64(max_round_to_even), "below_max_rte");
+    llvm::Value *const mantissa_low_bits = builder->CreateAnd(mantissa, builder->getInt64(3), "mantissa_low_bits");
+    llvm::Value *const is_odd_half = builder->CreateICmpEQ(mantissa_low_bits, builder->getInt64(1), "is_odd_half");
+    llvm::Value *const is_exact_shift = builder->CreateICmpEQ(builder->CreateShl(mantissa, shift), high, "is_exact_shift");
+    llvm::Value *is_halfway = builder->CreateAnd(low_is_exact, builder->CreateAnd(above_min_rte, below_max_rte));
+    is_halfway = builder->CreateAnd(is_halfway, builder->CreateAnd(is_odd_half, is_exact_shift), "is_halfway");
+    mantissa = builder->CreateSelect(is_halfway, builder->CreateAnd(mantissa, builder->getInt64(~1ULL)), mantissa, "mantissa_even");
+    mantissa = builder->CreateAdd(mantissa, builder->CreateAnd(mantissa, builder->getInt64(1)), "mantissa_rounded");
+    mantissa = builder->CreateLShr(mantissa, 1, "mantissa_shifted");
+
+    // Rounding up could have overflown the mantissa into the next binary exponent
+    llvm::Value *const mantissa_overflow = builder->CreateICmpUGE(mantissa, builder->getInt64(2ULL << mantissa_bits), "mantissa_overflow");
+    mantissa = builder->CreateSelect(mantissa_overflow, builder->getInt64(1ULL << mantissa_bits), mantissa, "mantissa_adjusted");
+    power2 = builder->CreateAdd(power2, builder->CreateZExt(mantissa_overflow, i64_type), "power2_adjusted");
+    mantissa = builder->CreateAnd(mantissa, builder->getInt64(~(1ULL << mantissa_bits)), "mantissa_bits");
+    llvm::Value *const is_finite = builder->CreateICmpSLT(power2, builder->getInt64(infinite_power), "is_finite");
+
+    llvm::Value *const bits = builder->CreateOr(mantissa, builder->CreateShl(power2, mantissa_bits), "bits");
+    llvm::Value *const is_valid = builder->CreateAnd(is_normal, is_finite, "is_valid");
+    builder->CreateRet(builder->CreateSelect(is_valid, bits, builder->getInt64(-1)));
+    return el_fn;
 }
 
-void Generator::Module::Parse::generate_parse_f64_function( //
-    llvm::IRBuilder<> *builder,                             //
-    llvm::Module *module,                                   //
-    const bool only_declarations                            //
+void Generator::Module::Parse::generate_parse_float_function( //
+    llvm::IRBuilder<> *builder,                               //
+    llvm::Module *module,                                     //
+    const bool only_declarations,                             //
+    const size_t bit_width                                    //
 ) {
     // THE C IMPLEMENTATION:
-    // float parse_f64(const str* input) {
-    //     size_t len = input->len;
+    // fN parse_fN(const str* input) {
+    //     const size_t len = input->len;
+    //     const char *s = input->value;
+    //     if (len == 0) {
+    //         return 0;
+    //     }
+    //     size_t i = 0;
+    //     while (i < len && isspace(s[i])) {
+    //         i++;
+    //     }
+    //     if (i == len) {
+    //         THROW ErrParse.InvalidCharacter;
+    //     }
+    //     const bool is_neg = s[i] == '-';
+    //     if (is_neg || s[i] == '+') {
+    //         i++;
+    //     }
+    //     // The value is w * 10^q, where w holds the first 19 significant digits
+    //     uint64_t w = 0;
+    //     int64_t q = 0;
+    //     size_t significant_digits = 0;
+    //     size_t digits = 0;
+    //     bool has_dot = false;
+    //     bool truncated = false;
+    //     for (; i < len; i++) {
+    //         if (s[i] == '.' && !has_dot) {
+    //             has_dot = true;
+    //             continue;
+    //         }
+    //         const uint8_t digit = s[i] - '0';
+    //         if (digit > 9) {
+    //             break;
+    //         }
+    //         digits++;
+    //         if (w == 0 && digit == 0) {
+    //             q -= has_dot;
+    //         } else if (significant_digits < 19) {
+    //             w = w * 10 + digit;
+    //             significant_digits++;
+    //             q -= has_dot;
+    //         } else {
+    //             truncated = true;
+    //             q += !has_dot;
+    //         }
+    //     }
+    //     if (digits == 0) {
+    //         goto fallback;
+    //     }
+    //     if (i < len && (s[i] | 0x20) == 'e') {
+    //         i++;
+    //         if (i == len) {
+    //             goto fallback;
+    //         }
+    //         const bool exp_is_neg = s[i] == '-';
+    //         if (exp_is_neg || s[i] == '+') {
+    //             i++;
+    //         }
+    //         const size_t exp_start = i;
+    //         int64_t exp = 0;
+    //         for (; i < len && (uint8_t)(s[i] - '0') <= 9; i++) {
+    //             if (exp < 0x10000) {
+    //                 exp = exp * 10 + (s[i] - '0');
+    //             }
+    //         }
+    //         if (i == exp_start) {
+    //             goto fallback;
+    //         }
+    //         q += exp_is_neg ? -exp : exp;
+    //     }
+    //     if (i != len) {
+    //         goto fallback;
+    //     }
+    //     if (w == 0) {
+    //         return is_neg ? -0.0 : 0.0;
+    //     }
+    //     // Clinger's fast path: both w and 10^|q| are exact, so a single correctly rounded operation gives the correct result
+    //     if (!truncated && q >= -MAX_FAST_EXPONENT && q <= MAX_FAST_EXPONENT && w <= MAX_FAST_MANTISSA) {
+    //         const fN value = q < 0 ? (fN)w / pow10[-q] : (fN)w * pow10[q];
+    //         return is_neg ? -value : value;
+    //     }
+    //     int64_t bits = eisel_lemire_fN(w, q);
+    //     // If digits were truncated, the result is only correct if it is the same for the next larger w
+    //     if (bits != -1 && (!truncated || bits == eisel_lemire_fN(w + 1, q))) {
+    //         return bitcast<fN>(bits | (is_neg << (N - 1)));
+    //     }
+    // fallback:
+    //     // Everything the fast path does not handle (inf, nan, hex floats, subnormals, overflows, ambiguous truncations) is handed to
+    //     // strtoN on a terminated copy of the input
+    //     char *buffer = malloc(len + 1);
+    //     memcpy(buffer, s, len);
+    //     buffer[len] = '\0';
     //     char *endptr = NULL;
     //     errno = 0;
-    //     double value = strtod(&input->value, &endptr);
-    //     // The whole string should have been parsed
-    //     if (endptr < &input->value + len) {
-    //         printf("Not whole buffer parsed!\n");
-    //         abort();
+    //     const fN value = strtoN(buffer, &endptr);
+    //     const bool not_whole_buffer = endptr < buffer + len;
+    //     const bool is_range_error = errno == ERANGE;
+    //     free(buffer);
+    //     if (not_whole_buffer) {
+    //         THROW ErrParse.InvalidCharacter;
     //     }
-    //     if (errno == ERANGE) {
-    //         printf("Floating point value out of bounds!\n");
-    //         abort();
+    //     if (is_range_error) {
+    //         THROW ErrParse.OutOfBounds;
     //     }
     //     return value;
     // }
-    llvm::Function *const strtod_fn = c_functions.at(STRTOD);
-    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
-
-    const std::shared_ptr<Type> result_type_ptr = Type::get_primitive_type("f64");
+    const bool is_f64 = bit_width == 64;
+    const int64_t max_fast_exponent = is_f64 ? 22 : 10;
+    const uint64_t max_fast_mantissa = is_f64 ? (1ULL << 53) : (1ULL << 24);
+    const std::string type_name = "f" + std::to_string(bit_width);
+    const std::shared_ptr<Type> result_type_ptr = Type::get_primitive_type(type_name);
     llvm::StructType *const function_result_type = IR::add_and_or_get_type(module, result_type_ptr, true);
-    const unsigned int ErrParse = hash.get_type_id_from_str("ErrParse");
-    const std::vector<error_value> &ErrParseValues = std::get<2>(core_module_error_sets.at("parse").front());
     const unsigned int OutOfBounds = 0;
     const unsigned int InvalidCharacter = 1;
-    const std::string OutOfBoundsMessage(ErrParseValues.at(OutOfBounds).second);
-    const std::string InvalidCharacterMessage(ErrParseValues.at(InvalidCharacter).second);
-    llvm::FunctionType *const parse_f64_type = llvm::FunctionType::get(function_result_type, {PTR_TY}, false);
-    llvm::Function *const parse_f64_fn = llvm::Function::Create( //
-        parse_f64_type,                                          //
-        llvm::Function::ExternalLinkage,                         //
-        prefix + "parse_f64",                                    //
-        module                                                   //
+    llvm::FunctionType *const parse_fN_type = llvm::FunctionType::get(function_result_type, {PTR_TY}, false);
+    llvm::Function *const parse_fN_fn = llvm::Function::Create( //
+        parse_fN_type,                                          //
+        llvm::Function::ExternalLinkage,                        //
+        prefix + "parse_" + type_name,                          //
+        module                                                  //
     );
-    parse_functions["parse_f64"] = parse_f64_fn;
+    parse_functions["parse_" + type_name] = parse_fN_fn;
     if (only_declarations) {
         return;
     }
 
+    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
+    llvm::Type *const i1_type = builder->getInt1Ty();
+    llvm::Type *const i8_type = builder->getInt8Ty();
+    llvm::Type *const i64_type = builder->getInt64Ty();
+    llvm::Type *const float_type = is_f64 ? builder->getDoubleTy() : builder->getFloatTy();
+    llvm::Type *const bits_type = builder->getIntNTy(bit_width);
+    llvm::Function *const el_fn = generate_eisel_lemire_function(builder, module, bit_width);
+    llvm::Function *const strto_fn = c_functions.at(is_f64 ? STRTOD : STRTOF);
+    llvm::Function *const malloc_fn = c_functions.at(MALLOC);
+    llvm::Function *const memcpy_fn = c_functions.at(MEMCPY);
+    llvm::Function *const free_fn = c_functions.at(FREE);
+
+    // The exact powers of ten for Clinger's fast path
+    std::vector<llvm::Constant *> pow10_values;
+    for (int64_t i = 0; i <= max_fast_exponent; i++) {
+        pow10_values.push_back(llvm::ConstantFP::get(float_type, "1e" + std::to_string(i)));
+    }
+    llvm::ArrayType *const pow10_type = llvm::ArrayType::get(float_type, pow10_values.size());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    llvm::GlobalVariable *const pow10_table = new llvm::GlobalVariable(                                                   //
+        *module, pow10_type, true, llvm::GlobalValue::PrivateLinkage, llvm::ConstantArray::get(pow10_type, pow10_values), //
+        prefix + "pow10_" + type_name                                                                                     //
+    );
+#pragma GCC diagnostic pop
+
     // Get the input argument
-    llvm::Argument *const arg_input = parse_f64_fn->arg_begin();
+    llvm::Argument *const arg_input = parse_fN_fn->arg_begin();
     arg_input->setName("input");
 
     // Create basic blocks
-    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_f64_fn);
-    llvm::BasicBlock *const parse_error_block = llvm::BasicBlock::Create(context, "parse_error", parse_f64_fn);
-    llvm::BasicBlock *const errno_check_block = llvm::BasicBlock::Create(context, "errno_check", parse_f64_fn);
-    llvm::BasicBlock *const errno_fail_block = llvm::BasicBlock::Create(context, "errno_fail", parse_f64_fn);
-    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", parse_f64_fn);
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", parse_fN_fn);
+    llvm::BasicBlock *const empty_block = llvm::BasicBlock::Create(context, "empty", parse_fN_fn);
+    llvm::BasicBlock *const space_cond_block = llvm::BasicBlock::Create(context, "space_cond", parse_fN_fn);
+    llvm::BasicBlock *const space_check_block = llvm::BasicBlock::Create(context, "space_check", parse_fN_fn);
+    llvm::BasicBlock *const space_next_block = llvm::BasicBlock::Create(context, "space_next", parse_fN_fn);
+    llvm::BasicBlock *const sign_block = llvm::BasicBlock::Create(context, "sign", parse_fN_fn);
+    llvm::BasicBlock *const mantissa_cond_block = llvm::BasicBlock::Create(context, "mantissa_cond", parse_fN_fn);
+    llvm::BasicBlock *const mantissa_body_block = llvm::BasicBlock::Create(context, "mantissa_body", parse_fN_fn);
+    llvm::BasicBlock *const dot_block = llvm::BasicBlock::Create(context, "dot", parse_fN_fn);
+    llvm::BasicBlock *const digit_check_block = llvm::BasicBlock::Create(context, "digit_check", parse_fN_fn);
+    llvm::BasicBlock *const digit_block = llvm::BasicBlock::Create(context, "digit", parse_fN_fn);
+    llvm::BasicBlock *const mantissa_end_block = llvm::BasicBlock::Create(context, "mantissa_end", parse_fN_fn);
+    llvm::BasicBlock *const exp_check_block = llvm::BasicBlock::Create(context, "exp_check", parse_fN_fn);
+    llvm::BasicBlock *const exp_start_block = llvm::BasicBlock::Create(context, "exp_start", parse_fN_fn);
+    llvm::BasicBlock *const exp_sign_check_block = llvm::BasicBlock::Create(context, "exp_sign_check", parse_fN_fn);
+    llvm::BasicBlock *const exp_sign_block = llvm::BasicBlock::Create(context, "exp_sign", parse_fN_fn);
+    llvm::BasicBlock *const exp_cond_block = llvm::BasicBlock::Create(context, "exp_cond", parse_fN_fn);
+    llvm::BasicBlock *const exp_body_block = llvm::BasicBlock::Create(context, "exp_body", parse_fN_fn);
+    llvm::BasicBlock *const exp_digit_block = llvm::BasicBlock::Create(context, "exp_digit", parse_fN_fn);
+    llvm::BasicBlock *const exp_end_block = llvm::BasicBlock::Create(context, "exp_end", parse_fN_fn);
+    llvm::BasicBlock *const end_check_block = llvm::BasicBlock::Create(context, "end_check", parse_fN_fn);
+    llvm::BasicBlock *const convert_block = llvm::BasicBlock::Create(context, "convert", parse_fN_fn);
+    llvm::BasicBlock *const zero_block = llvm::BasicBlock::Create(context, "zero", parse_fN_fn);
+    llvm::BasicBlock *const fast_check_block = llvm::BasicBlock::Create(context, "fast_check", parse_fN_fn);
+    llvm::BasicBlock *const clinger_block = llvm::BasicBlock::Create(context, "clinger", parse_fN_fn);
+    llvm::BasicBlock *const eisel_lemire_block = llvm::BasicBlock::Create(context, "eisel_lemire", parse_fN_fn);
+    llvm::BasicBlock *const eisel_lemire_truncated_block = llvm::BasicBlock::Create(context, "eisel_lemire_truncated", parse_fN_fn);
+    llvm::BasicBlock *const eisel_lemire_check_block = llvm::BasicBlock::Create(context, "eisel_lemire_check", parse_fN_fn);
+    llvm::BasicBlock *const eisel_lemire_ok_block = llvm::BasicBlock::Create(context, "eisel_lemire_ok", parse_fN_fn);
+    llvm::BasicBlock *const fallback_block = llvm::BasicBlock::Create(context, "fallback", parse_fN_fn);
+    llvm::BasicBlock *const range_check_block = llvm::BasicBlock::Create(context, "range_check", parse_fN_fn);
+    llvm::BasicBlock *const fallback_ok_block = llvm::BasicBlock::Create(context, "fallback_ok", parse_fN_fn);
+    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", parse_fN_fn);
+    llvm::BasicBlock *const invalid_block = generate_parse_error_block(                           //
+        builder, module, parse_fN_fn, function_result_type, InvalidCharacter, "invalid_character" //
+    );
+    llvm::BasicBlock *const out_of_bounds_block = generate_parse_error_block(            //
+        builder, module, parse_fN_fn, function_result_type, OutOfBounds, "out_of_bounds" //
+    );
 
-    // Set insertion point to entry block
     builder->SetInsertPoint(entry_block);
-
-    // Get the length of the input string
-    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, arg_input, 0);
-    llvm::Value *const len = IR::aligned_load(*builder, builder->getInt64Ty(), len_ptr, "len");
-
-    // Create endptr variable: char *endptr = NULL
-    llvm::Value *const endptr_ptr = builder->CreateAlloca(PTR_TY, nullptr, "endptr_ptr");
+    llvm::Value *const len_ptr = builder->CreateStructGEP(str_type, arg_input, 0, "len_ptr");
+    llvm::Value *const len = IR::aligned_load(*builder, i64_type, len_ptr, "len");
+    llvm::Value *const value_ptr = builder->CreateStructGEP(str_type, arg_input, 1, "value_ptr");
+    llvm::AllocaInst *const idx_ptr = builder->CreateAlloca(i64_type, nullptr, "idx_ptr");
+    llvm::AllocaInst *const w_ptr = builder->CreateAlloca(i64_type, nullptr, "w_ptr");
+    llvm::AllocaInst *const q_ptr = builder->CreateAlloca(i64_type, nullptr, "q_ptr");
+    llvm::AllocaInst *const significant_digits_ptr = builder->CreateAlloca(i64_type, nullptr, "significant_digits_ptr");
+    llvm::AllocaInst *const digits_ptr = builder->CreateAlloca(i64_type, nullptr, "digits_ptr");
+    llvm::AllocaInst *const has_dot_ptr = builder->CreateAlloca(i1_type, nullptr, "has_dot_ptr");
+    llvm::AllocaInst *const truncated_ptr = builder->CreateAlloca(i1_type, nullptr, "truncated_ptr");
+    llvm::AllocaInst *const exp_ptr = builder->CreateAlloca(i64_type, nullptr, "exp_ptr");
+    llvm::AllocaInst *const endptr_ptr = builder->CreateAlloca(PTR_TY, nullptr, "endptr_ptr");
+    IR::aligned_store(*builder, builder->getInt64(0), idx_ptr);
+    IR::aligned_store(*builder, builder->getInt64(0), w_ptr);
+    IR::aligned_store(*builder, builder->getInt64(0), q_ptr);
+    IR::aligned_store(*builder, builder->getInt64(0), significant_digits_ptr);
+    IR::aligned_store(*builder, builder->getInt64(0), digits_ptr);
+    IR::aligned_store(*builder, builder->getFalse(), has_dot_ptr);
+    IR::aligned_store(*builder, builder->getFalse(), truncated_ptr);
+    IR::aligned_store(*builder, builder->getInt64(0), exp_ptr);
+    builder->CreateCondBr(builder->CreateICmpEQ(len, builder->getInt64(0), "is_empty"), empty_block, space_cond_block);
+
+    // An empty input parses as 0
+    builder->SetInsertPoint(empty_block);
+    builder->CreateBr(exit_block);
+
+    // Skip all leading whitespace, an input consisting only of whitespace contains no number at all
+    builder->SetInsertPoint(space_cond_block);
+    llvm::Value *idx = IR::aligned_load(*builder, i64_type, idx_ptr, "idx");
+    builder->CreateCondBr(builder->CreateICmpULT(idx, len, "idx_in_range"), space_check_block, invalid_block);
+
+    builder->SetInsertPoint(space_check_block);
+    llvm::Value *const first_char_ptr = builder->CreateGEP(i8_type, value_ptr, idx, "first_char_ptr");
+    llvm::Value *const first_char = IR::aligned_load(*builder, i8_type, first_char_ptr, "first_char");
+    builder->CreateCondBr(generate_is_space(builder, first_char), space_next_block, sign_block);
+
+    builder->SetInsertPoint(space_next_block);
+    IR::aligned_store(*builder, builder->CreateAdd(idx, builder->getInt64(1)), idx_ptr);
+    builder->CreateBr(space_cond_block);
+
+    builder->SetInsertPoint(sign_block);
+    llvm::Value *const is_neg = builder->CreateICmpEQ(first_char, builder->getInt8('-'), "is_neg");
+    llvm::Value *const is_pos = builder->CreateICmpEQ(first_char, builder->getInt8('+'), "is_pos");
+    llvm::Value *const has_sign = builder->CreateOr(is_neg, is_pos, "has_sign");
+    IR::aligned_store(*builder, builder->CreateAdd(idx, builder->CreateZExt(has_sign, i64_type)), idx_ptr);
+    builder->CreateBr(mantissa_cond_block);
+
+    // Parse the digits of the mantissa, including an optional dot
+    builder->SetInsertPoint(mantissa_cond_block);
+    idx = IR::aligned_load(*builder, i64_type, idx_ptr, "idx");
+    builder->CreateCondBr(builder->CreateICmpULT(idx, len, "idx_in_range"), mantissa_body_block, mantissa_end_block);
+
+    builder->SetInsertPoint(mantissa_body_block);
+    llvm::Value *const char_ptr = builder->CreateGEP(i8_type, value_ptr, idx, "char_ptr");
+    llvm::Value *const current_char = IR::aligned_load(*builder, i8_type, char_ptr, "current_char");
+    llvm::Value *const has_dot = IR::aligned_load(*builder, i1_type, has_dot_ptr, "has_dot");
+    llvm::Value *const is_dot = builder->CreateICmpEQ(current_char, builder->getInt8('.'), "is_dot");
+    llvm::Value *const is_first_dot = builder->CreateAnd(is_dot, builder->CreateNot(has_dot), "is_first_dot");
+    llvm::Value *const next_idx = builder->CreateAdd(idx, builder->getInt64(1), "next_idx");
+    builder->CreateCondBr(is_first_dot, dot_block, digit_check_block);
+
+    builder->SetInsertPoint(dot_block);
+    IR::aligned_store(*builder, builder->getTrue(), has_dot_ptr);
+    IR::aligned_store(*builder, next_idx, idx_ptr);
+    builder->CreateBr(mantissa_cond_block);
+
+    builder->SetInsertPoint(digit_check_block);
+    llvm::Value *const digit = builder->CreateSub(current_char, builder->getInt8('0'), "digit");
+    llvm::Value *const is_digit = builder->CreateICmpULE(digit, builder->getInt8(9), "is_digit");
+    builder->CreateCondBr(is_digit, digit_block, mantissa_end_block);
+
+    // Leading zeros only shift the exponent, digits beyond the 19th only shift the exponent and mark the mantissa as truncated
+    builder->SetInsertPoint(digit_block);
+    llvm::Value *const w = IR::aligned_load(*builder, i64_type, w_ptr, "w");
+    llvm::Value *const q = IR::aligned_load(*builder, i64_type, q_ptr, "q");
+    llvm::Value *const significant_digits = IR::aligned_load(*builder, i64_type, significant_digits_ptr, "significant_digits");
+    llvm::Value *const digits = IR::aligned_load(*builder, i64_type, digits_ptr, "digits");
+    llvm::Value *const truncated = IR::aligned_load(*builder, i1_type, truncated_ptr, "truncated");
+    llvm::Value *const digit_64 = builder->CreateZExt(digit, i64_type, "digit_64");
+    llvm::Value *const is_leading_zero = builder->CreateICmpEQ(builder->CreateOr(w, digit_64), builder->getInt64(0), "is_leading_zero");
+    llvm::Value *const has_room = builder->CreateICmpULT(significant_digits, builder->getInt64(19), "has_room");
+    llvm::Value *const is_significant = builder->CreateNot(is_leading_zero, "is_significant");
+    llvm::Value *const is_stored = builder->CreateAnd(is_significant, has_room, "is_stored");
+    llvm::Value *const is_truncated = builder->CreateAnd(is_significant, builder->CreateNot(has_room), "is_truncated");
+    llvm::Value *const stored_w = builder->CreateAdd(builder->CreateMul(w, builder->getInt64(10)), digit_64, "stored_w");
+    IR::aligned_store(*builder, builder->CreateSelect(is_stored, stored_w, w), w_ptr);
+    IR::aligned_store(*builder, builder->CreateAdd(significant_digits, builder->CreateZExt(is_stored, i64_type)), significant_digits_ptr);
+    IR::aligned_store(*builder, builder->CreateAdd(digits, builder->getInt64(1)), digits_ptr);
+    IR::aligned_store(*builder, builder->CreateOr(truncated, is_truncated), truncated_ptr);
+    llvm::Value *const frac_q_delta = builder->CreateSelect(is_truncated, builder->getInt64(0), builder->getInt64(-1), "frac_q_delta");
+    llvm::Value *const int_q_delta = builder->CreateZExt(is_truncated, i64_type, "int_q_delta");
+    IR::aligned_store(*builder, builder->CreateAdd(q, builder->CreateSelect(has_dot, frac_q_delta, int_q_delta)), q_ptr);
+    IR::aligned_store(*builder, next_idx, idx_ptr);
+    builder->CreateBr(mantissa_cond_block);
+
+    builder->SetInsertPoint(mantissa_end_block);
+    llvm::Value *const total_digits = IR::aligned_load(*builder, i64_type, digits_ptr, "total_digits");
+    llvm::Value *const has_no_digits = builder->CreateICmpEQ(total_digits, builder->getInt64(0), "has_no_digits");
+    builder->CreateCondBr(has_no_digits, fallback_block, exp_check_block);
+
+    // Parse the optional exponent
+    builder->SetInsertPoint(exp_check_block);
+    idx = IR::aligned_load(*builder, i64_type, idx_ptr, "idx");
+    builder->CreateCondBr(builder->CreateICmpULT(idx, len, "idx_in_range"), exp_start_block, end_check_block);
+
+    builder->SetInsertPoint(exp_start_block);
+    llvm::Value *const exp_char_ptr = builder->CreateGEP(i8_type, value_ptr, idx, "exp_char_ptr");
+    llvm::Value *const exp_char = IR::aligned_load(*builder, i8_type, exp_char_ptr, "exp_char");
+    llvm::Value *const exp_char_lower = builder->CreateOr(exp_char, builder->getInt8(0x20), "exp_char_lower");
+    llvm::Value *const is_exp = builder->CreateICmpEQ(exp_char_lower, builder->getInt8('e'), "is_exp");
+    llvm::Value *const exp_sign_idx = builder->CreateAdd(idx, builder->getInt64(1), "exp_sign_idx");
+    llvm::Value *const exp_has_more = builder->CreateICmpULT(exp_sign_idx, len, "exp_has_more");
+    builder->CreateCondBr(is_exp, exp_sign_check_block, end_check_block);
+
+    builder->SetInsertPoint(exp_sign_check_block);
+    builder->CreateCondBr(exp_has_more, exp_sign_block, fallback_block);
+
+    builder->SetInsertPoint(exp_sign_block);
+    llvm::Value *const exp_sign_char_ptr = builder->CreateGEP(i8_type, value_ptr, exp_sign_idx, "exp_sign_char_ptr");
+    llvm::Value *const exp_sign_char = IR::aligned_load(*builder, i8_type, exp_sign_char_ptr, "exp_sign_char");
+    llvm::Value *const exp_is_neg = builder->CreateICmpEQ(exp_sign_char, builder->getInt8('-'), "exp_is_neg");
+    llvm::Value *const exp_is_pos = builder->CreateICmpEQ(exp_sign_char, builder->getInt8('+'), "exp_is_pos");
+    llvm::Value *const exp_has_sign = builder->CreateOr(exp_is_neg, exp_is_pos, "exp_has_sign");
+    llvm::Value *const exp_digits_start = builder->CreateAdd(exp_sign_idx, builder->CreateZExt(exp_has_sign, i64_type), "exp_digits_start");
+    IR::aligned_store(*builder, exp_digits_start, idx_ptr);
+    builder->CreateBr(exp_cond_block);
+
+    builder->SetInsertPoint(exp_cond_block);
+    idx = IR::aligned_load(*builder, i64_type, idx_ptr, "idx");
+    builder->CreateCondBr(builder->CreateICmpULT(idx, len, "idx_in_range"), exp_body_block, exp_end_block);
+
+    builder->SetInsertPoint(exp_body_block);
+    llvm::Value *const exp_digit_ptr = builder->CreateGEP(i8_type, value_ptr, idx, "exp_digit_ptr");
+    llvm::Value *const exp_digit_char = IR::aligned_load(*builder, i8_type, exp_digit_ptr, "exp_digit_char");
+    llvm::Value *const exp_digit = builder->CreateSub(exp_digit_char, builder->getInt8('0'), "exp_digit");
+    builder->CreateCondBr(builder->CreateICmpULE(exp_digit, builder->getInt8(9), "is_exp_digit"), exp_digit_block, exp_end_block);
+
+    // Huge exponents are saturated, they are out of the range of every float type anyway
+    builder->SetInsertPoint(exp_digit_block);
+    llvm::Value *const exp = IR::aligned_load(*builder, i64_type, exp_ptr, "exp");
+    llvm::Value *const shifted_exp = builder->CreateMul(exp, builder->getInt64(10), "shifted_exp");
+    llvm::Value *const next_exp = builder->CreateAdd(shifted_exp, builder->CreateZExt(exp_digit, i64_type), "next_exp");
+    llvm::Value *const exp_is_small = builder->CreateICmpULT(exp, builder->getInt64(0x10000), "exp_is_small");
+    IR::aligned_store(*builder, builder->CreateSelect(exp_is_small, next_exp, exp), exp_ptr);
+    IR::aligned_store(*builder, builder->CreateAdd(idx, builder->getInt64(1)), idx_ptr);
+    builder->CreateBr(exp_cond_block);
+
+    builder->SetInsertPoint(exp_end_block);
+    idx = IR::aligned_load(*builder, i64_type, idx_ptr, "idx");
+    llvm::Value *const final_exp = IR::aligned_load(*builder, i64_type, exp_ptr, "final_exp");
+    llvm::Value *const signed_exp = builder->CreateSelect(exp_is_neg, builder->CreateNeg(final_exp), final_exp, "signed_exp");
+    llvm::Value *const exp_q = IR::aligned_load(*builder, i64_type, q_ptr, "exp_q");
+    IR::aligned_store(*builder, builder->CreateAdd(exp_q, signed_exp), q_ptr);
+    builder->CreateCondBr(builder->CreateICmpEQ(idx, exp_digits_start, "exp_has_no_digits"), fallback_block, end_check_block);
+
+    // The whole input needs to be a number for the fast paths
+    builder->SetInsertPoint(end_check_block);
+    idx = IR::aligned_load(*builder, i64_type, idx_ptr, "idx");
+    builder->CreateCondBr(builder->CreateICmpEQ(idx, len, "is_whole_input"), convert_block, fallback_block);
+
+    builder->SetInsertPoint(convert_block);
+    llvm::Value *const final_w = IR::aligned_load(*builder, i64_type, w_ptr, "final_w");
+    llvm::Value *const final_q = IR::aligned_load(*builder, i64_type, q_ptr, "final_q");
+    llvm::Value *const final_truncated = IR::aligned_load(*builder, i1_type, truncated_ptr, "final_truncated");
+    llvm::Value *const sign_bit = builder->CreateShl(builder->CreateZExt(is_neg, bits_type), bit_width - 1, "sign_bit");
+    builder->CreateCondBr(builder->CreateICmpEQ(final_w, builder->getInt64(0), "is_zero"), zero_block, fast_check_block);
+
+    builder->SetInsertPoint(zero_block);
+    llvm::Value *const zero_value = builder->CreateBitCast(sign_bit, float_type, "zero_value");
+    builder->CreateBr(exit_block);
+
+    builder->SetInsertPoint(fast_check_block);
+    llvm::Value *const q_above_min = builder->CreateICmpSGE(final_q, builder->getInt64(-max_fast_exponent), "q_above_min");
+    llvm::Value *const q_below_max = builder->CreateICmpSLE(final_q, builder->getInt64(max_fast_exponent), "q_below_max");
+    llvm::Value *const w_is_exact = builder->CreateICmpULE(final_w, builder->getInt64(max_fast_mantissa), "w_is_exact");
+    llvm::Value *is_fast = builder->CreateAnd(builder->CreateNot(final_truncated), builder->CreateAnd(q_above_min, q_below_max));
+    is_fast = builder->CreateAnd(is_fast, w_is_exact, "is_fast");
+    builder->CreateCondBr(is_fast, clinger_block, eisel_lemire_block);
+
+    builder->SetInsertPoint(clinger_block);
+    llvm::Value *const q_is_neg = builder->CreateICmpSLT(final_q, builder->getInt64(0), "q_is_neg");
+    llvm::Value *const abs_q = builder->CreateSelect(q_is_neg, builder->CreateNeg(final_q), final_q, "abs_q");
+    llvm::Value *const pow10_ptr = builder->CreateGEP(float_type, pow10_table, abs_q, "pow10_ptr");
+    llvm::Value *const pow10 = IR::aligned_load(*builder, float_type, pow10_ptr, "pow10");
+    llvm::Value *const float_w = builder->CreateUIToFP(final_w, float_type, "float_w");
+    llvm::Value *const divided = builder->CreateFDiv(float_w, pow10, "divided");
+    llvm::Value *const multiplied = builder->CreateFMul(float_w, pow10, "multiplied");
+    llvm::Value *const clinger_abs = builder->CreateSelect(q_is_neg, divided, multiplied, "clinger_abs");
+    llvm::Value *const clinger_value = builder->CreateSelect(is_neg, builder->CreateFNeg(clinger_abs), clinger_abs, "clinger_value");
+    builder->CreateBr(exit_block);
+
+    builder->SetInsertPoint(eisel_lemire_block);
+    llvm::Value *const el_bits = builder->CreateCall(el_fn, {final_w, final_q}, "el_bits");
+    llvm::Value *const el_is_valid = builder->CreateICmpNE(el_bits, builder->getInt64(-1), "el_is_valid");
+    builder->CreateCondBr(final_truncated, eisel_lemire_truncated_block, eisel_lemire_check_block);
+
+    builder->SetInsertPoint(eisel_lemire_truncated_block);
+    llvm::Value *const next_w = builder->CreateAdd(final_w, builder->getInt64(1), "next_w");
+    llvm::Value *const el_next_bits = builder->CreateCall(el_fn, {next_w, final_q}, "el_next_bits");
+    llvm::Value *const el_is_same = builder->CreateICmpEQ(el_bits, el_next_bits, "el_is_same");
+    llvm::Value *const el_truncated_is_valid = builder->CreateAnd(el_is_valid, el_is_same, "el_truncated_is_valid");
+    builder->CreateBr(eisel_lemire_check_block);
+
+    builder->SetInsertPoint(eisel_lemire_check_block);
+    llvm::PHINode *const el_ok = builder->CreatePHI(i1_type, 2, "el_ok");
+    el_ok->addIncoming(el_is_valid, eisel_lemire_block);
+    el_ok->addIncoming(el_truncated_is_valid, eisel_lemire_truncated_block);
+    builder->CreateCondBr(el_ok, eisel_lemire_ok_block, fallback_block);
+
+    builder->SetInsertPoint(eisel_lemire_ok_block);
+    llvm::Value *const el_value_bits = builder->CreateOr(builder->CreateTrunc(el_bits, bits_type), sign_bit, "el_value_bits");
+    llvm::Value *const el_value = builder->CreateBitCast(el_value_bits, float_type, "el_value");
+    builder->CreateBr(exit_block);
+
+    // Fallback: parse a terminated copy of the input with strtof / strtod
+    builder->SetInsertPoint(fallback_block);
+    llvm::Value *const buffer = builder->CreateCall(malloc_fn, {builder->CreateAdd(len, builder->getInt64(1))}, "buffer");
+    builder->CreateCall(memcpy_fn, {buffer, value_ptr, len});
+    llvm::Value *const buffer_end = builder->CreateGEP(i8_type, buffer, len, "buffer_end");
+    IR::aligned_store(*builder, builder->getInt8(0), buffer_end);
     IR::aligned_store(*builder, llvm::ConstantPointerNull::get(PTR_TY), endptr_ptr);
-
-    // Call strtof: float value = strtod(input.c_str, &endptr)
-    llvm::Value *const input_cstr = builder->CreateStructGEP(str_type, arg_input, 1);
     llvm::Value *const errno_ptr = get_errno_ptr(builder, module);
     IR::aligned_store(*builder, builder->getInt32(0), errno_ptr);
-    llvm::Value *const value = builder->CreateCall(strtod_fn, {input_cstr, endptr_ptr}, "value");
-
-    // Load the endptr value after strtof call
+    llvm::Value *const fallback_value = builder->CreateCall(strto_fn, {buffer, endptr_ptr}, "fallback_value");
     llvm::Value *const endptr = IR::aligned_load(*builder, PTR_TY, endptr_ptr, "endptr");
+    llvm::Value *const endptr_lt_end = builder->CreateICmpULT(endptr, buffer_end, "endptr_lt_end");
+    llvm::Value *const errno_val = builder->CreateLoad(builder->getInt32Ty(), errno_ptr);
+    llvm::Value *const is_range_error = builder->CreateICmpEQ(errno_val, builder->getInt32(ERANGE));
+    builder->CreateCall(free_fn, {buffer});
+    builder->CreateCondBr(endptr_lt_end, invalid_block, range_check_block);
 
-    // Calculate input.c_str + len (end of the input c string)
-    llvm::Value *const input_end = builder->CreateGEP(builder->getInt8Ty(), input_cstr, len, "cstr_end");
-
-    // Check if endptr < input.c_str + len (not all input was parsed)
-    llvm::Value *const endptr_lt_end = builder->CreateICmpULT(endptr, input_end, "endptr_lt_end");
-
-    // Branch if an parse error occured
-    builder->CreateCondBr(endptr_lt_end, parse_error_block, errno_check_block);
+    builder->SetInsertPoint(range_check_block);
+    builder->CreateCondBr(is_range_error, out_of_bounds_block, fallback_ok_block);
 
-    // Parse warning: throw ErrParse.InvalidCharacter
-    builder->SetInsertPoint(parse_error_block);
-    llvm::AllocaInst *parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    llvm::Value *parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    llvm::Value *err_value = IR::generate_err_value(*builder, module, ErrParse, InvalidCharacter, InvalidCharacterMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    llvm::Value *parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
+    builder->SetInsertPoint(fallback_ok_block);
+    builder->CreateBr(exit_block);
 
-    // Check if errno had an error, e.g. if the input was outside the range of an `f64`
-    builder->SetInsertPoint(errno_check_block);
-    llvm::Value *const errno_val = builder->CreateLoad(builder->getInt32Ty(), errno_ptr);
-    llvm::Value *const is_range_error = builder->CreateICmpEQ(errno_val, builder->getInt32(ERANGE));
-    builder->CreateCondBr(is_range_error, errno_fail_block, exit_block);
-
-    // Errno error: throw ErrParse.OutOfBounds
-    builder->SetInsertPoint(errno_fail_block);
-    parse_ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "parse_ret_alloca", true);
-    parse_err_ptr = builder->CreateStructGEP(function_result_type, parse_ret_alloca, 0, "parse_err_ptr");
-    err_value = IR::generate_err_value(*builder, module, ErrParse, OutOfBounds, OutOfBoundsMessage);
-    IR::aligned_store(*builder, err_value, parse_err_ptr);
-    parse_ret_val = IR::aligned_load(*builder, function_result_type, parse_ret_alloca, "parse_ret_val");
-    builder->CreateRet(parse_ret_val);
-
-    // Exit block: return the double value
+    // Exit block: return the float value
     builder->SetInsertPoint(exit_block);
+    llvm::PHINode *const value = builder->CreatePHI(float_type, 5, "value");
+    value->addIncoming(llvm::ConstantFP::get(float_type, 0.0), empty_block);
+    value->addIncoming(zero_value, zero_block);
+    value->addIncoming(clinger_value, clinger_block);
+    value->addIncoming(el_value, eisel_lemire_ok_block);
+    value->addIncoming(fallback_value, fallback_ok_block);
     llvm::AllocaInst *const ret_alloca = Allocation::generate_default_struct(*builder, function_result_type, "ret_alloca", false);
     llvm::Value *const val_ptr = builder->CreateStructGEP(function_result_type, ret_alloca, 1, "ret_value_ptr");
     IR::aligned_store(*builder, value, val_ptr);
@@ -243,6 +243,87 @@ bool Generator::Module::Arithmetic::refresh_arithmetic_functions(llvm::Module *m
     return true;
 }
 
+llvm::Value *Generator::Module::Arithmetic::generate_inline_safe_op( //
+    llvm::IRBuilder<> &builder,                                       //
+    const Token operation,                                            //
+    const std::string &type_str,                                      //
+    llvm::Value *lhs,                                                 //
+    llvm::Value *rhs                                                  //
+) {
+    // THE C IMPLEMENTATION (for the i32 addition, all other operations and types work the same way):
+    // int32_t result;
+    // if (__builtin_expect(__builtin_add_overflow(lhs, rhs, &result), 0)) {
+    //     // Cold and never inlined, handles the overflow depending on the overflow mode
+    //     result = i32_safe_add(lhs, rhs);
+    // }
+    const bool is_signed = type_str[0] == 'i';
+    std::string op_name;
+    llvm::Intrinsic::ID overflow_intrinsic;
+    llvm::Intrinsic::ID saturating_intrinsic = llvm::Intrinsic::not_intrinsic;
+    switch (operation) {
+        default:
+            ASSERT(false, "Not allowed operation in 'generate_inline_safe_op'");
+            return nullptr;
+        case TOK_PLUS:
+            if (overflow_mode == ArithmeticOverflowMode::UNSAFE) {
+                return builder.CreateAdd(lhs, rhs, "add_res");
+            }
+            op_name = "add";
+            overflow_intrinsic = is_signed ? llvm::Intrinsic::sadd_with_overflow : llvm::Intrinsic::uadd_with_overflow;
+            saturating_intrinsic = is_signed ? llvm::Intrinsic::sadd_sat : llvm::Intrinsic::uadd_sat;
+            break;
+        case TOK_MINUS:
+            if (overflow_mode == ArithmeticOverflowMode::UNSAFE) {
+                return builder.CreateSub(lhs, rhs, "sub_res");
+            }
+            op_name = "sub";
+            overflow_intrinsic = is_signed ? llvm::Intrinsic::ssub_with_overflow : llvm::Intrinsic::usub_with_overflow;
+            saturating_intrinsic = is_signed ? llvm::Intrinsic::ssub_sat : llvm::Intrinsic::usub_sat;
+            break;
+        case TOK_MULT:
+            if (overflow_mode == ArithmeticOverflowMode::UNSAFE) {
+                return builder.CreateMul(lhs, rhs, "mul_res");
+            }
+            op_name = "mul";
+            overflow_intrinsic = is_signed ? llvm::Intrinsic::smul_with_overflow : llvm::Intrinsic::umul_with_overflow;
+            break;
+    }
+    // The silent mode saturates without any reporting, which is exactly what the saturating intrinsics do without a branch
+    if (overflow_mode == ArithmeticOverflowMode::SILENT && saturating_intrinsic != llvm::Intrinsic::not_intrinsic) {
+        return builder.CreateBinaryIntrinsic(saturating_intrinsic, lhs, rhs, nullptr, "sat_" + op_name + "_res");
+    }
+
+    llvm::Value *result_with_overflow = builder.CreateBinaryIntrinsic(overflow_intrinsic, lhs, rhs, nullptr, op_name + "_with_overflow");
+    llvm::Value *result = builder.CreateExtractValue(result_with_overflow, {0}, op_name + "_res");
+    llvm::Value *overflowed = builder.CreateExtractValue(result_with_overflow, {1}, op_name + "_overflowed");
+    if (overflowed->getType()->isVectorTy()) {
+        // Any overflowing lane sends the whole vector through the slow path
+        overflowed = builder.CreateOrReduce(overflowed);
+    }
+
+    llvm::Function *parent = builder.GetInsertBlock()->getParent();
+    llvm::BasicBlock *fast_block = builder.GetInsertBlock();
+    llvm::BasicBlock *overflow_block = llvm::BasicBlock::Create(context, op_name + "_overflow", parent);
+    llvm::BasicBlock *merge_block = llvm::BasicBlock::Create(context, op_name + "_merge", parent);
+    // Change branch prediction, as no overflow is much more likely to happen than an overflow
+    builder.CreateCondBr(overflowed, overflow_block, merge_block, IR::generate_weights(1, 100));
+
+    // The slow path recomputes the operation out of line, which prints, crashes or saturates depending on the overflow mode
+    builder.SetInsertPoint(overflow_block);
+    llvm::CallInst *safe_result = builder.CreateCall(                                                  //
+        arithmetic_functions.at(type_str + "_safe_" + op_name), {lhs, rhs}, "safe_" + op_name + "_res" //
+    );
+    safe_result->addFnAttr(llvm::Attribute::Cold);
+    safe_result->addFnAttr(llvm::Attribute::NoInline);
+    builder.CreateBr(merge_block);
+
+    builder.SetInsertPoint(merge_block);
+    llvm::PHINode *selection = builder.CreatePHI(result->getType(), 2, op_name + "_checked_res");
+    selection->addIncoming(result, fast_block);
+    selection->addIncoming(safe_result, overflow_block);
+    return selection;
+}
+
 void Generator::Module::Arithmetic::generate_pow_function( //
     llvm::IRBuilder<> *builder,                            //
     llvm::Module *module,                                  //
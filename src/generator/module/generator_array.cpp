@@ -569,7 +569,7 @@ void Generator::Module::Array::generate_access_arr_function( //
 
         // if (index >= dim_lengths[i]) return NULL;
         llvm::Value *const bounds_cond = builder->CreateICmpUGE(current_index, current_dim_length, "bounds_cond");
-        builder->CreateCondBr(bounds_cond, out_of_bounds_block, in_bounds_block);
+        builder->CreateCondBr(bounds_cond, out_of_bounds_block, in_bounds_block, IR::generate_weights(1, 100));
 
         // Out of bounds
         builder->SetInsertPoint(out_of_bounds_block);
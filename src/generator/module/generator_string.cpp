@@ -67,7 +67,7 @@ void Generator::Module::String::generate_access_str_at_function( //
     if (oob_mode != ArrayOutOfBoundsMode::UNSAFE) {
         // Check if idx >= string->len
         llvm::Value *const out_of_bounds_cond = builder->CreateICmpUGE(arg_idx, string_len, "out_of_bounds_cond");
-        builder->CreateCondBr(out_of_bounds_cond, out_of_bounds_block, in_bounds_block);
+        builder->CreateCondBr(out_of_bounds_cond, out_of_bounds_block, in_bounds_block, IR::generate_weights(1, 100));
 
         // Out of bounds block
         builder->SetInsertPoint(out_of_bounds_block);
@@ -165,7 +165,7 @@ void Generator::Module::String::generate_assign_str_at_function( //
     if (oob_mode != ArrayOutOfBoundsMode::UNSAFE) {
         // Check if idx >= string->len
         llvm::Value *const out_of_bounds_cond = builder->CreateICmpUGE(arg_idx, string_len, "out_of_bounds_cond");
-        builder->CreateCondBr(out_of_bounds_cond, out_of_bounds_block, in_bounds_block);
+        builder->CreateCondBr(out_of_bounds_cond, out_of_bounds_block, in_bounds_block, IR::generate_weights(1, 100));
 
         // Out of bounds block
         builder->SetInsertPoint(out_of_bounds_block);
@@ -1255,8 +1255,8 @@ void Generator::Module::String::generate_string_assignment( //
         const auto variation = expression_node->get_variation();
         const auto str_type_id = builder.getInt32(Type::get_primitive_type("str")->get_id());
         const bool is_identity_typecast = variation == ExpressionNode::Variation::TYPE_CAST //
-            && expression_node->as<TypeCastNode>()->expr->type->to_string() == "str";
-        const bool is_str = expression_node->type->to_string() == "str";
+            && expression_node->as<TypeCastNode>()->expr->type->is(Type::Builtin::STR);
+        const bool is_str = expression_node->type->is(Type::Builtin::STR);
         const bool owns_result = expression_node->is_producer()              //
             || (is_str && variation == ExpressionNode::Variation::BINARY_OP) //
             || (is_str && variation == ExpressionNode::Variation::TYPE_CAST && !is_identity_typecast);
@@ -1301,7 +1301,7 @@ void Generator::Module::String::generate_string_assignment( //
 std::optional<llvm::Value *> Generator::Module::String::generate_string_addition(                                 //
     llvm::IRBuilder<> &builder,                                                                                   //
     const std::shared_ptr<Scope> scope,                                                                           //
-    const std::unordered_map<std::string, llvm::Value *const> &allocations,                                       //
+    const AllocationMap &allocations,                                                                             //
     std::unordered_map<unsigned int, std::vector<std::pair<std::shared_ptr<Type>, llvm::Value *const>>> &garbage, //
     const unsigned int expr_depth,                                                                                //
     llvm::Value *lhs,                                                                                             //
@@ -1322,8 +1322,7 @@ std::optional<llvm::Value *> Generator::Module::String::generate_string_addition
                 return std::nullopt;
             }
             const auto *str_var = lhs_expr->as<VariableNode>();
-            const unsigned int variable_decl_scope = scope->variables.at(str_var->name).scope_id;
-            llvm::Value *const variable_alloca = allocations.at("s" + std::to_string(variable_decl_scope) + "::" + str_var->name);
+            llvm::Value *const variable_alloca = allocations.get_variable(str_var->slot);
             builder.CreateCall(append_str_fn, {variable_alloca, rhs});
             return lhs;
         } else {
@@ -1371,8 +1370,7 @@ std::optional<llvm::Value *> Generator::Module::String::generate_string_addition
                 return std::nullopt;
             }
             const auto *lhs_var = lhs_expr->as<VariableNode>();
-            const unsigned int variable_decl_scope = scope->variables.at(lhs_var->name).scope_id;
-            llvm::Value *const variable_alloca = allocations.at("s" + std::to_string(variable_decl_scope) + "::" + lhs_var->name);
+            llvm::Value *const variable_alloca = allocations.get_variable(lhs_var->slot);
             builder.CreateCall(append_lit_fn, {variable_alloca, rhs, builder.getInt64(std::get<LitStr>(rhs_lit->value).value.length())});
             return lhs;
         } else {
@@ -79,10 +79,7 @@ void Generator::Module::ThreadStack::generate_capacity_check( //
     builder.CreateCondBr(has_space, ok_block, overflow_block, IR::generate_weights(100, 1));
 
     builder.SetInsertPoint(overflow_block);
-    llvm::Value *msg = IR::generate_const_string(function->getParent(), "Stack overflow detected\n");
-    builder.CreateCall(c_functions.at(PRINTF), {msg});
-    builder.CreateCall(c_functions.at(ABORT), {});
-    builder.CreateUnreachable();
+    IR::generate_cold_crash(builder, function->getParent(), "stack_overflow", "Stack overflow detected\n");
 
     builder.SetInsertPoint(ok_block);
 }
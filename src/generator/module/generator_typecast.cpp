@@ -9,6 +9,9 @@ void Generator::Module::TypeCast::generate_typecast_functions( //
 ) {
     if (!only_declarations) {
         generate_count_digits_function(builder, module);
+        generate_write_digits_function(builder, module);
+        generate_to_decimal_function(builder, module);
+        generate_format_decimal_function(builder, module);
     }
     generate_bool_to_str(builder, module, only_declarations);
     generate_uN_to_str(builder, module, only_declarations, 8);
@@ -19,8 +22,8 @@ void Generator::Module::TypeCast::generate_typecast_functions( //
     generate_iN_to_str(builder, module, only_declarations, 16);
     generate_iN_to_str(builder, module, only_declarations, 32);
     generate_iN_to_str(builder, module, only_declarations, 64);
-    generate_f32_to_str(builder, module, only_declarations);
-    generate_f64_to_str(builder, module, only_declarations);
+    generate_fN_to_str(builder, module, only_declarations, 32);
+    generate_fN_to_str(builder, module, only_declarations, 64);
     generate_bool8_to_str_function(builder, module, only_declarations);
     generate_vector_to_str(builder, module, only_declarations, "u8", 2);
     generate_vector_to_str(builder, module, only_declarations, "u8", 3);
@@ -205,92 +208,587 @@ llvm::Value *Generator::Module::TypeCast::f64_to_f32(llvm::IRBuilder<> &builder,
     return builder.CreateFPTrunc(double_value, llvm::Type::getFloatTy(context), "fptrunc");
 }
 
-void Generator::Module::TypeCast::generate_count_digits_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
-    // C IMPLEMENTATION:
-    // size_t count_digits(size_t n) {
-    //     if (n == 0) {
-    //         return 1;
-    //     }
-    //     size_t count = 0;
-    //     while (n > 0) {
-    //         n /= 10;
-    //         count++;
-    //     }
-    //     return count;
-    // }
+llvm::GlobalVariable *Generator::Module::TypeCast::get_powers_of_ten_table(llvm::Module *module) {
+    const std::string table_name = prefix + "powers_of_ten";
+    if (llvm::GlobalVariable *const table = module->getGlobalVariable(table_name, true)) {
+        return table;
+    }
+    // All powers of ten from 10^0 up to 10^19, which is the largest power of ten fitting into a u64
+    std::vector<uint64_t> entries;
+    uint64_t power = 1;
+    for (unsigned int i = 0; i < 20; i++) {
+        entries.push_back(power);
+        power *= 10;
+    }
+    llvm::Constant *const table_data = llvm::ConstantDataArray::get(context, entries);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    llvm::GlobalVariable *const table = new llvm::GlobalVariable(                                       //
+        *module, table_data->getType(), true, llvm::GlobalValue::PrivateLinkage, table_data, table_name //
+    );
+#pragma GCC diagnostic pop
+    return table;
+}
+
+llvm::GlobalVariable *Generator::Module::TypeCast::get_digit_pairs_table(llvm::Module *module) {
+    const std::string table_name = prefix + "digit_pairs";
+    if (llvm::GlobalVariable *const table = module->getGlobalVariable(table_name, true)) {
+        return table;
+    }
+    // The characters of all two-digit numbers from "00" to "99" right after one another
+    std::string pairs;
+    pairs.reserve(200);
+    for (unsigned int i = 0; i < 100; i++) {
+        pairs += static_cast<char>('0' + i / 10);
+        pairs += static_cast<char>('0' + i % 10);
+    }
+    llvm::Constant *const table_data = llvm::ConstantDataArray::getString(context, pairs, false);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    llvm::GlobalVariable *const table = new llvm::GlobalVariable(                                       //
+        *module, table_data->getType(), true, llvm::GlobalValue::PrivateLinkage, table_data, table_name //
+    );
+#pragma GCC diagnostic pop
+    return table;
+}
 
-    // Create function type: size_t (size_t)
-    llvm::FunctionType *const count_digits_type = llvm::FunctionType::get(llvm::Type::getInt64Ty(context), // Return type: size_t (i64)
-        {llvm::Type::getInt64Ty(context)},                                                                 // Parameter: size_t (i64)
-        false                                                                                              // Not varargs
+llvm::GlobalVariable *Generator::Module::TypeCast::get_power_of_ten_significand_table(llvm::Module *module) {
+    const std::string table_name = prefix + "power_of_ten_128";
+    if (llvm::GlobalVariable *const table = module->getGlobalVariable(table_name, true)) {
+        return table;
+    }
+    // The table contains g = floor(10^e * 2^(127 - floor(log2(10^e)))) + 1 for every e in [SMALLEST_CACHED_POWER, LARGEST_CACHED_POWER],
+    // which is 10^e rounded up to 128 significant bits, stored as the high and then the low u64. All intermediate values fit into 2048
+    // bits, as 10^324 * 2^127 has less than 1210 bits
+    const unsigned int width = 2048;
+    std::vector<uint64_t> entries;
+    entries.reserve(2 * (LARGEST_CACHED_POWER - SMALLEST_CACHED_POWER + 1));
+    for (int e = SMALLEST_CACHED_POWER; e <= LARGEST_CACHED_POWER; e++) {
+        llvm::APInt power_of_ten(width, 1);
+        for (int i = 0; i < std::abs(e); i++) {
+            power_of_ten *= 10;
+        }
+        const int floor_log2 = (e * 1741647) >> 19;
+        llvm::APInt entry(width, 0);
+        if (e < 0) {
+            entry = llvm::APInt::getOneBitSet(width, 127 - floor_log2).udiv(power_of_ten);
+        } else if (floor_log2 <= 127) {
+            entry = power_of_ten.shl(127 - floor_log2);
+        } else {
+            entry = power_of_ten.lshr(floor_log2 - 127);
+        }
+        entry += 1;
+        entries.push_back(entry.lshr(64).trunc(64).getZExtValue());
+        entries.push_back(entry.trunc(64).getZExtValue());
+    }
+    llvm::Constant *const table_data = llvm::ConstantDataArray::get(context, entries);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+    llvm::GlobalVariable *const table = new llvm::GlobalVariable(                                       //
+        *module, table_data->getType(), true, llvm::GlobalValue::PrivateLinkage, table_data, table_name //
     );
+#pragma GCC diagnostic pop
+    return table;
+}
 
-    // Create the function
+void Generator::Module::TypeCast::generate_count_digits_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // C IMPLEMENTATION:
+    // size_t count_digits(uint64_t n) {
+    //     // The bit width approximates the digit count, as 1233 / 4096 is slightly above log10(2). The approximation is off by at most
+    //     // one, which a single comparison against the power of ten it predicts corrects. `n | 1` makes 0 count as a single digit
+    //     const uint64_t bits = 64 - __builtin_clzll(n | 1);
+    //     const uint64_t approximation = (bits * 1233) >> 12;
+    //     return approximation + ((n | 1) >= POWERS_OF_TEN[approximation]);
+    // }
+    llvm::Type *const i64_type = llvm::Type::getInt64Ty(context);
+    llvm::FunctionType *const count_digits_type = llvm::FunctionType::get(i64_type, {i64_type}, false);
     llvm::Function *const count_digits_fn = llvm::Function::Create( //
         count_digits_type,                                          //
         llvm::Function::ExternalLinkage,                            //
         prefix + "count_digits",                                    //
         module                                                      //
     );
-
-    // Set parameter name
     llvm::Argument *const n_arg = count_digits_fn->arg_begin();
     n_arg->setName("n");
 
-    // Create basic blocks
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", count_digits_fn);
-    llvm::BasicBlock *const check_zero_block = llvm::BasicBlock::Create(context, "check_zero", count_digits_fn);
-    llvm::BasicBlock *const return_one_block = llvm::BasicBlock::Create(context, "return_one", count_digits_fn);
-    llvm::BasicBlock *const loop_block = llvm::BasicBlock::Create(context, "loop", count_digits_fn);
-    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", count_digits_fn);
-    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", count_digits_fn);
+    builder->SetInsertPoint(entry_block);
+    llvm::Function *const ctlz_fn = llvm::Intrinsic::getDeclaration(module, llvm::Intrinsic::ctlz, {i64_type});
+    llvm::Value *const n_or_one = builder->CreateOr(n_arg, builder->getInt64(1), "n_or_one");
+    llvm::Value *const leading_zeros = builder->CreateCall(ctlz_fn, {n_or_one, builder->getTrue()}, "leading_zeros");
+    llvm::Value *const bits = builder->CreateSub(builder->getInt64(64), leading_zeros, "bits");
+    llvm::Value *const approximation = builder->CreateLShr(builder->CreateMul(bits, builder->getInt64(1233)), 12, "approximation");
+    llvm::Value *const power_ptr = builder->CreateGEP(i64_type, get_powers_of_ten_table(module), approximation, "power_ptr");
+    llvm::Value *const power = IR::aligned_load(*builder, i64_type, power_ptr, "power");
+    llvm::Value *const reaches_power = builder->CreateZExt(builder->CreateICmpUGE(n_or_one, power), i64_type, "reaches_power");
+    builder->CreateRet(builder->CreateAdd(approximation, reaches_power, "count"));
+
+    typecast_functions["count_digits"] = count_digits_fn;
+}
+
+void Generator::Module::TypeCast::generate_write_digits_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // C IMPLEMENTATION:
+    // void write_digits(char *end, uint64_t value) {
+    //     while (value >= 100) {
+    //         const uint64_t pair = value % 100;
+    //         value /= 100;
+    //         end -= 2;
+    //         memcpy(end, DIGIT_PAIRS + pair * 2, 2);
+    //     }
+    //     if (value >= 10) {
+    //         memcpy(end - 2, DIGIT_PAIRS + value * 2, 2);
+    //     } else {
+    //         end[-1] = '0' + value;
+    //     }
+    // }
+    llvm::Type *const i64_type = llvm::Type::getInt64Ty(context);
+    llvm::Type *const i16_type = llvm::Type::getInt16Ty(context);
+    llvm::Type *const i8_type = llvm::Type::getInt8Ty(context);
+    llvm::FunctionType *const write_digits_type = llvm::FunctionType::get( //
+        llvm::Type::getVoidTy(context),                                    // Return type: void
+        {PTR_TY, i64_type},                                                // Arguments: char *end, u64 value
+        false                                                              // No varargs
+    );
+    llvm::Function *const write_digits_fn = llvm::Function::Create( //
+        write_digits_type,                                          //
+        llvm::Function::ExternalLinkage,                            //
+        prefix + "write_digits",                                    //
+        module                                                      //
+    );
+    llvm::Argument *const arg_end = write_digits_fn->getArg(0);
+    arg_end->setName("end");
+    llvm::Argument *const arg_value = write_digits_fn->getArg(1);
+    arg_value->setName("value");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", write_digits_fn);
+    llvm::BasicBlock *const loop_block = llvm::BasicBlock::Create(context, "loop", write_digits_fn);
+    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", write_digits_fn);
+    llvm::BasicBlock *const tail_block = llvm::BasicBlock::Create(context, "tail", write_digits_fn);
+    llvm::BasicBlock *const pair_block = llvm::BasicBlock::Create(context, "pair", write_digits_fn);
+    llvm::BasicBlock *const single_block = llvm::BasicBlock::Create(context, "single", write_digits_fn);
+    llvm::GlobalVariable *const digit_pairs = get_digit_pairs_table(module);
 
-    // Entry block: Allocate variables and check if n is 0
     builder->SetInsertPoint(entry_block);
-    llvm::Value *const n = builder->CreateAlloca(llvm::Type::getInt64Ty(context), nullptr, "n_var");
-    llvm::Value *const count = builder->CreateAlloca(llvm::Type::getInt64Ty(context), nullptr, "count_var");
-    IR::aligned_store(*builder, n_arg, n);
-    IR::aligned_store(*builder, builder->getInt64(0), count);
-    builder->CreateBr(check_zero_block);
-
-    // Check if n is 0
-    builder->SetInsertPoint(check_zero_block);
-    llvm::Value *const n_value = IR::aligned_load(*builder, llvm::Type::getInt64Ty(context), n, "n_val");
-    llvm::Value *const is_zero = builder->CreateICmpEQ(n_value, builder->getInt64(0), "is_zero");
-    builder->CreateCondBr(is_zero, return_one_block, loop_block);
-
-    // Return 1 if n is 0
-    builder->SetInsertPoint(return_one_block);
-    builder->CreateRet(builder->getInt64(1));
-
-    // Loop header - check condition
+    builder->CreateBr(loop_block);
+
+    // The two digits of a pair are copied as a single unaligned 16 bit value
     builder->SetInsertPoint(loop_block);
-    llvm::Value *const loop_n = IR::aligned_load(*builder, llvm::Type::getInt64Ty(context), n, "loop_n");
-    llvm::Value *const loop_condition = builder->CreateICmpUGT(loop_n, builder->getInt64(0), "loop_condition");
-    builder->CreateCondBr(loop_condition, loop_body_block, exit_block);
+    llvm::PHINode *const value = builder->CreatePHI(i64_type, 2, "value");
+    llvm::PHINode *const end = builder->CreatePHI(PTR_TY, 2, "end");
+    value->addIncoming(arg_value, entry_block);
+    end->addIncoming(arg_end, entry_block);
+    builder->CreateCondBr(builder->CreateICmpUGE(value, builder->getInt64(100)), loop_body_block, tail_block);
 
-    // Loop body
     builder->SetInsertPoint(loop_body_block);
-    // n = n / 10
-    llvm::Value *const n_val = IR::aligned_load(*builder, llvm::Type::getInt64Ty(context), n, "n_val");
-    llvm::Value *const new_n = builder->CreateUDiv(n_val, builder->getInt64(10), "new_n");
-    IR::aligned_store(*builder, new_n, n);
+    llvm::Value *const pair = builder->CreateURem(value, builder->getInt64(100), "pair");
+    llvm::Value *const next_value = builder->CreateUDiv(value, builder->getInt64(100), "next_value");
+    llvm::Value *const next_end = builder->CreateGEP(i8_type, end, builder->getInt64(-2), "next_end");
+    llvm::Value *const pair_ptr = builder->CreateGEP(i8_type, digit_pairs, builder->CreateShl(pair, 1), "pair_ptr");
+    llvm::Value *const pair_chars = builder->CreateAlignedLoad(i16_type, pair_ptr, llvm::Align(1), "pair_chars");
+    builder->CreateAlignedStore(pair_chars, next_end, llvm::Align(1));
+    value->addIncoming(next_value, loop_body_block);
+    end->addIncoming(next_end, loop_body_block);
+    builder->CreateBr(loop_block);
 
-    // count++
-    llvm::Value *const count_val = IR::aligned_load(*builder, llvm::Type::getInt64Ty(context), count, "count_val");
-    llvm::Value *const new_count = builder->CreateAdd(count_val, builder->getInt64(1), "new_count");
-    IR::aligned_store(*builder, new_count, count);
+    builder->SetInsertPoint(tail_block);
+    builder->CreateCondBr(builder->CreateICmpUGE(value, builder->getInt64(10)), pair_block, single_block);
 
-    // Go back to loop header
-    builder->CreateBr(loop_block);
+    builder->SetInsertPoint(pair_block);
+    llvm::Value *const last_pair_ptr = builder->CreateGEP(i8_type, digit_pairs, builder->CreateShl(value, 1), "last_pair_ptr");
+    llvm::Value *const last_pair_chars = builder->CreateAlignedLoad(i16_type, last_pair_ptr, llvm::Align(1), "last_pair_chars");
+    builder->CreateAlignedStore(last_pair_chars, builder->CreateGEP(i8_type, end, builder->getInt64(-2)), llvm::Align(1));
+    builder->CreateRetVoid();
+
+    builder->SetInsertPoint(single_block);
+    llvm::Value *const digit_char = builder->CreateAdd(builder->getInt8('0'), builder->CreateTrunc(value, i8_type), "digit_char");
+    IR::aligned_store(*builder, digit_char, builder->CreateGEP(i8_type, end, builder->getInt64(-1)));
+    builder->CreateRetVoid();
+
+    typecast_functions["write_digits"] = write_digits_fn;
+}
+
+llvm::Value *Generator::Module::TypeCast::generate_round_to_odd( //
+    llvm::IRBuilder<> *builder,                                  //
+    llvm::Value *g_high,                                         //
+    llvm::Value *g_low,                                          //
+    llvm::Value *cp                                              //
+) {
+    // C IMPLEMENTATION:
+    // uint64_t round_to_odd(uint64_t g_high, uint64_t g_low, uint64_t cp) {
+    //     const __uint128_t x = ((__uint128_t)g_low * cp) >> 64;
+    //     const __uint128_t z = (__uint128_t)g_high * cp + x;
+    //     return (uint64_t)(z >> 64) | ((uint64_t)z > 1);
+    // }
+    llvm::Type *const i128_type = builder->getInt128Ty();
+    llvm::Type *const i64_type = builder->getInt64Ty();
+    llvm::Value *const cp_wide = builder->CreateZExt(cp, i128_type);
+    llvm::Value *const x = builder->CreateLShr(builder->CreateMul(builder->CreateZExt(g_low, i128_type), cp_wide), 64);
+    llvm::Value *const z = builder->CreateAdd(builder->CreateMul(builder->CreateZExt(g_high, i128_type), cp_wide), x);
+    llvm::Value *const z_high = builder->CreateTrunc(builder->CreateLShr(z, 64), i64_type);
+    llvm::Value *const z_low = builder->CreateTrunc(z, i64_type);
+    return builder->CreateOr(z_high, builder->CreateZExt(builder->CreateICmpUGT(z_low, builder->getInt64(1)), i64_type));
+}
+
+void Generator::Module::TypeCast::generate_to_decimal_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // C IMPLEMENTATION:
+    // This is the Schubfach algorithm by Raffaello Giulietti. It finds the shortest decimal `digits * 10^exponent` which lies within
+    // the rounding interval of the binary value `c * 2^q`, and out of those the one closest to the binary value
+    // decimal to_decimal(uint64_t c, int64_t q, bool is_closer) {
+    //     const bool is_even = (c & 1) == 0;
+    //     // The interval is asymmetric for powers of two, where the lower neighbour is only half as far away
+    //     const uint64_t cb = c << 2;
+    //     const uint64_t cbl = cb - 2 + is_closer;
+    //     const uint64_t cbr = cb + 2;
+    //     const int64_t k = is_closer ? (q * 1262611 - 524031) >> 22 : (q * 1262611) >> 22;
+    //     const int64_t h = q + ((-k * 1741647) >> 19) + 1;
+    //     const uint64_t *g = POWER_OF_TEN_128 + 2 * (-k - SMALLEST_CACHED_POWER);
+    //     const uint64_t vbl = round_to_odd(g[0], g[1], cbl << h);
+    //     const uint64_t vb = round_to_odd(g[0], g[1], cb << h);
+    //     const uint64_t vbr = round_to_odd(g[0], g[1], cbr << h);
+    //     const uint64_t lower = vbl + !is_even;
+    //     const uint64_t upper = vbr - !is_even;
+    //     const uint64_t s = vb >> 2;
+    //     if (s >= 10) {
+    //         // Check whether one digit less is enough
+    //         const uint64_t sp = s / 10;
+    //         const bool up_inside = lower <= 40 * sp;
+    //         const bool wp_inside = 40 * sp + 40 <= upper;
+    //         if (up_inside != wp_inside) {
+    //             return (decimal){sp + wp_inside, k + 1};
+    //         }
+    //     }
+    //     const bool u_inside = lower <= 4 * s;
+    //     const bool w_inside = 4 * s + 4 <= upper;
+    //     if (u_inside != w_inside) {
+    //         return (decimal){s + w_inside, k};
+    //     }
+    //     const uint64_t mid = 4 * s + 2;
+    //     const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+    //     return (decimal){s + round_up, k};
+    // }
+    llvm::Type *const i64_type = llvm::Type::getInt64Ty(context);
+    llvm::StructType *const decimal_type = llvm::StructType::get(context, {i64_type, i64_type});
+    llvm::FunctionType *const to_decimal_type = llvm::FunctionType::get( //
+        decimal_type,                                                    // Return type: {u64 digits, i64 exponent}
+        {i64_type, i64_type, llvm::Type::getInt1Ty(context)},            // Arguments: u64 c, i64 q, bool is_closer
+        false                                                            // No varargs
+    );
+    llvm::Function *const to_decimal_fn = llvm::Function::Create( //
+        to_decimal_type,                                          //
+        llvm::Function::ExternalLinkage,                          //
+        prefix + "to_decimal",                                    //
+        module                                                    //
+    );
+    llvm::Argument *const arg_c = to_decimal_fn->getArg(0);
+    arg_c->setName("c");
+    llvm::Argument *const arg_q = to_decimal_fn->getArg(1);
+    arg_q->setName("q");
+    llvm::Argument *const arg_is_closer = to_decimal_fn->getArg(2);
+    arg_is_closer->setName("is_closer");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", to_decimal_fn);
+    llvm::BasicBlock *const shorter_check_block = llvm::BasicBlock::Create(context, "shorter_check", to_decimal_fn);
+    llvm::BasicBlock *const shorter_block = llvm::BasicBlock::Create(context, "shorter", to_decimal_fn);
+    llvm::BasicBlock *const own_check_block = llvm::BasicBlock::Create(context, "own_check", to_decimal_fn);
+    llvm::BasicBlock *const own_block = llvm::BasicBlock::Create(context, "own", to_decimal_fn);
+    llvm::BasicBlock *const closest_block = llvm::BasicBlock::Create(context, "closest", to_decimal_fn);
+
+    const auto create_decimal = [&](llvm::Value *digits, llvm::Value *exponent) {
+        llvm::Value *const decimal = builder->CreateInsertValue(llvm::UndefValue::get(decimal_type), digits, {0});
+        builder->CreateRet(builder->CreateInsertValue(decimal, exponent, {1}));
+    };
+
+    builder->SetInsertPoint(entry_block);
+    llvm::Value *const is_odd = builder->CreateZExt(builder->CreateTrunc(arg_c, builder->getInt1Ty()), i64_type, "is_odd");
+    llvm::Value *const cb = builder->CreateShl(arg_c, 2, "cb");
+    llvm::Value *const closer_offset = builder->CreateZExt(arg_is_closer, i64_type);
+    llvm::Value *const cbl = builder->CreateAdd(builder->CreateSub(cb, builder->getInt64(2)), closer_offset, "cbl");
+    llvm::Value *const cbr = builder->CreateAdd(cb, builder->getInt64(2), "cbr");
+    llvm::Value *const k_scaled = builder->CreateMul(arg_q, builder->getInt64(1262611), "k_scaled");
+    llvm::Value *const k_closer = builder->CreateSub(k_scaled, builder->getInt64(524031), "k_closer");
+    llvm::Value *const k = builder->CreateAShr(builder->CreateSelect(arg_is_closer, k_closer, k_scaled), 22, "k");
+    llvm::Value *const neg_k = builder->CreateNeg(k, "neg_k");
+    llvm::Value *const floor_log2 = builder->CreateAShr(builder->CreateMul(neg_k, builder->getInt64(1741647)), 19, "floor_log2");
+    llvm::Value *const h = builder->CreateAdd(builder->CreateAdd(arg_q, floor_log2), builder->getInt64(1), "h");
+    llvm::Value *const table_idx = builder->CreateShl(builder->CreateSub(neg_k, builder->getInt64(SMALLEST_CACHED_POWER)), 1, "table_idx");
+    llvm::GlobalVariable *const table = get_power_of_ten_significand_table(module);
+    llvm::Value *const g_high_ptr = builder->CreateGEP(i64_type, table, table_idx, "g_high_ptr");
+    llvm::Value *const g_high = IR::aligned_load(*builder, i64_type, g_high_ptr, "g_high");
+    llvm::Value *const g_low_ptr = builder->CreateGEP(i64_type, g_high_ptr, builder->getInt64(1), "g_low_ptr");
+    llvm::Value *const g_low = IR::aligned_load(*builder, i64_type, g_low_ptr, "g_low");
+    llvm::Value *const vbl = generate_round_to_odd(builder, g_high, g_low, builder->CreateShl(cbl, h));
+    llvm::Value *const vb = generate_round_to_odd(builder, g_high, g_low, builder->CreateShl(cb, h));
+    llvm::Value *const vbr = generate_round_to_odd(builder, g_high, g_low, builder->CreateShl(cbr, h));
+    llvm::Value *const lower = builder->CreateAdd(vbl, is_odd, "lower");
+    llvm::Value *const upper = builder->CreateSub(vbr, is_odd, "upper");
+    llvm::Value *const s = builder->CreateLShr(vb, 2, "s");
+    builder->CreateCondBr(builder->CreateICmpUGE(s, builder->getInt64(10)), shorter_check_block, own_check_block);
+
+    builder->SetInsertPoint(shorter_check_block);
+    llvm::Value *const sp = builder->CreateUDiv(s, builder->getInt64(10), "sp");
+    llvm::Value *const sp_scaled = builder->CreateMul(sp, builder->getInt64(40), "sp_scaled");
+    llvm::Value *const up_inside = builder->CreateICmpULE(lower, sp_scaled, "up_inside");
+    llvm::Value *const wp_inside = builder->CreateICmpULE(builder->CreateAdd(sp_scaled, builder->getInt64(40)), upper, "wp_inside");
+    builder->CreateCondBr(builder->CreateICmpNE(up_inside, wp_inside), shorter_block, own_check_block);
+
+    builder->SetInsertPoint(shorter_block);
+    create_decimal(builder->CreateAdd(sp, builder->CreateZExt(wp_inside, i64_type)), builder->CreateAdd(k, builder->getInt64(1)));
+
+    builder->SetInsertPoint(own_check_block);
+    llvm::Value *const s_scaled = builder->CreateShl(s, 2, "s_scaled");
+    llvm::Value *const u_inside = builder->CreateICmpULE(lower, s_scaled, "u_inside");
+    llvm::Value *const w_inside = builder->CreateICmpULE(builder->CreateAdd(s_scaled, builder->getInt64(4)), upper, "w_inside");
+    builder->CreateCondBr(builder->CreateICmpNE(u_inside, w_inside), own_block, closest_block);
+
+    builder->SetInsertPoint(own_block);
+    create_decimal(builder->CreateAdd(s, builder->CreateZExt(w_inside, i64_type)), k);
+
+    builder->SetInsertPoint(closest_block);
+    llvm::Value *const mid = builder->CreateAdd(s_scaled, builder->getInt64(2), "mid");
+    llvm::Value *const is_s_odd = builder->CreateTrunc(s, builder->getInt1Ty(), "is_s_odd");
+    llvm::Value *const is_tie_up = builder->CreateAnd(builder->CreateICmpEQ(vb, mid), is_s_odd, "is_tie_up");
+    llvm::Value *const round_up = builder->CreateOr(builder->CreateICmpUGT(vb, mid), is_tie_up, "round_up");
+    create_decimal(builder->CreateAdd(s, builder->CreateZExt(round_up, i64_type)), k);
+
+    typecast_functions["to_decimal"] = to_decimal_fn;
+}
 
-    // Exit block - return count
-    builder->SetInsertPoint(exit_block);
-    llvm::Value *const result = IR::aligned_load(*builder, llvm::Type::getInt64Ty(context), count, "result");
+void Generator::Module::TypeCast::generate_format_decimal_function(llvm::IRBuilder<> *builder, llvm::Module *module) {
+    // C IMPLEMENTATION:
+    // str *format_decimal(bool is_negative, uint64_t digits, int64_t exponent, int64_t max_point) {
+    //     while (digits % 10 == 0) {
+    //         digits /= 10;
+    //         exponent++;
+    //     }
+    //     const size_t digit_count = count_digits(digits);
+    //     // The position of the decimal point relative to the first digit
+    //     const int64_t point = digit_count + exponent;
+    //     str *result;
+    //     char *start;
+    //     if (point < -3 || point > max_point) {
+    //         // Scientific notation like 1.25e+20, with at least two exponent digits
+    //         const int64_t exp10 = point - 1;
+    //         const uint64_t abs_exp = exp10 < 0 ? -exp10 : exp10;
+    //         const size_t exp_len = abs_exp >= 100 ? 3 : 2;
+    //         const size_t mantissa_len = digit_count + (digit_count > 1);
+    //         result = create_str(is_negative + mantissa_len + 2 + exp_len);
+    //         start = result->value + is_negative;
+    //         write_digits(start + mantissa_len, digits);
+    //         if (digit_count > 1) {
+    //             start[0] = start[1];
+    //             start[1] = '.';
+    //         }
+    //         char *exp_start = start + mantissa_len;
+    //         exp_start[0] = 'e';
+    //         exp_start[1] = exp10 < 0 ? '-' : '+';
+    //         exp_start[2] = '0';
+    //         write_digits(exp_start + 2 + exp_len, abs_exp);
+    //     } else if (exponent >= 0) {
+    //         // Integral values like 1500, the product fits because point <= max_point
+    //         result = create_str(is_negative + point);
+    //         start = result->value + is_negative;
+    //         write_digits(start + point, digits * POWERS_OF_TEN[exponent]);
+    //     } else if (point > 0) {
+    //         // Values like 12.5, the integral digits are moved to the front to make room for the point
+    //         result = create_str(is_negative + digit_count + 1);
+    //         start = result->value + is_negative;
+    //         write_digits(start + digit_count + 1, digits);
+    //         for (int64_t i = 0; i < point; i++) {
+    //             start[i] = start[i + 1];
+    //         }
+    //         start[point] = '.';
+    //     } else {
+    //         // Values like 0.0125, the at most three zeros are written before the digits overwrite the excess ones
+    //         const size_t len = 2 - point + digit_count;
+    //         result = create_str(is_negative + len);
+    //         start = result->value + is_negative;
+    //         start[0] = '0';
+    //         start[1] = '.';
+    //         for (size_t i = 2; i < 5; i++) {
+    //             start[min(i, len - 1)] = '0';
+    //         }
+    //         write_digits(start + len, digits);
+    //     }
+    //     if (is_negative) {
+    //         result->value[0] = '-';
+    //     }
+    //     return result;
+    // }
+    llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
+    llvm::Function *const create_str_fn = String::string_manip_functions.at("create_str");
+    llvm::Function *const count_digits_fn = typecast_functions.at("count_digits");
+    llvm::Function *const write_digits_fn = typecast_functions.at("write_digits");
+    llvm::Type *const i64_type = llvm::Type::getInt64Ty(context);
+    llvm::Type *const i8_type = llvm::Type::getInt8Ty(context);
+    llvm::FunctionType *const format_decimal_type = llvm::FunctionType::get( //
+        PTR_TY,                                                              // Return type: str*
+        {
+            llvm::Type::getInt1Ty(context), // Argument: bool is_negative
+            i64_type,                       // Argument: u64 digits
+            i64_type,                       // Argument: i64 exponent
+            i64_type                        // Argument: i64 max_point
+        },                                  //
+        false                               // No varargs
+    );
+    llvm::Function *const format_decimal_fn = llvm::Function::Create( //
+        format_decimal_type,                                          //
+        llvm::Function::ExternalLinkage,                              //
+        prefix + "format_decimal",                                    //
+        module                                                        //
+    );
+    llvm::Argument *const arg_is_negative = format_decimal_fn->getArg(0);
+    arg_is_negative->setName("is_negative");
+    llvm::Argument *const arg_digits = format_decimal_fn->getArg(1);
+    arg_digits->setName("digits");
+    llvm::Argument *const arg_exponent = format_decimal_fn->getArg(2);
+    arg_exponent->setName("exponent");
+    llvm::Argument *const arg_max_point = format_decimal_fn->getArg(3);
+    arg_max_point->setName("max_point");
+
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", format_decimal_fn);
+    llvm::BasicBlock *const strip_block = llvm::BasicBlock::Create(context, "strip", format_decimal_fn);
+    llvm::BasicBlock *const stripped_block = llvm::BasicBlock::Create(context, "stripped", format_decimal_fn);
+    llvm::BasicBlock *const scientific_block = llvm::BasicBlock::Create(context, "scientific", format_decimal_fn);
+    llvm::BasicBlock *const scientific_point_block = llvm::BasicBlock::Create(context, "scientific_point", format_decimal_fn);
+    llvm::BasicBlock *const scientific_exponent_block = llvm::BasicBlock::Create(context, "scientific_exponent", format_decimal_fn);
+    llvm::BasicBlock *const fixed_block = llvm::BasicBlock::Create(context, "fixed", format_decimal_fn);
+    llvm::BasicBlock *const integral_block = llvm::BasicBlock::Create(context, "integral", format_decimal_fn);
+    llvm::BasicBlock *const fraction_block = llvm::BasicBlock::Create(context, "fraction", format_decimal_fn);
+    llvm::BasicBlock *const inner_point_block = llvm::BasicBlock::Create(context, "inner_point", format_decimal_fn);
+    llvm::BasicBlock *const shift_loop_block = llvm::BasicBlock::Create(context, "shift_loop", format_decimal_fn);
+    llvm::BasicBlock *const shift_done_block = llvm::BasicBlock::Create(context, "shift_done", format_decimal_fn);
+    llvm::BasicBlock *const leading_zeros_block = llvm::BasicBlock::Create(context, "leading_zeros", format_decimal_fn);
+    llvm::BasicBlock *const sign_block = llvm::BasicBlock::Create(context, "sign", format_decimal_fn);
+    llvm::BasicBlock *const negative_block = llvm::BasicBlock::Create(context, "negative", format_decimal_fn);
+    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", format_decimal_fn);
+
+    builder->SetInsertPoint(entry_block);
+    llvm::Value *const sign_len = builder->CreateZExt(arg_is_negative, i64_type, "sign_len");
+    builder->CreateBr(strip_block);
+
+    // Strip the trailing zeros of the digits, the digits are never zero
+    builder->SetInsertPoint(strip_block);
+    llvm::PHINode *const digits = builder->CreatePHI(i64_type, 2, "digits");
+    llvm::PHINode *const exponent = builder->CreatePHI(i64_type, 2, "exponent");
+    digits->addIncoming(arg_digits, entry_block);
+    exponent->addIncoming(arg_exponent, entry_block);
+    llvm::Value *const digits_tenth = builder->CreateUDiv(digits, builder->getInt64(10), "digits_tenth");
+    llvm::Value *const has_trailing_zero = builder->CreateICmpEQ(                            //
+        builder->CreateMul(digits_tenth, builder->getInt64(10)), digits, "has_trailing_zero" //
+    );
+    digits->addIncoming(digits_tenth, strip_block);
+    exponent->addIncoming(builder->CreateAdd(exponent, builder->getInt64(1)), strip_block);
+    builder->CreateCondBr(has_trailing_zero, strip_block, stripped_block);
+
+    builder->SetInsertPoint(stripped_block);
+    llvm::Value *const digit_count = builder->CreateCall(count_digits_fn, {digits}, "digit_count");
+    llvm::Value *const point = builder->CreateAdd(digit_count, exponent, "point");
+    llvm::Value *const is_too_small = builder->CreateICmpSLT(point, builder->getInt64(-3), "is_too_small");
+    llvm::Value *const is_too_large = builder->CreateICmpSGT(point, arg_max_point, "is_too_large");
+    builder->CreateCondBr(builder->CreateOr(is_too_small, is_too_large), scientific_block, fixed_block);
+
+    // Creates the result string of the given length and returns the position the number starts at, right after the optional sign
+    const auto create_result = [&](llvm::Value *len, const std::string &name) -> std::pair<llvm::Value *, llvm::Value *> {
+        llvm::Value *const result = builder->CreateCall(create_str_fn, {builder->CreateAdd(sign_len, len)}, name + "_result");
+        llvm::Value *const data_ptr = builder->CreateStructGEP(str_type, result, 1, name + "_data_ptr");
+        return {result, builder->CreateGEP(i8_type, data_ptr, sign_len, name + "_start")};
+    };
+
+    builder->SetInsertPoint(scientific_block);
+    llvm::Value *const exp10 = builder->CreateSub(point, builder->getInt64(1), "exp10");
+    llvm::Value *const is_exp_negative = builder->CreateICmpSLT(exp10, builder->getInt64(0), "is_exp_negative");
+    llvm::Value *const abs_exp = builder->CreateSelect(is_exp_negative, builder->CreateNeg(exp10), exp10, "abs_exp");
+    llvm::Value *const exp_len = builder->CreateAdd(                                                                            //
+        builder->getInt64(2), builder->CreateZExt(builder->CreateICmpUGE(abs_exp, builder->getInt64(100)), i64_type), "exp_len" //
+    );
+    llvm::Value *const has_point = builder->CreateICmpUGT(digit_count, builder->getInt64(1), "has_point");
+    llvm::Value *const mantissa_len = builder->CreateAdd(digit_count, builder->CreateZExt(has_point, i64_type), "mantissa_len");
+    llvm::Value *const scientific_len = builder->CreateAdd(builder->CreateAdd(mantissa_len, builder->getInt64(2)), exp_len);
+    const auto [scientific_result, scientific_start] = create_result(scientific_len, "scientific");
+    builder->CreateCall(write_digits_fn, {builder->CreateGEP(i8_type, scientific_start, mantissa_len), digits});
+    builder->CreateCondBr(has_point, scientific_point_block, scientific_exponent_block);
+
+    builder->SetInsertPoint(scientific_point_block);
+    llvm::Value *const second_char_ptr = builder->CreateGEP(i8_type, scientific_start, builder->getInt64(1), "second_char_ptr");
+    llvm::Value *const first_digit = IR::aligned_load(*builder, i8_type, second_char_ptr, "first_digit");
+    IR::aligned_store(*builder, first_digit, scientific_start);
+    IR::aligned_store(*builder, builder->getInt8('.'), second_char_ptr);
+    builder->CreateBr(scientific_exponent_block);
+
+    builder->SetInsertPoint(scientific_exponent_block);
+    llvm::Value *const exp_start = builder->CreateGEP(i8_type, scientific_start, mantissa_len, "exp_start");
+    IR::aligned_store(*builder, builder->getInt8('e'), exp_start);
+    llvm::Value *const exp_sign = builder->CreateSelect(is_exp_negative, builder->getInt8('-'), builder->getInt8('+'), "exp_sign");
+    IR::aligned_store(*builder, exp_sign, builder->CreateGEP(i8_type, exp_start, builder->getInt64(1)));
+    IR::aligned_store(*builder, builder->getInt8('0'), builder->CreateGEP(i8_type, exp_start, builder->getInt64(2)));
+    llvm::Value *const exp_end = builder->CreateGEP(i8_type, exp_start, builder->CreateAdd(exp_len, builder->getInt64(2)), "exp_end");
+    builder->CreateCall(write_digits_fn, {exp_end, abs_exp});
+    builder->CreateBr(sign_block);
+
+    builder->SetInsertPoint(fixed_block);
+    builder->CreateCondBr(builder->CreateICmpSGE(exponent, builder->getInt64(0)), integral_block, fraction_block);
+
+    builder->SetInsertPoint(integral_block);
+    const auto [integral_result, integral_start] = create_result(point, "integral");
+    llvm::Value *const power_ptr = builder->CreateGEP(i64_type, get_powers_of_ten_table(module), exponent, "power_ptr");
+    llvm::Value *const power = IR::aligned_load(*builder, i64_type, power_ptr, "power");
+    llvm::Value *const integral_value = builder->CreateMul(digits, power, "integral_value");
+    builder->CreateCall(write_digits_fn, {builder->CreateGEP(i8_type, integral_start, point), integral_value});
+    builder->CreateBr(sign_block);
+
+    builder->SetInsertPoint(fraction_block);
+    builder->CreateCondBr(builder->CreateICmpSGT(point, builder->getInt64(0)), inner_point_block, leading_zeros_block);
+
+    builder->SetInsertPoint(inner_point_block);
+    llvm::Value *const inner_len = builder->CreateAdd(digit_count, builder->getInt64(1), "inner_len");
+    const auto [inner_result, inner_start] = create_result(inner_len, "inner");
+    builder->CreateCall(write_digits_fn, {builder->CreateGEP(i8_type, inner_start, inner_len), digits});
+    builder->CreateBr(shift_loop_block);
+
+    builder->SetInsertPoint(shift_loop_block);
+    llvm::PHINode *const shift_idx = builder->CreatePHI(i64_type, 2, "shift_idx");
+    shift_idx->addIncoming(builder->getInt64(0), inner_point_block);
+    llvm::Value *const next_shift_idx = builder->CreateAdd(shift_idx, builder->getInt64(1), "next_shift_idx");
+    llvm::Value *const shifted_char = IR::aligned_load(*builder, i8_type, builder->CreateGEP(i8_type, inner_start, next_shift_idx));
+    IR::aligned_store(*builder, shifted_char, builder->CreateGEP(i8_type, inner_start, shift_idx));
+    shift_idx->addIncoming(next_shift_idx, shift_loop_block);
+    builder->CreateCondBr(builder->CreateICmpSLT(next_shift_idx, point), shift_loop_block, shift_done_block);
+
+    builder->SetInsertPoint(shift_done_block);
+    IR::aligned_store(*builder, builder->getInt8('.'), builder->CreateGEP(i8_type, inner_start, point));
+    builder->CreateBr(sign_block);
+
+    builder->SetInsertPoint(leading_zeros_block);
+    llvm::Value *const leading_len = builder->CreateAdd(builder->CreateSub(builder->getInt64(2), point), digit_count, "leading_len");
+    const auto [leading_result, leading_start] = create_result(leading_len, "leading");
+    IR::aligned_store(*builder, builder->getInt8('0'), leading_start);
+    IR::aligned_store(*builder, builder->getInt8('.'), builder->CreateGEP(i8_type, leading_start, builder->getInt64(1)));
+    llvm::Value *const last_idx = builder->CreateSub(leading_len, builder->getInt64(1), "last_idx");
+    for (unsigned int i = 2; i < 5; i++) {
+        llvm::Value *const zero_idx = builder->CreateSelect(                                                   //
+            builder->CreateICmpULT(builder->getInt64(i), last_idx), builder->getInt64(i), last_idx, "zero_idx" //
+        );
+        IR::aligned_store(*builder, builder->getInt8('0'), builder->CreateGEP(i8_type, leading_start, zero_idx));
+    }
+    builder->CreateCall(write_digits_fn, {builder->CreateGEP(i8_type, leading_start, leading_len), digits});
+    builder->CreateBr(sign_block);
+
+    builder->SetInsertPoint(sign_block);
+    llvm::PHINode *const result = builder->CreatePHI(PTR_TY, 4, "result");
+    result->addIncoming(scientific_result, scientific_exponent_block);
+    result->addIncoming(integral_result, integral_block);
+    result->addIncoming(inner_result, shift_done_block);
+    result->addIncoming(leading_result, leading_zeros_block);
+    builder->CreateCondBr(arg_is_negative, negative_block, return_block);
+
+    builder->SetInsertPoint(negative_block);
+    IR::aligned_store(*builder, builder->getInt8('-'), builder->CreateStructGEP(str_type, result, 1, "data_ptr"));
+    builder->CreateBr(return_block);
+
+    builder->SetInsertPoint(return_block);
     builder->CreateRet(result);
 
-    // Store the function for later use
-    typecast_functions["count_digits"] = count_digits_fn;
+    typecast_functions["format_decimal"] = format_decimal_fn;
 }
 
 void Generator::Module::TypeCast::generate_bool_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations) {
@@ -432,31 +930,15 @@ void Generator::Module::TypeCast::generate_uN_to_str( //
 ) {
     // C IMPLEMENTATION:
     // str *uN_to_str(const uintN_t u_value) {
-    //     // Handle special case for 0
-    //     if (u_value == 0) {
-    //         return init_str(1, "0");
-    //     }
-    //
-    //     // Count digits
-    //     uint64_t u_value_64 = (uint64_t)u_value;
-    //     size_t len = count_digits(u_value_64);
-    //
-    //     // Allocate string
+    //     const uint64_t value = (uint64_t)u_value;
+    //     const size_t len = count_digits(value);
     //     str *result = create_str(len);
-    //     char *buffer = result->value + len; // Start at the end
-    //
-    //     // Write digits in reverse order
-    //     uintN_t value = u_value;
-    //     do {
-    //         *--buffer = '0' + (value % 10);
-    //         value /= 10;
-    //     } while (value > 0);
-    //
+    //     write_digits(result->value + len, value);
     //     return result;
     // }
     llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
-    llvm::Function *const init_str_fn = String::string_manip_functions.at("init_str");
     llvm::Function *const count_digits_fn = typecast_functions.at("count_digits");
+    llvm::Function *const write_digits_fn = typecast_functions.at("write_digits");
     llvm::Function *const create_str_fn = String::string_manip_functions.at("create_str");
     llvm::IntegerType *const uintN_t = llvm::IntegerType::getIntNTy(context, N);
 
@@ -477,107 +959,19 @@ void Generator::Module::TypeCast::generate_uN_to_str( //
         return;
     }
 
-    // Create basic blocks
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", uN_to_str_fn);
-    llvm::BasicBlock *const zero_case_block = llvm::BasicBlock::Create(context, "zero_case", uN_to_str_fn);
-    llvm::BasicBlock *const nonzero_case_block = llvm::BasicBlock::Create(context, "nonzero_case", uN_to_str_fn);
-    llvm::BasicBlock *const loop_block = llvm::BasicBlock::Create(context, "loop", uN_to_str_fn);
-    llvm::BasicBlock *const exit_block = llvm::BasicBlock::Create(context, "exit", uN_to_str_fn);
-
-    // Set insert point to entry block
     builder->SetInsertPoint(entry_block);
 
-    // Get the function parameter
     llvm::Argument *const arg_uvalue = uN_to_str_fn->arg_begin();
     arg_uvalue->setName("u_value");
 
-    // Check if u_value == 0
-    llvm::Value *const is_zero = builder->CreateICmpEQ(arg_uvalue, llvm::ConstantInt::get(builder->getIntNTy(N), 0), "is_zero");
-    builder->CreateCondBr(is_zero, zero_case_block, nonzero_case_block);
-
-    // Zero case block
-    builder->SetInsertPoint(zero_case_block);
-    // Init the string "0" and return it
-    llvm::Value *const zero_string_lit = IR::generate_const_string(module, "0");
-    llvm::Value *const zero_string = builder->CreateCall(init_str_fn, {zero_string_lit, builder->getInt64(1)}, "zero_string");
-    builder->CreateRet(zero_string);
-
-    // Non-zero case block
-    builder->SetInsertPoint(nonzero_case_block);
-    // Count digits - call count_digits((uint64_t)u_value)
-    llvm::Value *len = arg_uvalue;
     ASSERT(N <= 64);
-    if (N < 64) {
-        llvm::Value *u64_value = builder->CreateZExt(arg_uvalue, builder->getInt64Ty());
-        len = builder->CreateCall(count_digits_fn, {u64_value}, "len");
-    } else {
-        len = builder->CreateCall(count_digits_fn, {arg_uvalue}, "len");
-    }
-
-    // Allocate string - call create_str(len)
+    llvm::Value *const value = builder->CreateZExtOrBitCast(arg_uvalue, builder->getInt64Ty(), "value");
+    llvm::Value *const len = builder->CreateCall(count_digits_fn, {value}, "len");
     llvm::Value *const result = builder->CreateCall(create_str_fn, {len}, "result");
-
-    // Get pointer to result->value (the flexible array member)
     llvm::Value *const data_ptr = builder->CreateStructGEP(str_type, result, 1, "data_ptr");
-
-    // Create local variable for buffer
-    llvm::Value *const current_buffer = builder->CreateAlloca(builder->getPtrTy(), 0, nullptr, "current_buffer");
-    // Calculate buffer = result->value + len
-    llvm::Value *const buffer = builder->CreateGEP(builder->getInt8Ty(), data_ptr, len, "buffer");
-    // Store the calculated buffer in the variable
-    IR::aligned_store(*builder, buffer, current_buffer);
-
-    // Create local variable for value
-    llvm::Value *const current_value = builder->CreateAlloca(builder->getIntNTy(N), 0, nullptr, "current_value");
-    IR::aligned_store(*builder, arg_uvalue, current_value);
-
-    // Branch to the loop
-    builder->CreateBr(loop_block);
-
-    // Loop block
-    builder->SetInsertPoint(loop_block);
-    // Load current value and buffer
-    llvm::Value *const value_load = IR::aligned_load(*builder, builder->getIntNTy(N), current_value, "value_load");
-    llvm::Value *const buffer_load = IR::aligned_load(*builder, builder->getPtrTy(), current_buffer, "buffer_load");
-
-    // Calculate value % 10
-    llvm::Value *const remainder = builder->CreateURem(value_load, llvm::ConstantInt::get(builder->getIntNTy(N), 10), "remainder");
-
-    // Calculate '0' + (value % 10)
-    llvm::Value *const digit_char = builder->CreateAdd(        //
-        llvm::ConstantInt::get(builder->getInt8Ty(), '0'),     //
-        builder->CreateTrunc(remainder, builder->getInt8Ty()), //
-        "digit_char"                                           //
-    );
-
-    // Decrement buffer
-    llvm::Value *const buffer_prev = builder->CreateGEP(         //
-        builder->getInt8Ty(),                                    //
-        buffer_load,                                             //
-        llvm::ConstantInt::getSigned(builder->getInt32Ty(), -1), //
-        "buffer_prev"                                            //
-    );
-
-    // Store the digit character
-    IR::aligned_store(*builder, digit_char, buffer_prev);
-
-    // Update buffer
-    IR::aligned_store(*builder, buffer_prev, current_buffer);
-
-    // Calculate value / 10
-    llvm::Value *const new_value = builder->CreateUDiv(value_load, llvm::ConstantInt::get(builder->getIntNTy(N), 10), "new_value");
-
-    // Update value
-    IR::aligned_store(*builder, new_value, current_value);
-
-    // Check if value > 0
-    llvm::Value *const continue_loop = builder->CreateICmpUGT(new_value, llvm::ConstantInt::get(builder->getIntNTy(N), 0), "continue_loop");
-
-    // Branch based on condition
-    builder->CreateCondBr(continue_loop, loop_block, exit_block);
-
-    // Exit block
-    builder->SetInsertPoint(exit_block);
+    llvm::Value *const buffer_end = builder->CreateGEP(builder->getInt8Ty(), data_ptr, len, "buffer_end");
+    builder->CreateCall(write_digits_fn, {buffer_end, value});
     builder->CreateRet(result);
 }
 
@@ -589,40 +983,20 @@ void Generator::Module::TypeCast::generate_iN_to_str( //
 ) {
     // C IMPLEMENTATION:
     // str *iN_to_str(const intN_t i_value) {
-    //     // Handle special case of minimum value (can't be negated safely)
-    //     if (i_value == INTN_MIN) {
-    //         const char *min_str = "...";
-    //         return init_str(min_str, M);
-    //     }
-    //
-    //     // Handle sign
-    //     int is_negative = i_value < 0;
-    //     uintN_t value = is_negative ? -i_value : i_value;
-    //
-    //     // Count digits
-    //     size_t num_digits = count_digits(value);
-    //     size_t len = num_digits + (is_negative ? 1 : 0);
-    //
-    //     // Allocate string
+    //     const int64_t value = (int64_t)i_value;
+    //     const bool is_negative = value < 0;
+    //     // Negating in unsigned arithmetic also covers INT64_MIN, which has no positive counterpart
+    //     const uint64_t magnitude = is_negative ? 0 - (uint64_t)value : (uint64_t)value;
+    //     const size_t len = count_digits(magnitude) + is_negative;
     //     str *result = create_str(len);
-    //     char *buffer = result->value + len; // Start at the end
-    //
-    //     // Write digits in reverse order
-    //     do {
-    //         *--buffer = '0' + (value % 10);
-    //         value /= 10;
-    //     } while (value > 0);
-    //
-    //     // Add sign if negative
-    //     if (is_negative) {
-    //         *--buffer = '-';
-    //     }
-    //
+    //     // The sign is always written, for positive values the first digit overwrites it again
+    //     result->value[0] = '-';
+    //     write_digits(result->value + len, magnitude);
     //     return result;
     // }
     llvm::Type *const str_type = IR::get_type(module, Type::get_primitive_type("type.flint.str")).type;
-    llvm::Function *const init_str_fn = String::string_manip_functions.at("init_str");
     llvm::Function *const count_digits_fn = typecast_functions.at("count_digits");
+    llvm::Function *const write_digits_fn = typecast_functions.at("write_digits");
     llvm::Function *const create_str_fn = String::string_manip_functions.at("create_str");
     llvm::IntegerType *const intN_t = llvm::IntegerType::getIntNTy(context, N);
 
@@ -643,125 +1017,23 @@ void Generator::Module::TypeCast::generate_iN_to_str( //
         return;
     }
 
-    // Create basic blocks
     llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", iN_to_str_fn);
-    llvm::BasicBlock *const min_value_block = llvm::BasicBlock::Create(context, "min_value", iN_to_str_fn);
-    llvm::BasicBlock *const regular_case_block = llvm::BasicBlock::Create(context, "regular_case", iN_to_str_fn);
-    llvm::BasicBlock *const digit_loop_block = llvm::BasicBlock::Create(context, "digit_loop", iN_to_str_fn);
-    llvm::BasicBlock *const negative_sign_block = llvm::BasicBlock::Create(context, "negative_sign", iN_to_str_fn);
-    llvm::BasicBlock *const add_sign_block = llvm::BasicBlock::Create(context, "add_sign", iN_to_str_fn);
-    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", iN_to_str_fn);
-
-    // Set insert point to entry block
     builder->SetInsertPoint(entry_block);
 
-    // Get the function parameter
     llvm::Argument *const arg_ivalue = iN_to_str_fn->arg_begin();
     arg_ivalue->setName("i_value");
 
-    // Create constant for INTN_MIN
-    const llvm::APInt min = llvm::APInt::getSignedMinValue(N);
-    llvm::SmallVector<char, 64> strbuf;
-    min.toStringSigned(strbuf);
-    std::string min_str;
-    llvm::raw_string_ostream min_str_stream(min_str);
-    min.print(min_str_stream, true);
-    min_str_stream.flush();
-    auto intN_min = llvm::ConstantInt::get(intN_t, min);
-
-    // Check if i_value == INTN_MIN
-    llvm::Value *const is_min_value = builder->CreateICmpEQ(arg_ivalue, intN_min, "is_min_value");
-    builder->CreateCondBr(is_min_value, min_value_block, regular_case_block);
-
-    // Handle INTN_MIN special case
-    builder->SetInsertPoint(min_value_block);
-    llvm::Value *const min_str_ptr = IR::generate_const_string(module, min_str);
-    llvm::Value *const min_result = builder->CreateCall(init_str_fn, {min_str_ptr, builder->getInt64(min_str.size())}, "min_result");
-    builder->CreateRet(min_result);
-
-    // Regular case - handle sign
-    builder->SetInsertPoint(regular_case_block);
-    llvm::Value *const is_negative = builder->CreateICmpSLT(arg_ivalue, builder->getIntN(N, 0), "is_negative");
-    llvm::Value *const abs_value = builder->CreateSelect(is_negative, builder->CreateNeg(arg_ivalue, "negated"), arg_ivalue, "abs_value");
-
-    // Convert to uint32_t for consistent handling
     ASSERT(N <= 64);
-    llvm::Value *value = abs_value;
-    if (N < 64) {
-        value = builder->CreateZExt(abs_value, builder->getInt64Ty(), "value_u64");
-    }
-
-    // Count digits
-    llvm::Value *const num_digits = builder->CreateCall(count_digits_fn, {value}, "num_digits");
-
-    // Calculate length: num_digits + (is_negative ? 1 : 0)
-    llvm::Value *const sign_len = builder->CreateSelect(is_negative, builder->getInt64(1), builder->getInt64(0), "sign_len");
-    llvm::Value *const total_len = builder->CreateAdd(num_digits, sign_len, "total_len");
-
-    // Allocate string
-    llvm::Value *const result = builder->CreateCall(create_str_fn, {total_len}, "result");
-
-    // Get pointer to the string data area
+    llvm::Value *const value = builder->CreateSExtOrBitCast(arg_ivalue, builder->getInt64Ty(), "value");
+    llvm::Value *const is_negative = builder->CreateICmpSLT(value, builder->getInt64(0), "is_negative");
+    llvm::Value *const magnitude = builder->CreateSelect(is_negative, builder->CreateNeg(value, "negated"), value, "magnitude");
+    llvm::Value *const num_digits = builder->CreateCall(count_digits_fn, {magnitude}, "num_digits");
+    llvm::Value *const len = builder->CreateAdd(num_digits, builder->CreateZExt(is_negative, builder->getInt64Ty()), "len");
+    llvm::Value *const result = builder->CreateCall(create_str_fn, {len}, "result");
     llvm::Value *const data_ptr = builder->CreateStructGEP(str_type, result, 1, "data_ptr");
-
-    // Create a GEP to the end of the buffer (data + len)
-    llvm::Value *const buffer_end = builder->CreateGEP(builder->getInt8Ty(), data_ptr, total_len, "buffer_end");
-
-    // Create variables for the loop
-    llvm::Value *const current_value_ptr = builder->CreateAlloca(builder->getInt64Ty(), nullptr, "current_value_ptr");
-    llvm::Value *const current_buffer_ptr = builder->CreateAlloca(builder->getPtrTy(), nullptr, "current_buffer_ptr");
-
-    // Initialize values
-    IR::aligned_store(*builder, value, current_value_ptr);
-    IR::aligned_store(*builder, buffer_end, current_buffer_ptr);
-
-    // Start the digit loop
-    builder->CreateBr(digit_loop_block);
-
-    // Digit loop
-    builder->SetInsertPoint(digit_loop_block);
-
-    // Load current value
-    llvm::Value *const current_value = IR::aligned_load(*builder, builder->getInt64Ty(), current_value_ptr, "current_value");
-
-    // Calculate digit: value % 10
-    llvm::Value *const remainder = builder->CreateURem(current_value, builder->getInt64(10), "remainder");
-    llvm::Value *const digit_char = builder->CreateAdd(                                                     //
-        builder->getInt8('0'), builder->CreateTrunc(remainder, builder->getInt8Ty(), "digit"), "digit_char" //
-    );
-
-    // Decrement buffer pointer
-    llvm::Value *const buffer_ptr = IR::aligned_load(*builder, builder->getPtrTy(), current_buffer_ptr, "buffer_ptr");
-    llvm::Value *const prev_buffer = builder->CreateGEP(builder->getInt8Ty(), buffer_ptr, builder->getInt32(-1), "prev_buffer");
-    IR::aligned_store(*builder, prev_buffer, current_buffer_ptr);
-
-    // Store digit at the decremented position
-    IR::aligned_store(*builder, digit_char, prev_buffer);
-
-    // Divide value by 10
-    llvm::Value *const next_value = builder->CreateUDiv(current_value, builder->getInt64(10), "next_value");
-    IR::aligned_store(*builder, next_value, current_value_ptr);
-
-    // Continue loop if value > 0
-    llvm::Value *const continue_loop = builder->CreateICmpUGT(next_value, builder->getInt64(0), "continue_loop");
-    builder->CreateCondBr(continue_loop, digit_loop_block, negative_sign_block);
-
-    // Add negative sign if needed
-    builder->SetInsertPoint(negative_sign_block);
-    llvm::Value *const should_add_sign = builder->CreateICmpEQ(sign_len, builder->getInt64(1), "should_add_sign");
-    builder->CreateCondBr(should_add_sign, add_sign_block, return_block);
-
-    // Add negative sign
-    builder->SetInsertPoint(add_sign_block);
-    llvm::Value *const sign_buffer_ptr = IR::aligned_load(*builder, builder->getPtrTy(), current_buffer_ptr, "sign_buffer_ptr");
-    llvm::Value *const sign_prev_buffer = builder->CreateGEP(                            //
-        builder->getInt8Ty(), sign_buffer_ptr, builder->getInt32(-1), "sign_prev_buffer" //
-    );
-    IR::aligned_store(*builder, builder->getInt8('-'), sign_prev_buffer);
-    builder->CreateBr(return_block);
-
-    // Return the result of the function
-    builder->SetInsertPoint(return_block);
+    IR::aligned_store(*builder, builder->getInt8('-'), data_ptr);
+    llvm::Value *const buffer_end = builder->CreateGEP(builder->getInt8Ty(), data_ptr, len, "buffer_end");
+    builder->CreateCall(write_digits_fn, {buffer_end, magnitude});
     builder->CreateRet(result);
 }
 
@@ -823,572 +1095,130 @@ void Generator::Module::TypeCast::generate_bool8_to_str_function( //
     builder->CreateRet(b8_str);
 }
 
-void Generator::Module::TypeCast::generate_f32_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations) {
+void Generator::Module::TypeCast::generate_fN_to_str( //
+    llvm::IRBuilder<> *builder,                       //
+    llvm::Module *module,                             //
+    const bool only_declarations,                     //
+    const size_t N                                    //
+) {
     // C IMPLEMENTATION:
-    // str *f32_to_str(const float f_value) {
-    //     // Handle special cases
-    //     if (f_value != f_value) {
-    //         return init_str("nan", 3); // NaN check
-    //     }
-    //
-    //     // Use a union for type punning (equivalent to bitcast in LLVM IR)
-    //     union {
-    //         float f;
-    //         uint32_t bits;
-    //     } u;
-    //     u.f = f_value;
-    //
-    //     // Infinity check
-    //     if ((u.bits & 0x7FFFFFFF) == 0x7F800000) {
-    //         return (u.bits & 0x80000000) ? init_str("-inf", 4) : init_str("inf", 3);
+    // str *fN_to_str(const floatN_t f_value) {
+    //     const uintN_t bits = bitcast(f_value);
+    //     const bool is_negative = bits >> (N - 1);
+    //     const uint64_t ieee_mantissa = bits & MANTISSA_MASK;
+    //     const uint64_t ieee_exponent = (bits >> MANTISSA_BITS) & EXPONENT_MASK;
+    //     if (ieee_exponent == EXPONENT_MASK) {
+    //         if (ieee_mantissa != 0) {
+    //             return init_str("nan", 3);
+    //         }
+    //         return is_negative ? init_str("-inf", 4) : init_str("inf", 3);
     //     }
-    //
-    //     // For now, use a buffer large enough for any float representation
-    //     char buffer[32];
-    //     int len = 0;
-    //     const float f_pow = f_value * f_value;
-    //     if (f_pow < 1e-8f || f_pow > 1e12f) {
-    //         len = snprintf(buffer, sizeof(buffer), "%.6e", f_value);
-    //     } else {
-    //         len = snprintf(buffer, sizeof(buffer), "%.6f", f_value);
+    //     if (ieee_exponent == 0 && ieee_mantissa == 0) {
+    //         return is_negative ? init_str("-0", 2) : init_str("0", 1);
     //     }
-    //
-    //     // Trim trailing zeros after decimal point
-    //     int last_non_zero = len - 1;
-    //     while (last_non_zero > 0 && buffer[last_non_zero] == '0') {
-    //         last_non_zero--;
-    //     }
-    //
-    //     // If we ended up at the decimal point, remove it too
-    //     if (buffer[last_non_zero] == '.') {
-    //         last_non_zero--;
-    //     }
-    //
-    //     return init_str(buffer, last_non_zero + 1);
+    //     // The value is c * 2^q, subnormals have no hidden bit but the same exponent as the smallest normal numbers
+    //     const uint64_t c = ieee_exponent == 0 ? ieee_mantissa : ieee_mantissa | (1 << MANTISSA_BITS);
+    //     const int64_t q = (ieee_exponent == 0 ? 1 : ieee_exponent) - EXPONENT_BIAS;
+    //     const bool is_closer = ieee_mantissa == 0 && ieee_exponent > 1;
+    //     const decimal d = to_decimal(c, q, is_closer);
+    //     return format_decimal(is_negative, d.digits, d.exponent, MAX_POINT);
     // }
+    ASSERT(N == 32 || N == 64);
     llvm::Function *const init_str_fn = String::string_manip_functions.at("init_str");
-    llvm::Function *const snprintf_fn = c_functions.at(SNPRINTF);
-
-    llvm::FunctionType *const f32_to_str_type = llvm::FunctionType::get( //
-        PTR_TY,                                                          // Return type: str*
-        {llvm::Type::getFloatTy(context)},                               // Argument: f32 f_value
-        false                                                            // No varargs
+    const unsigned int mantissa_bits = N == 32 ? 23 : 52;
+    const uint64_t exponent_mask = N == 32 ? 0xFF : 0x7FF;
+    const int64_t exponent_bias = N == 32 ? 127 + 23 : 1023 + 52;
+    // Values with more integral digits than this are printed in scientific notation
+    const int64_t max_point = N == 32 ? 7 : 16;
+
+    llvm::Type *const float_type = N == 32 ? llvm::Type::getFloatTy(context) : llvm::Type::getDoubleTy(context);
+    llvm::FunctionType *const fN_to_str_type = llvm::FunctionType::get( //
+        PTR_TY,                                                         // Return type: str*
+        {float_type},                                                   // Argument: fN f_value
+        false                                                           // No varargs
     );
-    llvm::Function *const f32_to_str_fn = llvm::Function::Create( //
-        f32_to_str_type,                                          //
-        llvm::Function::ExternalLinkage,                          //
-        prefix + "f32_to_str",                                    //
-        module                                                    //
+    const std::string fN_to_str_fn_name = "f" + std::to_string(N) + "_to_str";
+    llvm::Function *const fN_to_str_fn = llvm::Function::Create( //
+        fN_to_str_type,                                          //
+        llvm::Function::ExternalLinkage,                         //
+        prefix + fN_to_str_fn_name,                              //
+        module                                                   //
     );
-    typecast_functions["f32_to_str"] = f32_to_str_fn;
+    typecast_functions[fN_to_str_fn_name] = fN_to_str_fn;
     if (only_declarations) {
         return;
     }
+    llvm::Function *const to_decimal_fn = typecast_functions.at("to_decimal");
+    llvm::Function *const format_decimal_fn = typecast_functions.at("format_decimal");
 
-    // Create basic blocks
-    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", f32_to_str_fn);
-    llvm::BasicBlock *const nan_block = llvm::BasicBlock::Create(context, "nan_case", f32_to_str_fn);
-    llvm::BasicBlock *const nan_merge_block = llvm::BasicBlock::Create(context, "nan_merge", f32_to_str_fn);
-    llvm::BasicBlock *const inf_block = llvm::BasicBlock::Create(context, "inf_case", f32_to_str_fn);
-    llvm::BasicBlock *const inf_merge_block = llvm::BasicBlock::Create(context, "inf_merge", f32_to_str_fn);
-    llvm::BasicBlock *const exponent_block = llvm::BasicBlock::Create(context, "exponent_case", f32_to_str_fn);
-    llvm::BasicBlock *const no_exponent_block = llvm::BasicBlock::Create(context, "no_exponent_case", f32_to_str_fn);
-    llvm::BasicBlock *const exponent_merge_block = llvm::BasicBlock::Create(context, "exponent_merge", f32_to_str_fn);
-    llvm::BasicBlock *const loop_block = llvm::BasicBlock::Create(context, "loop", f32_to_str_fn);
-    llvm::BasicBlock *const check_char_block = llvm::BasicBlock::Create(context, "check_char", f32_to_str_fn);
-    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", f32_to_str_fn);
-    llvm::BasicBlock *const loop_merge_block = llvm::BasicBlock::Create(context, "loop_merge", f32_to_str_fn);
-    llvm::BasicBlock *const decimal_case_block = llvm::BasicBlock::Create(context, "decimal_case", f32_to_str_fn);
-    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", f32_to_str_fn);
-
-    // Set insert point to entry block
-    builder->SetInsertPoint(entry_block);
+    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", fN_to_str_fn);
+    llvm::BasicBlock *const non_finite_block = llvm::BasicBlock::Create(context, "non_finite", fN_to_str_fn);
+    llvm::BasicBlock *const nan_block = llvm::BasicBlock::Create(context, "nan_case", fN_to_str_fn);
+    llvm::BasicBlock *const inf_block = llvm::BasicBlock::Create(context, "inf_case", fN_to_str_fn);
+    llvm::BasicBlock *const finite_block = llvm::BasicBlock::Create(context, "finite", fN_to_str_fn);
+    llvm::BasicBlock *const zero_block = llvm::BasicBlock::Create(context, "zero_case", fN_to_str_fn);
+    llvm::BasicBlock *const decimal_block = llvm::BasicBlock::Create(context, "decimal", fN_to_str_fn);
 
-    // Get the function parameter
-    llvm::Argument *const arg_fvalue = f32_to_str_fn->arg_begin();
+    builder->SetInsertPoint(entry_block);
+    llvm::Argument *const arg_fvalue = fN_to_str_fn->arg_begin();
     arg_fvalue->setName("f_value");
 
-    llvm::Value *const is_nan_condition = builder->CreateFCmpUNE(arg_fvalue, arg_fvalue, "is_nan_cmp");
-    builder->CreateCondBr(is_nan_condition, nan_block, nan_merge_block);
-
-    // The nan_block
-    {
-        builder->SetInsertPoint(nan_block);
-        llvm::Value *const nan_str = IR::generate_const_string(module, "nan");
-        llvm::Value *const nan_str_value = builder->CreateCall(                    //
-            init_str_fn,                                                           //
-            {nan_str, llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), 3)}, //
-            "nan_str_value"                                                        //
-        );
-        builder->CreateRet(nan_str_value);
-    }
-
-    // The nan_merge_block
-    builder->SetInsertPoint(nan_merge_block);
-    // First get all the bit values of the floating point number through bitcasting
-    llvm::Value *const bits = builder->CreateBitCast(arg_fvalue, builder->getInt32Ty(), "bits");
-
-    // Create the bitmask constants
-    llvm::Value *const abs_mask = builder->getInt32(0x7FFFFFFF);    // Mask to clear the sign bit
-    llvm::Value *const inf_pattern = builder->getInt32(0x7F800000); // Bit pattern for infinity
-    llvm::Value *const sign_mask = builder->getInt32(0x80000000);   // Mask to extract the sign bit
-
-    // Perform bitwise operations
-    llvm::Value *const abs_bits = builder->CreateAnd(bits, abs_mask, "abs_bits");       // bits & 0x7FFFFFFF
-    llvm::Value *const is_inf = builder->CreateICmpEQ(abs_bits, inf_pattern, "is_inf"); // (bits & 0x7FFFFFFF) == 0x7F800000
-    builder->CreateCondBr(is_inf, inf_block, inf_merge_block);
-
-    // The inf_block
-    {
-        builder->SetInsertPoint(inf_block);
-        // Check if negative infinity
-        llvm::Value *const sign_bit = builder->CreateAnd(bits, sign_mask, "sign_bit"); // bits & 0x80000000
-        llvm::Value *const is_neg_inf = builder->CreateICmpNE(sign_bit, builder->getInt32(0), "is_neg_inf");
-
-        // Create the two possible strings and select based on sign
-        llvm::Value *const neg_inf_str = IR::generate_const_string(module, "-inf");
-        llvm::Value *const pos_inf_str = IR::generate_const_string(module, "inf");
-
-        // Create string for negative infinity
-        llvm::Value *const neg_inf_value = builder->CreateCall(init_str_fn, {neg_inf_str, builder->getInt64(4)}, "neg_inf_value");
-
-        // Create string for positive infinity
-        llvm::Value *const pos_inf_value = builder->CreateCall(init_str_fn, {pos_inf_str, builder->getInt64(3)}, "pos_inf_value");
-
-        // Select the appropriate string based on sign
-        llvm::Value *const inf_result = builder->CreateSelect(is_neg_inf, neg_inf_value, pos_inf_value, "inf_result");
-        builder->CreateRet(inf_result);
-    }
-
-    // The inf_merge_block
-    builder->SetInsertPoint(inf_merge_block);
-    // First, create the char buffer[32]
-    llvm::AllocaInst *const buffer = builder->CreateAlloca( //
-        llvm::ArrayType::get(builder->getInt8Ty(), 32),     // Type: [32 x i8]
-        nullptr,                                            // No array size (it's fixed)
-        "buffer"                                            //
+    // Split the value into its sign, exponent and mantissa through bitcasting
+    llvm::Value *const bits = builder->CreateBitCast(arg_fvalue, builder->getIntNTy(N), "bits");
+    llvm::Value *const is_negative = builder->CreateICmpSLT(bits, builder->getIntN(N, 0), "is_negative");
+    llvm::Value *const bits_u64 = builder->CreateZExtOrBitCast(bits, builder->getInt64Ty(), "bits_u64");
+    llvm::Value *const ieee_mantissa = builder->CreateAnd(bits_u64, builder->getInt64((1ULL << mantissa_bits) - 1), "ieee_mantissa");
+    llvm::Value *const ieee_exponent = builder->CreateAnd(                                              //
+        builder->CreateLShr(bits_u64, mantissa_bits), builder->getInt64(exponent_mask), "ieee_exponent" //
     );
-    buffer->setAlignment(llvm::Align(8));
-    llvm::Value *const buffer_ptr = builder->CreateBitCast(buffer, PTR_TY, "buffer_ptr");
-    // Create the len variable
-    llvm::AllocaInst *const len_var = builder->CreateAlloca(builder->getInt32Ty(), 0, nullptr, "len_var");
-    llvm::Value *const f_pow = builder->CreateFMul(arg_fvalue, arg_fvalue, "f_pow");
-    llvm::Constant *const min_pow = llvm::ConstantFP::get(builder->getFloatTy(), static_cast<double>(1.0e-8f));
-    llvm::Constant *const max_pow = llvm::ConstantFP::get(builder->getFloatTy(), static_cast<double>(1.0e12f));
-    llvm::Value *const is_too_small = builder->CreateFCmpOLT(f_pow, min_pow, "is_too_small");
-    llvm::Value *const is_too_large = builder->CreateFCmpOGT(f_pow, max_pow, "is_too_large");
-    llvm::Value *const exponent_condition = builder->CreateOr(is_too_small, is_too_large, "exponent_condition");
-    builder->CreateCondBr(exponent_condition, exponent_block, no_exponent_block);
-
-    // The exponent_block
-    {
-        builder->SetInsertPoint(exponent_block);
-        llvm::Value *const snprintf_format = IR::generate_const_string(module, "%.6e");
-        llvm::Value *const f_value_as_d = f32_to_f64(*builder, arg_fvalue);
-        llvm::CallInst *const snprintf_ret = builder->CreateCall(snprintf_fn,
-            {
-                buffer_ptr,                                        //
-                llvm::ConstantInt::get(builder->getInt64Ty(), 32), //
-                snprintf_format,                                   //
-                f_value_as_d                                       //
-            },                                                     //
-            "snprintf_ret_e"                                       //
-        );
-        IR::aligned_store(*builder, snprintf_ret, len_var);
-        builder->CreateBr(exponent_merge_block);
-    }
-    // The no_exponent_block
-    {
-        builder->SetInsertPoint(no_exponent_block);
-        llvm::Value *const snprintf_format = IR::generate_const_string(module, "%.6f");
-        llvm::Value *const f_value_as_d = f32_to_f64(*builder, arg_fvalue);
-        llvm::Value *const snprintf_ret = builder->CreateCall(snprintf_fn,
-            {
-                buffer_ptr,                                        //
-                llvm::ConstantInt::get(builder->getInt64Ty(), 32), //
-                snprintf_format,                                   //
-                f_value_as_d                                       //
-            },                                                     //
-            "snprintf_ret_f"                                       //
-        );
-        IR::aligned_store(*builder, snprintf_ret, len_var);
-        builder->CreateBr(exponent_merge_block);
-    }
+    llvm::Value *const is_non_finite = builder->CreateICmpEQ(ieee_exponent, builder->getInt64(exponent_mask), "is_non_finite");
+    builder->CreateCondBr(is_non_finite, non_finite_block, finite_block);
 
-    // The exponent_merge_block
-    builder->SetInsertPoint(exponent_merge_block);
-    llvm::Value *const last_non_zero = builder->CreateAlloca(builder->getInt32Ty(), 0, nullptr, "last_non_zero");
-    llvm::Value *const len_value = IR::aligned_load(*builder, builder->getInt32Ty(), len_var, "len_val");
-    llvm::Value *const len_minus_1 = builder->CreateSub(len_value, llvm::ConstantInt::get(builder->getInt32Ty(), 1), "len_m_1");
-    IR::aligned_store(*builder, len_minus_1, last_non_zero);
-    builder->CreateBr(loop_block);
+    builder->SetInsertPoint(non_finite_block);
+    llvm::Value *const is_nan = builder->CreateICmpNE(ieee_mantissa, builder->getInt64(0), "is_nan");
+    builder->CreateCondBr(is_nan, nan_block, inf_block);
 
-    // The loop_block
-    builder->SetInsertPoint(loop_block);
-    // Load current value of last_non_zero
-    llvm::Value *last_zero_val = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "last_zero_val");
-    // Check if last_non_zero > 0
-    llvm::Value *const is_valid_index = builder->CreateICmpSGT( //
-        last_zero_val,                                          //
-        llvm::ConstantInt::get(builder->getInt32Ty(), 0),       //
-        "is_valid_index"                                        //
-    );
-    builder->CreateCondBr(is_valid_index, check_char_block, loop_merge_block);
-
-    // The check_char_block
-    {
-        builder->SetInsertPoint(check_char_block);
-        // Get pointer to buffer[last_non_zero]
-        llvm::Value *const cur_char_ptr = builder->CreateGEP(builder->getInt8Ty(), buffer_ptr, last_zero_val, "cur_char_ptr");
-        // Load the current character
-        llvm::Value *const cur_char = IR::aligned_load(*builder, builder->getInt8Ty(), cur_char_ptr, "cur_char");
-        // Check if the current character is '0'
-        llvm::Value *const is_zero = builder->CreateICmpEQ(cur_char, llvm::ConstantInt::get(builder->getInt8Ty(), '0'), "is_zero");
-        // Combine conditions: should continue if index > 0 && char == '0'
-        llvm::Value *const should_continue = builder->CreateAnd(is_valid_index, is_zero, "should_continue");
-        // Branch to loop body or merge
-        builder->CreateCondBr(should_continue, loop_body_block, loop_merge_block);
-    }
+    builder->SetInsertPoint(nan_block);
+    llvm::Value *const nan_str = IR::generate_const_string(module, "nan");
+    builder->CreateRet(builder->CreateCall(init_str_fn, {nan_str, builder->getInt64(3)}, "nan_str_value"));
 
-    // The loop_body_block
-    {
-        builder->SetInsertPoint(loop_body_block);
-        // Decrement last_non_zero
-        last_zero_val = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "last_zero_val");
-        llvm::Value *const new_last_zero = builder->CreateSub(                               //
-            last_zero_val, llvm::ConstantInt::get(builder->getInt32Ty(), 1), "new_last_zero" //
-        );
-        IR::aligned_store(*builder, new_last_zero, last_non_zero);
-        // Jump back to loop condition
-        builder->CreateBr(loop_block);
-    }
-
-    // The loop_merge_block
-    {
-        builder->SetInsertPoint(loop_merge_block);
-        // Load final value of last_non_zero
-        llvm::Value *const final_last_zero = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "final_last_zero");
-        // Get pointer to buffer[last_non_zero]
-        llvm::Value *const last_char_ptr = builder->CreateGEP(builder->getInt8Ty(), buffer_ptr, final_last_zero, "last_char_ptr");
-        // Load the character
-        llvm::Value *const last_char = IR::aligned_load(*builder, builder->getInt8Ty(), last_char_ptr, "last_char");
-        // Check if the character is '.'
-        llvm::Value *const is_dot = builder->CreateICmpEQ(last_char, llvm::ConstantInt::get(builder->getInt8Ty(), '.'), "is_dot");
-        // Branch based on whether the character is a decimal point
-        builder->CreateCondBr(is_dot, decimal_case_block, return_block);
-    }
-
-    // The decimal_case_block - handle case where we need to remove decimal point
-    {
-        builder->SetInsertPoint(decimal_case_block);
-        // Decrement last_non_zero one more time
-        llvm::Value *const decimal_last_zero = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "decimal_last_zero");
-        llvm::Value *const adjusted_last_zero = builder->CreateSub( //
-            decimal_last_zero,                                      //
-            llvm::ConstantInt::get(builder->getInt32Ty(), 1),       //
-            "adjusted_last_zero"                                    //
-        );
-        IR::aligned_store(*builder, adjusted_last_zero, last_non_zero);
-        // Branch to return block
-        builder->CreateBr(return_block);
-    }
-
-    // The return_block
-    {
-        builder->SetInsertPoint(return_block);
-        // Calculate final length: last_non_zero + 1
-        llvm::Value *const final_last_zero = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "final_last_zero");
-        llvm::Value *const final_len = builder->CreateAdd(final_last_zero, llvm::ConstantInt::get(builder->getInt32Ty(), 1), "final_len");
-        // Convert to i64 for init_str
-        llvm::Value *const final_len_i64 = builder->CreateZExt(final_len, builder->getInt64Ty(), "final_len_i64");
-        // Call init_str with buffer and calculated length
-        llvm::Value *const result = builder->CreateCall(init_str_fn, {buffer_ptr, final_len_i64}, "result");
-        // Return the string
-        builder->CreateRet(result);
-    }
-}
-
-void Generator::Module::TypeCast::generate_f64_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations) {
-    // C IMPLEMENTATION:
-    // str *f64_to_str(const double d_value) {
-    //     // Handle special cases
-    //     if (d_value != d_value) {
-    //         return init_str("nan", 3); // NaN check
-    //     }
-    //
-    //     // Use a union for type punning (equivalent to bitcast in LLVM IR)
-    //     union {
-    //         double d;
-    //         uint64_t bits;
-    //     } u;
-    //     u.d = d_value;
-    //
-    //     // Infinity check
-    //     if ((u.bits & 0x7FFFFFFFFFFFFFFF) == 0x7FF0000000000000) {
-    //         return (u.bits & 0x8000000000000000) ? init_str("-inf", 4) : init_str("inf", 3);
-    //     }
-    //
-    //     // For now, use a buffer large enough for any double representation
-    //     char buffer[64];
-    //     int len = 0;
-    //     const double d_pow = d_value * d_value;
-    //     if (d_pow < 1e-8f || d_pow > 1e30f) {
-    //         len = snprintf(buffer, sizeof(buffer), "%.15e", d_value);
-    //     } else {
-    //         len = snprintf(buffer, sizeof(buffer), "%.15f", d_value);
-    //     }
-    //
-    //     // Trim trailing zeros after decimal point
-    //     int last_non_zero = len - 1;
-    //     while (last_non_zero > 0 && buffer[last_non_zero] == '0') {
-    //         last_non_zero--;
-    //     }
-    //
-    //     // If we ended up at the decimal point, remove it too
-    //     if (buffer[last_non_zero] == '.') {
-    //         last_non_zero--;
-    //     }
-    //
-    //     return init_str(buffer, last_non_zero + 1);
-    // }
-    llvm::Function *const init_str_fn = String::string_manip_functions.at("init_str");
-    llvm::Function *const snprintf_fn = c_functions.at(SNPRINTF);
-
-    llvm::FunctionType *const f64_to_str_type = llvm::FunctionType::get( //
-        PTR_TY,                                                          // Return type: str*
-        {llvm::Type::getDoubleTy(context)},                              // Argument: f64 d_value
-        false                                                            // No varargs
-    );
-    llvm::Function *const f64_to_str_fn = llvm::Function::Create( //
-        f64_to_str_type,                                          //
-        llvm::Function::ExternalLinkage,                          //
-        prefix + "f64_to_str",                                    //
-        module                                                    //
+    builder->SetInsertPoint(inf_block);
+    llvm::Value *const neg_inf_str = IR::generate_const_string(module, "-inf");
+    llvm::Value *const inf_chars = builder->CreateSelect(                                                                  //
+        is_negative, neg_inf_str, builder->CreateGEP(builder->getInt8Ty(), neg_inf_str, builder->getInt64(1)), "inf_chars" //
     );
-    typecast_functions["f64_to_str"] = f64_to_str_fn;
-    if (only_declarations) {
-        return;
-    }
-
-    // Create basic blocks
-    llvm::BasicBlock *const entry_block = llvm::BasicBlock::Create(context, "entry", f64_to_str_fn);
-    llvm::BasicBlock *const nan_block = llvm::BasicBlock::Create(context, "nan_case", f64_to_str_fn);
-    llvm::BasicBlock *const nan_merge_block = llvm::BasicBlock::Create(context, "nan_merge", f64_to_str_fn);
-    llvm::BasicBlock *const inf_block = llvm::BasicBlock::Create(context, "inf_case", f64_to_str_fn);
-    llvm::BasicBlock *const inf_merge_block = llvm::BasicBlock::Create(context, "inf_merge", f64_to_str_fn);
-    llvm::BasicBlock *const exponent_block = llvm::BasicBlock::Create(context, "exponent_case", f64_to_str_fn);
-    llvm::BasicBlock *const no_exponent_block = llvm::BasicBlock::Create(context, "no_exponent_case", f64_to_str_fn);
-    llvm::BasicBlock *const exponent_merge_block = llvm::BasicBlock::Create(context, "exponent_merge", f64_to_str_fn);
-    llvm::BasicBlock *const loop_block = llvm::BasicBlock::Create(context, "loop", f64_to_str_fn);
-    llvm::BasicBlock *const check_char_block = llvm::BasicBlock::Create(context, "check_char", f64_to_str_fn);
-    llvm::BasicBlock *const loop_body_block = llvm::BasicBlock::Create(context, "loop_body", f64_to_str_fn);
-    llvm::BasicBlock *const loop_merge_block = llvm::BasicBlock::Create(context, "loop_merge", f64_to_str_fn);
-    llvm::BasicBlock *const decimal_case_block = llvm::BasicBlock::Create(context, "decimal_case", f64_to_str_fn);
-    llvm::BasicBlock *const return_block = llvm::BasicBlock::Create(context, "return", f64_to_str_fn);
-
-    // Set insert point to entry block
-    builder->SetInsertPoint(entry_block);
-
-    // Get the function parameter
-    llvm::Argument *const arg_dvalue = f64_to_str_fn->arg_begin();
-    arg_dvalue->setName("d_value");
-
-    llvm::Value *const is_nan_condition = builder->CreateFCmpUNE(arg_dvalue, arg_dvalue, "is_nan_cmp");
-    builder->CreateCondBr(is_nan_condition, nan_block, nan_merge_block);
-
-    // The nan_block
-    {
-        builder->SetInsertPoint(nan_block);
-        llvm::Value *const nan_str = IR::generate_const_string(module, "nan");
-        llvm::Value *const nan_str_value = builder->CreateCall(                    //
-            init_str_fn,                                                           //
-            {nan_str, llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), 3)}, //
-            "nan_str_value"                                                        //
-        );
-        builder->CreateRet(nan_str_value);
-    }
+    llvm::Value *const inf_len = builder->CreateSelect(is_negative, builder->getInt64(4), builder->getInt64(3), "inf_len");
+    builder->CreateRet(builder->CreateCall(init_str_fn, {inf_chars, inf_len}, "inf_result"));
 
-    // The nan_merge_block
-    builder->SetInsertPoint(nan_merge_block);
-    // First get all the bit values of the floating point number through bitcasting
-    llvm::Value *const bits = builder->CreateBitCast(arg_dvalue, builder->getInt64Ty(), "bits");
-
-    // Create the bitmask constants
-    llvm::Value *const abs_mask = builder->getInt64(0x7FFFFFFFFFFFFFFF);
-    llvm::Value *const inf_pattern = builder->getInt64(0x7FF0000000000000);
-    llvm::Value *const sign_mask = builder->getInt64(0x8000000000000000);
-
-    // Perform bitwise operations
-    llvm::Value *const abs_bits = builder->CreateAnd(bits, abs_mask, "abs_bits");       // bits & 0x7FFFFFFFFFFFFFFF
-    llvm::Value *const is_inf = builder->CreateICmpEQ(abs_bits, inf_pattern, "is_inf"); // (bits & 0x7FFFFFFFFFFFFFFF) == 0x7FF0000000000000
-    builder->CreateCondBr(is_inf, inf_block, inf_merge_block);
-
-    // The inf_block
-    {
-        builder->SetInsertPoint(inf_block);
-        // Check if negative infinity
-        llvm::Value *const sign_bit = builder->CreateAnd(bits, sign_mask, "sign_bit"); // bits & 0x8000000000000000
-        llvm::Value *const is_neg_inf = builder->CreateICmpNE(sign_bit, builder->getInt64(0), "is_neg_inf");
-
-        // Create the two possible strings and select based on sign
-        llvm::Value *const neg_inf_str = IR::generate_const_string(module, "-inf");
-        llvm::Value *const pos_inf_str = IR::generate_const_string(module, "inf");
-
-        // Create string for negative infinity
-        llvm::Value *const neg_inf_value = builder->CreateCall(init_str_fn, {neg_inf_str, builder->getInt64(4)}, "neg_inf_value");
-
-        // Create string for positive infinity
-        llvm::Value *const pos_inf_value = builder->CreateCall(init_str_fn, {pos_inf_str, builder->getInt64(3)}, "pos_inf_value");
-
-        // Select the appropriate string based on sign
-        llvm::Value *const inf_result = builder->CreateSelect(is_neg_inf, neg_inf_value, pos_inf_value, "inf_result");
-        builder->CreateRet(inf_result);
-    }
+    builder->SetInsertPoint(finite_block);
+    llvm::Value *const abs_bits = builder->CreateOr(ieee_exponent, ieee_mantissa, "abs_bits");
+    builder->CreateCondBr(builder->CreateICmpEQ(abs_bits, builder->getInt64(0)), zero_block, decimal_block);
 
-    // The inf_merge_block
-    builder->SetInsertPoint(inf_merge_block);
-    // First, create the char buffer[32]
-    llvm::AllocaInst *const buffer = builder->CreateAlloca( //
-        llvm::ArrayType::get(builder->getInt8Ty(), 64),     // Type: [64 x i8]
-        nullptr,                                            // No array size (it's fixed)
-        "buffer"                                            //
+    builder->SetInsertPoint(zero_block);
+    llvm::Value *const neg_zero_str = IR::generate_const_string(module, "-0");
+    llvm::Value *const zero_chars = builder->CreateSelect(                                                                    //
+        is_negative, neg_zero_str, builder->CreateGEP(builder->getInt8Ty(), neg_zero_str, builder->getInt64(1)), "zero_chars" //
     );
-    buffer->setAlignment(llvm::Align(8));
-    llvm::Value *const buffer_ptr = builder->CreateBitCast(buffer, PTR_TY, "buffer_ptr");
-    // Create the len variable
-    llvm::AllocaInst *const len_var = builder->CreateAlloca(builder->getInt32Ty(), 0, nullptr, "len_var");
-    llvm::Value *const d_pow = builder->CreateFMul(arg_dvalue, arg_dvalue, "d_pow");
-    llvm::Constant *const min_pow = llvm::ConstantFP::get(builder->getDoubleTy(), static_cast<double>(1.0e-8f));
-    llvm::Constant *const max_pow = llvm::ConstantFP::get(builder->getDoubleTy(), static_cast<double>(1.0e30f));
-    llvm::Value *const is_too_small = builder->CreateFCmpOLT(d_pow, min_pow, "is_too_small");
-    llvm::Value *const is_too_large = builder->CreateFCmpOGT(d_pow, max_pow, "is_too_large");
-    llvm::Value *const exponent_condition = builder->CreateOr(is_too_small, is_too_large, "exponent_condition");
-    builder->CreateCondBr(exponent_condition, exponent_block, no_exponent_block);
-
-    // The exponent_block
-    {
-        builder->SetInsertPoint(exponent_block);
-        llvm::Value *const snprintf_format = IR::generate_const_string(module, "%.15e");
-        llvm::CallInst *const snprintf_ret = builder->CreateCall(snprintf_fn,
-            {
-                buffer_ptr,                                        //
-                llvm::ConstantInt::get(builder->getInt64Ty(), 64), //
-                snprintf_format,                                   //
-                arg_dvalue                                         //
-            },                                                     //
-            "snprintf_ret_e"                                       //
-        );
-        IR::aligned_store(*builder, snprintf_ret, len_var);
-        builder->CreateBr(exponent_merge_block);
-    }
-    // The no_exponent_block
-    {
-        builder->SetInsertPoint(no_exponent_block);
-        llvm::Value *const snprintf_format = IR::generate_const_string(module, "%.15f");
-        llvm::Value *const snprintf_ret = builder->CreateCall(snprintf_fn,
-            {
-                buffer_ptr,                                        //
-                llvm::ConstantInt::get(builder->getInt64Ty(), 64), //
-                snprintf_format,                                   //
-                arg_dvalue                                         //
-            },                                                     //
-            "snprintf_ret_f"                                       //
-        );
-        IR::aligned_store(*builder, snprintf_ret, len_var);
-        builder->CreateBr(exponent_merge_block);
-    }
-
-    // The exponent_merge_block
-    builder->SetInsertPoint(exponent_merge_block);
-    llvm::Value *const last_non_zero = builder->CreateAlloca(builder->getInt32Ty(), 0, nullptr, "last_non_zero");
-    llvm::Value *const len_value = IR::aligned_load(*builder, builder->getInt32Ty(), len_var, "len_val");
-    llvm::Value *const len_minus_1 = builder->CreateSub(len_value, llvm::ConstantInt::get(builder->getInt32Ty(), 1), "len_m_1");
-    IR::aligned_store(*builder, len_minus_1, last_non_zero);
-    builder->CreateBr(loop_block);
-
-    // The loop_block
-    builder->SetInsertPoint(loop_block);
-    // Load current value of last_non_zero
-    llvm::Value *last_zero_val = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "last_zero_val");
-    // Check if last_non_zero > 0
-    llvm::Value *const is_valid_index = builder->CreateICmpSGT( //
-        last_zero_val,                                          //
-        llvm::ConstantInt::get(builder->getInt32Ty(), 0),       //
-        "is_valid_index"                                        //
+    llvm::Value *const zero_len = builder->CreateSelect(is_negative, builder->getInt64(2), builder->getInt64(1), "zero_len");
+    builder->CreateRet(builder->CreateCall(init_str_fn, {zero_chars, zero_len}, "zero_result"));
+
+    builder->SetInsertPoint(decimal_block);
+    llvm::Value *const is_subnormal = builder->CreateICmpEQ(ieee_exponent, builder->getInt64(0), "is_subnormal");
+    llvm::Value *const hidden_mantissa = builder->CreateOr(ieee_mantissa, builder->getInt64(1ULL << mantissa_bits), "hidden_mantissa");
+    llvm::Value *const c = builder->CreateSelect(is_subnormal, ieee_mantissa, hidden_mantissa, "c");
+    llvm::Value *const biased_exponent = builder->CreateSelect(is_subnormal, builder->getInt64(1), ieee_exponent, "biased_exponent");
+    llvm::Value *const q = builder->CreateSub(biased_exponent, builder->getInt64(exponent_bias), "q");
+    llvm::Value *const is_closer = builder->CreateAnd(                           //
+        builder->CreateICmpEQ(ieee_mantissa, builder->getInt64(0)),              //
+        builder->CreateICmpUGT(ieee_exponent, builder->getInt64(1)), "is_closer" //
     );
-    builder->CreateCondBr(is_valid_index, check_char_block, loop_merge_block);
-
-    // The check_char_block
-    {
-        builder->SetInsertPoint(check_char_block);
-        // Get pointer to buffer[last_non_zero]
-        llvm::Value *const cur_char_ptr = builder->CreateGEP(builder->getInt8Ty(), buffer_ptr, last_zero_val, "cur_char_ptr");
-        // Load the current character
-        llvm::Value *const cur_char = IR::aligned_load(*builder, builder->getInt8Ty(), cur_char_ptr, "cur_char");
-        // Check if the current character is '0'
-        llvm::Value *const is_zero = builder->CreateICmpEQ(cur_char, llvm::ConstantInt::get(builder->getInt8Ty(), '0'), "is_zero");
-        // Combine conditions: should continue if index > 0 && char == '0'
-        llvm::Value *const should_continue = builder->CreateAnd(is_valid_index, is_zero, "should_continue");
-        // Branch to loop body or merge
-        builder->CreateCondBr(should_continue, loop_body_block, loop_merge_block);
-    }
-
-    // The loop_body_block
-    {
-        builder->SetInsertPoint(loop_body_block);
-        // Decrement last_non_zero
-        last_zero_val = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "last_zero_val");
-        llvm::Value *const new_last_zero = builder->CreateSub(                               //
-            last_zero_val, llvm::ConstantInt::get(builder->getInt32Ty(), 1), "new_last_zero" //
-        );
-        IR::aligned_store(*builder, new_last_zero, last_non_zero);
-        // Jump back to loop condition
-        builder->CreateBr(loop_block);
-    }
-
-    // The loop_merge_block
-    {
-        builder->SetInsertPoint(loop_merge_block);
-        // Load final value of last_non_zero
-        llvm::Value *const final_last_zero = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "final_last_zero");
-        // Get pointer to buffer[last_non_zero]
-        llvm::Value *const last_char_ptr = builder->CreateGEP(builder->getInt8Ty(), buffer_ptr, final_last_zero, "last_char_ptr");
-        // Load the character
-        llvm::Value *const last_char = IR::aligned_load(*builder, builder->getInt8Ty(), last_char_ptr, "last_char");
-        // Check if the character is '.'
-        llvm::Value *const is_dot = builder->CreateICmpEQ(last_char, llvm::ConstantInt::get(builder->getInt8Ty(), '.'), "is_dot");
-        // Branch based on whether the character is a decimal point
-        builder->CreateCondBr(is_dot, decimal_case_block, return_block);
-    }
-
-    // The decimal_case_block - handle case where we need to remove decimal point
-    {
-        builder->SetInsertPoint(decimal_case_block);
-        // Decrement last_non_zero one more time
-        llvm::Value *const decimal_last_zero = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "decimal_last_zero");
-        llvm::Value *const adjusted_last_zero = builder->CreateSub( //
-            decimal_last_zero,                                      //
-            llvm::ConstantInt::get(builder->getInt32Ty(), 1),       //
-            "adjusted_last_zero"                                    //
-        );
-        IR::aligned_store(*builder, adjusted_last_zero, last_non_zero);
-        // Branch to return block
-        builder->CreateBr(return_block);
-    }
-
-    // The return_block
-    {
-        builder->SetInsertPoint(return_block);
-        // Calculate final length: last_non_zero + 1
-        llvm::Value *const final_last_zero = IR::aligned_load(*builder, builder->getInt32Ty(), last_non_zero, "final_last_zero");
-        llvm::Value *const final_len = builder->CreateAdd(final_last_zero, llvm::ConstantInt::get(builder->getInt32Ty(), 1), "final_len");
-        // Convert to i64 for init_str
-        llvm::Value *const final_len_i64 = builder->CreateZExt(final_len, builder->getInt64Ty(), "final_len_i64");
-        // Call init_str with buffer and calculated length
-        llvm::Value *const result = builder->CreateCall(init_str_fn, {buffer_ptr, final_len_i64}, "result");
-        // Return the string
-        builder->CreateRet(result);
-    }
+    llvm::Value *const decimal = builder->CreateCall(to_decimal_fn, {c, q, is_closer}, "decimal");
+    llvm::Value *const digits = builder->CreateExtractValue(decimal, {0}, "digits");
+    llvm::Value *const exponent = builder->CreateExtractValue(decimal, {1}, "exponent");
+    llvm::Value *const result = builder->CreateCall(                                               //
+        format_decimal_fn, {is_negative, digits, exponent, builder->getInt64(max_point)}, "result" //
+    );
+    builder->CreateRet(result);
 }
 
 void Generator::Module::TypeCast::generate_opaque_to_str(llvm::IRBuilder<> *builder, llvm::Module *module, const bool only_declarations) {
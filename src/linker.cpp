@@ -2,6 +2,7 @@
 #include "colors.hpp"
 #include "generator/generator.hpp"
 #include "globals.hpp"
+#include "io.hpp"
 
 #include <lld/Common/Driver.h>
 #include <llvm/Object/ArchiveWriter.h>
@@ -10,6 +11,11 @@
 
 #include <iostream>
 
+#ifndef __WIN32__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 // #define __WIN32__
 
 #ifdef __WIN32__
@@ -115,6 +121,84 @@ bool Linker::link(                                       //
     return false;
 }
 
+bool Linker::link(                                       //
+    const llvm::MemoryBufferRef program_object,          //
+    const std::vector<std::filesystem::path> &obj_files, //
+    const std::filesystem::path &output_file,            //
+    const std::vector<std::string> &flags,               //
+    const bool is_static                                 //
+) {
+    std::vector<std::filesystem::path> inputs;
+    inputs.reserve(obj_files.size() + 1);
+#ifndef __WIN32__
+    // LLD only reads its inputs from paths, so on Linux the object is handed to it as an anonymous in-memory file which never touches the
+    // disk. lld-link would parse a '/proc/...' path as an option, so this is only done for ELF targets
+    if (COMPILATION_TARGET != Target::WINDOWS) {
+        const int fd = memfd_create("flint_program", MFD_CLOEXEC);
+        if (fd != -1) {
+            const char *data = program_object.getBufferStart();
+            size_t remaining = program_object.getBufferSize();
+            while (remaining > 0) {
+                const ssize_t written = ::write(fd, data, remaining);
+                if (written <= 0) {
+                    break;
+                }
+                data += written;
+                remaining -= static_cast<size_t>(written);
+            }
+            if (remaining == 0) {
+                inputs.emplace_back("/proc/self/fd/" + std::to_string(fd));
+                inputs.insert(inputs.end(), obj_files.begin(), obj_files.end());
+                const bool result = link(inputs, output_file, flags, is_static);
+                close(fd);
+                return result;
+            }
+            close(fd);
+        }
+    }
+#endif
+
+    // Fall back to a temporary object file next to the executable
+    const std::filesystem::path obj_file = output_file.string() + get_object_file_ending();
+    if (!write_object_file(program_object, obj_file)) {
+        return false;
+    }
+    inputs.emplace_back(obj_file);
+    inputs.insert(inputs.end(), obj_files.begin(), obj_files.end());
+    const bool result = link(inputs, output_file, flags, is_static);
+    IO::remove_with_retry(obj_file);
+    return result;
+}
+
+std::string Linker::get_object_file_ending() {
+    switch (COMPILATION_TARGET) {
+        case Target::NATIVE:
+#ifdef __WIN32__
+            return ".obj";
+#else
+            return ".o";
+#endif
+        case Target::LINUX:
+            return ".o";
+        case Target::WINDOWS:
+            return ".obj";
+    }
+    UNREACHABLE();
+    return ".o";
+}
+
+bool Linker::write_object_file(const llvm::MemoryBufferRef object, const std::filesystem::path &obj_file) {
+    std::error_code EC;
+    llvm::raw_fd_ostream dest(obj_file.string(), EC, llvm::sys::fs::OF_None);
+    if (EC) {
+        llvm::errs() << "Could not open file: " << EC.message() << "\n";
+        return false;
+    }
+    dest << object.getBuffer();
+    dest.flush();
+    return !dest.has_error();
+}
+
 bool Linker::create_static_library(const std::vector<std::filesystem::path> &obj_files, const std::filesystem::path &output_file) {
     // Create archive members from object files
     std::vector<llvm::NewArchiveMember> newMembers;
@@ -5,6 +5,7 @@
 #include "parser/parser.hpp"
 #include "profiler.hpp"
 #include "resolver/resolver.hpp"
+#include "time_trace.hpp"
 
 #include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/IR/LLVMContext.h>
@@ -19,6 +20,16 @@
 
 std::filesystem::path main_file_path;
 
+/// @function `write_time_trace`
+/// @brief Writes the recorded time trace to the file given by the `--time-trace` flag, if the flag was set
+///
+/// @param `clp` The parsed command line arguments
+static void write_time_trace(const CLIParserMain &clp) {
+    if (clp.time_trace && !TimeTrace::write(clp.time_trace_file_path)) {
+        std::cerr << "Error: Could not write the time trace to '" << clp.time_trace_file_path.string() << "'" << std::endl;
+    }
+}
+
 int main(int argc, char *argv[]) {
     // Parse all the cli arguments
     CLIParserMain clp(argc, argv);
@@ -44,11 +55,15 @@ int main(int argc, char *argv[]) {
 
     main_file_path = clp.source_file_path;
 
+    if (clp.time_trace) {
+        TimeTrace::enable();
+    }
     Profiler::start_task("ALL");
     const auto &dep_graph = Parser::parse_program(clp.source_file_path, clp.test, clp.parallel);
     if (!dep_graph.has_value()) {
         Parser::clear_instances();
         Profiler::end_task("ALL");
+        write_time_trace(clp);
         FIP::shutdown();
         return 1;
     }
@@ -57,6 +72,7 @@ int main(int argc, char *argv[]) {
     if (DEBUG_MODE && NO_GENERATION) {
         FIP::shutdown();
         Profiler::end_task("ALL");
+        write_time_trace(clp);
         if (PRINT_PROFILE_RESULTS) {
             Profiler::print_results(Profiler::TimeUnit::MICS);
         }
@@ -74,6 +90,7 @@ int main(int argc, char *argv[]) {
     if (!program.has_value()) {
         Parser::clear_instances();
         Profiler::end_task("ALL");
+        write_time_trace(clp);
         FIP::shutdown();
         return 1;
     }
@@ -84,6 +101,7 @@ int main(int argc, char *argv[]) {
         std::error_code EC;
         llvm::raw_fd_ostream ll_file(clp.ir_file_path.string(), EC);
         if (!EC) {
+            ll_file << Generator::get_cold_path_statistics(program.value().get());
             ll_file << Generator::resolve_ir_comments(Generator::get_module_ir_string(program.value().get()));
             ll_file.close();
         }
@@ -93,6 +111,7 @@ int main(int argc, char *argv[]) {
             Resolver::clear();
             FIP::shutdown();
             Profiler::end_task("ALL");
+            write_time_trace(clp);
             program.value()->dropAllReferences();
             program.value().reset();
             return 1;
@@ -102,6 +121,7 @@ int main(int argc, char *argv[]) {
     Resolver::clear();
     FIP::shutdown();
     Profiler::end_task("ALL");
+    write_time_trace(clp);
     if (PRINT_PROFILE_RESULTS) {
         Profiler::print_results(Profiler::TimeUnit::MICS);
     }
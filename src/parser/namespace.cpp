@@ -22,19 +22,21 @@
 #include "parser/type/vector_type.hpp"
 
 #include <algorithm>
+#include <mutex>
 
 std::optional<std::shared_ptr<Type>> Namespace::get_type_from_str(const std::string &type_str) const {
     // First check the global types since they are the most common
     if (const auto type = Type::get_type_from_str(type_str)) {
         return type;
     }
+    std::shared_lock<std::shared_mutex> lock(types_mutex);
     // Check the public types of this namespace
-    if (public_symbols.types.find(type_str) != public_symbols.types.end()) {
-        return public_symbols.types.at(type_str);
+    if (const auto public_it = public_symbols.types.find(type_str); public_it != public_symbols.types.end()) {
+        return public_it->second;
     }
     // If it's not a public type maybe it's a private type
-    if (private_symbols.types.find(type_str) != private_symbols.types.end()) {
-        return private_symbols.types.at(type_str);
+    if (const auto private_it = private_symbols.types.find(type_str); private_it != private_symbols.types.end()) {
+        return private_it->second;
     }
     return std::nullopt;
 }
@@ -147,7 +149,16 @@ std::vector<const FunctionNode *> Namespace::get_functions_with_name( //
 
 std::optional<std::shared_ptr<Type>> Namespace::get_type(const token_slice &tokens) {
     ASSERT(tokens.first != tokens.second);
-    const std::string type_str = Lexer::to_string(tokens);
+    // Single-token types are by far the most common ones, so their string is taken directly from the token instead of going through the
+    // stringstream of `Lexer::to_string`
+    std::string type_str;
+    if (std::next(tokens.first) != tokens.second) {
+        type_str = Lexer::to_string(tokens);
+    } else if (tokens.first->token == TOK_TYPE) {
+        type_str = tokens.first->type->to_string();
+    } else {
+        type_str = std::string(tokens.first->lexme);
+    }
     // Check if the map already contains the given key
     std::optional<std::shared_ptr<Type>> type = get_type_from_str(type_str);
     if (type.has_value()) {
@@ -159,6 +170,7 @@ std::optional<std::shared_ptr<Type>> Namespace::get_type(const token_slice &toke
         return std::nullopt;
     }
     if (type.value()->get_variation() == Type::Variation::UNKNOWN) {
+        std::unique_lock<std::shared_mutex> lock(types_mutex);
         public_symbols.unknown_types[type_str] = type.value();
         return public_symbols.unknown_types.at(type_str);
     }
@@ -166,8 +178,9 @@ std::optional<std::shared_ptr<Type>> Namespace::get_type(const token_slice &toke
         Type::add_type(type.value());
         return type.value();
     }
-    public_symbols.types[type_str] = type.value();
-    return public_symbols.types.at(type_str);
+    // Another thread could have created the same type in the meantime, in that case the already stored type is returned
+    std::unique_lock<std::shared_mutex> lock(types_mutex);
+    return public_symbols.types.emplace(type_str, type.value()).first->second;
 }
 
 bool Namespace::add_type(const std::shared_ptr<Type> &type) {
@@ -186,13 +199,8 @@ bool Namespace::add_type(const std::shared_ptr<Type> &type) {
 
     // If it contains user-defined types we check if it's already present in the public type section of this file and if it's not
     // contained yet we add it
-    if (public_symbols.types.find(type_string) != public_symbols.types.end()) {
-        return false;
-    }
-
-    // Add the type to the public section of the namespace
-    public_symbols.types[type_string] = type;
-    return true;
+    std::unique_lock<std::shared_mutex> lock(types_mutex);
+    return public_symbols.types.emplace(type_string, type).second;
 }
 
 bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
@@ -213,6 +221,8 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
             if (!resolve_type(array_type->type)) {
                 return false;
             }
+            // The contained type could have been replaced, so the intern key of the type could have changed
+            type->intern();
             break;
         }
         case Type::Variation::FN: {
@@ -231,11 +241,12 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
                 if (!resolve_type(error_type)) {
                     return false;
                 }
-                if (error_type->to_string() != "anyerror" && error_type->get_variation() != Type::Variation::ERROR_SET) {
+                if (!error_type->is(Type::Builtin::ANYERROR) && error_type->get_variation() != Type::Variation::ERROR_SET) {
                     THROW_BASIC_ERR(ERR_PARSING);
                     return false;
                 }
             }
+            type->intern();
             break;
         }
         case Type::Variation::GROUP: {
@@ -245,6 +256,7 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
                     return false;
                 }
             }
+            type->intern();
             break;
         }
         case Type::Variation::OPTIONAL: {
@@ -252,6 +264,7 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
             if (!resolve_type(optional_type->base_type)) {
                 return false;
             }
+            type->intern();
             break;
         }
         case Type::Variation::POINTER: {
@@ -259,6 +272,7 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
             if (!resolve_type(pointer_type->base_type)) {
                 return false;
             }
+            type->intern();
             break;
         }
         case Type::Variation::TUPLE: {
@@ -268,6 +282,7 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
                     return false;
                 }
             }
+            type->intern();
             break;
         }
         case Type::Variation::UNKNOWN: {
@@ -325,6 +340,7 @@ bool Namespace::resolve_type(std::shared_ptr<Type> &type) {
                     return false;
                 }
             }
+            type->intern();
             break;
         }
     }
@@ -475,7 +491,7 @@ std::optional<std::shared_ptr<Type>> Namespace::create_type(const token_slice &t
                     }
                     if (all_types_same) {
                         // Its a vector-type but defined as a tuple, which is not valid
-                        const Hash &file_hash = Resolver::file_ids.at(tokens_mut.first->file_id);
+                        const Hash &file_hash = Resolver::get_file_hash(tokens_mut.first->file_id);
                         THROW_ERR(ErrTypeTupleVectorOverlap, ERR_PARSING, file_hash, tokens);
                         return std::nullopt;
                     }
@@ -641,7 +657,7 @@ std::optional<std::shared_ptr<Type>> Namespace::create_type(const token_slice &t
                 return_types.emplace_back(type.value());
                 return_tokens.first = type_tokens.second;
             }
-            if (return_types.size() == 1 && return_types.front()->to_string() == "void") {
+            if (return_types.size() == 1 && return_types.front()->is(Type::Builtin::VOID)) {
                 return_types.clear();
             }
             return std::make_shared<FnType>(params, return_types, error_types);
@@ -21,12 +21,15 @@
 #include "profiler.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 std::vector<Parser> Parser::instances;
@@ -172,7 +175,10 @@ std::optional<FileNode *> Parser::parse() {
     }
     file_node_ptr->file_namespace->file_node = file_node_ptr.get();
     Lexer lexer(file, *source_code.get());
-    file_node_ptr->tokens = lexer.scan();
+    {
+        PROFILE_SCOPE("Lex file '" + file.filename().string() + "'");
+        file_node_ptr->tokens = lexer.scan();
+    }
     if (file_node_ptr->tokens.empty()) {
         return std::nullopt;
     }
@@ -214,6 +220,14 @@ std::optional<std::shared_ptr<DepNode>> Parser::parse_program( //
     const bool parse_parallel                                  //
 ) {
     Profiler::start_task("Parser::parse_program", true);
+    phase_timings.clear();
+    auto phase_start = std::chrono::steady_clock::now();
+    const auto end_phase = [&phase_start](const std::string &name) {
+        const auto phase_end = std::chrono::steady_clock::now();
+        const uint64_t duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(phase_end - phase_start).count();
+        phase_timings.push_back(PhaseTiming{name, duration_ns, duration_ns, ""});
+        phase_start = phase_end;
+    };
     Type::init_types();
     Parser::init_core_modules();
     std::optional<Parser *> parser = Parser::create(path);
@@ -227,6 +241,7 @@ std::optional<std::shared_ptr<DepNode>> Parser::parse_program( //
         std::cerr << RED << "Error" << DEFAULT << ": Failed to parse file " << YELLOW << path.filename() << DEFAULT << std::endl;
         return std::nullopt;
     }
+    end_phase("Parse main file");
     const auto dep_graph = Resolver::create_dependency_graph(file.value(), parse_parallel);
     if (!dep_graph.has_value()) {
         std::cerr << RED << "Error" << DEFAULT << ": Failed to create dependency graph" << std::endl;
@@ -237,12 +252,15 @@ std::optional<std::shared_ptr<DepNode>> Parser::parse_program( //
         THROW_ERR(ErrDefNoMainFunction, ERR_PARSING, Hash(path));
         return std::nullopt;
     }
+    end_phase("Create dependency graph");
     if (!Parser::resolve_all_imports()) {
         return std::nullopt;
     }
+    end_phase("Resolve imports");
     if (!Parser::resolve_all_unknown_types()) {
         return std::nullopt;
     }
+    end_phase("Resolve unknown types");
     if (PRINT_DEP_TREE) {
         Debug::Dep::print_dep_tree(0, dep_graph.value());
     }
@@ -250,27 +268,41 @@ std::optional<std::shared_ptr<DepNode>> Parser::parse_program( //
     if (!parsed_successful) {
         return std::nullopt;
     }
+    end_phase("Parse data modules");
     parsed_successful = Parser::parse_all_open_objects(parse_parallel);
     if (!parsed_successful) {
         return std::nullopt;
     }
-    parsed_successful = Parser::parse_all_open_functions(parse_parallel);
-    if (!parsed_successful) {
-        return std::nullopt;
-    }
-    if (is_test) {
-        bool parsed_tests_successful = Parser::parse_all_open_tests(parse_parallel);
-        if (!parsed_tests_successful) {
+    end_phase("Parse objects");
+    if (parse_parallel) {
+        // All signatures are known now, so the bodies of every file can be parsed and analyzed without any further global barrier
+        if (!Parser::parse_and_analyze_bodies(is_test)) {
             return std::nullopt;
         }
-    }
-    // Analyze all files
-    for (auto &instance : Parser::instances) {
-        if (!Analyzer::analyze_file(instance)) {
+    } else {
+        parsed_successful = Parser::parse_all_open_functions(parse_parallel);
+        if (!parsed_successful) {
             return std::nullopt;
         }
+        end_phase("Parse functions");
+        if (is_test) {
+            bool parsed_tests_successful = Parser::parse_all_open_tests(parse_parallel);
+            if (!parsed_tests_successful) {
+                return std::nullopt;
+            }
+            end_phase("Parse tests");
+        }
+        // Analyze all files
+        if (!Analyzer::analyze_program()) {
+            return std::nullopt;
+        }
+        end_phase("Analyze files");
     }
+    Analyzer::assign_dense_error_ids();
     Profiler::end_task("Parser::parse_program");
+    if (PRINT_FRONTEND_TIMINGS) {
+        print_phase_timings();
+    }
 
     if (PRINT_AST) {
         Debug::AST::print_all_files();
@@ -302,9 +334,10 @@ std::optional<std::shared_ptr<DepNode>> Parser::parse_program( //
     return dep_graph;
 }
 
-bool Parser::resolve_all_imports() {
-    PROFILE_CUMULATIVE("Parser::resolve_all_imports");
-    for (const auto &instance : instances) {
+bool Parser::resolve_all_imports(const size_t first_instance) {
+    PROFILE_SCOPE("Resolve all imports");
+    for (size_t i = first_instance; i < instances.size(); i++) {
+        const Parser &instance = instances[i];
         const auto &file_namespace = instance.file_node_ptr->file_namespace;
         const auto &imports = file_namespace->public_symbols.imports;
         for (const auto &import : imports) {
@@ -391,10 +424,11 @@ bool Parser::resolve_all_imports() {
     return true;
 }
 
-bool Parser::resolve_all_unknown_types() {
-    PROFILE_CUMULATIVE("Parser::resolve_all_unknown_types");
+bool Parser::resolve_all_unknown_types(const size_t first_instance) {
+    PROFILE_SCOPE("Resolve all unknown types");
     // First go through all the parameters of the function and resolve their type if they are of unknown type
-    for (auto &parser : instances) {
+    for (size_t i = first_instance; i < instances.size(); i++) {
+        Parser &parser = instances[i];
         Namespace *file_namespace = parser.file_node_ptr->file_namespace.get();
         for (auto &definition : file_namespace->public_symbols.definitions) {
             // Resolve all types of the definitions first
@@ -532,6 +566,36 @@ bool Parser::resolve_all_unknown_types() {
     return true;
 }
 
+std::vector<Parser> Parser::remove_instances(const std::unordered_set<Hash> &file_hashes) {
+    const FunctionNode *main = main_function.load();
+    if (main != nullptr && file_hashes.contains(main->file_hash)) {
+        main_function.store(nullptr, std::memory_order_release);
+    }
+    {
+        std::lock_guard<std::mutex> lock(parsed_tests_mutex);
+        std::erase_if(parsed_tests, [&file_hashes](const auto &parsed_test) { return file_hashes.contains(parsed_test.first->file_hash); });
+    }
+    // The kept instances are moved into a new list, as the instances cannot be erased in place. Just like in `clear_instances`, the open
+    // lists of the removed instances are cleared before the instances themselves are destroyed
+    std::vector<Parser> kept_instances;
+    std::vector<Parser> removed_instances;
+    kept_instances.reserve(instances.size());
+    for (auto &instance : instances) {
+        if (!file_hashes.contains(instance.file_hash)) {
+            kept_instances.emplace_back(std::move(instance));
+            continue;
+        }
+        TestNode::clear_test_names(instance.file_name);
+        instance.open_functions_list.clear();
+        instance.open_object_list.clear();
+        instance.open_data_list.clear();
+        instance.open_tests_list.clear();
+        removed_instances.emplace_back(std::move(instance));
+    }
+    instances = std::move(kept_instances);
+    return removed_instances;
+}
+
 std::vector<FunctionNode *> Parser::get_open_functions() {
     PROFILE_CUMULATIVE("Parser::get_open_functions");
     std::vector<FunctionNode *> open_function_list;
@@ -1298,12 +1362,10 @@ bool Parser::parse_open_function(Parser &parser, FunctionNode *function, std::ve
     return true;
 }
 
-bool Parser::parse_all_open_functions(const bool parse_parallel, const std::optional<Hash> &only_file) {
-    PROFILE_THREADED_SCOPE("Parse Open Functions", parse_parallel);
-
+std::optional<std::vector<Parser::open_function>> Parser::collect_open_functions(const std::optional<Hash> &only_file) {
     // Collect all open functions
     Profiler::start_task("Collect all open functions");
-    std::vector<std::tuple<Parser &, FunctionNode *, std::vector<Line>>> open_functions;
+    std::vector<open_function> open_functions;
     for (auto &parser : Parser::instances) {
         if (only_file.has_value() && parser.file_hash.value != only_file.value().value) {
             // Skip all functions of all files other than the provided `only_file`
@@ -1362,11 +1424,22 @@ bool Parser::parse_all_open_functions(const bool parse_parallel, const std::opti
             parser.file_hash, function->line, function->column, function->length, err_type_name, "anyerror", err_values, default_values //
         );
         if (!parser.file_node_ptr->add_error(error_node)) {
-            return false;
+            return std::nullopt;
         }
     }
     Profiler::end_task("Create all anonymous error sets");
 
+    return open_functions;
+}
+
+bool Parser::parse_all_open_functions(const bool parse_parallel, const std::optional<Hash> &only_file) {
+    PROFILE_THREADED_SCOPE("Parse Open Functions", parse_parallel);
+    std::optional<std::vector<open_function>> collected_functions = collect_open_functions(only_file);
+    if (!collected_functions.has_value()) {
+        return false;
+    }
+    auto &open_functions = collected_functions.value();
+
     bool result = true;
     if (parse_parallel) {
         // Enqueue tasks in the global thread pool
@@ -1413,12 +1486,10 @@ bool Parser::parse_open_test(Parser &parser, TestNode *test, std::vector<Line> b
     return true;
 }
 
-bool Parser::parse_all_open_tests(const bool parse_parallel) {
-    PROFILE_THREADED_SCOPE("Parse Open Tests", parse_parallel);
-
+std::vector<Parser::open_test> Parser::collect_open_tests() {
     // Collect all open tests
     Profiler::start_task("Collect all open tests");
-    std::vector<std::tuple<Parser &, TestNode *, std::vector<Line>>> open_tests;
+    std::vector<open_test> open_tests;
     for (auto &parser : Parser::instances) {
         while (auto next = parser.get_next_open_test()) {
             auto &[test, body] = next.value();
@@ -1433,6 +1504,12 @@ bool Parser::parse_all_open_tests(const bool parse_parallel) {
         parser.collapse_types_in_lines(body, parser.file_node_ptr->tokens);
     }
     Profiler::end_task("Refine test body lines");
+    return open_tests;
+}
+
+bool Parser::parse_all_open_tests(const bool parse_parallel) {
+    PROFILE_THREADED_SCOPE("Parse Open Tests", parse_parallel);
+    std::vector<open_test> open_tests = collect_open_tests();
 
     bool result = true;
     if (parse_parallel) {
@@ -1456,6 +1533,173 @@ bool Parser::parse_all_open_tests(const bool parse_parallel) {
     return result;
 }
 
+bool Parser::parse_and_analyze_bodies(const bool is_test) {
+    PROFILE_THREADED_SCOPE("Parse and analyze bodies", true);
+    const auto stage_start = std::chrono::steady_clock::now();
+    std::optional<std::vector<open_function>> open_functions = collect_open_functions();
+    if (!open_functions.has_value()) {
+        return false;
+    }
+    std::vector<open_test> open_tests;
+    if (is_test) {
+        open_tests = collect_open_tests();
+    }
+    const auto prelude_end = std::chrono::steady_clock::now();
+
+    // The state of a single file within the task graph. Every body is a task, the last body task of a file to finish enqueues the analysis
+    // tasks of that file. Every task writes only into its own result, error buffer and duration slot
+    struct AnalysisRange {
+        size_t begin;
+        size_t end;
+        bool result{false};
+        ErrorBuffer errors{};
+        uint64_t duration_ns{0};
+    };
+    struct FileStage {
+        Parser *parser;
+        std::vector<std::function<bool()>> bodies;
+        std::vector<char> body_results;
+        std::vector<ErrorBuffer> body_errors;
+        std::vector<uint64_t> body_durations_ns;
+        std::vector<AnalysisRange> analysis;
+        std::atomic<size_t> pending_bodies{0};
+    };
+    std::vector<std::unique_ptr<FileStage>> stages;
+    stages.reserve(instances.size());
+    std::unordered_map<const Parser *, FileStage *> stage_of;
+    for (auto &instance : instances) {
+        stages.emplace_back(std::make_unique<FileStage>());
+        stages.back()->parser = &instance;
+        stage_of[&instance] = stages.back().get();
+    }
+    for (auto &[parser, function, body] : open_functions.value()) {
+        stage_of.at(&parser)->bodies.emplace_back([&parser, function, &body]() { return parse_open_function(parser, function, body); });
+    }
+    for (auto &[parser, test, body] : open_tests) {
+        stage_of.at(&parser)->bodies.emplace_back([&parser, test, &body]() { return parse_open_test(parser, test, body); });
+    }
+
+    const auto enqueue_analysis = [](FileStage &stage) {
+        for (const auto &[begin, end] : Analyzer::get_analysis_ranges(*stage.parser)) {
+            stage.analysis.push_back(AnalysisRange{begin, end});
+        }
+        for (auto &range : stage.analysis) {
+            thread_pool.enqueue([&stage, &range]() {
+                const auto start = std::chrono::steady_clock::now();
+                ErrorBufferScope error_scope(range.errors);
+                range.result = Analyzer::analyze_definitions(*stage.parser, range.begin, range.end);
+                range.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            });
+        }
+    };
+    for (auto &stage_ptr : stages) {
+        FileStage &stage = *stage_ptr;
+        const size_t body_count = stage.bodies.size();
+        stage.body_results.assign(body_count, false);
+        stage.body_errors.resize(body_count);
+        stage.body_durations_ns.assign(body_count, 0);
+        if (body_count == 0) {
+            enqueue_analysis(stage);
+            continue;
+        }
+        stage.pending_bodies.store(body_count, std::memory_order_relaxed);
+        for (size_t i = 0; i < body_count; i++) {
+            thread_pool.enqueue([&stage, i, &enqueue_analysis]() {
+                const auto start = std::chrono::steady_clock::now();
+                {
+                    ErrorBufferScope error_scope(stage.body_errors[i]);
+                    stage.body_results[i] = stage.bodies[i]();
+                }
+                stage.body_durations_ns[i] =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+                if (stage.pending_bodies.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    return;
+                }
+                // This was the last body of the file, it can be analyzed now if all of its bodies were parsed successfully
+                for (const char body_result : stage.body_results) {
+                    if (!body_result) {
+                        return;
+                    }
+                }
+                enqueue_analysis(stage);
+            });
+        }
+    }
+    thread_pool.waitForAllTasks();
+    const auto stage_end = std::chrono::steady_clock::now();
+
+    // Emit all body errors in file and body order. If any body failed to parse no analysis errors are emitted, just like the barrier-based
+    // front-end would not have started analyzing at all
+    bool bodies_parsed = true;
+    for (auto &stage : stages) {
+        for (size_t i = 0; i < stage->bodies.size(); i++) {
+            stage->body_errors[i].flush();
+            bodies_parsed = bodies_parsed && stage->body_results[i];
+        }
+    }
+    bool result = bodies_parsed;
+    if (bodies_parsed) {
+        for (auto &stage : stages) {
+            for (auto &range : stage->analysis) {
+                // Only emit the errors up to the first failing range, the sequential analysis would have stopped there too
+                if (result) {
+                    range.errors.flush();
+                }
+                result = result && range.result;
+            }
+        }
+    }
+
+    // The bodies and analysis ranges of one file are the only tasks which wait on each other, so the phase cannot be faster than the
+    // slowest body followed by the slowest analysis range of any file, no matter how many workers there are
+    const uint64_t prelude_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(prelude_end - stage_start).count();
+    uint64_t lower_bound_ns = 0;
+    std::string bounding_file;
+    for (const auto &stage : stages) {
+        uint64_t slowest_body_ns = 0;
+        for (const uint64_t duration : stage->body_durations_ns) {
+            slowest_body_ns = std::max(slowest_body_ns, duration);
+        }
+        uint64_t slowest_analysis_ns = 0;
+        for (const auto &range : stage->analysis) {
+            slowest_analysis_ns = std::max(slowest_analysis_ns, range.duration_ns);
+        }
+        if (slowest_body_ns + slowest_analysis_ns > lower_bound_ns) {
+            lower_bound_ns = slowest_body_ns + slowest_analysis_ns;
+            bounding_file = stage->parser->file_name;
+        }
+    }
+    phase_timings.push_back(PhaseTiming{"Collect open bodies", prelude_ns, prelude_ns, ""});
+    phase_timings.push_back(PhaseTiming{
+        "Parse and analyze bodies",
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stage_end - prelude_end).count()),
+        lower_bound_ns,
+        bounding_file,
+    });
+    return result;
+}
+
+void Parser::print_phase_timings() {
+    std::cout << YELLOW << "[Info] Front-end phase timings" << DEFAULT << "\n";
+    uint64_t total_wall_ns = 0;
+    uint64_t total_lower_bound_ns = 0;
+    for (const auto &timing : phase_timings) {
+        std::cout << "-- " << timing.name << ": " << (timing.wall_ns / 1000) << " µs";
+        if (timing.lower_bound_ns != timing.wall_ns) {
+            std::cout << " (lower bound " << (timing.lower_bound_ns / 1000) << " µs";
+            if (!timing.bounding_file.empty()) {
+                std::cout << " from the bodies of '" << timing.bounding_file << "'";
+            }
+            std::cout << ")";
+        }
+        std::cout << "\n";
+        total_wall_ns += timing.wall_ns;
+        total_lower_bound_ns += timing.lower_bound_ns;
+    }
+    // The phases before the body phase are global barriers, so their whole wall time is part of the lower bound
+    std::cout << "-- Total: " << (total_wall_ns / 1000) << " µs (lower bound " << (total_lower_bound_ns / 1000) << " µs)\n" << std::endl;
+}
+
 std::optional<std::tuple<std::string, overloads, std::optional<std::string>>> Parser::get_builtin_function( //
     const std::string &function_name,                                                                       //
     const std::unordered_map<std::string, ImportNode *const> &imported_core_modules                         //
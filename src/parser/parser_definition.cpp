@@ -238,7 +238,7 @@ std::optional<FunctionNode> Parser::create_function(
             const token_slice err_tokens = {arg_start_it, arg_end_it};
             THROW_ERR(ErrFnMainTooManyArgs, ERR_PARSING, file_hash, err_tokens);
             return std::nullopt;
-        } else if (parameters.size() == 1 && parameters.front().type->to_string() != "str[]") {
+        } else if (parameters.size() == 1 && !parameters.front().type->is(Type::Builtin::STR_ARRAY)) {
             // Wrong main argument type
             const token_slice err_tokens = {arg_start_it, arg_end_it};
             THROW_ERR(ErrFnMainWrongArgType, ERR_PARSING, file_hash, err_tokens, parameters.front().type);
@@ -246,7 +246,7 @@ std::optional<FunctionNode> Parser::create_function(
         }
 
         // The main funcition is not allowed to return anything except i32
-        if (!return_types.empty() && (return_types.size() > 1 || return_types.front()->to_string() != "i32")) {
+        if (!return_types.empty() && (return_types.size() > 1 || !return_types.front()->is(Type::Builtin::I32))) {
             const token_slice err_tokens = {ret_start_it, std::prev(definition.second)};
             THROW_ERR(ErrFnMainInvalid, ERR_PARSING, file_hash, err_tokens);
             return std::nullopt;
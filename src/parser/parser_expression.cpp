@@ -400,9 +400,11 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_variable(std::shar
             continue;
         }
         const std::string name(tok->lexme);
-        if (scope->variables.find(name) != scope->variables.end()) {
-            return std::make_unique<VariableNode>(                                                                             //
-                file_hash, get_pos_triple(tokens), name, scope->variables.at(name).type, !scope->variables.at(name).is_mutable //
+        const auto variable_it = scope->variables.find(name);
+        if (variable_it != scope->variables.end()) {
+            const Scope::Variable &variable = variable_it->second;
+            return std::make_unique<VariableNode>(                                                          //
+                file_hash, get_pos_triple(tokens), name, variable.type, !variable.is_mutable, variable.slot //
             );
         }
         if (scope->captured_object_identifiers.find(name) == scope->captured_object_identifiers.end()) {
@@ -432,8 +434,8 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_variable(std::shar
                     THROW_BASIC_ERR(ERR_PARSING);
                     return std::nullopt;
                 }
-                std::unique_ptr<ExpressionNode> base_expr = std::make_unique<VariableNode>( //
-                    file_hash, get_pos_triple(tokens), "self", self.type, !self.is_mutable  //
+                std::unique_ptr<ExpressionNode> base_expr = std::make_unique<VariableNode>(           //
+                    file_hash, get_pos_triple(tokens), "self", self.type, !self.is_mutable, self.slot //
                 );
                 std::unique_ptr<ExpressionNode> access = std::make_unique<DataAccessNode>( //
                     file_hash, get_pos_triple(tokens),                                     //
@@ -450,8 +452,8 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_variable(std::shar
                 ASSERT(self.type->get_variation() == Type::Variation::OBJECT);
                 // Store the name of the parent accessor in the variable, it will be changed to `self` later in the
                 // `create_field_access_base` function. We do this in order to be able to tell which parent was accessed in the
-                // `create_field_access_base` function.
-                return std::make_unique<VariableNode>(file_hash, get_pos_triple(tokens), name, self.type, !self.is_mutable);
+                // `create_field_access_base` function. The slot is already the slot of `self` for the same reason.
+                return std::make_unique<VariableNode>(file_hash, get_pos_triple(tokens), name, self.type, !self.is_mutable, self.slot);
         }
     }
     return std::nullopt;
@@ -824,7 +826,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_string_interpolati
             auto &expr = std::get<std::unique_ptr<ExpressionNode>>(elem);
 
             // Check if it's a type.flint.str.lit literal
-            if (expr->type->to_string() == "type.flint.str.lit" && expr->get_variation() == ExpressionNode::Variation::LITERAL) {
+            if (expr->type->is(Type::Builtin::STR_LIT) && expr->get_variation() == ExpressionNode::Variation::LITERAL) {
                 auto *lit = expr->as<LiteralNode>();
                 const auto &lit_str = std::get<LitStr>(lit->value);
                 literal_value = lit_str.value;
@@ -833,7 +835,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_string_interpolati
             // Check if it's a TypeCast wrapping a type.flint.str.lit
             else if (expr->get_variation() == ExpressionNode::Variation::TYPE_CAST) {
                 auto *cast = expr->as<TypeCastNode>();
-                if (cast->expr->type->to_string() == "type.flint.str.lit" &&
+                if (cast->expr->type->is(Type::Builtin::STR_LIT) &&
                     cast->expr->get_variation() == ExpressionNode::Variation::LITERAL) {
                     auto *lit = cast->expr->as<LiteralNode>();
                     const auto &lit_str = std::get<LitStr>(lit->value);
@@ -843,7 +845,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_string_interpolati
             }
         } else { // std::unique_ptr<LiteralNode>
             auto &lit_ptr = std::get<std::unique_ptr<LiteralNode>>(elem);
-            if (lit_ptr->type->to_string() == "type.flint.str.lit" || lit_ptr->type->to_string() == "str") {
+            if (lit_ptr->type->is(Type::Builtin::STR_LIT) || lit_ptr->type->is(Type::Builtin::STR)) {
                 const auto &lit_str = std::get<LitStr>(lit_ptr->value);
                 literal_value = lit_str.value;
                 is_str_literal = true;
@@ -883,7 +885,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_string_interpolati
     if (optimized_content.size() == 1) {
         if (std::holds_alternative<std::unique_ptr<ExpressionNode>>(optimized_content[0])) {
             auto expr = std::move(std::get<std::unique_ptr<ExpressionNode>>(optimized_content[0]));
-            if (expr->type->to_string() == "type.flint.str.lit") {
+            if (expr->type->is(Type::Builtin::STR_LIT)) {
                 return expr;
             } else {
                 // Interpolating only a single expression like `$"{val}"` is not allowed, you should use `str(val)` instead
@@ -892,7 +894,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_string_interpolati
             }
         } else {
             auto lit = std::move(std::get<std::unique_ptr<LiteralNode>>(optimized_content[0]));
-            if (lit->type->to_string() == "type.flint.str.lit") {
+            if (lit->type->is(Type::Builtin::STR_LIT)) {
                 return std::make_unique<LiteralNode>(std::move(*lit));
             }
         }
@@ -948,14 +950,17 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_call_expression( /
         last_parsed_call = instance_call_node.get();
         return std::move(instance_call_node);
     } else if (ret->callable.has_value()) {
-        const auto &error_types = scope->variables.at(ret->callable.value()).type->as<FnType>()->error_types;
+        const Scope::Variable &callable = scope->variables.at(ret->callable.value());
+        const auto &error_types = callable.type->as<FnType>()->error_types;
         std::unique_ptr<CallableCallNodeExpression> callable_call_node = std::make_unique<CallableCallNodeExpression>( //
             file_hash,                                                                                                 //
             get_pos_triple(tokens),                                                                                    //
             ret->args,                                                                                                 //
             error_types,                                                                                               //
             ret->type,                                                                                                 //
-            ret->callable.value()                                                                                      //
+            ret->callable.value(),                                                                                     //
+            callable.type,                                                                                             //
+            callable.slot                                                                                              //
         );
         callable_call_node->scope_id = scope->scope_id;
         last_parsed_call = callable_call_node.get();
@@ -1661,7 +1666,7 @@ std::optional<ArrayAccessNode> Parser::create_array_access( //
         return std::nullopt;
     }
     const bool is_array_type = base_expr.value()->type->get_variation() == Type::Variation::ARRAY;
-    const bool is_str_type = base_expr.value()->type->to_string() == "str";
+    const bool is_str_type = base_expr.value()->type->is(Type::Builtin::STR);
     if (!is_array_type && !is_str_type) {
         THROW_BASIC_ERR(ERR_PARSING);
         return std::nullopt;
@@ -1754,7 +1759,7 @@ std::optional<GroupedArrayAccessNode> Parser::create_grouped_array_access( //
         return std::nullopt;
     }
     const bool is_array_type = base_expr.value()->type->get_variation() == Type::Variation::ARRAY;
-    const bool is_str_type = base_expr.value()->type->to_string() == "str";
+    const bool is_str_type = base_expr.value()->type->is(Type::Builtin::STR);
     if (!is_array_type && !is_str_type) {
         THROW_BASIC_ERR(ERR_PARSING);
         return std::nullopt;
@@ -1779,8 +1784,8 @@ std::optional<GroupedArrayAccessNode> Parser::create_grouped_array_access( //
         return_types.emplace_back(base_ty);
     }
     std::shared_ptr<Type> ret_ty = std::make_shared<GroupType>(return_types);
-    if (!Type::add_type(ret_ty)) {
-        ret_ty = Type::get_type_from_str(ret_ty->to_string()).value();
+    if (!file_node_ptr->file_namespace->add_type(ret_ty)) {
+        ret_ty = file_node_ptr->file_namespace->get_type_from_str(ret_ty->to_string()).value();
     }
     return GroupedArrayAccessNode(file_hash, get_pos_triple(tokens), base_expr.value(), ret_ty, indexing_expressions.value());
 }
@@ -1888,7 +1893,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_optional_unwrap( /
             const auto *base_array_type = optional_type->base_type->as<ArrayType>();
             result_type = base_array_type->type;
             dimensionality = base_array_type->dimensionality;
-        } else if (optional_type->base_type->to_string() != "str") {
+        } else if (!optional_type->base_type->is(Type::Builtin::STR)) {
             result_type = Type::get_primitive_type("u8");
         } else {
             THROW_BASIC_ERR(ERR_PARSING);
@@ -2322,7 +2327,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_pivot_expression(
                             tag_it++;
                             ASSERT(tag_it->token == TOK_LEFT_PAREN);
                             std::optional<std::unique_ptr<ExpressionNode>> expr = std::nullopt;
-                            if (variation_type.value()->to_string() == "void") {
+                            if (variation_type.value()->is(Type::Builtin::VOID)) {
                                 if ((tag_it + 1)->token != TOK_RIGHT_PAREN) {
                                     THROW_BASIC_ERR(ERR_PARSING);
                                     return std::nullopt;
@@ -2395,7 +2400,7 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_pivot_expression(
                 }
                 return initializer;
             } else if (tokens_mut.first->type->get_variation() == Type::Variation::VECTOR &&
-                tokens_mut.first->type->to_string() != "bool8") {
+                !tokens_mut.first->type->is(Type::Builtin::BOOL8)) {
                 // It's an explicit initializer of an vector-type
                 std::optional<std::unique_ptr<ExpressionNode>> initializer = create_initializer(ctx, scope, tokens_mut);
                 if (!initializer.has_value()) {
@@ -2452,7 +2457,10 @@ std::optional<std::unique_ptr<ExpressionNode>> Parser::create_pivot_expression(
                     if (data_type->data_node->is_shared) {
                         const std::string hash_str = data_type->data_node->file_hash.to_string();
                         const std::string mangled_name = hash_str + ".shared." + data_type->data_node->name + "." + field_name;
-                        return std::make_unique<VariableNode>(file_hash, get_pos_triple(tokens_mut), mangled_name, field->type, false);
+                        const unsigned int global_slot = scope->variables.at(mangled_name).slot;
+                        return std::make_unique<VariableNode>(                                                   //
+                            file_hash, get_pos_triple(tokens_mut), mangled_name, field->type, false, global_slot //
+                        );
                     }
                     ASSERT(field->initializer.has_value());
                     return field->initializer.value()->clone(scope->scope_id);
@@ -69,9 +69,10 @@ std::optional<std::unique_ptr<StatementNode>> Parser::create_call_statement( //
         last_parsed_call = instance_call_node.get();
         return std::move(instance_call_node);
     } else if (ret->callable.has_value()) {
-        const auto &error_types = scope->variables.at(ret->callable.value()).type->as<FnType>()->error_types;
-        std::unique_ptr<CallableCallNodeStatement> callable_call_node = std::make_unique<CallableCallNodeStatement>( //
-            file_hash, tokens, ret->args, error_types, ret->type, ret->callable.value()                              //
+        const Scope::Variable &callable = scope->variables.at(ret->callable.value());
+        const auto &error_types = callable.type->as<FnType>()->error_types;
+        std::unique_ptr<CallableCallNodeStatement> callable_call_node = std::make_unique<CallableCallNodeStatement>(        //
+            file_hash, tokens, ret->args, error_types, ret->type, ret->callable.value(), callable.type, callable.slot //
         );
         callable_call_node->scope_id = scope->scope_id;
         last_parsed_call = callable_call_node.get();
@@ -104,7 +105,7 @@ std::optional<ThrowNode> Parser::create_throw(std::shared_ptr<Scope> &scope, con
     if (!expr.has_value()) {
         return std::nullopt;
     }
-    if (expr.value()->type->get_variation() != Type::Variation::ERROR_SET && expr.value()->type->to_string() != "anyerror") {
+    if (expr.value()->type->get_variation() != Type::Variation::ERROR_SET && !expr.value()->type->is(Type::Builtin::ANYERROR)) {
         THROW_ERR(                                                                          //
             ErrExprTypeMismatch, ERR_PARSING, file_hash, get_pos_triple(expression_tokens), //
             Type::get_primitive_type("anyerror"), expr.value()->type                        //
@@ -129,7 +130,7 @@ std::optional<ReturnNode> Parser::create_return(       //
         unsigned int return_id = 0;
         for (auto it = tokens.first; it != tokens.second; ++it) {
             if (it->token == TOK_RETURN) {
-                if (std::next(it) == tokens.second && return_type->to_string() != "void") {
+                if (std::next(it) == tokens.second && !return_type->is(Type::Builtin::VOID)) {
                     // Return statement without expression for a function that returns a non-void value
                     THROW_BASIC_ERR(ERR_PARSING);
                     return std::nullopt;
@@ -141,7 +142,7 @@ std::optional<ReturnNode> Parser::create_return(       //
         token_slice expression_tokens = {tokens.first + return_id + 1, tokens.second};
         if (std::next(expression_tokens.first) == expression_tokens.second) {
             // This can be asserted because of the check above
-            ASSERT(return_type->to_string() == "void");
+            ASSERT(return_type->is(Type::Builtin::VOID));
             return ReturnNode(file_hash, tokens, expr);
         }
         expr = create_expression(_ctx_, scope, expression_tokens);
@@ -243,7 +244,7 @@ std::optional<std::unique_ptr<IfNode>> Parser::create_if(            //
         // Invalid expression inside if statement
         return std::nullopt;
     }
-    if (condition.value()->type->to_string() != "bool") {
+    if (!condition.value()->type->is(Type::Builtin::BOOL)) {
         THROW_ERR(                                                                           //
             ErrExprTypeMismatch, ERR_PARSING, file_hash, get_pos_triple(this_if_pair.first), //
             Type::get_primitive_type("bool"), condition.value()->type                        //
@@ -551,7 +552,9 @@ std::optional<std::unique_ptr<EnhForLoopNode>> Parser::create_enh_for_loop( //
         }
     }
 
-    // Add the variable(s) to the definition scope
+    // Add the variable(s) to the definition scope, their slots are resolved here so the generator never looks them up by name
+    unsigned int index_slot = 0;
+    std::optional<unsigned int> element_slot = std::nullopt;
     if (std::holds_alternative<std::string>(iterators)) {
         // We add the tuple variable to the definition scope
         const std::string tuple_name = std::get<std::string>(iterators);
@@ -580,6 +583,7 @@ std::optional<std::unique_ptr<EnhForLoopNode>> Parser::create_enh_for_loop( //
             THROW_ERR(ErrVarRedefinition, ERR_PARSING, file_hash, tuple_it->line, tuple_it->column, tuple_name);
             return std::nullopt;
         }
+        index_slot = definition_scope->variables.at(tuple_name).slot;
     } else {
         // We add the index and element variable to the definition scope
         std::shared_ptr<Type> index_type = Type::get_primitive_type("u64");
@@ -607,6 +611,10 @@ std::optional<std::unique_ptr<EnhForLoopNode>> Parser::create_enh_for_loop( //
                 THROW_ERR(ErrVarRedefinition, ERR_PARSING, file_hash, index_it->line, index_it->column, index_name.value());
                 return std::nullopt;
             }
+            index_slot = definition_scope->variables.at(index_name.value()).slot;
+        } else {
+            // The loop still needs an index counter, it just is not accessible as a variable
+            index_slot = definition_scope->reserve_variable_slot();
         }
         if (element_name.has_value()) {
             auto element_it = definition_mut.first - 3;
@@ -629,6 +637,7 @@ std::optional<std::unique_ptr<EnhForLoopNode>> Parser::create_enh_for_loop( //
                 THROW_ERR(ErrVarRedefinition, ERR_PARSING, file_hash, element_it->line, element_it->column, element_name.value());
                 return std::nullopt;
             }
+            element_slot = definition_scope->variables.at(element_name.value()).slot;
         }
     }
 
@@ -641,8 +650,8 @@ std::optional<std::unique_ptr<EnhForLoopNode>> Parser::create_enh_for_loop( //
     }
     body_scope->body = std::move(body_statements.value());
 
-    auto enh_for_node = std::make_unique<EnhForLoopNode>(                                //
-        file_hash, definition, iterators, iterable.value(), definition_scope, body_scope //
+    auto enh_for_node = std::make_unique<EnhForLoopNode>(                                                            //
+        file_hash, definition, iterators, index_slot, element_slot, iterable.value(), definition_scope, body_scope //
     );
     return enh_for_node;
 }
@@ -1070,10 +1079,6 @@ bool Parser::create_optional_switch_branches(   //
                 return false;
             }
             const auto *optional_type = switcher_type->as<OptionalType>();
-            const std::string match_str(match_tokens.first->lexme);
-            match_expressions.push_back(                                                                                           //
-                std::make_unique<SwitchMatchNode>(file_hash, get_pos_triple(match_tokens), optional_type->base_type, match_str, 1) //
-            );
             std::shared_ptr<Scope> branch_scope = std::make_shared<Scope>(scope, scope_segment);
             const unsigned int scope_id = branch_scope->scope_id;
             const std::string var_name(match_tokens.first->lexme);
@@ -1092,6 +1097,11 @@ bool Parser::create_optional_switch_branches(   //
                 THROW_BASIC_ERR(ERR_PARSING);
                 return false;
             }
+            const unsigned int match_slot = branch_scope->variables.at(var_name).slot;
+            std::unique_ptr<ExpressionNode> match_node = std::make_unique<SwitchMatchNode>(                //
+                file_hash, get_pos_triple(match_tokens), optional_type->base_type, var_name, match_slot, 1 //
+            );
+            match_expressions.push_back(std::move(match_node));
             if (!create_switch_branch_body(                                                 //
                     branch_scope, scope_segment, match_expressions, s_branches, e_branches, //
                     line_it, body, tokens, match_range.value(), is_statement)               //
@@ -1216,7 +1226,7 @@ bool Parser::create_variant_switch_branches(    //
         }
         const std::shared_ptr<Type> &access_type = possible_types.at(type_idx - 1).second;
         std::optional<std::string> access_name;
-        if (access_type->to_string() == "void") {
+        if (access_type->is(Type::Builtin::VOID)) {
             // Void typed tags are not allowed to have an accessor
             if ((match_tokens.first + 1)->token == TOK_IDENTIFIER) {
                 THROW_BASIC_ERR(ERR_PARSING);
@@ -1234,10 +1244,8 @@ bool Parser::create_variant_switch_branches(    //
             THROW_BASIC_ERR(ERR_PARSING);
             return false;
         }
-        match_expressions.push_back(                                                                                       //
-            std::make_unique<SwitchMatchNode>(file_hash, get_pos_triple(match_tokens), access_type, access_name, type_idx) //
-        );
         std::shared_ptr<Scope> branch_scope = std::make_shared<Scope>(scope, scope_segment);
+        unsigned int access_slot = 0;
         if (access_name.has_value()) {
             if (!branch_scope->add_variable(access_name.value(),
                     {
@@ -1254,7 +1262,12 @@ bool Parser::create_variant_switch_branches(    //
                 THROW_BASIC_ERR(ERR_PARSING);
                 return false;
             }
+            access_slot = branch_scope->variables.at(access_name.value()).slot;
         }
+        std::unique_ptr<ExpressionNode> match_node = std::make_unique<SwitchMatchNode>(              //
+            file_hash, get_pos_triple(match_tokens), access_type, access_name, access_slot, type_idx //
+        );
+        match_expressions.push_back(std::move(match_node));
         if (!create_switch_branch_body(                                                 //
                 branch_scope, scope_segment, match_expressions, s_branches, e_branches, //
                 line_it, body, tokens, match_range.value(), is_statement)               //
@@ -1451,6 +1464,7 @@ std::optional<std::unique_ptr<CatchNode>> Parser::create_catch( //
     }
 
     std::shared_ptr<Scope> body_scope = std::make_shared<Scope>(scope, scope_segment);
+    unsigned int err_slot = 0;
     if (err_var.has_value()) {
         // Get all the possible error types of the call and give the error value a type depending on them
         const auto &error_types = catch_base_call->error_types;
@@ -1484,6 +1498,7 @@ std::optional<std::unique_ptr<CatchNode>> Parser::create_catch( //
                 ErrVarRedefinition, ERR_PARSING, file_hash, right_of_catch.first->line, right_of_catch.first->column, err_var.value() //
             );
         }
+        err_slot = body_scope->variables.at(err_var.value()).slot;
         auto body_statements = create_body(body_scope, body);
         if (!body_statements.has_value()) {
             return std::nullopt;
@@ -1510,16 +1525,17 @@ std::optional<std::unique_ptr<CatchNode>> Parser::create_catch( //
         if (!create_variant_switch_branches(body_scope, scope_segment, s_branches, e_branches, body, switcher_type, true, false)) {
             return std::nullopt;
         }
-        std::unique_ptr<ExpressionNode> dummy_switcher = std::make_unique<VariableNode>(      //
-            file_hash, get_pos_triple(right_of_catch), "flint.value_err", switcher_type, true //
+        err_slot = body_scope->variables.at("flint.value_err").slot;
+        std::unique_ptr<ExpressionNode> dummy_switcher = std::make_unique<VariableNode>(                //
+            file_hash, get_pos_triple(right_of_catch), "flint.value_err", switcher_type, true, err_slot //
         );
         std::unique_ptr<StatementNode> switch_statement = std::make_unique<SwitchStatement>( //
             file_hash, definition, dummy_switcher, s_branches                                //
         );
         body_scope->body.push_back(std::move(switch_statement));
     }
-    auto catch_node = std::make_unique<CatchNode>(                                                        //
-        file_hash, token_slice{catch_id.value(), definition.second}, err_var, body_scope, catch_base_call //
+    auto catch_node = std::make_unique<CatchNode>(                                                                  //
+        file_hash, token_slice{catch_id.value(), definition.second}, err_var, err_slot, body_scope, catch_base_call //
     );
     return catch_node;
 }
@@ -1731,7 +1747,7 @@ std::optional<AssignmentNode> Parser::create_assignment( //
                         THROW_BASIC_ERR(ERR_PARSING);
                         return std::nullopt;
                     }
-                    return AssignmentNode(file_hash, tokens, expected_type, it_lexme, rhs.value());
+                    return AssignmentNode(file_hash, tokens, expected_type, it_lexme, scope->variables.at(it_lexme).slot, rhs.value());
                 }
                 // Parse the expression with the expected type passed into it
                 token_slice expression_tokens = {it + 2, tokens.second};
@@ -1740,7 +1756,7 @@ std::optional<AssignmentNode> Parser::create_assignment( //
                 if (!expression.has_value()) {
                     return std::nullopt;
                 }
-                return AssignmentNode(file_hash, tokens, expected_type, it_lexme, expression.value());
+                return AssignmentNode(file_hash, tokens, expected_type, it_lexme, scope->variables.at(it_lexme).slot, expression.value());
             } else {
                 return std::nullopt;
             }
@@ -1807,13 +1823,13 @@ std::optional<AssignmentNode> Parser::create_assignment_shorthand( //
                 op = TOK_DIV;
                 break;
         }
-        std::unique_ptr<ExpressionNode> var_node = std::make_unique<VariableNode>(             //
-            file_hash, get_pos_triple(token_slice{it, it + 1}), it_lexme, expected_type, false //
+        std::unique_ptr<ExpressionNode> var_node = std::make_unique<VariableNode>(                                                 //
+            file_hash, get_pos_triple(token_slice{it, it + 1}), it_lexme, expected_type, false, scope->variables.at(it_lexme).slot //
         );
         std::unique_ptr<ExpressionNode> bin_op = std::make_unique<BinaryOpNode>(      //
             file_hash, rhs_pos, op, var_node, expression.value(), expected_type, true //
         );
-        return AssignmentNode(file_hash, tokens, expected_type, it_lexme, bin_op, true);
+        return AssignmentNode(file_hash, tokens, expected_type, it_lexme, scope->variables.at(it_lexme).slot, bin_op, true);
     }
     return std::nullopt;
 }
@@ -1873,6 +1889,7 @@ std::optional<GroupDeclarationNode> Parser::create_group_declaration( //
     if (!expression.has_value()) {
         return std::nullopt;
     }
+    std::vector<unsigned int> slots(variables.size(), 0);
     switch (expression.value()->type->get_variation()) {
         default:
             THROW_BASIC_ERR(ERR_NOT_IMPLEMENTED_YET);
@@ -1908,8 +1925,9 @@ std::optional<GroupDeclarationNode> Parser::create_group_declaration( //
                         variables.at(i).second);
                     return std::nullopt;
                 }
+                slots.at(i) = scope->variables.at(variables.at(i).second).slot;
             }
-            return GroupDeclarationNode(file_hash, tokens, variables, expression.value());
+            return GroupDeclarationNode(file_hash, tokens, variables, slots, expression.value());
         }
         case Type::Variation::VECTOR: {
             const auto *vector_type = expression.value()->type->as<VectorType>();
@@ -1941,6 +1959,7 @@ std::optional<GroupDeclarationNode> Parser::create_group_declaration( //
                     );
                     return std::nullopt;
                 }
+                slots.at(i) = scope->variables.at(variables.at(i).second).slot;
             }
             std::string group_type_str = "(";
             for (unsigned int i = 0; i < vector_type->width; i++) {
@@ -1961,7 +1980,7 @@ std::optional<GroupDeclarationNode> Parser::create_group_declaration( //
                     expr_group_type = file_node_ptr->file_namespace->get_type_from_str(expr_group_type.value()->to_string()).value();
                 }
             }
-            return GroupDeclarationNode(file_hash, tokens, variables, expression.value());
+            return GroupDeclarationNode(file_hash, tokens, variables, slots, expression.value());
         }
         case Type::Variation::TUPLE: {
             const auto *tuple_type = expression.value()->type->as<TupleType>();
@@ -1997,6 +2016,7 @@ std::optional<GroupDeclarationNode> Parser::create_group_declaration( //
                     );
                     return std::nullopt;
                 }
+                slots.at(i) = scope->variables.at(variables.at(i).second).slot;
             }
             std::string group_type_str = "(";
             for (unsigned int i = 0; i < tuple_type->types.size(); i++) {
@@ -2017,7 +2037,7 @@ std::optional<GroupDeclarationNode> Parser::create_group_declaration( //
                     expr_group_type = file_node_ptr->file_namespace->get_type_from_str(expr_group_type.value()->to_string()).value();
                 }
             }
-            return GroupDeclarationNode(file_hash, tokens, variables, expression.value());
+            return GroupDeclarationNode(file_hash, tokens, variables, slots, expression.value());
         }
     }
 }
@@ -2115,7 +2135,7 @@ std::optional<DeclarationNode> Parser::create_declaration( //
                 name);
             return std::nullopt;
         }
-        return DeclarationNode(file_hash, tokens, declared_type, name, is_persistent, expr);
+        return DeclarationNode(file_hash, tokens, declared_type, name, scope->variables.at(name).slot, is_persistent, expr);
     }
 
     // Case 2 & 3: Declaration with RHS - create expression if not provided
@@ -2211,7 +2231,7 @@ std::optional<DeclarationNode> Parser::create_declaration( //
         return std::nullopt;
     }
 
-    return DeclarationNode(file_hash, tokens, final_type, name, is_persistent, rhs);
+    return DeclarationNode(file_hash, tokens, final_type, name, scope->variables.at(name).slot, is_persistent, rhs);
 }
 
 std::optional<UnaryOpStatement> Parser::create_unary_op_statement(std::shared_ptr<Scope> &scope, const token_slice &tokens) {
@@ -2293,7 +2313,7 @@ std::optional<std::unique_ptr<StatementNode>> Parser::create_data_field_assignme
         const auto &var = scope->variables.at(mangled_name);
         // A global variable cannot be defined as const
         ASSERT(var.is_mutable);
-        return std::make_unique<AssignmentNode>(file_hash, tokens, var.type, mangled_name, expression.value());
+        return std::make_unique<AssignmentNode>(file_hash, tokens, var.type, mangled_name, var.slot, expression.value());
     }
 
     // The data field base expression should be a variable expression
@@ -2846,7 +2866,9 @@ std::optional<std::unique_ptr<StatementNode>> Parser::create_statement( //
             if (!rhs_expr.has_value()) {
                 return std::nullopt;
             }
-            statement_node = std::make_unique<AssignmentNode>(file_hash, tokens, rhs_expr.value()->type, "_", rhs_expr.value());
+            statement_node = std::make_unique<AssignmentNode>(                                     //
+                file_hash, tokens, rhs_expr.value()->type, "_", std::nullopt, rhs_expr.value() //
+            );
             break;
         }
         case StmtTrie::Pattern::RETURN: {
@@ -585,7 +585,7 @@ std::optional<Parser::CreateCallOrInitializerBaseRet> Parser::create_call_or_ini
     for (size_t i = 0; i < arguments.size(); i++) {
         // Typecast all string literals in the args to string variables
         auto &arg = arguments[i].first;
-        if (arg->type->to_string() == "type.flint.str.lit") {
+        if (arg->type->is(Type::Builtin::STR_LIT)) {
             arg = std::make_unique<TypeCastNode>(                                                                        //
                 file_hash, ASTNode::PosTriple{arg->line, arg->column, arg->length}, Type::get_primitive_type("str"), arg //
             );
@@ -616,10 +616,10 @@ std::optional<Parser::CreateCallOrInitializerBaseRet> Parser::create_call_or_ini
                 // Now check if the initializer arguments are equal to the expected initializer fields
                 if (fields.size() != arguments.size()) {
                     // If the last argument is a default node then *all* remaining fields will be default-constructed
-                    if (                                                                     //
-                        arguments.size() > fields.size()                                     //
-                        || arguments.empty()                                                 //
-                        || arguments.back().first->type->to_string() != "type.flint.default" //
+                    if (                                                             //
+                        arguments.size() > fields.size()                             //
+                        || arguments.empty()                                         //
+                        || !arguments.back().first->type->is(Type::Builtin::DEFAULT) //
                     ) {
                         THROW_ERR(ErrExprInitializerWrongArgCount, ERR_PARSING, file_hash, tokens, fields.size(), arguments.size());
                         return std::nullopt;
@@ -627,14 +627,14 @@ std::optional<Parser::CreateCallOrInitializerBaseRet> Parser::create_call_or_ini
                     // It's a single default-initializer at the end of the initializer list, so we fill all remaining initializers with the
                     // default initializer
                     ASSERT(arguments.size() >= 1);
-                    ASSERT(arguments.back().first->type->to_string() == "type.flint.default");
+                    ASSERT(arguments.back().first->type->is(Type::Builtin::DEFAULT));
                     for (size_t i = arguments.size(); i < fields.size(); i++) {
                         arguments.emplace_back(arguments.at(i - 1).first->clone(scope->scope_id), false);
                     }
                 }
                 for (size_t i = 0; i < arguments.size(); i++) {
                     std::shared_ptr<Type> arg_type = arguments[i].first->type;
-                    if (arg_type->to_string() == "type.flint.default") {
+                    if (arg_type->is(Type::Builtin::DEFAULT)) {
                         // We need to insert the default-value of the nth argument of the data type at the place of the arguments before
                         // continuing
                         if (!data_node->fields.at(i).initializer.has_value()) {
@@ -953,7 +953,8 @@ std::optional<Parser::CreateCallOrInitializerBaseRet> Parser::create_call_or_ini
                         get_pos_triple(token_slice{tokens.first, tokens.first + 1}),                  //
                         instance_variable.value()->as<VariableNode>()->name,                          //
                         instance_variable.value()->type,                                              //
-                        instance_variable.value()->is_const                                           //
+                        instance_variable.value()->is_const,                                          //
+                        instance_variable.value()->as<VariableNode>()->slot                           //
                     );
                     arguments.insert(arguments.begin(), std::make_pair(std::move(object_variable), true));
                     argument_types.insert(argument_types.begin(), instance_variable.value()->type);
@@ -982,7 +983,8 @@ std::optional<Parser::CreateCallOrInitializerBaseRet> Parser::create_call_or_ini
                         get_pos_triple(token_slice{tokens.first, tokens.first + 1}),            //
                         instance_variable.value()->as<VariableNode>()->name,                    //
                         instance_variable.value()->type,                                        //
-                        instance_variable.value()->is_const                                     //
+                        instance_variable.value()->is_const,                                    //
+                        instance_variable.value()->as<VariableNode>()->slot                     //
                     );
                     std::unique_ptr<ExpressionNode> argument = std::make_unique<DataAccessNode>( //
                         file_hash,                                                               //
@@ -1008,7 +1010,8 @@ std::optional<Parser::CreateCallOrInitializerBaseRet> Parser::create_call_or_ini
                         get_pos_triple(token_slice{tokens.first, tokens.first + 1}),            //
                         instance_variable.value()->as<VariableNode>()->name,                    //
                         instance_variable.value()->type,                                        //
-                        instance_variable.value()->is_const                                     //
+                        instance_variable.value()->is_const,                                    //
+                        instance_variable.value()->as<VariableNode>()->slot                     //
                     );
                     std::unique_ptr<ExpressionNode> argument = std::make_unique<DataAccessNode>( //
                         file_hash,                                                               //
@@ -1208,7 +1211,7 @@ std::optional<Parser::CreateFieldAccessBaseRet> Parser::create_field_access_base
     }
 
     // If the base expresion is of type `str`, the only valid access is its `length` variable
-    if (base_type->to_string() == "str") {
+    if (base_type->is(Type::Builtin::STR)) {
         if (field_name != "length" && field_name != "len") {
             THROW_ERR(ErrExprFieldNonexistent, ERR_PARSING, file_hash, tokens, field_name, base_type,
                 std::vector<std::pair<std::string, std::shared_ptr<Type>>>{
@@ -1325,7 +1328,7 @@ std::optional<Parser::CreateFieldAccessBaseRet> Parser::create_field_access_base
             return std::nullopt;
         }
         case Type::Variation::PRIMITIVE:
-            if (base_type->to_string() != "anyerror") {
+            if (!base_type->is(Type::Builtin::ANYERROR)) {
                 break;
             }
             [[fallthrough]];
@@ -1784,11 +1787,11 @@ std::optional<Parser::CreateArrayAccessBaseRet> Parser::create_array_access_base
     if (has_inbetween_operator) {
         base_type = base_type->as<OptionalType>()->base_type;
     }
-    if (base_type->get_variation() != Type::Variation::ARRAY && base_type->to_string() != "str") {
+    if (base_type->get_variation() != Type::Variation::ARRAY && !base_type->is(Type::Builtin::STR)) {
         THROW_ERR(ErrExprArrayAccessNotAllowedOnType, ERR_PARSING, file_hash, tokens, base_expr.value()->type);
         return std::nullopt;
     }
-    const bool base_is_str = base_type->to_string() == "str";
+    const bool base_is_str = base_type->is(Type::Builtin::STR);
     if (base_is_str) {
         base_type = Type::get_primitive_type("u8");
     } else {
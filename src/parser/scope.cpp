@@ -10,8 +10,9 @@
 #include <iterator>
 
 bool Scope::clone_variables(const std::shared_ptr<Scope> other) {
+    // The cloned variables are the same variables as in the other scope, so they keep their slots
     for (const auto &[name, variable] : other->variables) {
-        if (!add_variable(name, variable)) {
+        if (!variables.insert({name, variable}).second) {
             // Duplicate definition / shadowing
             return false;
         }
@@ -21,7 +22,11 @@ bool Scope::clone_variables(const std::shared_ptr<Scope> other) {
 }
 
 bool Scope::add_variable(const std::string &var_name, const Variable &variable) {
-    return variables.insert({var_name, variable}).second;
+    const auto [it, inserted] = variables.insert({var_name, variable});
+    if (inserted) {
+        it->second.slot = (*variable_slot_count)++;
+    }
+    return inserted;
 }
 
 std::optional<std::shared_ptr<Type>> Scope::get_variable_type(const std::string &var_name) {
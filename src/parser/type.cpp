@@ -8,24 +8,117 @@
 #include "parser/type/primitive_type.hpp"
 #include "parser/type/vector_type.hpp"
 
+#include <array>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
+
+static constexpr std::array<std::string_view, static_cast<size_t>(Type::Builtin::COUNT)> builtin_names = {
+    "",                   // NONE
+    "u8",                 // U8
+    "i8",                 // I8
+    "u16",                // U16
+    "i16",                // I16
+    "u32",                // U32
+    "i32",                // I32
+    "u64",                // U64
+    "i64",                // I64
+    "f32",                // F32
+    "f64",                // F64
+    "bool",               // BOOL
+    "str",                // STR
+    "type.flint.str",     // FLINT_STR
+    "type.flint.str.lit", // STR_LIT
+    "type.flint.default", // DEFAULT
+    "void",               // VOID
+    "void?",              // VOID_OPT
+    "void*",              // VOID_PTR
+    "anyerror",           // ANYERROR
+    "int",                // INT
+    "float",              // FLOAT
+    "bool8",              // BOOL8
+    "str[]",              // STR_ARRAY
+};
 
 uint32_t Type::get_id() const {
     return get_hash().get_type_id_from_str(to_string());
 }
 
+void Type::intern() {
+    const uint32_t previous_id = interned_id.load(std::memory_order_relaxed);
+    const uint32_t epoch = intern_epoch.load(std::memory_order_acquire);
+    const uint32_t id = get_interned_id_of_key(get_intern_key());
+    interned_id.store(id, std::memory_order_relaxed);
+    interned_epoch.store(epoch, std::memory_order_release);
+    if (previous_id != 0 && previous_id != id) {
+        // The keys of all types containing this type were built from its previous ID, so all IDs are interned again when needed
+        intern_epoch.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+uint32_t Type::refresh_interned_id(const uint32_t epoch) const {
+    const uint32_t id = get_interned_id_of_key(get_intern_key());
+    interned_id.store(id, std::memory_order_relaxed);
+    interned_epoch.store(epoch, std::memory_order_release);
+    return id;
+}
+
+uint32_t Type::get_interned_id_of_key(const std::string &key) const {
+    {
+        std::shared_lock<std::shared_mutex> lock(interned_ids_mutex);
+        const auto it = interned_ids.find(key);
+        if (it != interned_ids.end()) {
+            return it->second;
+        }
+    }
+    // Builtin types are recognized by their name the first time their key is seen, all later types with the same key share the ID
+    static const std::unordered_map<std::string_view, Builtin> builtin_ids = []() {
+        std::unordered_map<std::string_view, Builtin> ids;
+        for (size_t i = 1; i < builtin_names.size(); i++) {
+            ids.emplace(builtin_names[i], static_cast<Builtin>(i));
+        }
+        return ids;
+    }();
+    uint32_t builtin_id = 0;
+    switch (get_variation()) {
+        default:
+            break;
+        case Variation::ARRAY:
+        case Variation::OPTIONAL:
+        case Variation::POINTER:
+        case Variation::PRIMITIVE:
+        case Variation::VECTOR: {
+            const auto builtin_it = builtin_ids.find(to_string());
+            if (builtin_it != builtin_ids.end()) {
+                builtin_id = static_cast<uint32_t>(builtin_it->second);
+            }
+            break;
+        }
+    }
+    // Another thread could have interned the same key in the meantime, in that case its ID is kept
+    std::unique_lock<std::shared_mutex> lock(interned_ids_mutex);
+    const auto [it, inserted] = interned_ids.try_emplace(key, builtin_id);
+    if (inserted && builtin_id == 0) {
+        it->second = next_interned_id++;
+    }
+    return it->second;
+}
+
+std::string_view Type::get_builtin_name(const Builtin builtin) {
+    ASSERT(builtin != Builtin::NONE && builtin != Builtin::COUNT);
+    return builtin_names[static_cast<size_t>(builtin)];
+}
+
 bool Type::is_reference() const {
     const auto variation = get_variation();
     if (variation == Variation::ENUM || variation == Variation::OPAQUE) {
         return false;
     }
-    const std::string type_str = to_string();
-    if (type_str == "str") {
+    if (is(Builtin::STR)) {
         return true;
     }
-    return primitives.find(type_str) == primitives.end();
+    return primitives.find(to_string()) == primitives.end();
 }
 
 void Type::init_types() {
@@ -107,6 +200,11 @@ void Type::init_types() {
 
 void Type::clear_types() {
     types.clear();
+    std::unique_lock<std::shared_mutex> lock(interned_ids_mutex);
+    interned_ids.clear();
+    next_interned_id = static_cast<uint32_t>(Builtin::COUNT) + 1;
+    // All IDs assigned so far refer to the cleared keys, so the types which are still alive get their ID again when it is needed
+    intern_epoch.fetch_add(1, std::memory_order_acq_rel);
 }
 
 bool Type::add_type(const std::shared_ptr<Type> &type_to_add) {
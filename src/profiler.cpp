@@ -60,6 +60,9 @@ void Profiler::end_task(const std::string &task) {
     // Get the node and record end time
     auto node = active_tasks[task];
     node->end = std::chrono::high_resolution_clock::now();
+    if (TimeTrace::is_enabled()) {
+        TimeTrace::record(task, node->start, node->end);
+    }
 
     // Pop from stack only if this is the top node
     if (!profile_stack.empty() && profile_stack.top() == node) {
@@ -96,13 +96,29 @@ void Resolver::clear() {
     std::lock_guard<std::mutex> lock_dep_map(dependency_map_mutex);
     std::lock_guard<std::shared_mutex> lock_namespace_map(namespace_map_mutex);
     std::lock_guard<std::mutex> lock_mod_map(generated_files_mutex);
+    std::lock_guard<std::shared_mutex> lock_file_ids(file_ids_mutex);
 
     dependency_map.clear();
     namespace_map.clear();
     file_ids.clear();
+    file_id_map.clear();
     generated_files.clear();
 }
 
+void Resolver::remove_files(const std::unordered_set<Hash> &file_hashes) {
+    std::lock_guard<std::mutex> lock_dep_map(dependency_map_mutex);
+    std::lock_guard<std::shared_mutex> lock_namespace_map(namespace_map_mutex);
+    std::lock_guard<std::mutex> lock_mod_map(generated_files_mutex);
+    std::lock_guard<std::mutex> lock_dep_node_map(dependency_node_map_mutex);
+
+    for (const Hash &file_hash : file_hashes) {
+        dependency_map.erase(file_hash);
+        namespace_map.erase(file_hash);
+        dependency_node_map.erase(file_hash);
+    }
+    std::erase_if(generated_files, [&file_hashes](const Hash &file_hash) { return file_hashes.contains(file_hash); });
+}
+
 void Resolver::file_generation_finished(const Hash &file_hash) {
     std::lock_guard<std::mutex> lock(generated_files_mutex);
     generated_files.emplace_back(file_hash);
@@ -112,6 +128,27 @@ bool Resolver::generated_files_contain(const Hash &file_hash) {
     return std::find(generated_files.begin(), generated_files.end(), file_hash) != generated_files.end();
 }
 
+unsigned int Resolver::get_file_id(const Hash &file_hash) {
+    {
+        std::shared_lock<std::shared_mutex> lock(file_ids_mutex);
+        const auto it = file_id_map.find(file_hash);
+        if (it != file_id_map.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(file_ids_mutex);
+    const auto [it, inserted] = file_id_map.emplace(file_hash, static_cast<unsigned int>(file_ids.size()));
+    if (inserted) {
+        file_ids.emplace_back(file_hash);
+    }
+    return it->second;
+}
+
+const Hash &Resolver::get_file_hash(const unsigned int file_id) {
+    std::shared_lock<std::shared_mutex> lock(file_ids_mutex);
+    return file_ids.at(file_id);
+}
+
 Namespace *Resolver::get_namespace_from_hash(const Hash &file_hash) {
     std::lock_guard<std::shared_mutex> lock(namespace_map_mutex);
     return namespace_map.at(file_hash);
@@ -249,7 +286,6 @@ std::optional<DepNode> Resolver::add_dependencies_and_file(const FileNode *file_
     }
 
     dependency_map.emplace(file_hash, dependencies);
-    file_ids.emplace_back(file_hash);
     return DepNode{file_node->file_name, file_hash, {}, {}};
 }
 
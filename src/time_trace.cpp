@@ -0,0 +1,104 @@
+#include "time_trace.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+/// @function `write_json_string`
+/// @brief Writes the given string as an escaped JSON string literal to the given stream
+///
+/// @param `out` The stream to write the string to
+/// @param `str` The string to escape and write
+static void write_json_string(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    out << c;
+                }
+                break;
+        }
+    }
+    out << '"';
+}
+
+void TimeTrace::enable() {
+    start_time = Clock::now();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+TimeTrace::ThreadBuffer &TimeTrace::get_thread_buffer() {
+    thread_local ThreadBuffer *buffer = nullptr;
+    if (buffer == nullptr) {
+        auto new_buffer = std::make_unique<ThreadBuffer>();
+        new_buffer->events.resize(BUFFER_CAPACITY);
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        new_buffer->thread_id = static_cast<uint32_t>(buffers.size());
+        buffer = new_buffer.get();
+        buffers.emplace_back(std::move(new_buffer));
+    }
+    return *buffer;
+}
+
+void TimeTrace::record(std::string name, const Clock::time_point &start, const Clock::time_point &end) {
+    if (!is_enabled()) {
+        return;
+    }
+    ThreadBuffer &buffer = get_thread_buffer();
+    const uint64_t index = buffer.recorded.load(std::memory_order_relaxed);
+    Event &event = buffer.events[index % BUFFER_CAPACITY];
+    event.name = std::move(name);
+    // Events which started before tracing was enabled are clamped to the start of the trace
+    const auto start_offset = std::max(start, start_time) - start_time;
+    event.start_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start_offset).count());
+    event.duration_ns = end > start ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) : 0;
+    buffer.recorded.store(index + 1, std::memory_order_release);
+}
+
+bool TimeTrace::write(const std::filesystem::path &file_path) {
+    std::ofstream file(file_path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool is_first = true;
+    for (const auto &buffer : buffers) {
+        if (!is_first) {
+            file << ",";
+        }
+        is_first = false;
+        file << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->thread_id << ",\"args\":{\"name\":";
+        write_json_string(file, "Thread " + std::to_string(buffer->thread_id));
+        file << "}}";
+
+        const uint64_t recorded = buffer->recorded.load(std::memory_order_acquire);
+        const uint64_t first = recorded > BUFFER_CAPACITY ? recorded - BUFFER_CAPACITY : 0;
+        for (uint64_t i = first; i < recorded; i++) {
+            const Event &event = buffer->events[i % BUFFER_CAPACITY];
+            file << ",\n{\"name\":";
+            write_json_string(file, event.name);
+            // Timestamps of the trace-event format are given in (fractional) microseconds
+            file << ",\"cat\":\"flintc\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id;
+            file << ",\"ts\":" << event.start_ns / 1000 << "." << std::setw(3) << std::setfill('0') << event.start_ns % 1000;
+            file << ",\"dur\":" << event.duration_ns / 1000 << "." << std::setw(3) << std::setfill('0') << event.duration_ns % 1000 << "}";
+        }
+    }
+    file << "\n]}\n";
+    return file.good();
+}